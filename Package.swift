@@ -382,6 +382,8 @@ let package = Package(
         "src/core/ext/transport/chttp2/client/chttp2_connector.h",
         "src/core/ext/transport/chttp2/server/chttp2_server.cc",
         "src/core/ext/transport/chttp2/server/chttp2_server.h",
+        "src/core/ext/transport/chttp2/transport/base64_simd.cc",
+        "src/core/ext/transport/chttp2/transport/base64_simd.h",
         "src/core/ext/transport/chttp2/transport/bin_decoder.cc",
         "src/core/ext/transport/chttp2/transport/bin_decoder.h",
         "src/core/ext/transport/chttp2/transport/bin_encoder.cc",
@@ -392,6 +394,8 @@ let package = Package(
         "src/core/ext/transport/chttp2/transport/chttp2_transport.h",
         "src/core/ext/transport/chttp2/transport/decode_huff.cc",
         "src/core/ext/transport/chttp2/transport/decode_huff.h",
+        "src/core/ext/transport/chttp2/transport/decode_huff_multi.cc",
+        "src/core/ext/transport/chttp2/transport/decode_huff_multi.h",
         "src/core/ext/transport/chttp2/transport/flow_control.cc",
         "src/core/ext/transport/chttp2/transport/flow_control.h",
         "src/core/ext/transport/chttp2/transport/flow_control_manager.h",
@@ -1436,6 +1440,8 @@ let package = Package(
         "src/core/lib/event_engine/posix.h",
         "src/core/lib/event_engine/posix_engine/ev_epoll1_linux.cc",
         "src/core/lib/event_engine/posix_engine/ev_epoll1_linux.h",
+        "src/core/lib/event_engine/posix_engine/ev_io_uring_linux.cc",
+        "src/core/lib/event_engine/posix_engine/ev_io_uring_linux.h",
         "src/core/lib/event_engine/posix_engine/ev_poll_posix.cc",
         "src/core/lib/event_engine/posix_engine/ev_poll_posix.h",
         "src/core/lib/event_engine/posix_engine/event_poller.h",
@@ -1446,6 +1452,8 @@ let package = Package(
         "src/core/lib/event_engine/posix_engine/grpc_polled_fd_posix.h",
         "src/core/lib/event_engine/posix_engine/internal_errqueue.cc",
         "src/core/lib/event_engine/posix_engine/internal_errqueue.h",
+        "src/core/lib/event_engine/posix_engine/io_uring.cc",
+        "src/core/lib/event_engine/posix_engine/io_uring.h",
         "src/core/lib/event_engine/posix_engine/lockfree_event.cc",
         "src/core/lib/event_engine/posix_engine/lockfree_event.h",
         "src/core/lib/event_engine/posix_engine/native_posix_dns_resolver.cc",
@@ -1473,6 +1481,8 @@ let package = Package(
         "src/core/lib/event_engine/posix_engine/timer_heap.h",
         "src/core/lib/event_engine/posix_engine/timer_manager.cc",
         "src/core/lib/event_engine/posix_engine/timer_manager.h",
+        "src/core/lib/event_engine/posix_engine/timer_wheel.cc",
+        "src/core/lib/event_engine/posix_engine/timer_wheel.h",
         "src/core/lib/event_engine/posix_engine/traced_buffer_list.cc",
         "src/core/lib/event_engine/posix_engine/traced_buffer_list.h",
         "src/core/lib/event_engine/posix_engine/wakeup_fd_eventfd.cc",
@@ -1482,6 +1492,8 @@ let package = Package(
         "src/core/lib/event_engine/posix_engine/wakeup_fd_posix.h",
         "src/core/lib/event_engine/posix_engine/wakeup_fd_posix_default.cc",
         "src/core/lib/event_engine/posix_engine/wakeup_fd_posix_default.h",
+        "src/core/lib/event_engine/posix_engine/write_batcher.cc",
+        "src/core/lib/event_engine/posix_engine/write_batcher.h",
         "src/core/lib/event_engine/query_extensions.h",
         "src/core/lib/event_engine/ref_counted_dns_resolver_interface.h",
         "src/core/lib/event_engine/resolved_address.cc",
@@ -1494,6 +1506,8 @@ let package = Package(
         "src/core/lib/event_engine/tcp_socket_utils.h",
         "src/core/lib/event_engine/thread_local.cc",
         "src/core/lib/event_engine/thread_local.h",
+        "src/core/lib/event_engine/thread_pool/cpu_topology.cc",
+        "src/core/lib/event_engine/thread_pool/cpu_topology.h",
         "src/core/lib/event_engine/thread_pool/thread_count.cc",
         "src/core/lib/event_engine/thread_pool/thread_count.h",
         "src/core/lib/event_engine/thread_pool/thread_pool.h",
@@ -1522,6 +1536,8 @@ let package = Package(
         "src/core/lib/event_engine/windows/windows_listener.h",
         "src/core/lib/event_engine/work_queue/basic_work_queue.cc",
         "src/core/lib/event_engine/work_queue/basic_work_queue.h",
+        "src/core/lib/event_engine/work_queue/chase_lev_work_queue.cc",
+        "src/core/lib/event_engine/work_queue/chase_lev_work_queue.h",
         "src/core/lib/event_engine/work_queue/work_queue.h",
         "src/core/lib/experiments/config.cc",
         "src/core/lib/experiments/config.h",
@@ -1990,6 +2006,8 @@ let package = Package(
         "src/core/tsi/local_transport_security.h",
         "src/core/tsi/ssl/key_logging/ssl_key_logging.cc",
         "src/core/tsi/ssl/key_logging/ssl_key_logging.h",
+        "src/core/tsi/ssl/ktls/ssl_ktls.cc",
+        "src/core/tsi/ssl/ktls/ssl_ktls.h",
         "src/core/tsi/ssl/session_cache/ssl_session.h",
         "src/core/tsi/ssl/session_cache/ssl_session_boringssl.cc",
         "src/core/tsi/ssl/session_cache/ssl_session_cache.cc",
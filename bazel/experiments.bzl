@@ -18,23 +18,32 @@
 
 EXPERIMENT_ENABLES = {
     "buffer_list_deletion_prep": "buffer_list_deletion_prep",
+    "call_arena_recycling": "call_arena_recycling",
     "call_tracer_in_transport": "call_tracer_in_transport",
     "call_tracer_send_initial_metadata_is_an_annotation": "call_tracer_send_initial_metadata_is_an_annotation",
     "call_tracer_send_trailing_metadata_is_an_annotation": "call_tracer_send_trailing_metadata_is_an_annotation",
     "chaotic_good_connect_deadline": "chaotic_good_connect_deadline",
     "chaotic_good_framing_layer": "chaotic_good_framing_layer",
+    "chttp2_adaptive_stream_window": "chttp2_adaptive_stream_window",
+    "chttp2_model_write_sizing": "chttp2_model_write_sizing",
+    "chttp2_pipelined_reads": "chttp2_pipelined_reads",
+    "chttp2_write_combining": "chttp2_write_combining",
     "error_flatten": "error_flatten",
     "event_engine_client": "event_engine_client",
     "event_engine_dns": "event_engine_dns",
     "event_engine_dns_non_client_channel": "event_engine_dns_non_client_channel",
     "event_engine_fork": "event_engine_fork",
+    "event_engine_io_uring_provided_buffers": "event_engine_io_uring_provided_buffers",
     "event_engine_listener": "event_engine_listener",
     "event_engine_callback_cq": "event_engine_callback_cq,event_engine_client,event_engine_listener",
     "event_engine_for_all_other_endpoints": "event_engine_client,event_engine_dns,event_engine_dns_non_client_channel,event_engine_for_all_other_endpoints,event_engine_listener",
     "event_engine_poller_for_python": "event_engine_poller_for_python",
+    "event_engine_timer_wheel": "event_engine_timer_wheel",
+    "event_engine_write_batching": "event_engine_write_batching",
     "fail_recv_metadata_on_deadline_exceeded": "fail_recv_metadata_on_deadline_exceeded",
     "free_large_allocator": "free_large_allocator",
     "fuse_filters": "fuse_filters",
+    "hpack_adaptive_indexing": "hpack_adaptive_indexing",
     "keep_alive_ping_timer_batch": "keep_alive_ping_timer_batch",
     "local_connector_secure": "local_connector_secure",
     "max_inflight_pings_strict_limit": "max_inflight_pings_strict_limit",
@@ -76,9 +85,11 @@ EXPERIMENT_POLLERS = [
     "event_engine_dns",
     "event_engine_dns_non_client_channel",
     "event_engine_fork",
+    "event_engine_io_uring_provided_buffers",
     "event_engine_listener",
     "event_engine_for_all_other_endpoints",
     "event_engine_poller_for_python",
+    "event_engine_write_batching",
     "pipelined_read_secure_endpoint",
 ]
 
@@ -92,6 +103,7 @@ EXPERIMENTS = {
             ],
             "core_end2end_test": [
                 "buffer_list_deletion_prep",
+                "chttp2_pipelined_reads",
                 "error_flatten",
                 "event_engine_fork",
                 "local_connector_secure",
@@ -200,6 +212,7 @@ EXPERIMENTS = {
             ],
             "core_end2end_test": [
                 "buffer_list_deletion_prep",
+                "chttp2_pipelined_reads",
                 "error_flatten",
                 "event_engine_fork",
                 "local_connector_secure",
@@ -308,6 +321,7 @@ EXPERIMENTS = {
             ],
             "core_end2end_test": [
                 "buffer_list_deletion_prep",
+                "chttp2_pipelined_reads",
                 "error_flatten",
                 "event_engine_fork",
                 "local_connector_secure",
@@ -45,7 +45,14 @@ load("//bazel:experiments.bzl", "EXPERIMENTS", "EXPERIMENT_ENABLES", "EXPERIMENT
 load("//bazel:test_experiments.bzl", "TEST_EXPERIMENTS", "TEST_EXPERIMENT_ENABLES", "TEST_EXPERIMENT_POLLERS")
 
 # The set of pollers to test against if a test exercises polling
-POLLERS = ["epoll1", "poll"]
+POLLERS = ["epoll1", "poll", "io_uring"]
+
+# GRPC_POLL_STRATEGY for pollers that need a fallback. iomgr has no io_uring
+# engine, and the EventEngine falls back to epoll1 when the kernel lacks
+# io_uring or it is disabled.
+POLL_STRATEGIES = {
+    "io_uring": "io_uring,epoll1",
+}
 
 # The set of known EventEngines to test
 EVENT_ENGINES = {"default": {"tags": []}}
@@ -370,7 +377,7 @@ def expand_poller_config(name, srcs, deps, tags, args, exclude_pollers, uses_pol
                 ]),
                 "args": args,
                 "env": {
-                    "GRPC_POLL_STRATEGY": poller,
+                    "GRPC_POLL_STRATEGY": POLL_STRATEGIES.get(poller, poller),
                 } | default_env,
                 "flaky": flaky,
             })
@@ -89,6 +89,15 @@
     indicating use of default http2 setting(4096 bytes). */
 #define GRPC_ARG_HTTP2_HPACK_TABLE_SIZE_ENCODER \
   "grpc.http2.hpack_table_size.encoder"
+/** Metadata that is sent unchanged on many calls of a connection, such as
+    custom response headers, and that should be HPACK encoded once per
+    connection rather than once per call. String valued: one "key: value" pair
+    per line. Only applies to metadata that gRPC does not itself know. Keys
+    that may carry credentials (authorization, proxy-authorization, cookie,
+    set-cookie and binary -bin keys) are ignored: their values are never
+    indexed, so that they cannot be guessed from the size of compressed
+    headers. */
+#define GRPC_ARG_HTTP2_STATIC_METADATA "grpc.http2.static_metadata"
 /** How big a frame are we willing to receive via HTTP2.
     Min 16384, max 16777215. Larger values give lower CPU usage for large
     messages, but more head of line blocking for small messages. Defaults to
@@ -137,6 +146,18 @@
     GRPC_WRITE_BUFFER_HINT is set? This is an upper bound
   * Integer valued, bytes. Defaults to 65535 bytes. */
 #define GRPC_ARG_HTTP2_WRITE_BUFFER_SIZE "grpc.http2.write_buffer_size"
+/** How long may writes of call frames be held back, so that the frames of
+    other calls that become ready meanwhile go out in the same write? Writes
+    are only held back while many calls are writing; 0 disables this.
+  * Integer valued, milliseconds. Defaults to 1 with the
+    chttp2_write_combining experiment, else 0. */
+#define GRPC_ARG_HTTP2_WRITE_COMBINING_WINDOW_MS \
+  "grpc.http2.write_combining_window_ms"
+/** How many bytes of call frames may be held back by the write combining
+    window before they are written at once?
+  * Integer valued, bytes. Defaults to 65536 bytes. */
+#define GRPC_ARG_HTTP2_WRITE_COMBINING_MAX_BYTES \
+  "grpc.http2.write_combining_max_bytes"
 /** Should we allow receipt of true-binary data on http2 connections?
     Defaults to on (1) */
 #define GRPC_ARG_HTTP2_ENABLE_TRUE_BINARY "grpc.http2.true_binary"
@@ -221,6 +242,18 @@
 #define GRPC_ARG_ABSOLUTE_MAX_METADATA_SIZE "grpc.absolute_max_metadata_size"
 /** If non-zero, allow the use of SO_REUSEPORT if it's available (default 1) */
 #define GRPC_ARG_ALLOW_REUSEPORT "grpc.so_reuseport"
+/** Number of listening sockets to open for each address a server binds to.
+    With more than one, each socket accepts on its own poller and the kernel
+    spreads incoming connections across them with SO_REUSEPORT, so that
+    accepting scales across threads. Requires GRPC_ARG_ALLOW_REUSEPORT.
+    Defaults to 1. */
+#define GRPC_ARG_EXPERIMENTAL_TCP_LISTENER_SHARDS \
+  "grpc.experimental.tcp_listener_shards"
+/** If non-zero, and there is more than one listener shard, a new connection is
+    accepted by shard (cpu % shards), where cpu is the CPU that received its
+    first packet. Linux only. Defaults to 0. */
+#define GRPC_ARG_EXPERIMENTAL_TCP_LISTENER_CPU_STEERING \
+  "grpc.experimental.tcp_listener_cpu_steering"
 /** If non-zero, a pointer to a buffer pool (a pointer of type
  * grpc_resource_quota*). (use grpc_resource_quota_arg_vtable() to fetch an
  * appropriate pointer arg vtable). */
@@ -284,6 +317,16 @@
    issued by the tcp_write(). By default, this is set to 4. */
 #define GRPC_ARG_TCP_TX_ZEROCOPY_MAX_SIMULT_SENDS \
   "grpc.experimental.tcp_tx_zerocopy_max_simultaneous_sends"
+/* TCP RX Zerocopy enable state: zero is disabled, non-zero is enabled. When
+   enabled on Linux, large reads map the received pages into the process with
+   TCP_ZEROCOPY_RECEIVE instead of copying them. By default, it is disabled. */
+#define GRPC_ARG_TCP_RX_ZEROCOPY_ENABLED \
+  "grpc.experimental.tcp_rx_zerocopy_enabled"
+/* TCP RX Zerocopy receive threshold: only map pages if at least this many
+   bytes are expected to be read. Smaller reads are copied. By default, this is
+   set to 64KB. */
+#define GRPC_ARG_TCP_RX_ZEROCOPY_RECV_BYTES_THRESHOLD \
+  "grpc.experimental.tcp_rx_zerocopy_recv_bytes_threshold"
 /* Overrides the TCP socket receive buffer size, SO_RCVBUF.
     Default value is -1(kReadBufferSizeUnset) indicating that the system will
     decide the buffer size. Range varies from 0 to INT_MAX. */
@@ -433,6 +476,14 @@
 #define GRPC_ARG_EXPERIMENTAL_STATS_PLUGINS "grpc.experimental.stats_plugins"
 /** If non-zero, allow security frames to be sent and received. */
 #define GRPC_ARG_SECURITY_FRAME_ALLOWED "grpc.security_frame_allowed"
+/** If non-zero on the arguments of an in-process channel, C++ calls on it
+ * hand the other end a copy of each message object instead of its
+ * serialization, where both ends use generated (protobuf) stubs and handlers
+ * and no interceptors. Requires the promise based in-process transport.
+ * Messages too large for the message size limits of either end are still
+ * serialized, and so are all messages of a channel with a service config.
+ * Messages passed as objects are not compressed. Defaults to 0. */
+#define GRPC_ARG_INPROC_OBJECT_PASSING "grpc.experimental.inproc_object_passing"
 /** \} */
 /** If non-zero, enable TCP tracing and stats collection. */
 #define GRPC_ARG_TCP_TRACING_ENABLED "grpc.tcp_tracing_enabled"
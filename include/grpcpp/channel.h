@@ -33,6 +33,7 @@
 struct grpc_channel;
 
 namespace grpc {
+class Server;
 namespace testing {
 class ChannelTestPeer;
 }  // namespace testing
@@ -88,6 +89,7 @@ class Channel final : public grpc::ChannelInterface,
           grpc::experimental::ClientInterceptorFactoryInterface>>
           interceptor_creators);
   friend class grpc::internal::InterceptedChannel;
+  friend class grpc::Server;
   Channel(const std::string& host, grpc_channel* c_channel,
           std::vector<std::unique_ptr<
               grpc::experimental::ClientInterceptorFactoryInterface>>
@@ -127,6 +129,10 @@ class Channel final : public grpc::ChannelInterface,
   std::vector<
       std::unique_ptr<grpc::experimental::ClientInterceptorFactoryInterface>>
       interceptor_creators_;
+
+  // Set by Server for in-process channels whose calls pass message objects:
+  // the largest message they pass so.
+  size_t max_boxed_message_size_ = 0;
 };
 
 }  // namespace grpc
@@ -21,6 +21,8 @@
 
 #include <grpc/impl/grpc_types.h>
 
+#include <cstddef>
+
 namespace grpc {
 class CompletionQueue;
 namespace experimental {
@@ -65,12 +67,21 @@ class Call final {
     return server_rpc_info_;
   }
 
+  /// The largest message, in serialized bytes, that this call passes to the
+  /// other end as an object rather than serialized, or 0 if it serializes
+  /// every message (see GRPC_ARG_INPROC_OBJECT_PASSING).
+  size_t max_boxed_message_size() const { return max_boxed_message_size_; }
+  void set_max_boxed_message_size(size_t max_boxed_message_size) {
+    max_boxed_message_size_ = max_boxed_message_size;
+  }
+
  private:
   grpc::CompletionQueue* cq_;
   grpc_call* call_;
   int max_receive_message_size_;
   experimental::ClientRpcInfo* client_rpc_info_ = nullptr;
   experimental::ServerRpcInfo* server_rpc_info_ = nullptr;
+  size_t max_boxed_message_size_ = 0;
 };
 }  // namespace internal
 }  // namespace grpc
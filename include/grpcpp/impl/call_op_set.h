@@ -333,6 +333,9 @@ class CallOpSendMessage {
     grpc_op* op = &ops[(*nops)++];
     op->op = GRPC_OP_SEND_MESSAGE;
     op->flags = write_options_.flags();
+    // A boxed message has no bytes worth compressing.
+    if (boxed_) op->flags |= GRPC_WRITE_NO_COMPRESS;
+    boxed_ = false;
     op->reserved = nullptr;
     op->data.send_message.send_message = send_buf_.c_buffer();
     // Flags are per-message: clear them after use.
@@ -377,10 +380,19 @@ class CallOpSendMessage {
     hijacked_ = true;
   }
 
+  // Passes the message given to SendMessagePtr as an object if its type
+  // supports it and it serializes to at most max_boxed_message_size bytes
+  // (see GRPC_ARG_INPROC_OBJECT_PASSING).
+  void set_max_boxed_message_size(size_t max_boxed_message_size) {
+    max_boxed_message_size_ = max_boxed_message_size;
+  }
+
  private:
   const void* msg_ = nullptr;  // The original non-serialized message
   bool hijacked_ = false;
   bool failed_send_ = false;
+  size_t max_boxed_message_size_ = 0;
+  bool boxed_ = false;
   ByteBuffer send_buf_;
   WriteOptions write_options_;
   std::function<Status(const void*)> serializer_;
@@ -408,6 +420,15 @@ Status CallOpSendMessage::SendMessagePtr(
   write_options_ = options;
   // Store the serializer for later since we have access to the message
   serializer_ = [this, allocator](const void* message) {
+    if constexpr (impl::has_box_v<M>) {
+      if (max_boxed_message_size_ > 0 &&
+          SerializationTraits<M>::Box(*static_cast<const M*>(message),
+                                      max_boxed_message_size_,
+                                      send_buf_.bbuf_ptr())) {
+        boxed_ = true;
+        return Status();
+      }
+    }
     bool own_buf;
     // TODO(vjpai): Remove the void below when possible
     // The void in the template parameter below should not be needed
@@ -962,6 +983,14 @@ class CallOpSet : public CallOpSetInterface,
     static const size_t MAX_OPS = 6;
     grpc_op ops[MAX_OPS];
     size_t nops = 0;
+    if constexpr (std::is_base_of<CallOpSendMessage, CallOpSet>::value) {
+      // Interceptors may read the serialized message, so objects are only
+      // passed on calls without interceptors.
+      this->CallOpSendMessage::set_max_boxed_message_size(
+          interceptor_methods_.InterceptorsListEmpty()
+              ? call_.max_boxed_message_size()
+              : 0);
+    }
     this->Op1::AddOp(ops, &nops);
     this->Op2::AddOp(ops, &nops);
     this->Op3::AddOp(ops, &nops);
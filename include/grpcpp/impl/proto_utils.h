@@ -31,7 +31,9 @@
 #include <grpcpp/support/slice.h>
 #include <grpcpp/support/status.h>
 
+#include <memory>
 #include <type_traits>
+#include <utility>
 
 /// This header provides serialization and deserialization between gRPC
 /// messages serialized using protobuf and the C++ objects they represent.
@@ -51,8 +53,37 @@ class SerializationTraits<
     return GenericSerialize<ProtoBufferWriter, T>(msg, bb, own_buffer);
   }
 
+  static bool Box(const T& msg, size_t max_size, ByteBuffer* bb) {
+    if (msg.ByteSizeLong() > max_size) return false;
+    internal::BoxMessage(std::make_unique<internal::BoxedMessageOf<T>>(msg),
+                         bb);
+    return true;
+  }
+
   static Status Deserialize(ByteBuffer* buffer,
                             grpc::protobuf::MessageLite* msg) {
+    bool exclusive;
+    internal::BoxedMessage* boxed =
+        internal::GetBoxedMessage(buffer, &exclusive);
+    if (boxed != nullptr) {
+      if (boxed->type() == internal::BoxedMessageOf<T>::Type()) {
+        T* message =
+            static_cast<internal::BoxedMessageOf<T>*>(boxed)->message();
+        if (exclusive) {
+          *static_cast<T*>(msg) = std::move(*message);
+        } else {
+          *static_cast<T*>(msg) = *message;
+        }
+        buffer->Clear();
+        return grpc::Status::OK;
+      }
+      // The sender used another message type: parse its serialization.
+      ByteBuffer serialized;
+      Status result = boxed->Serialize(&serialized);
+      buffer->Clear();
+      if (!result.ok()) return result;
+      return GenericDeserialize<ProtoBufferReader, T>(&serialized, msg);
+    }
     return GenericDeserialize<ProtoBufferReader, T>(buffer, msg);
   }
 };
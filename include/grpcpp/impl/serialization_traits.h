@@ -21,11 +21,14 @@
 
 #include <grpc/event_engine/memory_allocator.h>
 
+#include <cstddef>
 #include <type_traits>
 #include <utility>
 
 namespace grpc {
 
+class ByteBuffer;
+
 /// Defines how to serialize and deserialize some type.
 ///
 /// Used for hooking different message serialization API's into GRPC.
@@ -58,6 +61,15 @@ namespace grpc {
 ///
 /// Both functions return a Status, allowing them to explain what went
 /// wrong if required.
+///
+/// An implementation may also provide
+///     static bool Box(const Message& msg, size_t max_size,
+///                     ByteBuffer* buffer);
+/// to carry a copy of msg in buffer as an object, for calls on in-process
+/// channels that pass message objects (GRPC_ARG_INPROC_OBJECT_PASSING). It
+/// returns false, leaving msg to be serialized, if msg serializes to more than
+/// max_size bytes: size limits on messages apply to their serialization. Its
+/// Deserialize must then accept such buffers.
 template <class Message,
           class UnusedButHereForPartialTemplateSpecialization = void>
 class SerializationTraits;
@@ -107,6 +119,19 @@ struct SerializeDispatch<Message, BufferPtr, false> {
   }
 };
 
+// Helper trait to check if SerializationTraits<Message> can box messages.
+template <typename Message, typename = void>
+struct has_box : std::false_type {};
+
+template <typename Message>
+struct has_box<Message,
+               std::void_t<decltype(SerializationTraits<Message>::Box(
+                   std::declval<const Message&>(), std::declval<size_t>(),
+                   std::declval<ByteBuffer*>()))>> : std::true_type {};
+
+template <typename Message>
+inline constexpr bool has_box_v = has_box<Message>::value;
+
 }  // namespace impl
 
 template <typename Message, typename BufferPtr>
@@ -221,6 +221,12 @@ class Server : public ServerInterface, private internal::GrpcLibrary {
   friend class ServerBuilder;
   friend class ServerInitializer;
 
+  std::shared_ptr<Channel> CreateInProcessChannel(
+      const ChannelArguments& args,
+      std::vector<
+          std::unique_ptr<experimental::ClientInterceptorFactoryInterface>>
+          interceptor_creators);
+
   class SyncRequest;
   class CallbackRequestBase;
   template <class ServerContextType>
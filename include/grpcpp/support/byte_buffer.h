@@ -26,6 +26,7 @@
 #include <grpcpp/support/slice.h>
 #include <grpcpp/support/status.h>
 
+#include <memory>
 #include <vector>
 
 namespace grpc {
@@ -53,6 +54,9 @@ class ExternalConnectionAcceptorImpl;
 template <class R>
 class DeserializeFuncType;
 class GrpcByteBufferPeer;
+class BoxedMessage;
+void BoxMessage(std::unique_ptr<BoxedMessage> message, ByteBuffer* buffer);
+BoxedMessage* GetBoxedMessage(ByteBuffer* buffer, bool* exclusive);
 
 }  // namespace internal
 /// A sequence of bytes.
@@ -181,6 +185,10 @@ class ByteBuffer final {
   friend class ProtoBufferWriter;
   friend class internal::GrpcByteBufferPeer;
   friend class internal::ExternalConnectionAcceptorImpl;
+  friend void internal::BoxMessage(std::unique_ptr<internal::BoxedMessage>,
+                                   ByteBuffer*);
+  friend internal::BoxedMessage* internal::GetBoxedMessage(ByteBuffer*,
+                                                          bool*);
 
   grpc_byte_buffer* buffer_;
 
@@ -213,10 +221,76 @@ class ByteBuffer final {
   ByteBufferPointer bbuf_ptr() const { return ByteBufferPointer(this); }
 };
 
+namespace internal {
+
+/// A message carried by a ByteBuffer as an object rather than serialized, on
+/// an in-process channel that passes message objects (see
+/// GRPC_ARG_INPROC_OBJECT_PASSING). Code that reads the bytes of such a buffer
+/// sees a single zero byte, which does not parse as a protobuf message. So a
+/// boxed message is not compressed, and filters that log the payloads of
+/// messages log that byte instead. Size limits on messages still apply: only
+/// messages whose serialization is within them are boxed.
+class BoxedMessage {
+ public:
+  virtual ~BoxedMessage() = default;
+
+  /// Identifies the type of the message.
+  virtual const void* type() const = 0;
+
+  /// Serializes the message, for a receiver that expects another type.
+  virtual Status Serialize(ByteBuffer* buffer) const = 0;
+};
+
+template <class M>
+class BoxedMessageOf final : public BoxedMessage {
+ public:
+  explicit BoxedMessageOf(const M& message) : message_(message) {}
+
+  static const void* Type() {
+    static const char type = 0;
+    return &type;
+  }
+
+  const void* type() const override { return Type(); }
+
+  Status Serialize(ByteBuffer* buffer) const override {
+    bool own_buffer;
+    Status result = grpc::Serialize(nullptr, message_, buffer, &own_buffer);
+    if (!own_buffer) {
+      buffer->Duplicate();
+    }
+    return result;
+  }
+
+  M* message() { return &message_; }
+
+ private:
+  M message_;
+};
+
+/// Makes buffer carry message, which it owns from then on.
+void BoxMessage(std::unique_ptr<BoxedMessage> message, ByteBuffer* buffer);
+
+/// The message carried by buffer, or nullptr if buffer carries bytes. It
+/// remains owned by buffer. Sets *exclusive if no other buffer shares the
+/// message, so that it may be moved from.
+BoxedMessage* GetBoxedMessage(ByteBuffer* buffer, bool* exclusive);
+
+}  // namespace internal
+
 template <>
 class SerializationTraits<ByteBuffer, void> {
  public:
   static Status Deserialize(ByteBuffer* byte_buffer, ByteBuffer* dest) {
+    bool exclusive;
+    internal::BoxedMessage* boxed =
+        internal::GetBoxedMessage(byte_buffer, &exclusive);
+    if (boxed != nullptr) {
+      dest->Clear();
+      Status result = boxed->Serialize(dest);
+      byte_buffer->Clear();
+      return result;
+    }
     dest->set_buffer(byte_buffer->buffer_);
     return Status::OK;
   }
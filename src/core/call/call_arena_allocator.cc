@@ -17,11 +17,105 @@
 #include <grpc/support/port_platform.h>
 
 #include <algorithm>
+#include <memory>
+#include <optional>
+#include <utility>
 
 namespace grpc_core {
 
+CallArenaAllocator::CallArenaAllocator(MemoryAllocator allocator,
+                                       size_t initial_size,
+                                       MemoryQuotaRefPtr memory_quota)
+    : ArenaFactory(std::move(allocator)),
+      call_size_estimator_(initial_size),
+      memory_quota_(std::move(memory_quota)) {
+  if (memory_quota_ != nullptr) {
+    recycled_arenas_ = std::make_unique<PerCpu<RecycledArenas>>(
+        PerCpuOptions().SetMaxShards(16));
+    reclaimer_target_ = MakeRefCounted<ReclaimerTarget>();
+    reclaimer_target_->allocator = this;
+    reclaimer_owner_ = memory_quota_->CreateMemoryOwner();
+  }
+}
+
+CallArenaAllocator::~CallArenaAllocator() {
+  if (recycled_arenas_ == nullptr) return;
+  {
+    // Waits for a reclaimer that is running.
+    MutexLock lock(&reclaimer_target_->mu);
+    reclaimer_target_->allocator = nullptr;
+  }
+  FreeAllRecycledArenas();
+}
+
 void CallArenaAllocator::FinalizeArena(Arena* arena) {
   call_size_estimator_.UpdateCallSizeEstimate(arena->TotalUsedBytes());
 }
 
+void* CallArenaAllocator::AllocateArenaStorage(size_t initial_size) {
+  if (recycled_arenas_ != nullptr) {
+    RecycledArenas& shard = recycled_arenas_->this_cpu();
+    MutexLock lock(&shard.mu);
+    if (shard.count > 0 && shard.initial_size == initial_size) {
+      return shard.storage[--shard.count];
+    }
+  }
+  return ArenaFactory::AllocateArenaStorage(initial_size);
+}
+
+void CallArenaAllocator::FreeArenaStorage(void* storage, size_t initial_size) {
+  if (recycled_arenas_ != nullptr) {
+    const bool under_pressure =
+        memory_quota_->GetPressureInfo().pressure_control_value >
+        kMaxRecyclingPressure;
+    RecycledArenas& shard = recycled_arenas_->this_cpu();
+    ReleasableMutexLock lock(&shard.mu);
+    if (under_pressure) {
+      FreeRecycledArenasLocked(shard);
+    } else if (initial_size == CallSizeEstimate()) {
+      // Storage sized for an earlier estimate will not be asked for again.
+      if (shard.initial_size != initial_size) {
+        FreeRecycledArenasLocked(shard);
+        shard.initial_size = initial_size;
+      }
+      if (shard.count < kMaxRecycledArenasPerShard) {
+        shard.storage[shard.count++] = storage;
+        lock.Release();
+        MaybePostReclaimer();
+        return;
+      }
+    }
+  }
+  ArenaFactory::FreeArenaStorage(storage, initial_size);
+}
+
+void CallArenaAllocator::FreeAllRecycledArenas() {
+  for (RecycledArenas& shard : *recycled_arenas_) {
+    MutexLock lock(&shard.mu);
+    FreeRecycledArenasLocked(shard);
+  }
+}
+
+void CallArenaAllocator::MaybePostReclaimer() {
+  if (has_posted_reclaimer_.exchange(true, std::memory_order_relaxed)) return;
+  reclaimer_owner_.PostReclaimer(
+      ReclamationPass::kBenign,
+      [target = reclaimer_target_](std::optional<ReclamationSweep> sweep) {
+        if (!sweep.has_value()) return;
+        MutexLock lock(&target->mu);
+        CallArenaAllocator* allocator = target->allocator;
+        if (allocator == nullptr) return;
+        allocator->has_posted_reclaimer_.store(false,
+                                               std::memory_order_relaxed);
+        allocator->FreeAllRecycledArenas();
+      });
+}
+
+void CallArenaAllocator::FreeRecycledArenasLocked(RecycledArenas& shard) {
+  while (shard.count > 0) {
+    ArenaFactory::FreeArenaStorage(shard.storage[--shard.count],
+                                   shard.initial_size);
+  }
+}
+
 }  // namespace grpc_core
@@ -20,10 +20,14 @@
 
 #include <atomic>
 #include <cstddef>
+#include <memory>
 
 #include "src/core/lib/resource_quota/arena.h"
 #include "src/core/lib/resource_quota/memory_quota.h"
+#include "src/core/util/per_cpu.h"
 #include "src/core/util/ref_counted.h"
+#include "src/core/util/sync.h"
+#include "absl/base/thread_annotations.h"
 
 namespace grpc_core {
 
@@ -70,20 +74,59 @@ class CallSizeEstimator final {
 
 class CallArenaAllocator final : public ArenaFactory {
  public:
-  CallArenaAllocator(MemoryAllocator allocator, size_t initial_size)
-      : ArenaFactory(std::move(allocator)),
-        call_size_estimator_(initial_size) {}
+  // If memory_quota is set, the storage of destroyed arenas is recycled for
+  // new ones while the quota is not under pressure.
+  CallArenaAllocator(MemoryAllocator allocator, size_t initial_size,
+                     MemoryQuotaRefPtr memory_quota = nullptr);
+  ~CallArenaAllocator() override;
 
   RefCountedPtr<Arena> MakeArena() override {
     return Arena::Create(call_size_estimator_.CallSizeEstimate(), Ref());
   }
 
   void FinalizeArena(Arena* arena) override;
+  void* AllocateArenaStorage(size_t initial_size) override;
+  void FreeArenaStorage(void* storage, size_t initial_size) override;
 
   size_t CallSizeEstimate() { return call_size_estimator_.CallSizeEstimate(); }
 
  private:
+  static constexpr size_t kMaxRecycledArenasPerShard = 8;
+  // Above this memory pressure, recycled storage is freed instead of kept.
+  static constexpr double kMaxRecyclingPressure = 0.8;
+
+  // Storage of destroyed arenas, all with an initial zone of initial_size
+  // bytes. It stays reserved from allocator() until it is reused or freed.
+  struct alignas(GPR_CACHELINE_SIZE) RecycledArenas {
+    Mutex mu;
+    size_t initial_size ABSL_GUARDED_BY(mu) = 0;
+    size_t count ABSL_GUARDED_BY(mu) = 0;
+    void* storage[kMaxRecycledArenasPerShard] ABSL_GUARDED_BY(mu);
+  };
+
+  // What the benign reclaimer acts on. The reclaimer may run after this
+  // allocator is gone, so it holds this rather than the allocator.
+  struct ReclaimerTarget : public RefCounted<ReclaimerTarget> {
+    Mutex mu;
+    CallArenaAllocator* allocator ABSL_GUARDED_BY(mu);
+  };
+
+  void FreeRecycledArenasLocked(RecycledArenas& shard)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(shard.mu);
+  void FreeAllRecycledArenas();
+  // Posts a benign reclaimer that frees all recycled storage, unless one is
+  // already posted.
+  void MaybePostReclaimer();
+
   CallSizeEstimator call_size_estimator_;
+  const MemoryQuotaRefPtr memory_quota_;
+  // Null if arenas are not recycled.
+  std::unique_ptr<PerCpu<RecycledArenas>> recycled_arenas_;
+  RefCountedPtr<ReclaimerTarget> reclaimer_target_;
+  std::atomic<bool> has_posted_reclaimer_{false};
+  // Only posts the reclaimer: recycled storage is reserved from allocator().
+  // Destroying it cancels the reclaimer.
+  MemoryOwner reclaimer_owner_;
 };
 
 }  // namespace grpc_core
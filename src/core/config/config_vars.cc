@@ -97,6 +97,13 @@ ABSL_FLAG(absl::optional<double>, grpc_experimental_memory_pressure_threshold,
           "EXPERIMENTAL: The threshold for the memory quota pressure "
           "controller. This is a value between 0 and 1, and must always be "
           "greater than the target pressure.");
+ABSL_FLAG(absl::optional<int32_t>, grpc_experimental_event_engine_busy_poll_us,
+          {},
+          "EXPERIMENTAL: If non-zero, each EventEngine poller gets a dedicated "
+          "thread that busy polls for up to this many microseconds after its "
+          "last event before blocking, and runs I/O callbacks inline. Sockets "
+          "are also given SO_BUSY_POLL with this value. Trades CPU for "
+          "latency.");
 
 namespace grpc_core {
 
@@ -109,6 +116,10 @@ ConfigVars::ConfigVars(const Overrides& overrides)
           LoadConfig(FLAGS_grpc_channelz_max_orphaned_nodes,
                      "GRPC_CHANNELZ_MAX_ORPHANED_NODES",
                      overrides.channelz_max_orphaned_nodes, 0)),
+      experimental_event_engine_busy_poll_us_(
+          LoadConfig(FLAGS_grpc_experimental_event_engine_busy_poll_us,
+                     "GRPC_EXPERIMENTAL_EVENT_ENGINE_BUSY_POLL_US",
+                     overrides.experimental_event_engine_busy_poll_us, 0)),
       experimental_target_memory_pressure_(
           LoadConfig(FLAGS_grpc_experimental_target_memory_pressure,
                      "GRPC_EXPERIMENTAL_TARGET_MEMORY_PRESSURE",
@@ -194,6 +205,8 @@ std::string ConfigVars::ToString() const {
       ", experimental_target_memory_pressure: ",
       ExperimentalTargetMemoryPressure(),
       ", experimental_memory_pressure_threshold: ",
-      ExperimentalMemoryPressureThreshold());
+      ExperimentalMemoryPressureThreshold(),
+      ", experimental_event_engine_busy_poll_us: ",
+      ExperimentalEventEngineBusyPollUs());
 }
 }  // namespace grpc_core
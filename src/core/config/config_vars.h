@@ -36,6 +36,7 @@ class GPR_DLL ConfigVars {
   struct Overrides {
     absl::optional<int32_t> client_channel_backup_poll_interval_ms;
     absl::optional<int32_t> channelz_max_orphaned_nodes;
+    absl::optional<int32_t> experimental_event_engine_busy_poll_us;
     absl::optional<double> experimental_target_memory_pressure;
     absl::optional<double> experimental_memory_pressure_threshold;
     absl::optional<bool> enable_fork_support;
@@ -133,6 +134,13 @@ class GPR_DLL ConfigVars {
   double ExperimentalMemoryPressureThreshold() const {
     return experimental_memory_pressure_threshold_;
   }
+  // EXPERIMENTAL: If non-zero, each EventEngine poller gets a dedicated thread
+  // that busy polls for up to this many microseconds after its last event
+  // before blocking, and runs I/O callbacks inline. Sockets are also given
+  // SO_BUSY_POLL with this value. Trades CPU for latency.
+  int32_t ExperimentalEventEngineBusyPollUs() const {
+    return experimental_event_engine_busy_poll_us_;
+  }
 
  private:
   explicit ConfigVars(const Overrides& overrides);
@@ -140,6 +148,7 @@ class GPR_DLL ConfigVars {
   static std::atomic<ConfigVars*> config_vars_;
   int32_t client_channel_backup_poll_interval_ms_;
   int32_t channelz_max_orphaned_nodes_;
+  int32_t experimental_event_engine_busy_poll_us_;
   double experimental_target_memory_pressure_;
   double experimental_memory_pressure_threshold_;
   bool enable_fork_support_;
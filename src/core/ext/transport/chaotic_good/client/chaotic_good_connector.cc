@@ -28,6 +28,7 @@
 #include "src/core/ext/transport/chaotic_good/client_transport.h"
 #include "src/core/ext/transport/chaotic_good/frame.h"
 #include "src/core/ext/transport/chaotic_good/frame_header.h"
+#include "src/core/ext/transport/chaotic_good/shared_memory.h"
 #include "src/core/ext/transport/chaotic_good_legacy/client/chaotic_good_connector.h"
 #include "src/core/handshaker/handshaker.h"
 #include "src/core/handshaker/tcp_connect/tcp_connect_handshaker.h"
@@ -281,17 +282,44 @@ PendingConnection ChaoticGoodConnector::ConnectionCreator::Connect(
   chaotic_good_frame::Settings settings;
   settings.set_data_channel(true);
   settings.add_connection_id(id);
+  // Offer the server a segment to share, should it be on this host. Only
+  // addresses that can reach this host get a segment: otherwise it would be
+  // created and advertised for nothing.
+  RefCountedPtr<SharedMemorySegment> shared_memory;
+  std::shared_ptr<SharedMemoryHandoff> shared_memory_handoff;
+  const int shared_memory_size =
+      args_.GetInt(GRPC_ARG_CHAOTIC_GOOD_SHARED_MEMORY_SIZE).value_or(0);
+  if (shared_memory_size > 0 && SharedMemorySegment::IsLocalPeer(address_)) {
+    auto segment = SharedMemorySegment::Create(shared_memory_size);
+    if (segment.ok()) {
+      shared_memory = std::move(*segment);
+      shared_memory->PrepareOffer(*settings.mutable_shared_memory());
+      shared_memory_handoff = std::make_shared<SharedMemoryHandoff>();
+    } else {
+      GRPC_TRACE_LOG(chaotic_good, INFO)
+          << "CHAOTIC_GOOD: no shared memory for data connection: "
+          << segment.status();
+    }
+  }
   return PendingConnection(
       id,
       Map(ConnectChaoticGood(
               address_, args_,
               Timestamp::Now() + Duration::FromSecondsAsDouble(kTimeoutSecs),
               std::move(settings)),
-          [](absl::StatusOr<ConnectChaoticGoodResult> result)
+          [shared_memory, shared_memory_handoff](
+              absl::StatusOr<ConnectChaoticGoodResult> result)
               -> absl::StatusOr<PromiseEndpoint> {
             if (!result.ok()) return result.status();
+            if (shared_memory != nullptr &&
+                result->server_settings.has_shared_memory() &&
+                SharedMemorySegment::IsLocalPeer(
+                    result->connect_result.endpoint.GetPeerAddress())) {
+              shared_memory_handoff->Set(shared_memory);
+            }
             return std::move(result->connect_result.endpoint);
-          }));
+          }),
+      shared_memory_handoff);
 }
 
 absl::StatusOr<grpc_channel*> CreateChaoticGoodChannel(
@@ -92,12 +92,6 @@ auto ChaoticGoodClientTransport::StreamDispatch::PushFrameIntoCall(
                                                   stream->call);
 }
 
-auto ChaoticGoodClientTransport::StreamDispatch::PushFrameIntoCall(
-    MessageChunkFrame frame, RefCountedPtr<Stream> stream) {
-  return stream->message_reassembly.PushFrameInto(std::move(frame),
-                                                  stream->call);
-}
-
 auto ChaoticGoodClientTransport::StreamDispatch::PushFrameIntoCall(
     ServerTrailingMetadataFrame frame, RefCountedPtr<Stream> stream) {
   auto trailers = ServerMetadataGrpcFromProto(frame.body);
@@ -140,6 +134,26 @@ void ChaoticGoodClientTransport::StreamDispatch::DispatchFrame(
   });
 }
 
+void ChaoticGoodClientTransport::StreamDispatch::DispatchMessageChunk(
+    IncomingFrame incoming_frame) {
+  auto stream = LookupStream(incoming_frame.header().stream_id);
+  if (stream == nullptr) return;
+  auto dispatcher = stream->frame_dispatch_serializer;
+  dispatcher->Spawn([stream,
+                     incoming_frame = std::move(incoming_frame)]() mutable {
+    auto& call = stream->call;
+    auto push = stream->message_reassembly.PushChunkInto(
+        std::move(incoming_frame), call);
+    // The stream outlives the chunks that the last one waits for.
+    return Map(call.CancelIfFails(Map(
+                   std::move(push),
+                   [stream = std::move(stream)](StatusFlag result) {
+                     return result;
+                   })),
+               [](auto) {});
+  });
+}
+
 void ChaoticGoodClientTransport::StreamDispatch::OnIncomingFrame(
     IncomingFrame incoming_frame) {
   switch (incoming_frame.header().type) {
@@ -156,7 +170,7 @@ void ChaoticGoodClientTransport::StreamDispatch::OnIncomingFrame(
       DispatchFrame<BeginMessageFrame>(std::move(incoming_frame));
       break;
     case FrameType::kMessageChunk:
-      DispatchFrame<MessageChunkFrame>(std::move(incoming_frame));
+      DispatchMessageChunk(std::move(incoming_frame));
       break;
     default:
       LOG_EVERY_N_SEC(INFO, 10)
@@ -130,6 +130,7 @@ class ChaoticGoodClientTransport final : public ClientTransport,
    private:
     template <typename T>
     void DispatchFrame(IncomingFrame incoming_frame);
+    void DispatchMessageChunk(IncomingFrame incoming_frame);
     RefCountedPtr<Stream> LookupStream(uint32_t stream_id);
 
     // Push one frame into a call
@@ -141,8 +142,6 @@ class ChaoticGoodClientTransport final : public ClientTransport,
                                   RefCountedPtr<Stream> stream);
     static auto PushFrameIntoCall(BeginMessageFrame frame,
                                   RefCountedPtr<Stream> stream);
-    static auto PushFrameIntoCall(MessageChunkFrame frame,
-                                  RefCountedPtr<Stream> stream);
 
     static constexpr const uint32_t kClosedTransportStreamId =
         std::numeric_limits<uint32_t>::max();
@@ -25,6 +25,8 @@
 #include <utility>
 
 #include "src/core/channelz/property_list.h"
+#include "src/core/ext/transport/chaotic_good/serialize_little_endian.h"
+#include "src/core/ext/transport/chaotic_good/shared_memory.h"
 #include "src/core/ext/transport/chaotic_good/tcp_frame_header.h"
 #include "src/core/ext/transport/chaotic_good/tcp_ztrace_collector.h"
 #include "src/core/ext/transport/chaotic_good/transport_context.h"
@@ -32,8 +34,10 @@
 #include "src/core/lib/event_engine/extensions/tcp_trace.h"
 #include "src/core/lib/event_engine/query_extensions.h"
 #include "src/core/lib/event_engine/tcp_socket_utils.h"
+#include "src/core/lib/promise/if.h"
 #include "src/core/lib/promise/loop.h"
 #include "src/core/lib/promise/map.h"
+#include "src/core/lib/promise/promise.h"
 #include "src/core/lib/promise/race.h"
 #include "src/core/lib/promise/try_seq.h"
 #include "src/core/lib/transport/transport_framing_endpoint_extension.h"
@@ -57,7 +61,13 @@ namespace data_endpoints_detail {
 
 namespace {
 const uint64_t kSecurityFramePayloadTag = 0;
+
+// Bytes of the header of each frame, before padding.
+size_t DataFrameHeaderSize(bool shared_memory) {
+  return TcpDataFrameHeader::kFrameHeaderSize +
+         (shared_memory ? kSharedMemoryPositionSize : 0);
 }
+}  // namespace
 
 ///////////////////////////////////////////////////////////////////////////////
 // OutputBuffers
@@ -350,14 +360,17 @@ void SecureFrameQueue::Write(SliceBuffer buffer) {
   uint32_t frame_length = buffer.Length();
   uint32_t frame_padding =
       DataConnectionPadding(frame_length, encode_alignment_);
-  uint32_t header_padding = DataConnectionPadding(
-      TcpDataFrameHeader::kFrameHeaderSize, encode_alignment_);
-  auto slice = MutableSlice::CreateUninitialized(
-      TcpDataFrameHeader::kFrameHeaderSize + header_padding);
+  const size_t header_size = DataFrameHeaderSize(shared_memory_);
+  uint32_t header_padding =
+      DataConnectionPadding(header_size, encode_alignment_);
+  auto slice = MutableSlice::CreateUninitialized(header_size + header_padding);
   TcpDataFrameHeader{0, 0, frame_length}.Serialize(slice.data());
+  if (shared_memory_) {
+    WriteLittleEndianUint64(
+        kPayloadNotShared, slice.data() + TcpDataFrameHeader::kFrameHeaderSize);
+  }
   if (header_padding != 0) {
-    memset(slice.data() + TcpDataFrameHeader::kFrameHeaderSize, 0,
-           frame_padding);
+    memset(slice.data() + header_size, 0, header_padding);
   }
   all_frames_.Append(Slice(std::move(slice)));
   all_frames_.TakeAndAppend(buffer);
@@ -701,10 +714,11 @@ auto Endpoint::PullDataPayload(RefCountedPtr<EndpointContext> ctx) {
         GRPC_LATENT_SEE_SCOPE("SerializePayload");
         // Frame everything into a slice buffer.
         SliceBuffer buffer;
-        const size_t header_padding = DataConnectionPadding(
-            TcpDataFrameHeader::kFrameHeaderSize, ctx->encode_alignment);
+        SharedMemorySegment* const shared_memory = ctx->shared_memory.get();
         const size_t header_size =
-            TcpDataFrameHeader::kFrameHeaderSize + header_padding;
+            DataFrameHeaderSize(shared_memory != nullptr) +
+            DataConnectionPadding(DataFrameHeaderSize(shared_memory != nullptr),
+                                  ctx->encode_alignment);
         auto header_frames = MutableSlice::CreateUninitialized(
             header_size * queued_frames->size() + ctx->encode_alignment);
         auto padding_mut =
@@ -721,9 +735,23 @@ auto Endpoint::PullDataPayload(RefCountedPtr<EndpointContext> ctx) {
                              payload_length}
               .Serialize(hdr.data());
           memset(hdr.data() + TcpDataFrameHeader::kFrameHeaderSize, 0,
-                 header_padding);
-          buffer.AppendIndexed(Slice(std::move(hdr)));
-          frame.SerializePayload(buffer);
+                 header_size - TcpDataFrameHeader::kFrameHeaderSize);
+          if (shared_memory == nullptr) {
+            buffer.AppendIndexed(Slice(std::move(hdr)));
+            frame.SerializePayload(buffer);
+          } else {
+            SliceBuffer payload;
+            frame.SerializePayload(payload);
+            const std::optional<uint64_t> position =
+                shared_memory->Write(payload, ctx->encode_alignment);
+            WriteLittleEndianUint64(
+                position.value_or(kPayloadNotShared),
+                hdr.data() + TcpDataFrameHeader::kFrameHeaderSize);
+            buffer.AppendIndexed(Slice(std::move(hdr)));
+            // The peer reads the payload from the ring.
+            if (position.has_value()) continue;
+            buffer.TakeAndAppend(payload);
+          }
           const size_t frame_padding =
               DataConnectionPadding(payload_length, ctx->encode_alignment);
           if (frame_padding != 0) {
@@ -800,37 +828,71 @@ auto Endpoint::WriteLoop(RefCountedPtr<EndpointContext> ctx) {
 
 auto Endpoint::ReadLoop(RefCountedPtr<EndpointContext> ctx) {
   return Loop([ctx = std::move(ctx)]() {
+    const size_t header_size =
+        DataFrameHeaderSize(ctx->shared_memory != nullptr);
     return TrySeq(
         GRPC_LATENT_SEE_PROMISE(
             "DataEndpointReadHdr",
             ctx->endpoint->ReadSlice(
-                TcpDataFrameHeader::kFrameHeaderSize +
-                DataConnectionPadding(TcpDataFrameHeader::kFrameHeaderSize,
-                                      ctx->decode_alignment))),
-        [id = ctx->id](Slice frame_header) {
+                header_size +
+                DataConnectionPadding(header_size, ctx->decode_alignment))),
+        [ctx](Slice frame_header)
+            -> absl::StatusOr<std::tuple<TcpDataFrameHeader, uint64_t>> {
           auto hdr = TcpDataFrameHeader::Parse(frame_header.data());
           GRPC_TRACE_LOG(chaotic_good, INFO)
               << "CHAOTIC_GOOD: Read "
               << (hdr.ok() ? absl::StrCat(*hdr) : hdr.status().ToString())
-              << " on data connection #" << id;
-          return hdr;
+              << " on data connection #" << ctx->id;
+          if (!hdr.ok()) return hdr.status();
+          uint64_t position = kPayloadNotShared;
+          if (ctx->shared_memory != nullptr) {
+            position = ReadLittleEndianUint64(
+                frame_header.data() + TcpDataFrameHeader::kFrameHeaderSize);
+          }
+          return std::tuple(*hdr, position);
         },
-        [ctx](TcpDataFrameHeader frame_header) {
+        [ctx](std::tuple<TcpDataFrameHeader, uint64_t> header_position) {
+          const TcpDataFrameHeader frame_header = std::get<0>(header_position);
+          const uint64_t position = std::get<1>(header_position);
           ctx->ztrace_collector->Append(ReadDataHeaderTrace{frame_header});
-          return Map(
-              TryStaple(GRPC_LATENT_SEE_PROMISE(
+          return If(
+              position != kPayloadNotShared,
+              [ctx, frame_header, position]() {
+                auto payload = ctx->shared_memory->Read(
+                    position, frame_header.payload_length);
+                absl::StatusOr<std::tuple<SliceBuffer, TcpDataFrameHeader>>
+                    result = payload.status();
+                if (payload.ok()) {
+                  result = std::tuple(std::move(*payload), frame_header);
+                }
+                return Immediate(std::move(result));
+              },
+              [ctx, frame_header]() {
+                return Map(
+                    TryStaple(
+                        GRPC_LATENT_SEE_PROMISE(
                             "DataEndpointRead",
-                            ctx->endpoint->Read(frame_header.payload_length +
-                                                DataConnectionPadding(
-                                                    frame_header.payload_length,
-                                                    ctx->decode_alignment))),
+                            ctx->endpoint->Read(
+                                frame_header.payload_length +
+                                DataConnectionPadding(
+                                    frame_header.payload_length,
+                                    ctx->decode_alignment))),
                         frame_header),
-              [id = ctx->id, frame_header](auto x) {
-                GRPC_TRACE_LOG(chaotic_good, INFO)
-                    << "CHAOTIC_GOOD: Complete read " << frame_header
-                    << " on data connection #" << id
-                    << " status: " << x.status();
-                return x;
+                    [ctx, frame_header](
+                        absl::StatusOr<
+                            std::tuple<SliceBuffer, TcpDataFrameHeader>>
+                            x) {
+                      GRPC_TRACE_LOG(chaotic_good, INFO)
+                          << "CHAOTIC_GOOD: Complete read " << frame_header
+                          << " on data connection #" << ctx->id
+                          << " status: " << x.status();
+                      if (x.ok()) {
+                        std::get<0>(*x).RemoveLastNBytesNoInline(
+                            DataConnectionPadding(frame_header.payload_length,
+                                                  ctx->decode_alignment));
+                      }
+                      return x;
+                    });
               });
         },
         [ctx](std::tuple<SliceBuffer, TcpDataFrameHeader> buffer_frame)
@@ -839,8 +901,6 @@ auto Endpoint::ReadLoop(RefCountedPtr<EndpointContext> ctx) {
           GRPC_TRACE_LOG(chaotic_good, INFO)
               << "CHAOTIC_GOOD: Complete read " << frame_header
               << " on data connection #" << ctx->id;
-          buffer.RemoveLastNBytesNoInline(DataConnectionPadding(
-              frame_header.payload_length, ctx->decode_alignment));
           if (GPR_UNLIKELY(frame_header.payload_tag ==
                            kSecurityFramePayloadTag)) {
             ReceiveSecurityFrame(*ctx->endpoint, std::move(buffer));
@@ -907,13 +967,20 @@ Endpoint::Endpoint(uint32_t id, uint32_t encode_alignment,
       [ep_ctx, pending_connection = std::move(pending_connection)]() mutable {
         return TrySeq(
             pending_connection.Await(),
-            [ep_ctx = std::move(ep_ctx)](PromiseEndpoint ep) mutable {
+            [ep_ctx = std::move(ep_ctx),
+             shared_memory = pending_connection.shared_memory()](
+                PromiseEndpoint ep) mutable {
+              if (shared_memory != nullptr) {
+                ep_ctx->shared_memory = shared_memory->Take();
+              }
               GRPC_TRACE_LOG(chaotic_good, INFO)
                   << "CHAOTIC_GOOD: data endpoint " << ep_ctx->id << " to "
                   << grpc_event_engine::experimental::ResolvedAddressToString(
                          ep.GetPeerAddress())
                          .value_or("<<unknown peer address>>")
-                  << " ready";
+                  << " ready"
+                  << (ep_ctx->shared_memory != nullptr ? " (shared memory)"
+                                                       : "");
               RefCountedPtr<channelz::SocketNode> socket_node;
               if (ep_ctx->transport_ctx->socket_node != nullptr) {
                 auto* channelz_endpoint =
@@ -950,7 +1017,9 @@ Endpoint::Endpoint(uint32_t id, uint32_t encode_alignment,
                 }
               }
               ep_ctx->secure_frame_queue.Set(
-                  MakeRefCounted<SecureFrameQueue>(ep_ctx->encode_alignment));
+                  MakeRefCounted<SecureFrameQueue>(
+                      ep_ctx->encode_alignment,
+                      ep_ctx->shared_memory != nullptr));
               auto* transport_framing_endpoint_extension =
                   GetTransportFramingEndpointExtension(*endpoint);
               if (transport_framing_endpoint_extension != nullptr) {
@@ -28,6 +28,7 @@
 #include "src/core/ext/transport/chaotic_good/pending_connection.h"
 #include "src/core/ext/transport/chaotic_good/scheduler.h"
 #include "src/core/ext/transport/chaotic_good/send_rate.h"
+#include "src/core/ext/transport/chaotic_good/shared_memory.h"
 #include "src/core/ext/transport/chaotic_good/tcp_ztrace_collector.h"
 #include "src/core/ext/transport/chaotic_good/transport_context.h"
 #include "src/core/lib/promise/loop.h"
@@ -381,8 +382,8 @@ class InputQueue final : public RefCounted<InputQueue> {
 class SecureFrameQueue
     : public RefCounted<SecureFrameQueue, NonPolymorphicRefCount> {
  public:
-  explicit SecureFrameQueue(uint32_t encode_alignment)
-      : encode_alignment_(encode_alignment) {}
+  SecureFrameQueue(uint32_t encode_alignment, bool shared_memory)
+      : encode_alignment_(encode_alignment), shared_memory_(shared_memory) {}
 
   void Write(SliceBuffer buffer);
 
@@ -407,6 +408,8 @@ class SecureFrameQueue
  private:
   Mutex mu_;
   const uint32_t encode_alignment_;
+  // Whether frame headers carry a shared memory position.
+  const bool shared_memory_;
   SliceBuffer all_frames_ ABSL_GUARDED_BY(mu_);
   Waker read_waker_ ABSL_GUARDED_BY(mu_);
 };
@@ -441,6 +444,8 @@ class Endpoint final {
     RefCountedPtr<InputQueue> input_queues;
     SingleSetRefCountedPtr<SecureFrameQueue> secure_frame_queue;
     std::shared_ptr<PromiseEndpoint> endpoint;
+    // Set if payloads may be carried by memory shared with the peer.
+    RefCountedPtr<SharedMemorySegment> shared_memory;
     std::shared_ptr<TcpZTraceCollector> ztrace_collector;
     TransportContextPtr transport_ctx;
     RefCountedPtr<Arena> arena;
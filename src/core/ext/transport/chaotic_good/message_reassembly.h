@@ -15,9 +15,19 @@
 #ifndef GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_MESSAGE_REASSEMBLY_H
 #define GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_MESSAGE_REASSEMBLY_H
 
+#include <utility>
+#include <variant>
+#include <vector>
+
 #include "src/core/call/call_spine.h"
 #include "src/core/ext/transport/chaotic_good/frame.h"
+#include "src/core/ext/transport/chaotic_good/frame_transport.h"
+#include "src/core/lib/promise/if.h"
+#include "src/core/lib/promise/poll.h"
+#include "src/core/lib/promise/promise.h"
+#include "src/core/lib/promise/seq.h"
 #include "absl/log/log.h"
+#include "absl/status/statusor.h"
 
 namespace grpc_core {
 namespace chaotic_good {
@@ -26,15 +36,20 @@ namespace chaotic_good {
 // never having two messages in flight on the same stream.
 class MessageReassembly {
  public:
-  void FailCall(CallInitiator& call, absl::string_view msg) {
+  static void FailCall(CallInitiator& call, absl::string_view msg) {
     LOG_EVERY_N_SEC(INFO, 10) << "Call failed during reassembly: " << msg;
     call.Cancel();
   }
-  void FailCall(CallHandler& call, absl::string_view msg) {
+  static void FailCall(CallHandler& call, absl::string_view msg) {
     LOG_EVERY_N_SEC(INFO, 10) << "Call failed during reassembly: " << msg;
     call.PushServerTrailingMetadata(
         CancelledServerMetadataFromStatus(GRPC_STATUS_INTERNAL, msg));
   }
+  // Other sinks fail themselves.
+  template <typename Sink>
+  static void FailCall(Sink& sink, absl::string_view msg) {
+    sink.FailCall(msg);
+  }
 
   template <typename Sink>
   auto PushFrameInto(MessageFrame frame, Sink& sink) {
@@ -71,33 +86,48 @@ class MessageReassembly {
     return Immediate(StatusFlag(ok));
   }
 
+  // Takes a chunk whose payload may still be arriving on a data connection.
+  // Chunks are placed in their message as their frames arrive, and only the
+  // last chunk of a message waits, for all of their payloads at once: chunks
+  // striped over several data connections are gathered as each connection
+  // delivers them, rather than one at a time behind the slowest connection.
   template <typename Sink>
-  auto PushFrameInto(MessageChunkFrame frame, Sink& sink) {
+  auto PushChunkInto(IncomingFrame frame, Sink& sink) {
     bool ok = false;
     bool done = false;
+    const uint32_t length = frame.header().payload_length;
     if (in_message_boundary()) {
       FailCall(sink, "Received message chunk without BeginMessage");
-    } else if (chunk_receiver_->bytes_remaining < frame.payload.Length()) {
+    } else if (chunk_receiver_->bytes_remaining < length) {
       FailCall(sink, "Message chunks are longer than BeginMessage declared");
     } else {
       GRPC_TRACE_LOG(chaotic_good, INFO)
-          << "CHAOTIC_GOOD: " << this << " got chunk " << frame.payload.Length()
+          << "CHAOTIC_GOOD: " << this << " got chunk " << length
           << "b in message with " << chunk_receiver_->bytes_remaining
           << "b left";
-      chunk_receiver_->bytes_remaining -= frame.payload.Length();
-      chunk_receiver_->incoming.Append(frame.payload);
+      chunk_receiver_->bytes_remaining -= length;
+      chunk_receiver_->pending.emplace_back(frame.Payload());
       ok = true;
       done = chunk_receiver_->bytes_remaining == 0;
-      GRPC_TRACE_LOG(chaotic_good, INFO)
-          << "CHAOTIC_GOOD: " << this << " " << GRPC_DUMP_ARGS(ok, done);
     }
     return If(
         done,
         [&]() {
-          auto message = Arena::MakePooled<Message>(
-              std::move(chunk_receiver_->incoming), 0);
+          auto pending = std::move(chunk_receiver_->pending);
           chunk_receiver_.reset();
-          return sink.PushMessage(std::move(message));
+          return Seq(AwaitChunks(std::move(pending)),
+                     [sink](absl::StatusOr<SliceBuffer> payload) mutable {
+                       return If(
+                           payload.ok(),
+                           [&]() {
+                             return sink.PushMessage(Arena::MakePooled<Message>(
+                                 std::move(*payload), 0));
+                           },
+                           [&]() {
+                             FailCall(sink, payload.status().message());
+                             return Immediate(StatusFlag(Failure{}));
+                           });
+                     });
         },
         [ok]() { return StatusFlag(ok); });
   }
@@ -105,9 +135,55 @@ class MessageReassembly {
   bool in_message_boundary() { return chunk_receiver_ == nullptr; }
 
  private:
+  struct PendingChunk {
+    explicit PendingChunk(Promise<absl::StatusOr<Frame>> frame)
+        : frame(std::move(frame)) {}
+    // Null once the payload arrived.
+    Promise<absl::StatusOr<Frame>> frame;
+    SliceBuffer payload;
+  };
+
+  // Resolves to the payloads of the chunks of a message joined in order, once
+  // all of them have arrived.
+  class AwaitChunks {
+   public:
+    explicit AwaitChunks(std::vector<PendingChunk> chunks)
+        : chunks_(std::move(chunks)) {}
+
+    Poll<absl::StatusOr<SliceBuffer>> operator()() {
+      bool pending = false;
+      for (PendingChunk& chunk : chunks_) {
+        if (chunk.frame == nullptr) continue;
+        auto p = chunk.frame();
+        auto* frame = p.value_if_ready();
+        if (frame == nullptr) {
+          pending = true;
+          continue;
+        }
+        chunk.frame = nullptr;
+        if (!frame->ok()) return frame->status();
+        auto* chunk_frame = std::get_if<MessageChunkFrame>(&**frame);
+        if (chunk_frame == nullptr) {
+          return absl::InternalError("Expected a message chunk");
+        }
+        chunk.payload = std::move(chunk_frame->payload);
+      }
+      if (pending) return Pending{};
+      SliceBuffer message;
+      for (PendingChunk& chunk : chunks_) {
+        chunk.payload.MoveFirstNBytesIntoSliceBuffer(chunk.payload.Length(),
+                                                     message);
+      }
+      return message;
+    }
+
+   private:
+    std::vector<PendingChunk> chunks_;
+  };
+
   struct ChunkReceiver {
     size_t bytes_remaining;
-    SliceBuffer incoming;
+    std::vector<PendingChunk> pending;
   };
   std::unique_ptr<ChunkReceiver> chunk_receiver_;
 };
@@ -15,7 +15,9 @@
 #ifndef GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_PENDING_CONNECTION_H
 #define GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_PENDING_CONNECTION_H
 
+#include <memory>
 #include <string>
+#include <utility>
 
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/promise/promise.h"
@@ -26,14 +28,19 @@
 namespace grpc_core {
 namespace chaotic_good {
 
+class SharedMemoryHandoff;
+
 // Essentially this is the promise of one endpoint in the future, with the
 // addition of an id used for handshaking so that can be communicated around as
 // necessary.
 class PendingConnection {
  public:
-  explicit PendingConnection(absl::string_view id,
-                             Promise<absl::StatusOr<PromiseEndpoint>> connector)
-      : id_(id), connector_(std::move(connector)) {}
+  explicit PendingConnection(
+      absl::string_view id, Promise<absl::StatusOr<PromiseEndpoint>> connector,
+      std::shared_ptr<SharedMemoryHandoff> shared_memory = nullptr)
+      : id_(id),
+        connector_(std::move(connector)),
+        shared_memory_(std::move(shared_memory)) {}
 
   PendingConnection(const PendingConnection&) = delete;
   PendingConnection& operator=(const PendingConnection&) = delete;
@@ -42,10 +49,16 @@ class PendingConnection {
 
   absl::string_view id() const { return id_; }
   auto Await() { return std::move(connector_); }
+  // Where the handshake leaves the shared memory it negotiates for this
+  // connection, if it may negotiate any.
+  const std::shared_ptr<SharedMemoryHandoff>& shared_memory() const {
+    return shared_memory_;
+  }
 
  private:
   std::string id_;
   Promise<absl::StatusOr<PromiseEndpoint>> connector_;
+  std::shared_ptr<SharedMemoryHandoff> shared_memory_;
 };
 
 class ServerConnectionFactory : public DualRefCounted<ServerConnectionFactory> {
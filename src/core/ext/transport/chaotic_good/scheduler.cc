@@ -696,6 +696,46 @@ class SpanRoundRobinScheduler final : public SpanScheduler {
   EndOfBurst end_of_burst_ = EndOfBurst::kRandomDeliveryTime;
 };
 
+// StripeScheduler stripes large messages across all data channels in
+// proportion to how fast each one delivers.
+// Each frame goes to the channel that would deliver its last byte soonest,
+// given when a byte sent now would arrive (start_time), the bytes already
+// placed on it this step, and its observed rate. A frame whose soonest
+// delivery is on a channel that is not ready waits for that channel instead
+// of going to a slower one: this keeps a slow channel from carrying the tail
+// of a message.
+class StripeScheduler final : public SimpleScheduler {
+ public:
+  std::string Config() const override {
+    return absl::StrCat("stripe", BaseConfig());
+  }
+
+ private:
+  double DeliveryTime(const Channel* c, uint64_t bytes) const {
+    // A channel with no measured rate counts as fast, as SendRate reports.
+    if (c->delivery_data.bytes_per_second <= 0) {
+      return c->delivery_data.start_time;
+    }
+    return c->delivery_data.start_time +
+           (scheduled_bytes_per_channel(c->id) + bytes) /
+               c->delivery_data.bytes_per_second;
+  }
+
+  const Channel* ChooseChannel(uint64_t bytes) override {
+    const Channel* best_channel = nullptr;
+    double best_delivery_time = 0.0;
+    for (const Channel& c : channels()) {
+      const double delivery_time = DeliveryTime(&c, bytes);
+      if (best_channel == nullptr || delivery_time < best_delivery_time) {
+        best_channel = &c;
+        best_delivery_time = delivery_time;
+      }
+    }
+    if (best_channel == nullptr || !best_channel->ready) return nullptr;
+    return best_channel;
+  }
+};
+
 }  // namespace
 
 std::unique_ptr<Scheduler> MakeScheduler(absl::string_view config) {
@@ -708,6 +748,8 @@ std::unique_ptr<Scheduler> MakeScheduler(absl::string_view config) {
     scheduler = std::make_unique<RandomChoiceScheduler>();
   } else if (name == "pick_best") {
     scheduler = std::make_unique<PickBestScheduler>();
+  } else if (name == "stripe") {
+    scheduler = std::make_unique<StripeScheduler>();
   } else {
     LOG(ERROR) << "Unknown scheduler type: " << name
                << " using spanrr scheduler";
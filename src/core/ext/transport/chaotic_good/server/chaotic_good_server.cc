@@ -104,6 +104,25 @@ void LogInformational(Server* server, std::string what) {
   }
 }
 
+// Opens the segment that a client offered to share on a data connection, if
+// this server shares memory too.
+RefCountedPtr<SharedMemorySegment> AttachSharedMemory(
+    const ChannelArgs& args, const PromiseEndpoint& endpoint,
+    const chaotic_good_frame::Settings::SharedMemory& offer) {
+  const int max_size =
+      args.GetInt(GRPC_ARG_CHAOTIC_GOOD_SHARED_MEMORY_SIZE).value_or(0);
+  if (max_size <= 0) return nullptr;
+  auto segment =
+      SharedMemorySegment::Attach(endpoint.GetPeerAddress(), offer, max_size);
+  if (!segment.ok()) {
+    GRPC_TRACE_LOG(chaotic_good, INFO)
+        << "CHAOTIC_GOOD: not sharing memory with data connection: "
+        << segment.status();
+    return nullptr;
+  }
+  return std::move(*segment);
+}
+
 }  // namespace
 
 using grpc_event_engine::experimental::EventEngine;
@@ -344,6 +363,7 @@ ChaoticGoodServerListener::DataConnectionListener::RequestDataConnection(
     });
   }
   auto latch = std::make_shared<PromiseEndpointLatch>();
+  auto shared_memory = std::make_shared<SharedMemoryHandoff>();
   auto timeout_task = event_engine_->RunAfter(
       connect_timeout_,
       [connection_id, self = WeakRefAsSubclass<DataConnectionListener>()]() {
@@ -353,9 +373,11 @@ ChaoticGoodServerListener::DataConnectionListener::RequestDataConnection(
       connection_id,
       PendingConnectionInfo{
           latch, timeout_task,
-          handshake_result_args.GetObjectRef<grpc_auth_context>()});
+          handshake_result_args.GetObjectRef<grpc_auth_context>(),
+          shared_memory});
   return PendingConnection(connection_id,
-                           Map(latch->Wait(), [latch](auto x) { return x; }));
+                           Map(latch->Wait(), [latch](auto x) { return x; }),
+                           std::move(shared_memory));
 }
 
 std::optional<
@@ -372,6 +394,12 @@ ChaoticGoodServerListener::DataConnectionListener::Extract(
   return ex.mapped();
 }
 
+bool ChaoticGoodServerListener::DataConnectionListener::IsPending(
+    absl::string_view id) {
+  MutexLock lock(&mu_);
+  return pending_connections_.contains(id);
+}
+
 void ChaoticGoodServerListener::DataConnectionListener::ConnectionTimeout(
     absl::string_view id) {
   std::optional<PendingConnectionInfo> pending_connection = Extract(id);
@@ -386,7 +414,8 @@ void ChaoticGoodServerListener::DataConnectionListener::ConnectionTimeout(
 
 void ChaoticGoodServerListener::DataConnectionListener::FinishDataConnection(
     absl::string_view id, PromiseEndpoint endpoint,
-    RefCountedPtr<grpc_auth_context> auth_context) {
+    RefCountedPtr<grpc_auth_context> auth_context,
+    RefCountedPtr<SharedMemorySegment> shared_memory) {
   auto pending_connection = Extract(id);
   if (pending_connection == std::nullopt) {
     GRPC_TRACE_LOG(chaotic_good, ERROR) << "FinishDataConnection: connection "
@@ -412,6 +441,9 @@ void ChaoticGoodServerListener::DataConnectionListener::FinishDataConnection(
     }
   }
 
+  if (shared_memory != nullptr) {
+    pending_connection->shared_memory->Set(std::move(shared_memory));
+  }
   pending_connection->latch->Set(std::move(endpoint));
 }
 
@@ -508,8 +540,20 @@ auto ChaoticGoodServerListener::ActiveConnection::HandshakingState::
                             " connection ids in data endpoint "
                             "settings frame (expect one)"));
                       }
-                      self->data_.emplace<DataConnection>(
-                          frame.body.connection_id()[0]);
+                      auto& data_connection =
+                          self->data_.emplace<DataConnection>(
+                              frame.body.connection_id()[0]);
+                      // Only open what a client names once it is known to be
+                      // expected.
+                      if (frame.body.has_shared_memory() &&
+                          self->connection_->listener_
+                              ->data_connection_listener_->IsPending(
+                                  data_connection.connection_id)) {
+                        data_connection.shared_memory = AttachSharedMemory(
+                            self->connection_->args(),
+                            self->connection_->endpoint_,
+                            frame.body.shared_memory());
+                      }
                     } else {
                       Config config{self->connection_->args()};
                       auto settings_status =
@@ -578,6 +622,12 @@ auto ChaoticGoodServerListener::ActiveConnection::HandshakingState::
   // Send data endpoint setting frame
   SettingsFrame frame;
   frame.body.set_data_channel(true);
+  auto& data_connection = std::get<DataConnection>(self->data_);
+  if (data_connection.shared_memory != nullptr) {
+    // Accept the segment offered by the client.
+    frame.body.mutable_shared_memory()->set_ring_size(
+        data_connection.shared_memory->ring_size());
+  }
   SliceBuffer write_buffer;
   TcpFrameHeader{frame.MakeHeader(), 0}.Serialize(
       write_buffer.AddTiny(TcpFrameHeader::kFrameHeaderSize));
@@ -591,7 +641,9 @@ auto ChaoticGoodServerListener::ActiveConnection::HandshakingState::
                           std::get<DataConnection>(self->data_).connection_id,
                           std::move(self->connection_->endpoint_),
                           self->connection_->handshake_result_args_
-                              ->GetObjectRef<grpc_auth_context>());
+                              ->GetObjectRef<grpc_auth_context>(),
+                          std::move(std::get<DataConnection>(self->data_)
+                                        .shared_memory));
                   return absl::OkStatus();
                 });
 }
@@ -28,6 +28,7 @@
 #include "src/core/channelz/channelz.h"
 #include "src/core/ext/transport/chaotic_good/config.h"
 #include "src/core/ext/transport/chaotic_good/pending_connection.h"
+#include "src/core/ext/transport/chaotic_good/shared_memory.h"
 #include "src/core/handshaker/handshaker.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/iomgr/closure.h"
@@ -112,6 +113,8 @@ class ChaoticGoodServerListener final : public Server::ListenerInterface {
         explicit DataConnection(std::string connection_id)
             : connection_id(std::move(connection_id)) {}
         std::string connection_id;
+        // Set if the client offered a segment that this server could open.
+        RefCountedPtr<SharedMemorySegment> shared_memory;
       };
       struct ControlConnection {
         explicit ControlConnection(Config config) : config(std::move(config)) {}
@@ -159,8 +162,12 @@ class ChaoticGoodServerListener final : public Server::ListenerInterface {
 
     PendingConnection RequestDataConnection(
         const ChannelArgs& handshake_result_args) override;
-    void FinishDataConnection(absl::string_view id, PromiseEndpoint endpoint,
-                              RefCountedPtr<grpc_auth_context> auth_context);
+    void FinishDataConnection(
+        absl::string_view id, PromiseEndpoint endpoint,
+        RefCountedPtr<grpc_auth_context> auth_context,
+        RefCountedPtr<SharedMemorySegment> shared_memory);
+    // Whether a data connection with this id is awaited.
+    bool IsPending(absl::string_view id);
     Duration connection_timeout() const { return connect_timeout_; }
 
    private:
@@ -171,6 +178,7 @@ class ChaoticGoodServerListener final : public Server::ListenerInterface {
       PromiseEndpointLatchPtr latch;
       grpc_event_engine::experimental::EventEngine::TaskHandle timeout;
       RefCountedPtr<grpc_auth_context> control_endpoint_auth_context;
+      std::shared_ptr<SharedMemoryHandoff> shared_memory;
     };
 
     void ConnectionTimeout(absl::string_view id);
@@ -69,14 +69,6 @@ auto ChaoticGoodServerTransport::StreamDispatch::PushFrameIntoCall(
                                                   stream->call);
 }
 
-auto ChaoticGoodServerTransport::StreamDispatch::PushFrameIntoCall(
-    RefCountedPtr<Stream> stream, MessageChunkFrame frame) {
-  GRPC_TRACE_LOG(chaotic_good, INFO)
-      << "CHAOTIC_GOOD: PushFrameIntoCall: frame=" << frame.ToString();
-  return stream->message_reassembly.PushFrameInto(std::move(frame),
-                                                  stream->call);
-}
-
 auto ChaoticGoodServerTransport::StreamDispatch::PushFrameIntoCall(
     RefCountedPtr<Stream> stream, ClientEndOfStream) {
   if (stream->message_reassembly.in_message_boundary()) {
@@ -110,6 +102,23 @@ void ChaoticGoodServerTransport::StreamDispatch::DispatchFrame(
       });
 }
 
+void ChaoticGoodServerTransport::StreamDispatch::DispatchMessageChunk(
+    IncomingFrame frame) {
+  auto stream = LookupStream(frame.header().stream_id);
+  if (stream == nullptr) return;
+  stream->spawn_serializer->Spawn(
+      [stream, frame = std::move(frame)]() mutable {
+        GRPC_DCHECK_NE(stream.get(), nullptr);
+        auto& call = stream->call;
+        auto push = stream->message_reassembly.PushChunkInto(std::move(frame),
+                                                             call);
+        // The stream outlives the chunks that the last one waits for.
+        return call.CancelIfFails(call.UntilCallCompletes(TrySeq(
+            std::move(push),
+            [stream = std::move(stream)]() { return absl::OkStatus(); })));
+      });
+}
+
 auto ChaoticGoodServerTransport::StreamDispatch::SendCallBody(
     uint32_t stream_id, CallInitiator call_initiator,
     std::shared_ptr<TcpCallTracer> call_tracer) {
@@ -230,7 +239,7 @@ auto ChaoticGoodServerTransport::StreamDispatch::ProcessNextFrame(
         DispatchFrame<BeginMessageFrame>(std::move(incoming_frame));
       }),
       Case<FrameType::kMessageChunk>([&, this]() mutable {
-        DispatchFrame<MessageChunkFrame>(std::move(incoming_frame));
+        DispatchMessageChunk(std::move(incoming_frame));
       }),
       Case<FrameType::kClientEndOfStream>([&, this]() mutable {
         DispatchFrame<ClientEndOfStream>(std::move(incoming_frame));
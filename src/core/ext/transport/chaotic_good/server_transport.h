@@ -145,13 +145,12 @@ class ChaoticGoodServerTransport final : public ServerTransport {
 
     template <typename T>
     void DispatchFrame(IncomingFrame frame);
+    void DispatchMessageChunk(IncomingFrame frame);
     auto PushFrameIntoCall(RefCountedPtr<Stream> stream, MessageFrame frame);
     auto PushFrameIntoCall(RefCountedPtr<Stream> stream,
                            ClientEndOfStream frame);
     auto PushFrameIntoCall(RefCountedPtr<Stream> stream,
                            BeginMessageFrame frame);
-    auto PushFrameIntoCall(RefCountedPtr<Stream> stream,
-                           MessageChunkFrame frame);
     auto SendCallInitialMetadataAndBody(
         uint32_t stream_id, CallInitiator call_initiator,
         std::shared_ptr<TcpCallTracer> call_tracer);
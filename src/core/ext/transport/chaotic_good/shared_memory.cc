@@ -0,0 +1,345 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/chaotic_good/shared_memory.h"
+
+#include <grpc/slice.h>
+#include <grpc/support/port_platform.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <new>
+#include <string>
+
+#include "src/core/lib/event_engine/tcp_socket_utils.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/util/grpc_check.h"
+#include "src/core/util/load_file.h"
+#include "src/core/util/no_destruct.h"
+#include "src/core/util/shared_bit_gen.h"
+#include "src/core/util/strerror.h"
+#include "absl/random/random.h"
+#include "absl/status/status.h"
+#include "absl/strings/ascii.h"
+#include "absl/strings/match.h"
+#include "absl/strings/str_cat.h"
+
+#ifdef GPR_LINUX
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace grpc_core {
+namespace chaotic_good {
+
+namespace {
+
+using grpc_event_engine::experimental::EventEngine;
+
+constexpr size_t kPageSize = 4096;
+constexpr size_t kNonceSize = 16;
+constexpr uint32_t kMaxRingSize = 1u << 30;
+
+size_t RoundUp(size_t value, size_t multiple) {
+  return (value + multiple - 1) / multiple * multiple;
+}
+
+#ifdef GPR_LINUX
+constexpr char kMemfdName[] = "grpc_chaotic_good";
+// The size of a segment is fixed once created, so that neither end can make
+// the mapping of the other fault by shrinking it.
+constexpr int kSeals = F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_SEAL;
+
+// Two processes run on the same host if they see the same boot id.
+const std::string& HostId() {
+  static const NoDestruct<std::string> host_id([]() {
+    auto boot_id = LoadFile("/proc/sys/kernel/random/boot_id", false);
+    if (!boot_id.ok()) return std::string();
+    return std::string(absl::StripAsciiWhitespace(boot_id->as_string_view()));
+  }());
+  return *host_id;
+}
+
+// Whether path names a file that Create() made.
+bool IsSegmentPath(const std::string& path) {
+  char target[256];
+  const ssize_t length = readlink(path.c_str(), target, sizeof(target));
+  if (length < 0) return false;
+  return absl::StartsWith(absl::string_view(target, length),
+                          absl::StrCat("/memfd:", kMemfdName));
+}
+#endif
+
+}  // namespace
+
+// The first page of the segment. The rings follow it: ring 0 is written by
+// the end that created the segment, and ring 1 by the other.
+struct SharedMemorySegment::Header {
+  struct alignas(64) Ring {
+    std::atomic<uint64_t> released;
+  };
+  uint8_t nonce[kNonceSize];
+  Ring rings[2];
+};
+
+namespace {
+
+static_assert(sizeof(std::atomic<uint64_t>) == sizeof(uint64_t) &&
+                  std::atomic<uint64_t>::is_always_lock_free,
+              "ring positions are shared between processes");
+
+// Keeps the segment mapped until a payload read from it is released.
+struct PayloadRef {
+  RefCountedPtr<SharedMemorySegment> segment;
+  uint64_t end;
+};
+
+}  // namespace
+
+SharedMemorySegment::SharedMemorySegment(int fd, uint8_t* base,
+                                         uint32_t ring_size, bool creator)
+    : fd_(fd),
+      base_(base),
+      ring_size_(ring_size),
+      write_ring_(base + kPageSize + (creator ? 0 : ring_size)),
+      read_ring_(base + kPageSize + (creator ? ring_size : 0)),
+      write_ring_released_(
+          &reinterpret_cast<Header*>(base)->rings[creator ? 0 : 1].released),
+      read_ring_released_(
+          &reinterpret_cast<Header*>(base)->rings[creator ? 1 : 0].released) {
+  static_assert(sizeof(Header) <= kPageSize);
+}
+
+SharedMemorySegment::~SharedMemorySegment() {
+#ifdef GPR_LINUX
+  munmap(base_, kPageSize + 2 * static_cast<size_t>(ring_size_));
+  if (fd_ >= 0) close(fd_);
+#endif
+}
+
+absl::StatusOr<RefCountedPtr<SharedMemorySegment>> SharedMemorySegment::Create(
+    uint32_t ring_size) {
+#ifdef GPR_LINUX
+  if (HostId().empty()) return absl::UnavailableError("Unknown host id");
+  ring_size = static_cast<uint32_t>(RoundUp(
+      std::clamp<uint32_t>(ring_size, kPageSize, kMaxRingSize), kPageSize));
+  const size_t size = kPageSize + 2 * static_cast<size_t>(ring_size);
+  const int fd = memfd_create(kMemfdName, MFD_CLOEXEC | MFD_ALLOW_SEALING);
+  if (fd < 0) {
+    return absl::UnavailableError(
+        absl::StrCat("memfd_create: ", StrError(errno)));
+  }
+  if (ftruncate(fd, size) != 0) {
+    const int err = errno;
+    close(fd);
+    return absl::UnavailableError(absl::StrCat("ftruncate: ", StrError(err)));
+  }
+  if (fcntl(fd, F_ADD_SEALS, kSeals) != 0) {
+    const int err = errno;
+    close(fd);
+    return absl::UnavailableError(absl::StrCat("F_ADD_SEALS: ", StrError(err)));
+  }
+  void* base = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if (base == MAP_FAILED) {
+    const int err = errno;
+    close(fd);
+    return absl::UnavailableError(absl::StrCat("mmap: ", StrError(err)));
+  }
+  Header* header = new (base) Header();
+  SharedBitGen g;
+  for (uint8_t& byte : header->nonce) byte = absl::Uniform<uint8_t>(g);
+  return RefCountedPtr<SharedMemorySegment>(new SharedMemorySegment(
+      fd, static_cast<uint8_t*>(base), ring_size, /*creator=*/true));
+#else
+  (void)ring_size;
+  return absl::UnimplementedError("Shared memory is only supported on Linux");
+#endif
+}
+
+absl::StatusOr<RefCountedPtr<SharedMemorySegment>> SharedMemorySegment::Attach(
+    const EventEngine::ResolvedAddress& peer,
+    const chaotic_good_frame::Settings::SharedMemory& offer,
+    uint32_t max_ring_size) {
+#ifdef GPR_LINUX
+  if (!IsLocalPeer(peer) || offer.host_id().empty() ||
+      offer.host_id() != HostId()) {
+    return absl::FailedPreconditionError("Peer is on another host");
+  }
+  const uint32_t ring_size = offer.ring_size();
+  if (ring_size == 0 || ring_size % kPageSize != 0 ||
+      ring_size > kMaxRingSize || offer.nonce().size() != kNonceSize) {
+    return absl::InvalidArgumentError("Malformed shared memory offer");
+  }
+  if (ring_size > RoundUp(max_ring_size, kPageSize)) {
+    return absl::ResourceExhaustedError(
+        absl::StrCat("Shared memory rings of ", ring_size,
+                     " bytes exceed the limit of ", max_ring_size));
+  }
+  const std::string path =
+      absl::StrCat("/proc/", offer.pid(), "/fd/", offer.fd());
+  // Check what the peer names before opening it, and check the file opened
+  // is sealed as Create() leaves it, as the peer may have replaced the first.
+  if (!IsSegmentPath(path)) {
+    return absl::InvalidArgumentError(
+        absl::StrCat(path, " is not a shared memory segment"));
+  }
+  const int fd = open(path.c_str(), O_RDWR | O_CLOEXEC | O_NONBLOCK);
+  if (fd < 0) {
+    return absl::UnavailableError(
+        absl::StrCat("open ", path, ": ", StrError(errno)));
+  }
+  const size_t size = kPageSize + 2 * static_cast<size_t>(ring_size);
+  struct stat st;
+  if (fcntl(fd, F_GET_SEALS) != kSeals || fstat(fd, &st) != 0 ||
+      static_cast<size_t>(st.st_size) != size) {
+    close(fd);
+    return absl::InvalidArgumentError(
+        "Shared memory segment does not match the offer");
+  }
+  void* base = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  const int err = errno;
+  // The mapping keeps the segment alive.
+  close(fd);
+  if (base == MAP_FAILED) {
+    return absl::UnavailableError(absl::StrCat("mmap: ", StrError(err)));
+  }
+  if (memcmp(static_cast<Header*>(base)->nonce, offer.nonce().data(),
+             kNonceSize) != 0) {
+    munmap(base, size);
+    return absl::InvalidArgumentError(
+        "Shared memory segment does not match the offer");
+  }
+  return RefCountedPtr<SharedMemorySegment>(new SharedMemorySegment(
+      -1, static_cast<uint8_t*>(base), ring_size, /*creator=*/false));
+#else
+  (void)peer;
+  (void)offer;
+  (void)max_ring_size;
+  return absl::UnimplementedError("Shared memory is only supported on Linux");
+#endif
+}
+
+bool SharedMemorySegment::IsLocalPeer(
+    const EventEngine::ResolvedAddress& peer) {
+#ifdef GPR_LINUX
+  EventEngine::ResolvedAddress peer4;
+  const EventEngine::ResolvedAddress& address =
+      grpc_event_engine::experimental::ResolvedAddressIsV4Mapped(peer, &peer4)
+          ? peer4
+          : peer;
+  switch (address.address()->sa_family) {
+    case AF_UNIX:
+      return true;
+    case AF_INET:
+      return (ntohl(reinterpret_cast<const sockaddr_in*>(address.address())
+                        ->sin_addr.s_addr) >>
+              24) == IN_LOOPBACKNET;
+    case AF_INET6:
+      return IN6_IS_ADDR_LOOPBACK(
+          &reinterpret_cast<const sockaddr_in6*>(address.address())
+               ->sin6_addr);
+    default:
+      return false;
+  }
+#else
+  (void)peer;
+  return false;
+#endif
+}
+
+void SharedMemorySegment::PrepareOffer(
+    chaotic_good_frame::Settings::SharedMemory& offer) const {
+#ifdef GPR_LINUX
+  offer.set_host_id(HostId());
+  offer.set_pid(getpid());
+  offer.set_fd(fd_);
+#endif
+  offer.set_ring_size(ring_size_);
+  offer.set_nonce(std::string(
+      reinterpret_cast<const char*>(reinterpret_cast<Header*>(base_)->nonce),
+      kNonceSize));
+}
+
+std::optional<uint64_t> SharedMemorySegment::Write(SliceBuffer& payload,
+                                                   uint32_t alignment) {
+  const size_t length = payload.Length();
+  if (length == 0 || length > ring_size_) return std::nullopt;
+  const uint64_t lap = write_position_ - write_position_ % ring_size_;
+  uint64_t position =
+      lap + RoundUp(write_position_ - lap, std::max<uint32_t>(alignment, 1));
+  // Payloads are contiguous: one that would wrap around starts the next lap.
+  if (position + length > lap + ring_size_) position = lap + ring_size_;
+  const uint64_t end = position + length;
+  if (end - write_ring_released_->load(std::memory_order_acquire) >
+      ring_size_) {
+    return std::nullopt;
+  }
+  payload.CopyToBuffer(write_ring_ + position % ring_size_);
+  write_position_ = end;
+  return position;
+}
+
+absl::StatusOr<SliceBuffer> SharedMemorySegment::Read(uint64_t position,
+                                                      uint32_t length) {
+  const uint64_t offset = position % ring_size_;
+  if (length == 0 || offset + length > ring_size_) {
+    return absl::InternalError("Shared memory payload out of bounds");
+  }
+  const uint64_t end = position + length;
+  {
+    MutexLock lock(&mu_);
+    if (position < read_position_) {
+      return absl::InternalError("Shared memory payload out of order");
+    }
+    read_position_ = end;
+    regions_.push_back(Region{end, false});
+  }
+  SliceBuffer payload;
+  payload.Append(Slice(
+      grpc_slice_new_with_user_data(read_ring_ + offset, length, ReleasePayload,
+                                    new PayloadRef{Ref(), end})));
+  return payload;
+}
+
+void SharedMemorySegment::ReleasePayload(void* arg) {
+  auto* payload = static_cast<PayloadRef*>(arg);
+  payload->segment->Release(payload->end);
+  delete payload;
+}
+
+void SharedMemorySegment::Release(uint64_t end) {
+  MutexLock lock(&mu_);
+  auto it = std::lower_bound(
+      regions_.begin(), regions_.end(), end,
+      [](const Region& region, uint64_t end) { return region.end < end; });
+  GRPC_DCHECK(it != regions_.end() && it->end == end);
+  it->released = true;
+  // The writer may reuse everything up to the first payload still held.
+  std::optional<uint64_t> released;
+  while (!regions_.empty() && regions_.front().released) {
+    released = regions_.front().end;
+    regions_.pop_front();
+  }
+  if (released.has_value()) {
+    read_ring_released_->store(*released, std::memory_order_release);
+  }
+}
+
+}  // namespace chaotic_good
+}  // namespace grpc_core
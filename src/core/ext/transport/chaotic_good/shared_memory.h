@@ -0,0 +1,150 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_SHARED_MEMORY_H
+#define GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_SHARED_MEMORY_H
+
+#include <grpc/event_engine/event_engine.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <optional>
+#include <utility>
+
+#include "src/core/ext/transport/chaotic_good/chaotic_good_frame.pb.h"
+#include "src/core/lib/slice/slice_buffer.h"
+#include "src/core/util/ref_counted.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/sync.h"
+#include "absl/base/thread_annotations.h"
+#include "absl/status/statusor.h"
+
+// Channel arg: bytes of shared memory that each direction of a data connection
+// uses to carry payloads when both peers are on the same host. Both peers must
+// set it. Defaults to 0: payloads are carried by the connection.
+#define GRPC_ARG_CHAOTIC_GOOD_SHARED_MEMORY_SIZE \
+  "grpc.chaotic_good.shared_memory_size"
+
+namespace grpc_core {
+namespace chaotic_good {
+
+// On a data connection that shares memory, the header of each frame is
+// followed by the position in the ring of its payload, or by kPayloadNotShared
+// if the payload follows on the connection as usual.
+inline constexpr size_t kSharedMemoryPositionSize = 8;
+inline constexpr uint64_t kPayloadNotShared =
+    std::numeric_limits<uint64_t>::max();
+
+// Memory shared by the two ends of a data connection on the same host.
+// It holds one ring per direction. The writer copies each payload into its
+// ring and sends the position on the connection. The reader gets the payload
+// as a slice that points into the ring, and the space is reused once that
+// slice is released. A payload that does not fit in the ring is sent on the
+// connection instead, so the writer never waits for the reader.
+class SharedMemorySegment final : public RefCounted<SharedMemorySegment> {
+ public:
+  // Creates a segment with rings of at least ring_size bytes, to be offered
+  // to the peer of a data connection.
+  static absl::StatusOr<RefCountedPtr<SharedMemorySegment>> Create(
+      uint32_t ring_size);
+  // Opens the segment offered by the peer of a data connection, if the peer
+  // is on this host and its rings are at most max_ring_size bytes.
+  // Only call this once the offer is known to come from a connection that is
+  // expected: opening the segment opens a file that the peer names.
+  static absl::StatusOr<RefCountedPtr<SharedMemorySegment>> Attach(
+      const grpc_event_engine::experimental::EventEngine::ResolvedAddress&
+          peer,
+      const chaotic_good_frame::Settings::SharedMemory& offer,
+      uint32_t max_ring_size);
+
+  // Whether a connection to peer may share memory: only loopback and unix
+  // domain connections can reach a peer on this host.
+  static bool IsLocalPeer(
+      const grpc_event_engine::experimental::EventEngine::ResolvedAddress&
+          peer);
+
+  ~SharedMemorySegment() override;
+
+  SharedMemorySegment(const SharedMemorySegment&) = delete;
+  SharedMemorySegment& operator=(const SharedMemorySegment&) = delete;
+
+  // Describes a segment returned by Create() to the peer.
+  void PrepareOffer(chaotic_good_frame::Settings::SharedMemory& offer) const;
+
+  uint32_t ring_size() const { return ring_size_; }
+
+  // Copies payload into the ring written by this end, at an offset that is a
+  // multiple of alignment. Returns the position to send to the peer, or
+  // nullopt if there is no room for it.
+  // Only the write loop of the data connection may call this.
+  std::optional<uint64_t> Write(SliceBuffer& payload, uint32_t alignment);
+  // The payload of length bytes that the peer wrote at position.
+  absl::StatusOr<SliceBuffer> Read(uint64_t position, uint32_t length);
+
+ private:
+  struct Header;
+  struct Region {
+    // Position just past the payload.
+    uint64_t end;
+    bool released;
+  };
+
+  SharedMemorySegment(int fd, uint8_t* base, uint32_t ring_size, bool creator);
+
+  static void ReleasePayload(void* arg);
+  void Release(uint64_t end);
+
+  // Only set for a segment that this end created: it stays open so that the
+  // peer can open it too.
+  const int fd_;
+  uint8_t* const base_;
+  const uint32_t ring_size_;
+  uint8_t* const write_ring_;
+  uint8_t* const read_ring_;
+  // How far each ring has been released by its reader.
+  std::atomic<uint64_t>* const write_ring_released_;
+  std::atomic<uint64_t>* const read_ring_released_;
+  // Position just past the last payload written.
+  uint64_t write_position_ = 0;
+  Mutex mu_;
+  uint64_t read_position_ ABSL_GUARDED_BY(mu_) = 0;
+  // The payloads read and not yet released, in the order they were written.
+  std::deque<Region> regions_ ABSL_GUARDED_BY(mu_);
+};
+
+// Passes the segment negotiated by the handshake of a data connection to the
+// data endpoint that will use it.
+class SharedMemoryHandoff {
+ public:
+  void Set(RefCountedPtr<SharedMemorySegment> segment) {
+    MutexLock lock(&mu_);
+    segment_ = std::move(segment);
+  }
+  RefCountedPtr<SharedMemorySegment> Take() {
+    MutexLock lock(&mu_);
+    return std::move(segment_);
+  }
+
+ private:
+  Mutex mu_;
+  RefCountedPtr<SharedMemorySegment> segment_ ABSL_GUARDED_BY(mu_);
+};
+
+}  // namespace chaotic_good
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_SHARED_MEMORY_H
@@ -0,0 +1,162 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/chttp2/transport/base64_simd.h"
+
+#include <grpc/support/port_platform.h>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define GRPC_BASE64_SSSE3
+#endif
+
+#ifdef GRPC_BASE64_SSSE3
+#include <tmmintrin.h>
+
+#include <cstring>
+#endif
+
+namespace grpc_core {
+
+#ifdef GRPC_BASE64_SSSE3
+
+namespace {
+
+bool HaveSsse3() {
+#ifdef __SSSE3__
+  return true;
+#else
+  static const bool have_ssse3 = []() {
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("ssse3") != 0;
+  }();
+  return have_ssse3;
+#endif
+}
+
+// Both kernels follow Wojciech Muła's "Base64 encoding and decoding with SIMD
+// instructions" (http://0x80.pl/notesen/2016-01-17-sse-base64-decoding.html).
+
+__attribute__((target("ssse3"))) size_t DecodeSsse3(const uint8_t* in,
+                                                    size_t length,
+                                                    uint8_t* out) {
+  // Each character is valid iff the entries for its low and its high nibble
+  // share no bit.
+  const __m128i lut_lo =
+      _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                    0x13, 0x1a, 0x1b, 0x1b, 0x1b, 0x1a);
+  const __m128i lut_hi =
+      _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10,
+                    0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+  // The offset from a valid character to its value, by its high nibble; '/'
+  // is the odd one out among the characters from 0x20 to 0x2f.
+  const __m128i lut_roll =
+      _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+  const __m128i nibble_mask = _mm_set1_epi8(0x0f);
+  const __m128i slash = _mm_set1_epi8('/');
+  const __m128i pack = _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1,
+                                     -1, -1, -1);
+  size_t decoded = 0;
+  while (length - decoded >= 16) {
+    const __m128i chars =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + decoded));
+    const __m128i hi_nibbles =
+        _mm_and_si128(_mm_srli_epi32(chars, 4), nibble_mask);
+    const __m128i lo_nibbles = _mm_and_si128(chars, nibble_mask);
+    const __m128i lo = _mm_shuffle_epi8(lut_lo, lo_nibbles);
+    const __m128i hi = _mm_shuffle_epi8(lut_hi, hi_nibbles);
+    if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(lo, hi),
+                                         _mm_setzero_si128())) != 0xffff) {
+      break;
+    }
+    const __m128i roll = _mm_shuffle_epi8(
+        lut_roll, _mm_add_epi8(_mm_cmpeq_epi8(chars, slash), hi_nibbles));
+    const __m128i values = _mm_add_epi8(chars, roll);
+    // Join the four six bit values of each 32 bit lane into 24 bits, then
+    // gather the three bytes of every lane, most significant first.
+    const __m128i pairs =
+        _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+    const __m128i lanes = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011000));
+    uint8_t bytes[16];
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(bytes),
+                     _mm_shuffle_epi8(lanes, pack));
+    memcpy(out + decoded / 4 * 3, bytes, 12);
+    decoded += 16;
+  }
+  return decoded;
+}
+
+__attribute__((target("ssse3"))) size_t EncodeSsse3(const uint8_t* in,
+                                                    size_t length, char* out) {
+  // Spread each three bytes over a 32 bit lane, in the order that lets the
+  // multiplications below move every six bit value into its own byte.
+  const __m128i spread =
+      _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+  // The offset from a value to its character, by the range it falls into.
+  const __m128i lut_shift = _mm_setr_epi8(
+      'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+      '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+  size_t encoded = 0;
+  // Every load reads 16 bytes to encode 12 of them.
+  while (length - encoded >= 16) {
+    const __m128i bytes = _mm_shuffle_epi8(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + encoded)),
+        spread);
+    const __m128i ac = _mm_mulhi_epu16(
+        _mm_and_si128(bytes, _mm_set1_epi32(0x0fc0fc00)),
+        _mm_set1_epi32(0x04000040));
+    const __m128i bd = _mm_mullo_epi16(
+        _mm_and_si128(bytes, _mm_set1_epi32(0x003f03f0)),
+        _mm_set1_epi32(0x01000010));
+    const __m128i values = _mm_or_si128(ac, bd);
+    // The index into lut_shift: 13 for values 0-25, 0 for 26-51, 1-10 for
+    // 52-61, and 11 and 12 for 62 and 63.
+    __m128i range = _mm_subs_epu8(values, _mm_set1_epi8(51));
+    range = _mm_or_si128(
+        range, _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26), values),
+                             _mm_set1_epi8(13)));
+    _mm_storeu_si128(
+        reinterpret_cast<__m128i*>(out + encoded / 3 * 4),
+        _mm_add_epi8(values, _mm_shuffle_epi8(lut_shift, range)));
+    encoded += 12;
+  }
+  return encoded;
+}
+
+}  // namespace
+
+size_t DecodeBase64Blocks(const uint8_t* in, size_t length, uint8_t* out) {
+  if (length < 16 || !HaveSsse3()) return 0;
+  return DecodeSsse3(in, length, out);
+}
+
+size_t EncodeBase64Blocks(const uint8_t* in, size_t length, char* out) {
+  if (length < 16 || !HaveSsse3()) return 0;
+  return EncodeSsse3(in, length, out);
+}
+
+#else  // GRPC_BASE64_SSSE3
+
+size_t DecodeBase64Blocks(const uint8_t* /*in*/, size_t /*length*/,
+                          uint8_t* /*out*/) {
+  return 0;
+}
+
+size_t EncodeBase64Blocks(const uint8_t* /*in*/, size_t /*length*/,
+                          char* /*out*/) {
+  return 0;
+}
+
+#endif  // GRPC_BASE64_SSSE3
+
+}  // namespace grpc_core
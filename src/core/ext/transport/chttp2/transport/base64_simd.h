@@ -0,0 +1,43 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_BASE64_SIMD_H
+#define GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_BASE64_SIMD_H
+
+#include <grpc/support/port_platform.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace grpc_core {
+
+// Vector kernels for the bulk of base64 coding of binary metadata. They only
+// handle whole blocks and leave the rest, including all error reporting, to
+// the caller's scalar code. Where the CPU has no suitable instructions (they
+// are picked at runtime), they do nothing and return zero.
+
+// Decodes the longest prefix of the length characters at in that consists of
+// whole 16 character blocks of the base64 alphabet, without padding, to
+// three bytes for every four characters at out. Returns the number of
+// characters decoded.
+size_t DecodeBase64Blocks(const uint8_t* in, size_t length, uint8_t* out);
+
+// Encodes a prefix of the length bytes at in that is a multiple of three bytes
+// long, to four base64 characters for every three bytes at out. Returns the
+// number of bytes encoded.
+size_t EncodeBase64Blocks(const uint8_t* in, size_t length, char* out);
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_BASE64_SIMD_H
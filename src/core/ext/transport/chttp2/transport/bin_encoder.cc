@@ -22,6 +22,7 @@
 #include <stdint.h>
 #include <string.h>
 
+#include "src/core/ext/transport/chttp2/transport/base64_simd.h"
 #include "src/core/ext/transport/chttp2/transport/huffsyms.h"
 #include "src/core/util/grpc_check.h"
 
@@ -57,8 +58,12 @@ grpc_slice grpc_chttp2_base64_encode(const grpc_slice& input) {
   char* out = reinterpret_cast<char*> GRPC_SLICE_START_PTR(output);
   size_t i;
 
-  // encode full triplets
-  for (i = 0; i < input_triplets; i++) {
+  // encode whole vector blocks of triplets, then the rest of them one by one
+  const size_t vector_bytes =
+      grpc_core::EncodeBase64Blocks(in, input_length, out);
+  in += vector_bytes;
+  out += vector_bytes / 3 * 4;
+  for (i = vector_bytes / 3; i < input_triplets; i++) {
     out[0] = alphabet[in[0] >> 2];
     out[1] = alphabet[((in[0] & 0x3) << 4) | (in[1] >> 4)];
     out[2] = alphabet[((in[1] & 0xf) << 2) | (in[2] >> 6)];
@@ -136,7 +141,7 @@ grpc_slice grpc_chttp2_huffman_compress(const grpc_slice& input) {
 }
 
 struct huff_out {
-  uint32_t temp;
+  uint64_t temp;
   uint32_t temp_length;
   uint8_t* out;
 };
@@ -152,12 +157,26 @@ static void enc_add2(huff_out* out, uint8_t a, uint8_t b, uint32_t* wire_size) {
   b64_huff_sym sa = huff_alphabet[a];
   b64_huff_sym sb = huff_alphabet[b];
   out->temp = (out->temp << (sa.length + sb.length)) |
-              (static_cast<uint32_t>(sa.bits) << sb.length) | sb.bits;
+              (static_cast<uint64_t>(sa.bits) << sb.length) | sb.bits;
   out->temp_length +=
       static_cast<uint32_t>(sa.length) + static_cast<uint32_t>(sb.length);
   enc_flush_some(out);
 }
 
+// Adds the four symbols of a triplet at once: at most 44 bits, which fit with
+// the at most 8 left over from the previous flush.
+static void enc_add4(huff_out* out, const uint8_t* in, uint32_t* wire_size) {
+  *wire_size += 4;
+  const uint32_t triplet = (static_cast<uint32_t>(in[0]) << 16) |
+                           (static_cast<uint32_t>(in[1]) << 8) | in[2];
+  for (int shift = 18; shift >= 0; shift -= 6) {
+    b64_huff_sym sym = huff_alphabet[(triplet >> shift) & 0x3f];
+    out->temp = (out->temp << sym.length) | sym.bits;
+    out->temp_length += sym.length;
+  }
+  enc_flush_some(out);
+}
+
 static void enc_add1(huff_out* out, uint8_t a, uint32_t* wire_size) {
   *wire_size += 1;
   b64_huff_sym sa = huff_alphabet[a];
@@ -187,13 +206,7 @@ grpc_slice grpc_chttp2_base64_encode_and_huffman_compress(
 
   // encode full triplets
   for (i = 0; i < input_triplets; i++) {
-    const uint8_t low_to_high = static_cast<uint8_t>((in[0] & 0x3) << 4);
-    const uint8_t high_to_low = in[1] >> 4;
-    enc_add2(&out, in[0] >> 2, low_to_high | high_to_low, wire_size);
-
-    const uint8_t a = static_cast<uint8_t>((in[1] & 0xf) << 2);
-    const uint8_t b = (in[2] >> 6);
-    enc_add2(&out, a | b, in[2] & 0x3f, wire_size);
+    enc_add4(&out, in, wire_size);
     in += 3;
   }
 
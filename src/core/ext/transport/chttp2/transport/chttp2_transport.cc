@@ -91,6 +91,7 @@
 #include "src/core/lib/slice/slice.h"
 #include "src/core/lib/slice/slice_buffer.h"
 #include "src/core/lib/slice/slice_internal.h"
+#include "src/core/lib/surface/validate_metadata.h"
 #include "src/core/lib/transport/bdp_estimator.h"
 #include "src/core/lib/transport/connectivity_state.h"
 #include "src/core/lib/transport/error_utils.h"
@@ -124,9 +125,12 @@
 #include "absl/meta/type_traits.h"
 #include "absl/random/random.h"
 #include "absl/status/status.h"
+#include "absl/strings/ascii.h"
 #include "absl/strings/cord.h"
+#include "absl/strings/escaping.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/str_format.h"
+#include "absl/strings/str_split.h"
 #include "absl/strings/string_view.h"
 #include "absl/time/time.h"
 
@@ -170,6 +174,11 @@ static void read_action_locked(grpc_core::RefCountedPtr<grpc_chttp2_transport>,
                                grpc_error_handle error);
 static void continue_read_action_locked(
     grpc_core::RefCountedPtr<grpc_chttp2_transport> t);
+static void read_ahead_done(grpc_core::RefCountedPtr<grpc_chttp2_transport> t,
+                            grpc_error_handle error);
+static void read_ahead_done_locked(
+    grpc_core::RefCountedPtr<grpc_chttp2_transport> t,
+    grpc_error_handle error);
 
 static void close_from_api(
     grpc_chttp2_transport* t, grpc_chttp2_stream* s, grpc_error_handle error,
@@ -215,6 +224,10 @@ static void send_ping_locked(grpc_chttp2_transport* t,
 static void retry_initiate_ping_locked(
     grpc_core::RefCountedPtr<grpc_chttp2_transport> t,
     GRPC_UNUSED grpc_error_handle error);
+static void write_combining_timer_locked(
+    grpc_core::RefCountedPtr<grpc_chttp2_transport> t,
+    GRPC_UNUSED grpc_error_handle error);
+static void flush_combined_write(grpc_chttp2_transport* t);
 
 // keepalive-relevant functions
 static void init_keepalive_ping(
@@ -384,6 +397,7 @@ grpc_chttp2_transport::~grpc_chttp2_transport() {
   context_list = nullptr;
 
   grpc_slice_buffer_destroy(&read_buffer);
+  grpc_slice_buffer_destroy(&read_ahead_buffer);
   grpc_chttp2_goaway_parser_destroy(&goaway_parser);
 
   for (i = 0; i < STREAM_LIST_COUNT; i++) {
@@ -430,10 +444,44 @@ static void read_channel_args(grpc_chttp2_transport* t,
   if (max_hpack_table_size >= 0) {
     t->hpack_compressor.SetMaxUsableSize(max_hpack_table_size);
   }
+  const std::optional<absl::string_view> static_metadata =
+      channel_args.GetString(GRPC_ARG_HTTP2_STATIC_METADATA);
+  if (static_metadata.has_value()) {
+    for (absl::string_view line :
+         absl::StrSplit(*static_metadata, '\n', absl::SkipWhitespace())) {
+      std::pair<absl::string_view, absl::string_view> pair =
+          absl::StrSplit(line, absl::MaxSplits(':', 1));
+      const absl::string_view key = absl::StripAsciiWhitespace(pair.first);
+      if (grpc_core::ValidateHeaderKeyIsLegal(key) !=
+          grpc_core::ValidateMetadataResult::kOk) {
+        LOG(ERROR) << GRPC_ARG_HTTP2_STATIC_METADATA << ": ignoring key \""
+                   << absl::CEscape(key) << "\"";
+        continue;
+      }
+      if (grpc_core::HPackCompressor::IsSensitiveKey(key)) {
+        LOG(ERROR) << GRPC_ARG_HTTP2_STATIC_METADATA
+                   << ": ignoring sensitive key \"" << key << "\"";
+        continue;
+      }
+      t->hpack_compressor.AddStaticMetadata(
+          grpc_core::Slice::FromCopiedString(key),
+          grpc_core::Slice::FromCopiedString(
+              absl::StripAsciiWhitespace(pair.second)));
+    }
+  }
 
   t->write_buffer_size =
       std::max(0, channel_args.GetInt(GRPC_ARG_HTTP2_WRITE_BUFFER_SIZE)
                       .value_or(grpc_core::chttp2::kDefaultWindow));
+  t->write_combiner.Configure(
+      std::max(grpc_core::Duration::Zero(),
+               channel_args.GetDurationFromIntMillis(
+                               GRPC_ARG_HTTP2_WRITE_COMBINING_WINDOW_MS)
+                   .value_or(grpc_core::IsChttp2WriteCombiningEnabled()
+                                 ? grpc_core::Duration::Milliseconds(1)
+                                 : grpc_core::Duration::Zero())),
+      std::max(0, channel_args.GetInt(GRPC_ARG_HTTP2_WRITE_COMBINING_MAX_BYTES)
+                      .value_or(64 * 1024)));
   t->keepalive_time =
       std::max(grpc_core::Duration::Milliseconds(1),
                channel_args.GetDurationFromIntMillis(GRPC_ARG_KEEPALIVE_TIME_MS)
@@ -622,6 +670,8 @@ void grpc_chttp2_transport::ChannelzDataSource::AddData(
                   .Set("settings", t->settings.ChannelzProperties())
                   .Set("flow_control",
                        t->flow_control.stats().ChannelzProperties())
+                  .Set("hpack_encoder",
+                       t->hpack_compressor.stats().ChannelzProperties())
                   .Set("ping_rate_policy",
                        t->ping_rate_policy.ChannelzProperties())
                   .Set("ping_callbacks", t->ping_callbacks.ChannelzProperties())
@@ -763,6 +813,7 @@ grpc_chttp2_transport::grpc_chttp2_transport(
              GRPC_CHTTP2_CLIENT_CONNECT_STRLEN);
 
   grpc_slice_buffer_init(&read_buffer);
+  grpc_slice_buffer_init(&read_ahead_buffer);
   if (is_client) {
     grpc_slice_buffer_add(
         outbuf.c_slice_buffer(),
@@ -781,6 +832,17 @@ grpc_chttp2_transport::grpc_chttp2_transport(
 
   read_channel_args(this, channel_args, is_client);
 
+  if (grpc_core::IsChttp2ModelWriteSizingEnabled()) {
+    write_size_policy.UseModel();
+  }
+  if (grpc_core::IsChttp2AdaptiveStreamWindowEnabled()) {
+    flow_control.EnableAdaptiveStreamWindows();
+  }
+  if (grpc_core::IsHpackAdaptiveIndexingEnabled()) {
+    hpack_compressor.EnableAdaptiveIndexing();
+  }
+  pipelined_reads = grpc_core::IsChttp2PipelinedReadsEnabled();
+
   next_adjusted_keepalive_timestamp = grpc_core::Timestamp::InfPast();
 
   // Initially allow *UP TO* MAX_CONCURRENT_STREAMS incoming before we start
@@ -864,6 +926,10 @@ static void close_transport_locked(grpc_chttp2_transport* t,
                              GRPC_STATUS_UNAVAILABLE);
     }
     if (t->write_state != GRPC_CHTTP2_WRITE_STATE_IDLE) {
+      // Don't wait out the write combining window for a held back write.
+      if (t->write_combining_timer_handle != TaskHandle::kInvalid) {
+        flush_combined_write(t);
+      }
       if (t->close_transport_on_writes_finished.ok()) {
         t->close_transport_on_writes_finished =
             GRPC_ERROR_CREATE("Delayed close due to in-progress write");
@@ -1099,12 +1165,87 @@ static void set_write_state(grpc_chttp2_transport* t,
   }
 }
 
+// Whether a write for reason carries only frames of calls, and so may be held
+// back by the write combiner. Frames the peer waits on (acks, flow control
+// updates, resets, ...) are written at once.
+static bool is_combinable_write_reason(
+    grpc_chttp2_initiate_write_reason reason) {
+  switch (reason) {
+    case GRPC_CHTTP2_INITIATE_WRITE_START_NEW_STREAM:
+    case GRPC_CHTTP2_INITIATE_WRITE_SEND_MESSAGE:
+    case GRPC_CHTTP2_INITIATE_WRITE_SEND_INITIAL_METADATA:
+    case GRPC_CHTTP2_INITIATE_WRITE_SEND_TRAILING_METADATA:
+      return true;
+    default:
+      return false;
+  }
+}
+
+// Starts a write held back by the write combiner now, if its timer can still
+// be cancelled; otherwise the timer is about to start it.
+static void flush_combined_write(grpc_chttp2_transport* t) {
+  if (t->event_engine->Cancel(t->write_combining_timer_handle)) {
+    t->write_combining_timer_handle = TaskHandle::kInvalid;
+    t->combiner->FinallyRun(
+        grpc_core::InitTransportClosure<write_action_begin_locked>(
+            t->Ref(), &t->write_action_begin_locked),
+        absl::OkStatus());
+  }
+}
+
+static void write_combining_timer_locked(
+    grpc_core::RefCountedPtr<grpc_chttp2_transport> t,
+    GRPC_UNUSED grpc_error_handle error) {
+  GRPC_DCHECK(error.ok());
+  // The write was started early if the timer was cancelled.
+  if (t->write_combining_timer_handle == TaskHandle::kInvalid) return;
+  t->write_combining_timer_handle = TaskHandle::kInvalid;
+  auto* tp = t.get();
+  tp->combiner->FinallyRun(
+      grpc_core::InitTransportClosure<write_action_begin_locked>(
+          std::move(t), &tp->write_action_begin_locked),
+      absl::OkStatus());
+}
+
+// Holds back the write that is needed now for hold, so that it gathers the
+// frames of other calls that become ready meanwhile.
+static void hold_write(grpc_chttp2_transport* t, grpc_core::Duration hold) {
+  GRPC_CHECK(t->write_combining_timer_handle == TaskHandle::kInvalid);
+  t->write_combining_timer_handle =
+      t->event_engine->RunAfter(hold, [t = t->Ref()]() mutable {
+        grpc_core::ExecCtx exec_ctx;
+        auto* tp = t.get();
+        tp->combiner->Run(
+            grpc_core::InitTransportClosure<write_combining_timer_locked>(
+                std::move(t), &tp->write_combining_timer_locked),
+            absl::OkStatus());
+      });
+}
+
 void grpc_chttp2_initiate_write(grpc_chttp2_transport* t,
                                 grpc_chttp2_initiate_write_reason reason) {
+  const bool combinable = is_combinable_write_reason(reason);
+  if (t->write_combiner.enabled()) {
+    if (combinable) {
+      t->write_combiner.RecordReady(grpc_core::Timestamp::Now());
+    } else {
+      t->write_combiner.WriteNow();
+    }
+  }
+  if (t->write_combining_timer_handle != TaskHandle::kInvalid) {
+    // A write is already scheduled, and will pick up these frames.
+    if (!combinable || t->write_combiner.Full()) flush_combined_write(t);
+    return;
+  }
   switch (t->write_state) {
     case GRPC_CHTTP2_WRITE_STATE_IDLE:
       set_write_state(t, GRPC_CHTTP2_WRITE_STATE_WRITING,
                       grpc_chttp2_initiate_write_reason_string(reason));
+      if (const auto hold = t->write_combiner.HoldTime();
+          hold > grpc_core::Duration::Zero()) {
+        hold_write(t, hold);
+        break;
+      }
       // Note that the 'write_action_begin_locked' closure is being scheduled
       // on the 'finally_scheduler' of t->combiner. This means that
       // 'write_action_begin_locked' is called only *after* all the other
@@ -1155,11 +1296,14 @@ static void write_action_begin_locked(
     grpc_error_handle /*error_ignored*/) {
   GRPC_LATENT_SEE_ALWAYS_ON_SCOPE("write_action_begin_locked");
   GRPC_CHECK(t->write_state != GRPC_CHTTP2_WRITE_STATE_IDLE);
+  t->write_combiner.BeginWrite();
   grpc_chttp2_begin_write_result r;
   if (!t->closed_with_error.ok()) {
     r.writing = false;
   } else {
     r = grpc_chttp2_begin_write(t.get());
+    // What did not fit in this write is written straight after it.
+    if (r.partial) t->write_combiner.WriteNow();
   }
   if (r.writing) {
     set_write_state(t.get(),
@@ -1275,6 +1419,23 @@ static void write_action(
                       std::move(args));
 }
 
+// Feeds the write size model the link measurements of the BDP estimator and,
+// where the endpoint is a socket, of the kernel. They are taken at most once
+// per round trip, which keeps getsockopt(TCP_INFO) off most writes.
+static void update_write_size_model(
+    grpc_chttp2_transport* t, grpc_core::Chttp2ModelWriteSizePolicy* model) {
+  if (!model->LinkEstimateDue()) return;
+  grpc_core::Chttp2LinkEstimate estimate;
+  grpc_core::BdpEstimator* bdp_estimator = t->flow_control.bdp_estimator();
+  estimate.bandwidth = bdp_estimator->EstimateBandwidth();
+  estimate.rtt = bdp_estimator->EstimateRtt();
+  if (t->ep != nullptr) {
+    grpc_core::ReadKernelLinkEstimate(grpc_endpoint_get_fd(t->ep.get()),
+                                      &estimate);
+  }
+  model->UpdateLinkEstimate(estimate);
+}
+
 static void write_action_end(grpc_core::RefCountedPtr<grpc_chttp2_transport> t,
                              grpc_error_handle error) {
   auto* tp = t.get();
@@ -1291,6 +1452,9 @@ static void write_action_end_locked(
     grpc_core::RefCountedPtr<grpc_chttp2_transport> t,
     grpc_error_handle error) {
   t->write_size_policy.EndWrite(error.ok());
+  if (auto* model = t->write_size_policy.model(); model != nullptr) {
+    update_write_size_model(t.get(), model);
+  }
 
   bool closed = false;
   if (!error.ok()) {
@@ -1323,6 +1487,12 @@ static void write_action_end_locked(
       if (!closed) {
         grpc_core::ExecCtx::RunList(DEBUG_LOCATION, &t->run_after_write);
       }
+      // Once the transport is closed, what is left is written at once.
+      if (const auto hold = t->write_combiner.HoldTime();
+          !closed && hold > grpc_core::Duration::Zero()) {
+        hold_write(t.get(), hold);
+        break;
+      }
       t->combiner->FinallyRun(
           grpc_core::InitTransportClosure<write_action_begin_locked>(
               t, &t->write_action_begin_locked),
@@ -1678,6 +1848,7 @@ static void send_message_locked(
 
     s->call_tracer_wrapper.RecordOutgoingBytes(
         {GRPC_HEADER_SIZE_IN_BYTES, len, 0});
+    t->write_combiner.AddPendingBytes(GRPC_HEADER_SIZE_IN_BYTES + len);
     s->next_message_end_offset =
         s->flow_controlled_bytes_written +
         static_cast<int64_t>(s->flow_controlled_buffer.length) +
@@ -2366,6 +2537,7 @@ void grpc_chttp2_maybe_complete_recv_message(grpc_chttp2_transport* t,
     // save the length of the buffer before handing control back to application
     // threads. Needed to support correct flow control bookkeeping
     if (error.ok() && s->recv_message->has_value()) {
+      upd.RecordRead((*s->recv_message)->Length() + GRPC_HEADER_SIZE_IN_BYTES);
       null_then_sched_closure(&s->recv_message_ready);
     } else if (s->published_metadata[1] != GRPC_METADATA_NOT_PUBLISHED) {
       if (s->call_failed_before_recv_message != nullptr) {
@@ -3039,6 +3211,7 @@ static void read_action_parse_loop_locked(
     }
   }
   grpc_slice_buffer_reset_and_unref(&t->read_buffer);
+  t->parsing_read_buffer = false;
 
   if (keep_reading) {
     if (t->num_pending_induced_frames >= DEFAULT_MAX_PENDING_INDUCED_FRAMES) {
@@ -3072,11 +3245,69 @@ static void read_action_locked(
     err = GRPC_ERROR_CREATE_REFERENCING("Endpoint read failed", &err, 1);
   }
   std::swap(err, error);
+  t->parsing_read_buffer = true;
   read_action_parse_loop_locked(std::move(t), std::move(err));
 }
 
+// Starts an endpoint read into read_ahead_buffer.
+static void start_read_ahead(grpc_chttp2_transport* t,
+                             size_t min_progress_size) {
+  GRPC_CHECK(!t->read_ahead_outstanding);
+  t->read_ahead_outstanding = true;
+  grpc_endpoint_read(t->ep.get(), &t->read_ahead_buffer,
+                     grpc_core::InitTransportClosure<read_ahead_done>(
+                         t->Ref(), &t->read_ahead_done),
+                     !t->goaway_error.ok(), min_progress_size);
+}
+
+// Parses the bytes of a finished read ahead, while the endpoint reads the
+// next ones.
+static void parse_read_ahead_locked(
+    grpc_core::RefCountedPtr<grpc_chttp2_transport> t,
+    grpc_error_handle error) {
+  grpc_slice_buffer_move_into(&t->read_ahead_buffer, &t->read_buffer);
+  if (error.ok() && t->closed_with_error.ok()) {
+    // How many bytes the parser will need next is not known until it has
+    // parsed these, so take whatever arrives.
+    start_read_ahead(t.get(), 1);
+  }
+  read_action_locked(std::move(t), std::move(error));
+}
+
+static void read_ahead_done(grpc_core::RefCountedPtr<grpc_chttp2_transport> t,
+                            grpc_error_handle error) {
+  auto* tp = t.get();
+  tp->combiner->Run(grpc_core::InitTransportClosure<read_ahead_done_locked>(
+                        std::move(t), &tp->read_ahead_done),
+                    error);
+}
+
+static void read_ahead_done_locked(
+    grpc_core::RefCountedPtr<grpc_chttp2_transport> t,
+    grpc_error_handle error) {
+  t->read_ahead_outstanding = false;
+  if (t->parsing_read_buffer || t->reading_paused_on_pending_induced_frames) {
+    // Parsed by continue_read_action_locked, once the bytes before these have
+    // been or reading resumes.
+    t->read_ahead_result = std::move(error);
+    return;
+  }
+  parse_read_ahead_locked(std::move(t), std::move(error));
+}
+
 static void continue_read_action_locked(
     grpc_core::RefCountedPtr<grpc_chttp2_transport> t) {
+  if (t->pipelined_reads) {
+    if (t->parsing_read_buffer) return;
+    if (t->read_ahead_result.has_value()) {
+      grpc_error_handle error = std::move(*t->read_ahead_result);
+      t->read_ahead_result.reset();
+      parse_read_ahead_locked(std::move(t), std::move(error));
+    } else if (!t->read_ahead_outstanding) {
+      start_read_ahead(t.get(), grpc_chttp2_min_read_progress_size(t.get()));
+    }
+    return;
+  }
   const bool urgent = !t->goaway_error.ok();
   auto* tp = t.get();
   grpc_endpoint_read(tp->ep.get(), &tp->read_buffer,
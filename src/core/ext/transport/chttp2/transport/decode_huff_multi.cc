@@ -0,0 +1,103 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/chttp2/transport/decode_huff_multi.h"
+
+#include <grpc/support/port_platform.h>
+
+#include "absl/base/attributes.h"
+
+namespace grpc_core {
+
+namespace {
+
+using Tables = HuffMultiDecodeTables;
+
+// The code length of each symbol, from the HPACK spec (see huffsyms.cc). The
+// HPACK code is canonical, so the codes themselves follow from the lengths.
+constexpr uint8_t kCodeLengths[Tables::kEos + 1] = {
+    13, 23, 28, 28, 28, 28, 28, 28, 28, 24, 30, 28, 28, 30, 28, 28, 28, 28, 28,
+    28, 28, 28, 30, 28, 28, 28, 28, 28, 28, 28, 28, 28, 6, 10, 10, 12, 13, 6, 8,
+    11, 10, 10, 8, 11, 8, 6, 6, 6, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 7, 8, 15, 6,
+    12, 10, 13, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 8, 7, 8, 13, 19, 13, 14, 6, 15, 5, 6, 5, 6, 5, 6, 6, 6, 5, 7, 7, 6, 6,
+    6, 5, 6, 7, 6, 5, 5, 6, 7, 7, 7, 7, 7, 15, 11, 14, 13, 28, 20, 22, 20, 20,
+    22, 22, 22, 23, 22, 23, 23, 23, 23, 23, 24, 23, 24, 24, 22, 23, 24, 23, 23,
+    23, 23, 21, 22, 23, 22, 23, 23, 24, 22, 21, 20, 22, 22, 23, 23, 21, 23, 22,
+    22, 24, 21, 22, 23, 23, 21, 21, 22, 21, 23, 22, 23, 23, 20, 22, 22, 22, 23,
+    22, 22, 23, 26, 26, 20, 19, 22, 23, 22, 25, 26, 26, 26, 27, 27, 26, 24, 25,
+    19, 21, 26, 27, 27, 26, 27, 24, 21, 21, 26, 26, 28, 27, 27, 27, 20, 24, 20,
+    21, 22, 21, 21, 23, 22, 22, 25, 25, 24, 24, 26, 23, 26, 27, 26, 26, 27, 27,
+    27, 27, 27, 28, 27, 27, 27, 27, 27, 26, 30,
+};
+
+constexpr uint32_t ProbeEntry(int symbols, uint32_t first, uint32_t second,
+                              int first_length, int length) {
+  return first | (second << 8) | (static_cast<uint32_t>(first_length) << 16) |
+         (static_cast<uint32_t>(length) << 20) |
+         (static_cast<uint32_t>(symbols) << 24);
+}
+
+constexpr Tables BuildTables() {
+  Tables tables{};
+  // Assign the canonical codes: shorter codes first, and codes of the same
+  // length in symbol order.
+  uint32_t code = 0;
+  uint16_t index = 0;
+  for (int length = 1; length <= Tables::kMaxCodeLength; ++length) {
+    tables.first_code[length] = code;
+    tables.first_index[length] = index;
+    for (int symbol = 0; symbol <= Tables::kEos; ++symbol) {
+      if (kCodeLengths[symbol] != length) continue;
+      if (length <= Tables::kProbeBits) {
+        // Every probe that starts with this code decodes to it.
+        const int spare = Tables::kProbeBits - length;
+        for (uint32_t i = 0; i < (uint32_t{1} << spare); ++i) {
+          tables.probe[(code << spare) | i] = ProbeEntry(1, symbol, 0, length,
+                                                         length);
+        }
+      }
+      tables.symbols[index++] = symbol;
+      ++tables.count[length];
+      ++code;
+    }
+    code <<= 1;
+  }
+  // Add a second symbol to the probes that hold one more complete code after
+  // the first.
+  for (uint32_t probe = 0; probe < (uint32_t{1} << Tables::kProbeBits);
+       ++probe) {
+    const uint32_t entry = tables.probe[probe];
+    if ((entry >> 24) == 0) continue;
+    const int first_length = (entry >> 16) & 0xf;
+    const uint32_t rest =
+        (probe << first_length) & ((uint32_t{1} << Tables::kProbeBits) - 1);
+    const uint32_t next = tables.probe[rest];
+    const int next_length = (next >> 16) & 0xf;
+    if ((next >> 24) == 0 ||
+        first_length + next_length > Tables::kProbeBits) {
+      continue;
+    }
+    tables.probe[probe] = ProbeEntry(2, entry & 0xff, next & 0xff,
+                                     first_length, first_length + next_length);
+  }
+  return tables;
+}
+
+}  // namespace
+
+ABSL_CONST_INIT const HuffMultiDecodeTables kHuffMultiDecodeTables =
+    BuildTables();
+
+}  // namespace grpc_core
@@ -0,0 +1,175 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_DECODE_HUFF_MULTI_H
+#define GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_DECODE_HUFF_MULTI_H
+
+#include <grpc/support/port_platform.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace grpc_core {
+
+// Lookup tables for HuffMultiDecoder.
+struct HuffMultiDecodeTables {
+  // Number of input bits looked up per probe.
+  static constexpr int kProbeBits = 12;
+  // Codes are at most this long.
+  static constexpr int kMaxCodeLength = 30;
+  static constexpr uint16_t kEos = 256;
+
+  // For each value of the next kProbeBits bits of input:
+  //   bits 0-7:   the first symbol they start with
+  //   bits 8-15:  the symbol after it, if its code fits too
+  //   bits 16-19: the code length of the first symbol
+  //   bits 20-23: the code length of both symbols
+  //   bits 24-25: the number of symbols, or zero if the first code is longer
+  //               than kProbeBits
+  uint32_t probe[1 << kProbeBits];
+  // Canonical decoding of longer codes: codes of length n are the count[n]
+  // consecutive values from first_code[n], and map to the symbols from
+  // symbols[first_index[n]].
+  uint32_t first_code[kMaxCodeLength + 1];
+  uint16_t first_index[kMaxCodeLength + 1];
+  uint16_t count[kMaxCodeLength + 1];
+  uint16_t symbols[kEos + 1];
+};
+
+extern const HuffMultiDecodeTables kHuffMultiDecodeTables;
+
+// Decodes an HPACK Huffman coded string, with the same interface and results
+// as HuffDecoder: sink is called with each decoded byte, and Run() returns
+// false if the input is not validly coded. As with HuffDecoder, an EOS code
+// ends the string, and anything after it is ignored.
+//
+// Instead of walking the code a few bits at a time, each step looks up the
+// next twelve bits of input and emits the one or two symbols they hold; as
+// the most frequent symbols have five to eight bit codes, most steps emit two.
+// The rare codes that are longer than twelve bits are decoded canonically.
+template <typename F>
+class HuffMultiDecoder {
+ public:
+  HuffMultiDecoder(F sink, const uint8_t* begin, const uint8_t* end)
+      : sink_(std::move(sink)), begin_(begin), end_(end) {}
+
+  bool Run() {
+    const HuffMultiDecodeTables& tables = kHuffMultiDecodeTables;
+    // While eight bytes remain, refill them at once: that leaves at least 56
+    // bits buffered, enough for four probes.
+    while (end_ - begin_ >= 8) {
+      // Compilers turn this into a single byte swapped load.
+      uint64_t next = 0;
+      for (int i = 0; i < 8; ++i) next = (next << 8) | begin_[i];
+      buffer_ |= next >> buffer_len_;
+      begin_ += (63 - buffer_len_) >> 3;
+      buffer_len_ |= 56;
+      for (int i = 0; i < 4; ++i) {
+        const uint32_t entry = tables.probe[buffer_ >> 52];
+        if (GPR_UNLIKELY((entry >> 24) == 0)) {
+          // A long code: needs a full window of input, and leaves too little
+          // for the remaining probes, so refill after it.
+          if (buffer_len_ < HuffMultiDecodeTables::kMaxCodeLength) break;
+          uint16_t symbol;
+          const int length = LongCode(tables, &symbol);
+          if (length == 0) return false;
+          if (symbol == HuffMultiDecodeTables::kEos) return true;
+          sink_(static_cast<uint8_t>(symbol));
+          buffer_ <<= length;
+          buffer_len_ -= length;
+          break;
+        }
+        sink_(static_cast<uint8_t>(entry));
+        if ((entry >> 24) == 2) sink_(static_cast<uint8_t>(entry >> 8));
+        const int length = (entry >> 20) & 0xf;
+        buffer_ <<= length;
+        buffer_len_ -= length;
+      }
+    }
+    return RunTail(tables);
+  }
+
+ private:
+  // Decodes the remaining input one byte at a time, checking that codes do
+  // not run past its end.
+  bool RunTail(const HuffMultiDecodeTables& tables) {
+    while (true) {
+      while (buffer_len_ <= 56 && begin_ != end_) {
+        buffer_ |= static_cast<uint64_t>(*begin_++) << (56 - buffer_len_);
+        buffer_len_ += 8;
+      }
+      if (buffer_len_ == 0) return true;
+      const uint32_t entry = tables.probe[buffer_ >> 52];
+      const int symbols = entry >> 24;
+      if (symbols == 0) {
+        uint16_t symbol;
+        const int length = LongCode(tables, &symbol);
+        if (length == 0) return false;
+        if (length > buffer_len_) break;
+        if (symbol == HuffMultiDecodeTables::kEos) return true;
+        sink_(static_cast<uint8_t>(symbol));
+        buffer_ <<= length;
+        buffer_len_ -= length;
+        continue;
+      }
+      const int first_length = (entry >> 16) & 0xf;
+      const int length = (entry >> 20) & 0xf;
+      if (length <= buffer_len_) {
+        sink_(static_cast<uint8_t>(entry));
+        if (symbols == 2) sink_(static_cast<uint8_t>(entry >> 8));
+        buffer_ <<= length;
+        buffer_len_ -= length;
+      } else if (first_length <= buffer_len_) {
+        sink_(static_cast<uint8_t>(entry));
+        buffer_ <<= first_length;
+        buffer_len_ -= first_length;
+      } else {
+        break;
+      }
+    }
+    // What is left must be padding: the start of the EOS code, which is all
+    // ones. Like HuffDecoder, this accepts padding longer than the seven bits
+    // RFC 7541 allows.
+    return (buffer_ >> (64 - buffer_len_)) == (uint64_t{1} << buffer_len_) - 1;
+  }
+
+  // Returns the length of the code longer than the probe at the top of the
+  // buffer, and sets *symbol to its symbol; or returns zero if there is no
+  // such code.
+  int LongCode(const HuffMultiDecodeTables& tables, uint16_t* symbol) const {
+    const uint32_t window = static_cast<uint32_t>(buffer_ >> 32);
+    for (int length = HuffMultiDecodeTables::kProbeBits + 1;
+         length <= HuffMultiDecodeTables::kMaxCodeLength; ++length) {
+      const uint32_t offset =
+          (window >> (32 - length)) - tables.first_code[length];
+      if (offset < tables.count[length]) {
+        *symbol = tables.symbols[tables.first_index[length] + offset];
+        return length;
+      }
+    }
+    return 0;
+  }
+
+  F sink_;
+  const uint8_t* begin_;
+  const uint8_t* const end_;
+  // Buffered input bits, most significant first.
+  uint64_t buffer_ = 0;
+  int buffer_len_ = 0;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_DECODE_HUFF_MULTI_H
@@ -52,6 +52,14 @@ namespace {
 
 constexpr const int64_t kMaxWindowUpdateSize = (1u << 31) - 1;
 
+// Adaptive stream windows: the read rate of a stream is sampled over at least
+// this long.
+constexpr Duration kReadRateSampleInterval = Duration::Milliseconds(10);
+// A stream's window holds what the application reads in this many seconds,
+// or in two round trips if that is longer.
+constexpr double kMinReadHorizon = 0.05;
+constexpr int64_t kMinAdaptiveStreamWindow = 16384;
+
 }  // namespace
 
 const char* FlowControlAction::UrgencyString(Urgency u) {
@@ -305,10 +313,14 @@ FlowControlAction TransportFlowControl::PeriodicUpdate() {
     }
     // Though initial window 'could' drop to 0, we keep the floor at
     // kMinInitialWindowSize
-    UpdateSetting(Http2Settings::initial_window_size_name(),
-                  &target_initial_window_size_,
-                  std::min(target, Http2Settings::max_initial_window_size()),
-                  &action, &FlowControlAction::set_send_initial_window_update);
+    // With adaptive stream windows, streams are given more than the default
+    // window only once they are read quickly enough to need it.
+    const uint32_t initial_window =
+        adaptive_stream_windows_ ? std::min(target, kDefaultWindow) : target;
+    UpdateSetting(
+        Http2Settings::initial_window_size_name(), &target_initial_window_size_,
+        std::min(initial_window, Http2Settings::max_initial_window_size()),
+        &action, &FlowControlAction::set_send_initial_window_update);
     // we target the max of BDP or bandwidth in microseconds.
     UpdateSetting(Http2Settings::max_frame_size_name(), &target_frame_size_,
                   Clamp(target, Http2Settings::min_max_frame_size(),
@@ -361,6 +373,7 @@ void StreamFlowControl::SentUpdate(uint32_t announce) {
 }
 
 uint32_t StreamFlowControl::DesiredAnnounceSize() const {
+  if (tfc_->adaptive_stream_windows()) return AdaptiveDesiredAnnounceSize();
   int64_t desired_window_delta = [this]() {
     if (min_progress_size_ == 0) {
       if (pending_size_.has_value() &&
@@ -377,6 +390,66 @@ uint32_t StreamFlowControl::DesiredAnnounceSize() const {
                kMaxWindowUpdateSize);
 }
 
+uint32_t StreamFlowControl::AdaptiveDesiredAnnounceSize() const {
+  // Only streams that the application reads advertise: while it waits for
+  // data, the window is opened to target_window_, and when it is given a
+  // message, to target_window_ less what remains buffered.
+  int64_t desired_window;
+  if (min_progress_size_ > 0) {
+    desired_window =
+        std::max(target_window_, std::min(min_progress_size_, kMaxWindowDelta));
+  } else if (pending_size_.has_value()) {
+    desired_window = target_window_ - *pending_size_;
+  } else {
+    return 0;
+  }
+  const int64_t desired_window_delta =
+      desired_window - static_cast<int64_t>(tfc_->acked_init_window());
+  return Clamp(desired_window_delta - announced_window_delta_, int64_t{0},
+               kMaxWindowUpdateSize);
+}
+
+void StreamFlowControl::NoteReaderWaiting() {
+  // The peer had little window left while the application waited: the window,
+  // not the peer, is holding the stream back.
+  if (tfc_->acked_init_window() + announced_window_delta_ <
+      target_window_ / 2) {
+    starved_ = true;
+  }
+}
+
+void StreamFlowControl::RecordRead(int64_t bytes) {
+  const Timestamp now = Timestamp::Now();
+  if (read_sample_start_ == Timestamp::InfPast()) {
+    read_sample_start_ = now;
+    return;
+  }
+  read_bytes_ += bytes;
+  const Duration elapsed = now - read_sample_start_;
+  if (elapsed < kReadRateSampleInterval) return;
+  const double rate = read_bytes_ / elapsed.seconds();
+  read_rate_ = read_rate_ == 0 ? rate : (read_rate_ + rate) / 2;
+  read_bytes_ = 0;
+  read_sample_start_ = now;
+  const double horizon =
+      std::max(2 * tfc_->bdp_estimator_.EstimateRtt(), kMinReadHorizon);
+  int64_t target = static_cast<int64_t>(read_rate_ * horizon);
+  // A starved reader may read faster than the window let it: grow
+  // exponentially until it no longer waits.
+  if (std::exchange(starved_, false)) {
+    target = std::max(target, 2 * target_window_);
+  }
+  // Under memory pressure no stream gets more than the transport would give
+  // each stream without adaptive windows.
+  const int64_t cap = static_cast<int64_t>(
+      tfc_->TargetInitialWindowSizeBasedOnMemoryPressureAndBdp());
+  target_window_ =
+      Clamp(target, std::min(kMinAdaptiveStreamWindow, cap), cap);
+  GRPC_TRACE_LOG(flowctl, INFO)
+      << "[flowctl] stream read rate " << read_rate_ << " bytes/s, window "
+      << target_window_;
+}
+
 FlowControlAction StreamFlowControl::UpdateAction(FlowControlAction action) {
   const int64_t desired_announce_size = DesiredAnnounceSize();
   if (desired_announce_size > 0) {
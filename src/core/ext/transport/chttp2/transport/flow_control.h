@@ -342,6 +342,14 @@ class TransportFlowControl final {
         std::min(value, Http2Settings::max_initial_window_size());
   }
 
+  // Sizes the window of each stream from the rate at which the application
+  // reads it (see StreamFlowControl::IncomingUpdateContext::RecordRead),
+  // instead of giving every stream the window the BDP allows. The initial
+  // window is kept at kDefaultWindow, and streams that are read quickly
+  // grow past it with WINDOW_UPDATEs.
+  void EnableAdaptiveStreamWindows() { adaptive_stream_windows_ = true; }
+  bool adaptive_stream_windows() const { return adaptive_stream_windows_; }
+
   // Getters
   int64_t remote_window() const { return remote_window_; }
   int64_t test_only_announced_window() const { return announced_window(); }
@@ -470,6 +478,7 @@ class TransportFlowControl final {
   int64_t announced_window_ = kDefaultWindow;
   uint32_t acked_init_window_ = kDefaultWindow;
   uint32_t sent_init_window_ = kDefaultWindow;
+  bool adaptive_stream_windows_ = false;
   absl::flat_hash_set<uint32_t> window_update_list_;
 };
 
@@ -517,6 +526,16 @@ class StreamFlowControl final {
     // TODO(tjagtap) [PH2][P2] Plumb with PH2 flow control.
     void SetMinProgressSize(int64_t min_progress_size) {
       sfc_->min_progress_size_ = min_progress_size;
+      if (min_progress_size > 0 && sfc_->tfc_->adaptive_stream_windows()) {
+        sfc_->NoteReaderWaiting();
+      }
+    }
+
+    // Informs flow control that the application has read `bytes` bytes of
+    // the stream. With adaptive stream windows, the window of the stream is
+    // sized from the rate of these reads.
+    void RecordRead(int64_t bytes) {
+      if (sfc_->tfc_->adaptive_stream_windows()) sfc_->RecordRead(bytes);
     }
 
     // Informs flow control that `pending_size` bytes are buffered and waiting
@@ -589,6 +608,7 @@ class StreamFlowControl final {
     return announced_window_delta_;
   }
   int64_t test_only_min_progress_size() const { return min_progress_size_; }
+  int64_t test_only_target_window() const { return target_window_; }
 
   // A snapshot of the flow control stats to export.
   struct Stats {
@@ -635,7 +655,23 @@ class StreamFlowControl final {
   int64_t announced_window_delta_ = 0;
   std::optional<int64_t> pending_size_;
 
+  // Adaptive stream windows only.
+  // The window to keep open for the peer, including the bytes buffered for
+  // the application.
+  int64_t target_window_ = kDefaultWindow;
+  // Smoothed rate at which the application reads the stream, in bytes per
+  // second, and the reads since the current sample started.
+  double read_rate_ = 0;
+  int64_t read_bytes_ = 0;
+  Timestamp read_sample_start_ = Timestamp::InfPast();
+  // Whether the application waited for data that the window held back since
+  // the current sample started.
+  bool starved_ = false;
+
   FlowControlAction UpdateAction(FlowControlAction action);
+  uint32_t AdaptiveDesiredAnnounceSize() const;
+  void NoteReaderWaiting();
+  void RecordRead(int64_t bytes);
 };
 
 class TestOnlyTransportTargetWindowEstimatesMocker {
@@ -27,6 +27,7 @@
 #include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/slice/slice.h"
 #include "src/core/lib/slice/slice_buffer.h"
+#include "src/core/lib/slice/slice_internal.h"
 #include "src/core/lib/transport/transport.h"
 #include "src/core/telemetry/stats.h"
 #include "src/core/util/grpc_check.h"
@@ -52,17 +53,56 @@ absl::Status grpc_chttp2_data_parser_begin_frame(uint8_t flags,
   return absl::OkStatus();
 }
 
+namespace grpc_core {
+
+MutableSlice DataFrameHeaderArena::Allocate() {
+  if (block_.size() < kHeaderSize) {
+    block_ = MutableSlice::CreateUninitialized(kHeaderSize * kHeadersPerBlock);
+  }
+  return block_.TakeFirstNoInline(kHeaderSize);
+}
+
+}  // namespace grpc_core
+
+namespace {
+
+// Moves the first n bytes of src to the end of dst, appending the slices as
+// they are instead of coalescing small ones like grpc_slice_buffer_add does.
+void move_payload(grpc_slice_buffer* src, size_t n,
+                  grpc_core::Http2StatsCollector* http2_stats,
+                  grpc_slice_buffer* dst) {
+  GRPC_CHECK(src->length >= n);
+  while (n > 0) {
+    grpc_slice slice = grpc_slice_buffer_take_first(src);
+    const size_t slice_len = GRPC_SLICE_LENGTH(slice);
+    if (slice.refcount == nullptr) {
+      http2_stats->IncrementHttp2DataPayloadCopies();
+    } else {
+      http2_stats->IncrementHttp2DataPayloadReferences();
+    }
+    if (slice_len > n) {
+      grpc_slice_buffer_undo_take_first(
+          src, grpc_slice_split_tail_maybe_ref_no_inline(&slice, n,
+                                                         GRPC_SLICE_REF_TAIL));
+      n = 0;
+    } else {
+      n -= slice_len;
+    }
+    grpc_slice_buffer_add_indexed(dst, slice);
+  }
+}
+
+}  // namespace
+
 void grpc_chttp2_encode_data(uint32_t id, grpc_slice_buffer* inbuf,
                              uint32_t write_bytes, int is_eof,
                              grpc_core::CallTracerInterface* call_tracer,
                              grpc_core::Http2ZTraceCollector* ztrace_collector,
+                             grpc_core::DataFrameHeaderArena* header_arena,
+                             grpc_core::Http2StatsCollector* http2_stats,
                              grpc_slice_buffer* outbuf) {
-  grpc_slice hdr;
-  uint8_t* p;
-  static const size_t header_size = 9;
-
-  hdr = GRPC_SLICE_MALLOC(header_size);
-  p = GRPC_SLICE_START_PTR(hdr);
+  grpc_core::MutableSlice hdr = header_arena->Allocate();
+  uint8_t* p = hdr.data();
   GRPC_CHECK(write_bytes < (1 << 24));
   *p++ = static_cast<uint8_t>(write_bytes >> 16);
   *p++ = static_cast<uint8_t>(write_bytes >> 8);
@@ -73,15 +113,16 @@ void grpc_chttp2_encode_data(uint32_t id, grpc_slice_buffer* inbuf,
   *p++ = static_cast<uint8_t>(id >> 16);
   *p++ = static_cast<uint8_t>(id >> 8);
   *p++ = static_cast<uint8_t>(id);
-  grpc_slice_buffer_add(outbuf, hdr);
+  grpc_slice_buffer_add_indexed(outbuf, hdr.TakeCSlice());
 
   ztrace_collector->Append(
       grpc_core::H2DataTrace<false>{id, is_eof != 0, write_bytes});
 
-  grpc_slice_buffer_move_first_no_ref(inbuf, write_bytes, outbuf);
+  move_payload(inbuf, write_bytes, http2_stats, outbuf);
 
   grpc_core::http2_global_stats().IncrementHttp2WriteDataFrameSize(write_bytes);
-  call_tracer->RecordOutgoingBytes({header_size, 0, 0});
+  call_tracer->RecordOutgoingBytes(
+      {grpc_core::DataFrameHeaderArena::kHeaderSize, 0, 0});
 }
 
 grpc_core::Poll<grpc_error_handle> grpc_deframe_unprocessed_incoming_frames(
@@ -29,11 +29,32 @@
 #include "src/core/ext/transport/chttp2/transport/legacy_frame.h"
 #include "src/core/lib/iomgr/error.h"
 #include "src/core/lib/promise/poll.h"
+#include "src/core/lib/slice/slice.h"
 #include "src/core/lib/slice/slice_buffer.h"
 #include "src/core/lib/transport/transport.h"
 #include "src/core/telemetry/call_tracer.h"
+#include "src/core/telemetry/stats_data.h"
 #include "absl/status/status.h"
 
+namespace grpc_core {
+
+// Storage for the headers of the DATA frames a transport writes. Headers are
+// handed out as references into a shared block rather than as inlined slices,
+// so that the write buffer never coalesces the payload after a header into it.
+class DataFrameHeaderArena {
+ public:
+  static constexpr size_t kHeaderSize = 9;
+
+  MutableSlice Allocate();
+
+ private:
+  static constexpr size_t kHeadersPerBlock = 128;
+
+  MutableSlice block_;
+};
+
+}  // namespace grpc_core
+
 // start processing a new data frame
 absl::Status grpc_chttp2_data_parser_begin_frame(uint8_t flags,
                                                  uint32_t stream_id,
@@ -47,10 +68,16 @@ grpc_error_handle grpc_chttp2_data_parser_parse(void* parser,
                                                 const grpc_slice& slice,
                                                 int is_last);
 
+// Moves write_bytes of inbuf into a DATA frame at the end of outbuf. The
+// payload is never copied: its slices are appended by reference, and one that
+// straddles the end of the frame is split into two references to its bytes.
+// Only inlined slices, which hold their bytes themselves, are copied.
 void grpc_chttp2_encode_data(uint32_t id, grpc_slice_buffer* inbuf,
                              uint32_t write_bytes, int is_eof,
                              grpc_core::CallTracerInterface* call_tracer,
                              grpc_core::Http2ZTraceCollector* ztrace_collector,
+                             grpc_core::DataFrameHeaderArena* header_arena,
+                             grpc_core::Http2StatsCollector* http2_stats,
                              grpc_slice_buffer* outbuf);
 
 grpc_core::Poll<grpc_error_handle> grpc_deframe_unprocessed_incoming_frames(
@@ -38,6 +38,7 @@
 #include "src/core/lib/transport/timeout_encoding.h"
 #include "src/core/util/crash.h"
 #include "src/core/util/grpc_check.h"
+#include "absl/hash/hash.h"
 #include "absl/log/log.h"
 
 namespace grpc_core {
@@ -118,6 +119,12 @@ void HPackCompressor::Frame(const EncodeHeaderOptions& options,
   }
 }
 
+bool HPackCompressor::IsSensitiveKey(absl::string_view key) {
+  return key == "authorization" || key == "proxy-authorization" ||
+         key == "cookie" || key == "set-cookie" ||
+         absl::EndsWith(key, "-bin");
+}
+
 void HPackCompressor::SetMaxUsableSize(uint32_t max_table_size) {
   max_usable_size_ = max_table_size;
   SetMaxTableSize(std::min(table_.max_size(), max_table_size));
@@ -317,7 +324,50 @@ void HPackWriter::EmitLitHdrWithNonBinaryStringKeyNotIdx(Slice key_slice,
   output.Append(emit.data());
 }
 
+void HPackWriter::EmitLitHdrWithStringKeyNeverIdx(
+    Slice key_slice, Slice value_slice, SliceBuffer& output,
+    bool use_true_binary_metadata) {
+  const bool is_bin_hdr = absl::EndsWith(key_slice.as_string_view(), "-bin");
+  StringKey key(std::move(key_slice));
+  key.WritePrefix(0x10, output.AddTiny(key.prefix_length()));
+  output.Append(key.key());
+  if (is_bin_hdr) {
+    BinaryStringValue emit(std::move(value_slice), use_true_binary_metadata);
+    emit.WritePrefix(output.AddTiny(emit.prefix_length()));
+    output.Append(emit.data());
+    return;
+  }
+  NonBinaryStringValue emit(std::move(value_slice));
+  emit.WritePrefix(output.AddTiny(emit.prefix_length()));
+  output.Append(emit.data());
+}
+
+size_t HPackWriter::WriteLitHdrWithStringKeyIncIdx(
+    Slice key_slice, Slice value_slice, SliceBuffer& output,
+    bool use_true_binary_metadata) {
+  const size_t key_len = key_slice.length();
+  const bool is_bin_hdr = absl::EndsWith(key_slice.as_string_view(), "-bin");
+  StringKey key(std::move(key_slice));
+  key.WritePrefix(0x40, output.AddTiny(key.prefix_length()));
+  output.Append(key.key());
+  if (is_bin_hdr) {
+    BinaryStringValue emit(std::move(value_slice), use_true_binary_metadata);
+    emit.WritePrefix(output.AddTiny(emit.prefix_length()));
+    const size_t value_len = emit.hpack_length();
+    output.Append(emit.data());
+    return key_len + value_len + hpack_constants::kEntryOverhead;
+  }
+  const size_t value_len = value_slice.length();
+  NonBinaryStringValue emit(std::move(value_slice));
+  emit.WritePrefix(output.AddTiny(emit.prefix_length()));
+  output.Append(emit.data());
+  return key_len + value_len + hpack_constants::kEntryOverhead;
+}
+
 void Encoder::EmitIndexed(uint32_t elem_index) {
+  if (elem_index > hpack_constants::kLastStaticEntry) {
+    ++compressor_->stats_.dynamic_table_hits;
+  }
   VarintWriter<1> w(elem_index);
   w.Write(0x80, output_.AddTiny(w.length()));
 }
@@ -365,13 +415,146 @@ void SliceIndex::EmitTo(absl::string_view key, const Slice& value,
     }
     prev = it;
   }
+  if (!encoder->ShouldIndex(key, value.as_string_view())) {
+    encoder->EmitLitHdrWithNonBinaryStringKeyNotIdx(
+        Slice::FromStaticString(key), value.Ref());
+    return;
+  }
   // No hit, emit a new literal and add it to the index.
   uint32_t index = encoder->EmitLitHdrWithNonBinaryStringKeyIncIdx(
       Slice::FromStaticString(key), value.Ref());
   values_.emplace_back(value.Ref(), index);
 }
 
+uint32_t Encoder::EmitEncodedLitHdrIncIdx(const Slice& literal,
+                                          size_t entry_size) {
+  ++compressor_->stats_.dynamic_table_inserts;
+  output_.Append(literal.Ref());
+  return compressor_->table_.AllocateIndex(entry_size);
+}
+
+void EncodedHeaderCache::AddStatic(Slice key, Slice value) {
+  if (HPackCompressor::IsSensitiveKey(key.as_string_view()) ||
+      hpack_constants::SizeForEntry(key.size(), value.size()) >
+          HPackEncoderTable::MaxEntrySize()) {
+    return;
+  }
+  for (const auto& entry : declared_) {
+    if (entry.key == key && entry.value == value) return;
+  }
+  declared_.emplace_back(std::move(key), std::move(value));
+}
+
+bool EncodedHeaderCache::MaybeEmit(const Slice& key, const Slice& value,
+                                   Encoder* encoder) {
+  for (auto& entry : declared_) {
+    if (entry.key == key && entry.value == value) {
+      Emit(entry, encoder);
+      return true;
+    }
+  }
+  if (value.c_slice().refcount != grpc_slice_refcount::NoopRefcount()) {
+    return false;
+  }
+  if (hpack_constants::SizeForEntry(key.size(), value.size()) >
+      HPackEncoderTable::MaxEntrySize()) {
+    return false;
+  }
+  // Static values are matched by content: the application may release the
+  // memory behind them (grpc++ wraps its strings in static slices), so the
+  // cache keeps copies of its own.
+  const uint64_t hash =
+      absl::HashOf(key.as_string_view(), value.as_string_view());
+  auto it = static_values_.find(hash);
+  if (it != static_values_.end()) {
+    // Leave pairs whose hash collides with a cached one to the caller.
+    if (it->second.key != key || it->second.value != value) return false;
+  } else {
+    // Leave pairs that adaptive indexing already caches to it.
+    if (by_content_.contains(hash)) return false;
+    // Only start caching the pair once it is sent again.
+    if (static_values_seen_.insert(hash).second) {
+      if (static_values_seen_.size() > kMaxStaticValuesSeen) {
+        static_values_seen_.clear();
+        static_values_seen_.insert(hash);
+      }
+      return false;
+    }
+    if (static_values_.size() >= kMaxStaticValueEntries) return false;
+    static_values_seen_.erase(hash);
+    it = static_values_.emplace(hash, Entry(key.Copy(), value.Copy())).first;
+  }
+  Emit(it->second, encoder);
+  return true;
+}
+
+bool EncodedHeaderCache::MaybeEmitRepeated(const Slice& key,
+                                           const Slice& value,
+                                           Encoder* encoder) {
+  const size_t entry_size =
+      hpack_constants::SizeForEntry(key.size(), value.size());
+  if (entry_size > HPackEncoderTable::MaxEntrySize()) return false;
+  const uint64_t hash =
+      absl::HashOf(key.as_string_view(), value.as_string_view());
+  auto& table = encoder->hpack_table();
+  auto it = by_content_.find(hash);
+  if (it != by_content_.end()) {
+    // Leave pairs whose hash collides with a cached one to the caller.
+    if (it->second.key != key || it->second.value != value) return false;
+    if (!table.ConvertibleToDynamicIndex(it->second.index) &&
+        !encoder->ShouldIndex(hash, entry_size)) {
+      return false;
+    }
+  } else {
+    if (!encoder->ShouldIndex(hash, entry_size)) return false;
+    if (by_content_.size() >= kMaxContentEntries) {
+      // Make room by forgetting the pairs that were evicted from the table.
+      for (auto evict = by_content_.begin(); evict != by_content_.end();) {
+        if (table.ConvertibleToDynamicIndex(evict->second.index)) {
+          ++evict;
+        } else {
+          by_content_.erase(evict++);
+        }
+      }
+      if (by_content_.size() >= kMaxContentEntries) return false;
+    }
+    // Keep copies: the slices may not own their memory.
+    it = by_content_.emplace(hash, Entry(key.Copy(), value.Copy())).first;
+  }
+  Emit(it->second, encoder);
+  return true;
+}
+
+void EncodedHeaderCache::Emit(Entry& entry, Encoder* encoder) {
+  auto& table = encoder->hpack_table();
+  if (table.ConvertibleToDynamicIndex(entry.index)) {
+    encoder->EmitIndexed(table.DynamicIndex(entry.index));
+    return;
+  }
+  if (entry.literal.empty() || entry.literal_uses_true_binary_metadata !=
+                                   encoder->use_true_binary_metadata()) {
+    SliceBuffer literal;
+    entry.entry_size = HPackWriter::WriteLitHdrWithStringKeyIncIdx(
+        entry.key.Ref(), entry.value.Ref(), literal,
+        encoder->use_true_binary_metadata());
+    entry.literal = literal.JoinIntoSlice();
+    entry.literal_uses_true_binary_metadata =
+        encoder->use_true_binary_metadata();
+  }
+  entry.index = encoder->EmitEncodedLitHdrIncIdx(entry.literal,
+                                                 entry.entry_size);
+}
+
 void Encoder::Encode(const Slice& key, const Slice& value) {
+  if (HPackCompressor::IsSensitiveKey(key.as_string_view())) {
+    EmitLitHdrWithStringKeyNeverIdx(key.Ref(), value.Ref());
+    return;
+  }
+  if (compressor_->header_cache_.MaybeEmit(key, value, this)) return;
+  if (compressor_->reuse_sketch_ != nullptr &&
+      compressor_->header_cache_.MaybeEmitRepeated(key, value, this)) {
+    return;
+  }
   if (absl::EndsWith(key.as_string_view(), "-bin")) {
     EmitLitHdrWithBinaryStringKeyNotIdx(key.Ref(), value.Ref());
   } else {
@@ -463,6 +646,19 @@ void Encoder::EncodeAlwaysIndexed(uint32_t* index, absl::string_view key,
   }
 }
 
+bool Encoder::ShouldIndex(absl::string_view key, absl::string_view value) {
+  if (compressor_->reuse_sketch_ == nullptr) return true;
+  return ShouldIndex(absl::HashOf(key, value),
+                     hpack_constants::SizeForEntry(key.size(), value.size()));
+}
+
+bool Encoder::ShouldIndex(uint64_t hash, size_t entry_size) {
+  HPackReuseSketch* sketch = compressor_->reuse_sketch_.get();
+  if (sketch == nullptr) return true;
+  return sketch->Record(hash) > 0 ||
+         compressor_->table_.HasRoomFor(entry_size);
+}
+
 void Encoder::EncodeIndexedKeyWithBinaryValue(uint32_t* index,
                                               absl::string_view key,
                                               Slice value) {
@@ -503,6 +699,11 @@ void TimeoutCompressorImpl::EncodeWith(absl::string_view key,
     }
   }
   Slice encoded = timeout.Encode();
+  if (!encoder->ShouldIndex(key, encoded.as_string_view())) {
+    encoder->EmitLitHdrWithNonBinaryStringKeyNotIdx(
+        Slice::FromStaticString(key), std::move(encoded));
+    return;
+  }
   uint32_t index = encoder->EmitLitHdrWithNonBinaryStringKeyIncIdx(
       Slice::FromStaticString(key), std::move(encoded));
   uint32_t i = next_previous_value_;
@@ -24,11 +24,13 @@
 #include <stddef.h>
 
 #include <cstdint>
+#include <memory>
 #include <utility>
 #include <vector>
 
 #include "src/core/call/metadata_batch.h"
 #include "src/core/call/metadata_compression_traits.h"
+#include "src/core/channelz/property_list.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_constants.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_encoder_table.h"
 #include "src/core/ext/transport/chttp2/transport/http2_ztrace_collector.h"
@@ -38,6 +40,8 @@
 #include "src/core/lib/transport/transport.h"
 #include "src/core/telemetry/call_tracer.h"
 #include "src/core/util/time.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/container/flat_hash_set.h"
 #include "absl/log/log.h"
 #include "absl/strings/match.h"
 #include "absl/strings/str_cat.h"
@@ -68,6 +72,19 @@ struct HPackWriter {
   static void EmitLitHdrWithNonBinaryStringKeyNotIdx(Slice key_slice,
                                                      Slice value_slice,
                                                      SliceBuffer& output);
+  // Writes a literal that neither this table nor that of any intermediary
+  // may add key and value to.
+  static void EmitLitHdrWithStringKeyNeverIdx(Slice key_slice,
+                                              Slice value_slice,
+                                              SliceBuffer& output,
+                                              bool use_true_binary_metadata);
+  // Writes a literal that adds key and value to the HPACK table, but leaves
+  // allocating its index to whoever emits it. Returns the size of the table
+  // entry.
+  static size_t WriteLitHdrWithStringKeyIncIdx(Slice key_slice,
+                                               Slice value_slice,
+                                               SliceBuffer& output,
+                                               bool use_true_binary_metadata);
 };
 
 class Encoder {
@@ -92,6 +109,10 @@ class Encoder {
                                            Slice value_slice);
   void EmitLitHdrWithNonBinaryStringKeyNotIdx(Slice key_slice,
                                               Slice value_slice);
+  void EmitLitHdrWithStringKeyNeverIdx(Slice key_slice, Slice value_slice);
+  // Emits a literal written by HPackWriter::WriteLitHdrWithStringKeyIncIdx.
+  GRPC_MUST_USE_RESULT
+  uint32_t EmitEncodedLitHdrIncIdx(const Slice& literal, size_t entry_size);
 
   void EncodeAlwaysIndexed(uint32_t* index, absl::string_view key, Slice value,
                            size_t transport_length);
@@ -102,10 +123,17 @@ class Encoder {
                                  const Slice& slice, uint32_t* index,
                                  size_t max_compression_size);
 
+  // Whether a header that is not in the HPACK table should be added to it,
+  // rather than sent as a literal that is not indexed. Always true unless the
+  // compressor indexes adaptively.
+  bool ShouldIndex(absl::string_view key, absl::string_view value);
+  bool ShouldIndex(uint64_t hash, size_t entry_size);
+
   void NoteEncodingError() { saw_encoding_errors_ = true; }
   bool saw_encoding_errors() const { return saw_encoding_errors_; }
 
   HPackEncoderTable& hpack_table();
+  bool use_true_binary_metadata() const { return use_true_binary_metadata_; }
 
  private:
   const bool use_true_binary_metadata_;
@@ -198,15 +226,16 @@ class Compressor<MetadataTrait, StableValueCompressor> {
       encoder->EmitIndexed(table.DynamicIndex(previously_sent_index_));
       return;
     }
-    previously_sent_index_ = 0;
     auto key = MetadataTrait::key();
     const Slice& value_slice = MetadataValueAsSlice<MetadataTrait>(value);
     if (hpack_constants::SizeForEntry(key.size(), value_slice.size()) >
-        HPackEncoderTable::MaxEntrySize()) {
+            HPackEncoderTable::MaxEntrySize() ||
+        !encoder->ShouldIndex(key, value_slice.as_string_view())) {
       encoder->EmitLitHdrWithNonBinaryStringKeyNotIdx(
           Slice::FromStaticString(key), value_slice.Ref());
       return;
     }
+    previously_sent_index_ = 0;
     encoder->EncodeAlwaysIndexed(
         &previously_sent_index_, key, value_slice.Ref(),
         hpack_constants::SizeForEntry(key.size(), value_slice.size()));
@@ -344,6 +373,58 @@ class Compressor<HttpSchemeMetadata, HttpSchemeCompressor> {
                   Encoder* encoder);
 };
 
+// Caches the encoding of metadata that is not known to the metadata batch,
+// and that is sent unchanged on many streams of a connection: pairs declared
+// with HPackCompressor::AddStaticMetadata, and pairs whose value is a static
+// slice once they are sent a second time, both matched by content. The
+// first time a cached pair is sent it is added to the HPACK table with a
+// literal that is encoded once and kept. After that it is sent as an index for
+// as long as it stays in the table, and as the kept literal again once it has
+// been evicted.
+// When the compressor indexes adaptively, other pairs are also cached, by
+// content, once Encoder::ShouldIndex admits them to the table.
+class EncodedHeaderCache {
+ public:
+  void AddStatic(Slice key, Slice value);
+  // Emits key and value and returns true if they are cached, or can be;
+  // otherwise leaves them for the caller.
+  bool MaybeEmit(const Slice& key, const Slice& value, Encoder* encoder);
+  // Like MaybeEmit, for pairs that are repeated on the connection however
+  // their slices were made.
+  bool MaybeEmitRepeated(const Slice& key, const Slice& value,
+                         Encoder* encoder);
+
+ private:
+  struct Entry {
+    Entry(Slice key, Slice value)
+        : key(std::move(key)), value(std::move(value)) {}
+    Slice key;
+    Slice value;
+    // The literal adding the pair to the table, once encoded; -bin values are
+    // encoded differently with and without true binary metadata.
+    Slice literal;
+    bool literal_uses_true_binary_metadata = false;
+    size_t entry_size = 0;
+    // The pair's index in the table.
+    uint32_t index = 0;
+  };
+
+  // Bounds the number of cached pairs with a static value.
+  static constexpr size_t kMaxStaticValueEntries = 64;
+  // Bounds the number of pairs with a static value that were sent once.
+  static constexpr size_t kMaxStaticValuesSeen = 256;
+  // Bounds the number of content matched pairs.
+  static constexpr size_t kMaxContentEntries = 128;
+
+  static void Emit(Entry& entry, Encoder* encoder);
+
+  std::vector<Entry> declared_;
+  // These are keyed by the hash of key and value.
+  absl::flat_hash_map<uint64_t, Entry> static_values_;
+  absl::flat_hash_set<uint64_t> static_values_seen_;
+  absl::flat_hash_map<uint64_t, Entry> by_content_;
+};
+
 }  // namespace hpack_encoder_detail
 
 class HPackCompressor {
@@ -364,6 +445,57 @@ class HPackCompressor {
   void SetMaxTableSize(uint32_t max_table_size);
   void SetMaxUsableSize(uint32_t max_table_size);
 
+  // Whether metadata with this key may carry credentials: authorization and
+  // cookie headers, and binary metadata. The encoder never adds such metadata
+  // that the metadata batch does not know to the HPACK table, and sends it as
+  // a literal that intermediaries must not index either, so that its value
+  // cannot be guessed from the size of compressed headers (RFC 7541 section
+  // 7.1.3).
+  static bool IsSensitiveKey(absl::string_view key);
+
+  // Declares metadata that is sent unchanged on many streams of the
+  // connection, so that it is encoded once for the connection rather than
+  // once per stream. Only applies to keys that the metadata batch does not
+  // know, and that are not sensitive.
+  void AddStaticMetadata(Slice key, Slice value) {
+    header_cache_.AddStatic(std::move(key), std::move(value));
+  }
+
+  // Only adds a header to the HPACK table if it was sent on the connection
+  // before, or if adding it evicts nothing, instead of adding every value of
+  // the headers that are usually stable: values that are only sent once would
+  // evict the ones that are reused. Metadata that the metadata batch does not
+  // know is added to the table too once it is repeated.
+  void EnableAdaptiveIndexing() {
+    reuse_sketch_ = std::make_unique<HPackReuseSketch>();
+  }
+
+  // Counts of how the headers sent on the connection were encoded. Headers
+  // sent as an index into the static table are not counted.
+  struct Stats {
+    // Sent as an index into the dynamic table.
+    uint64_t dynamic_table_hits = 0;
+    // Sent as a literal that is added to the dynamic table.
+    uint64_t dynamic_table_inserts = 0;
+    // Sent as a literal that is not added to the dynamic table.
+    uint64_t literals = 0;
+
+    double dynamic_table_hit_rate() const {
+      const uint64_t total =
+          dynamic_table_hits + dynamic_table_inserts + literals;
+      return total == 0 ? 0.0 : static_cast<double>(dynamic_table_hits) / total;
+    }
+    channelz::PropertyList ChannelzProperties() const {
+      return channelz::PropertyList()
+          .Set("dynamic_table_hits", dynamic_table_hits)
+          .Set("dynamic_table_inserts", dynamic_table_inserts)
+          .Set("literals", literals)
+          .Set("dynamic_table_hit_rate", dynamic_table_hit_rate());
+    }
+  };
+
+  const Stats& stats() const { return stats_; }
+
   uint32_t test_only_table_size() const {
     return table_.test_only_table_size();
   }
@@ -415,6 +547,10 @@ class HPackCompressor {
 
   grpc_metadata_batch::StatefulCompressor<hpack_encoder_detail::Compressor>
       compression_state_;
+  hpack_encoder_detail::EncodedHeaderCache header_cache_;
+  // Set if the compressor indexes adaptively.
+  std::unique_ptr<HPackReuseSketch> reuse_sketch_;
+  Stats stats_;
 };
 
 namespace hpack_encoder_detail {
@@ -429,6 +565,7 @@ void Encoder::Encode(MetadataTrait,
 
 inline uint32_t Encoder::EmitLitHdrWithNonBinaryStringKeyIncIdx(
     Slice key_slice, Slice value_slice) {
+  ++compressor_->stats_.dynamic_table_inserts;
   return HPackWriter::EmitLitHdrWithNonBinaryStringKeyIncIdx(
       std::move(key_slice), std::move(value_slice), output_,
       compressor_->table_);
@@ -436,6 +573,7 @@ inline uint32_t Encoder::EmitLitHdrWithNonBinaryStringKeyIncIdx(
 
 inline void Encoder::EmitLitHdrWithBinaryStringKeyNotIdx(Slice key_slice,
                                                          Slice value_slice) {
+  ++compressor_->stats_.literals;
   HPackWriter::EmitLitHdrWithBinaryStringKeyNotIdx(
       std::move(key_slice), std::move(value_slice), output_,
       use_true_binary_metadata_);
@@ -443,6 +581,7 @@ inline void Encoder::EmitLitHdrWithBinaryStringKeyNotIdx(Slice key_slice,
 
 inline uint32_t Encoder::EmitLitHdrWithBinaryStringKeyIncIdx(
     Slice key_slice, Slice value_slice) {
+  ++compressor_->stats_.dynamic_table_inserts;
   return HPackWriter::EmitLitHdrWithBinaryStringKeyIncIdx(
       std::move(key_slice), std::move(value_slice), output_,
       compressor_->table_, use_true_binary_metadata_);
@@ -450,16 +589,26 @@ inline uint32_t Encoder::EmitLitHdrWithBinaryStringKeyIncIdx(
 
 inline void Encoder::EmitLitHdrWithBinaryStringKeyNotIdx(uint32_t key_index,
                                                          Slice value_slice) {
+  ++compressor_->stats_.literals;
   HPackWriter::EmitLitHdrWithBinaryStringKeyNotIdx(
       key_index, std::move(value_slice), output_, use_true_binary_metadata_);
 }
 
 inline void Encoder::EmitLitHdrWithNonBinaryStringKeyNotIdx(Slice key_slice,
                                                             Slice value_slice) {
+  ++compressor_->stats_.literals;
   HPackWriter::EmitLitHdrWithNonBinaryStringKeyNotIdx(
       std::move(key_slice), std::move(value_slice), output_);
 }
 
+inline void Encoder::EmitLitHdrWithStringKeyNeverIdx(Slice key_slice,
+                                                     Slice value_slice) {
+  ++compressor_->stats_.literals;
+  HPackWriter::EmitLitHdrWithStringKeyNeverIdx(
+      std::move(key_slice), std::move(value_slice), output_,
+      use_true_binary_metadata_);
+}
+
 inline HPackEncoderTable& Encoder::hpack_table() { return compressor_->table_; }
 
 }  // namespace hpack_encoder_detail
@@ -17,6 +17,7 @@
 #include <grpc/support/port_platform.h>
 
 #include <algorithm>
+#include <limits>
 
 #include "src/core/util/grpc_check.h"
 
@@ -88,4 +89,29 @@ void HPackEncoderTable::Rebuild(uint32_t capacity) {
   elem_size_.swap(new_elem_size);
 }
 
+uint8_t HPackReuseSketch::Record(uint64_t hash) {
+  uint8_t* counts[kRows];
+  uint8_t estimate = std::numeric_limits<uint8_t>::max();
+  for (size_t row = 0; row < kRows; ++row) {
+    // Each row is indexed by different bits of the hash.
+    counts[row] =
+        &counts_[row][(hash >> (row * kColumnBits)) & (kColumns - 1)];
+    estimate = std::min(estimate, *counts[row]);
+  }
+  // Conservative update: only the smallest counts grow, so that headers that
+  // collide with frequent ones are not overestimated as much.
+  if (estimate < std::numeric_limits<uint8_t>::max()) {
+    for (uint8_t* count : counts) {
+      if (*count == estimate) ++*count;
+    }
+  }
+  if (++records_ == kHalvingPeriod) {
+    records_ = 0;
+    for (auto& row : counts_) {
+      for (uint8_t& count : row) count >>= 1;
+    }
+  }
+  return estimate;
+}
+
 }  // namespace grpc_core
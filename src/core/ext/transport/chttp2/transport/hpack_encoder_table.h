@@ -50,6 +50,10 @@ class HPackEncoderTable {
   uint32_t test_only_table_size() const { return table_size_; }
   // Get the number of entries in the table
   uint32_t test_only_table_elems() const { return table_elems_; }
+  // Check if an element of this size can be added without evicting any
+  bool HasRoomFor(size_t element_size) const {
+    return table_size_ + element_size <= max_table_size_;
+  }
 
   // Convert an element index into a dynamic index
   uint32_t DynamicIndex(uint32_t index) const {
@@ -75,6 +79,27 @@ class HPackEncoderTable {
   std::vector<EntrySize> elem_size_;
 };
 
+// A count-min sketch of the headers sent on a connection, so that the encoder
+// only adds to the HPACK table values that are likely to be sent again: values
+// that differ on every call, like request ids, would otherwise evict entries
+// that are reused.
+class HPackReuseSketch {
+ public:
+  // Counts a send of the header with this hash, and returns an estimate of
+  // how many times it was sent before. Counts saturate, and are halved
+  // periodically so that headers that are no longer sent are forgotten.
+  uint8_t Record(uint64_t hash);
+
+ private:
+  static constexpr size_t kRows = 4;
+  static constexpr size_t kColumnBits = 9;
+  static constexpr size_t kColumns = size_t{1} << kColumnBits;
+  static constexpr uint32_t kHalvingPeriod = 8 * kColumns;
+
+  uint8_t counts_[kRows][kColumns] = {};
+  uint32_t records_ = 0;
+};
+
 }  // namespace grpc_core
 
 #endif  // GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_HPACK_ENCODER_TABLE_H
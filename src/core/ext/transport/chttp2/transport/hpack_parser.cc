@@ -32,7 +32,8 @@
 
 #include "src/core/call/metadata_info.h"
 #include "src/core/call/parsed_metadata.h"
-#include "src/core/ext/transport/chttp2/transport/decode_huff.h"
+#include "src/core/ext/transport/chttp2/transport/base64_simd.h"
+#include "src/core/ext/transport/chttp2/transport/decode_huff_multi.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_constants.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_parse_result.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_parser_table.h"
@@ -47,6 +48,7 @@
 #include "src/core/util/match.h"
 #include "absl/base/attributes.h"
 #include "absl/log/log.h"
+#include "absl/numeric/bits.h"
 #include "absl/status/status.h"
 #include "absl/strings/match.h"
 #include "absl/strings/str_cat.h"
@@ -135,8 +137,22 @@ class HPackParser::Input {
   // Helper to parse a varint delta on top of value, return nullopt on failure
   // (setting error)
   std::optional<uint32_t> ParseVarint(uint32_t value) {
-    // TODO(ctiller): break out a variant of this when we know there are at
-    // least 5 bytes in input_
+    // Fast path: when four bytes are buffered, decode varints of up to four
+    // bytes all at once.
+    if (remaining() >= 4) {
+      const uint32_t bytes =
+          uint32_t{begin_[0]} | (uint32_t{begin_[1]} << 8) |
+          (uint32_t{begin_[2]} << 16) | (uint32_t{begin_[3]} << 24);
+      // The varint ends at the first byte without the continuation bit.
+      const uint32_t last = ~bytes & 0x80808080u;
+      if (GPR_LIKELY(last != 0)) {
+        const int length = absl::countr_zero(last) / 8 + 1;
+        const uint32_t v = bytes & (0xffffffffu >> (32 - 8 * length));
+        begin_ += length;
+        return value + ((v & 0x7f) | ((v >> 1) & 0x3f80) |
+                        ((v >> 2) & 0x1fc000) | ((v >> 3) & 0xfe00000));
+      }
+    }
     auto cur = Next();
     if (!cur) return {};
     value += *cur & 0x7f;
@@ -362,7 +378,7 @@ HpackParseStatus HPackParser::String::ParseHuff(Input* input, uint32_t length,
   // Grab the byte range, and iterate through it.
   const uint8_t* p = input->cur_ptr();
   input->Advance(length);
-  return HuffDecoder<Out>(output, p, p + length).Run()
+  return HuffMultiDecoder<Out>(output, p, p + length).Run()
              ? HpackParseStatus::kOk
              : HpackParseStatus::kParseHuffFailed;
 }
@@ -405,6 +421,13 @@ std::optional<std::vector<uint8_t>> HPackParser::String::Unbase64Loop(
   std::vector<uint8_t> out;
   out.reserve((3 * (end - cur) / 4) + 3);
 
+  // Decode whole vector blocks first; anything they stop at is left to the
+  // loops below, which also report any invalid characters.
+  out.resize(3 * ((end - cur) / 4));
+  const size_t decoded = DecodeBase64Blocks(cur, end - cur, out.data());
+  cur += decoded;
+  out.resize(decoded / 4 * 3);
+
   // Decode 4 bytes at a time while we can
   while (end - cur >= 4) {
     uint32_t bits = kBase64InverseTable.table[*cur];
@@ -502,6 +525,10 @@ HPackParser::String::StringResult HPackParser::String::Parse(Input* input,
   if (is_huff) {
     // Huffman coded
     std::vector<uint8_t> output;
+    // The shortest code is five bits long. Only reserve once the whole string
+    // has arrived: until then ParseHuff reports EOF, and the length is just a
+    // claim from the peer.
+    if (input->remaining() >= length) output.reserve(length * 8 / 5);
     HpackParseStatus sts =
         ParseHuff(input, length, [&output](uint8_t c) { output.push_back(c); });
     size_t wire_len = output.size();
@@ -868,6 +895,16 @@ class HPackParser::Parser {
     }
     input_->UpdateFrontier();
     state_.parse_state = ParseState::kParsingValueLength;
+    // A literal key that is in the static table is parsed as if it was sent
+    // as an index: it needs neither validating nor keeping.
+    const uint32_t static_index =
+        HPackTable::StaticKeyIndex(key.value.string_view());
+    if (static_index != 0) {
+      const auto* elem = state_.hpack_table.Lookup(static_index);
+      state_.is_binary_header = elem->md.is_binary_header();
+      state_.key.emplace<const HPackTable::Memento*>(elem);
+      return ParseValueLength();
+    }
     state_.is_binary_header = absl::EndsWith(key.value.string_view(), "-bin");
     state_.key.emplace<Slice>(key.value.Take());
     return ParseValueLength();
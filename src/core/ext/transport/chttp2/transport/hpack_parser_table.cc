@@ -208,7 +208,7 @@ struct StaticTableEntry {
   const char* value;
 };
 
-const StaticTableEntry kStaticTable[hpack_constants::kLastStaticEntry] = {
+constexpr StaticTableEntry kStaticTable[hpack_constants::kLastStaticEntry] = {
     {":authority", ""},
     {":method", "GET"},
     {":method", "POST"},
@@ -272,6 +272,42 @@ const StaticTableEntry kStaticTable[hpack_constants::kLastStaticEntry] = {
     {"www-authenticate", ""},
 };
 
+// Literal keys are looked up in the static table by a perfect hash of their
+// distinct keys; the constants were found by search.
+constexpr size_t kStaticKeySlots = 128;
+
+constexpr size_t StaticKeySlot(absl::string_view key) {
+  return (key.size() * 27 + static_cast<uint8_t>(key[1]) +
+          static_cast<uint8_t>(key[key.size() - 1]) * 11 +
+          static_cast<uint8_t>(key[key.size() - 2]) * 20) %
+         kStaticKeySlots;
+}
+
+struct StaticKeyTable {
+  // For each slot, one plus the index of the first static table entry whose
+  // key hashes to it, or zero.
+  uint8_t entry[kStaticKeySlots] = {};
+  bool perfect = true;
+};
+
+constexpr StaticKeyTable MakeStaticKeyTable() {
+  StaticKeyTable table;
+  for (size_t i = 0; i < hpack_constants::kLastStaticEntry; i++) {
+    const absl::string_view key = kStaticTable[i].key;
+    uint8_t& slot = table.entry[StaticKeySlot(key)];
+    if (slot == 0) {
+      slot = static_cast<uint8_t>(i + 1);
+    } else if (absl::string_view(kStaticTable[slot - 1].key) != key) {
+      table.perfect = false;
+    }
+  }
+  return table;
+}
+
+constexpr StaticKeyTable kStaticKeyTable = MakeStaticKeyTable();
+static_assert(kStaticKeyTable.perfect,
+              "static table keys must hash to distinct slots");
+
 HPackTable::Memento MakeMemento(size_t i) {
   auto sm = kStaticTable[i];
   return HPackTable::Memento{
@@ -286,6 +322,13 @@ HPackTable::Memento MakeMemento(size_t i) {
 
 }  // namespace
 
+uint32_t HPackTable::StaticKeyIndex(absl::string_view key) {
+  if (key.size() < 2) return 0;
+  const uint32_t index = kStaticKeyTable.entry[StaticKeySlot(key)];
+  if (index == 0 || kStaticTable[index - 1].key != key) return 0;
+  return index;
+}
+
 HPackTable::StaticMementos::StaticMementos() {
   for (uint32_t i = 0; i < hpack_constants::kLastStaticEntry; i++) {
     memento[i] = MakeMemento(i);
@@ -36,6 +36,7 @@
 #include "src/core/util/no_destruct.h"
 #include "src/core/util/unique_ptr_with_bitset.h"
 #include "absl/functional/function_ref.h"
+#include "absl/strings/string_view.h"
 
 namespace grpc_core {
 
@@ -79,6 +80,10 @@ class HPackTable {
     }
   }
 
+  // Index of the first static table entry with this key, or 0 if no static
+  // table entry has it.
+  static uint32_t StaticKeyIndex(absl::string_view key);
+
   // add a table entry to the index
   GRPC_MUST_USE_RESULT bool Add(Memento md);
   void AddLargerThanCurrentTableSize();
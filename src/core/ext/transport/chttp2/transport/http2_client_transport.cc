@@ -1118,6 +1118,7 @@ absl::Status Http2ClientTransport::DequeueStreamFrames(
                             frame_sender);
   ProcessOutgoingDataFrameFlowControl(stream->flow_control,
                                       result.flow_control_tokens_consumed);
+  writable_stream_list_.RecordBytesWritten(result.flow_control_tokens_consumed);
   if (result.is_writable) {
     // Stream is still writable. Enqueue it back to the writable
     // stream list.
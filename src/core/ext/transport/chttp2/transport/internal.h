@@ -39,6 +39,7 @@
 #include "src/core/channelz/channelz.h"
 #include "src/core/ext/transport/chttp2/transport/call_tracer_wrapper.h"
 #include "src/core/ext/transport/chttp2/transport/flow_control.h"
+#include "src/core/ext/transport/chttp2/transport/frame_data.h"
 #include "src/core/ext/transport/chttp2/transport/frame_goaway.h"
 #include "src/core/ext/transport/chttp2/transport/frame_ping.h"
 #include "src/core/ext/transport/chttp2/transport/frame_rst_stream.h"
@@ -376,6 +377,18 @@ struct grpc_chttp2_transport final : public grpc_core::FilterStackTransport,
 
   /// incoming read bytes
   grpc_slice_buffer read_buffer;
+  /// with pipelined reads, the endpoint reads the next bytes into
+  /// read_ahead_buffer while read_buffer is parsed
+  bool pipelined_reads = false;
+  grpc_slice_buffer read_ahead_buffer;
+  grpc_closure read_ahead_done;
+  /// a read into read_ahead_buffer is outstanding
+  bool read_ahead_outstanding = false;
+  /// a read into read_ahead_buffer finished, with this result, while
+  /// read_buffer was being parsed or reading was paused
+  std::optional<grpc_error_handle> read_ahead_result;
+  /// read_buffer is being parsed
+  bool parsing_read_buffer = false;
 
   /// address to place a newly accepted stream - set and unset by
   /// grpc_chttp2_parsing_accept_stream; used by init_stream to
@@ -401,6 +414,8 @@ struct grpc_chttp2_transport final : public grpc_core::FilterStackTransport,
 
   /// data to write now
   grpc_core::SliceBuffer outbuf;
+  /// headers of the DATA frames in outbuf
+  grpc_core::DataFrameHeaderArena data_frame_headers;
   /// hpack encoding
   grpc_core::HPackCompressor hpack_compressor;
 
@@ -565,6 +580,12 @@ struct grpc_chttp2_transport final : public grpc_core::FilterStackTransport,
 
   /// policy for how much data we're willing to put into one http2 write
   grpc_core::Chttp2WriteSizePolicy write_size_policy;
+  /// holds back writes so that the frames of concurrent calls share them
+  grpc_core::Chttp2WriteCombiner write_combiner;
+  grpc_event_engine::experimental::EventEngine::TaskHandle
+      write_combining_timer_handle =
+          grpc_event_engine::experimental::EventEngine::TaskHandle::kInvalid;
+  grpc_closure write_combining_timer_locked;
 
   bool reading_paused_on_pending_induced_frames = false;
   /// Based on channel args, preferred_rx_crypto_frame_sizes are advertised to
@@ -23,6 +23,7 @@
 
 #include <atomic>
 #include <cstdint>
+#include <optional>
 #include <string>
 #include <utility>
 
@@ -36,11 +37,13 @@
 #include "src/core/ext/transport/chttp2/transport/http2_status.h"
 #include "src/core/ext/transport/chttp2/transport/message_assembler.h"
 #include "src/core/ext/transport/chttp2/transport/stream_data_queue.h"
+#include "src/core/ext/transport/chttp2/transport/transport_common.h"
 #include "src/core/ext/transport/chttp2/transport/write_cycle.h"
 #include "src/core/util/grpc_check.h"
 #include "src/core/util/ref_counted.h"
 #include "src/core/util/ref_counted_ptr.h"
 #include "absl/log/log.h"
+#include "absl/strings/string_view.h"
 
 namespace grpc_core {
 namespace http2 {
@@ -71,6 +74,7 @@ struct Stream : public RefCounted<Stream> {
         did_receive_initial_metadata(false),
         did_receive_trailing_metadata(false),
         did_push_server_trailing_metadata(false),
+        urgency(kDefaultUrgency),
         data_queue(MakeRefCounted<StreamDataQueue<ClientMetadataHandle>>(
             /*is_client*/ true,
             /*queue_size*/ kStreamQueueSize)),
@@ -101,6 +105,12 @@ struct Stream : public RefCounted<Stream> {
 
   auto EnqueueInitialMetadata(ClientMetadataHandle&& metadata) {
     GRPC_HTTP2_STREAM_LOG << "Stream::EnqueueInitialMetadata";
+    std::string buffer;
+    std::optional<absl::string_view> priority =
+        metadata->GetStringValue(kPriorityHeader, &buffer);
+    if (priority.has_value()) {
+      urgency.store(ParseUrgency(*priority), std::memory_order_relaxed);
+    }
     return data_queue->EnqueueInitialMetadata(std::move(metadata));
   }
 
@@ -231,6 +241,10 @@ struct Stream : public RefCounted<Stream> {
 
   inline uint32_t GetStreamId() const { return stream_id; }
 
+  inline uint8_t GetUrgency() const {
+    return urgency.load(std::memory_order_relaxed);
+  }
+
   inline bool IsClosedForWrites() const {
     return is_write_closed.load(std::memory_order_relaxed);
   }
@@ -289,6 +303,9 @@ struct Stream : public RefCounted<Stream> {
   bool did_receive_initial_metadata;
   bool did_receive_trailing_metadata;
   bool did_push_server_trailing_metadata;
+  // Set from the priority header of the initial metadata, and read by the
+  // transport party when scheduling writes.
+  std::atomic<uint8_t> urgency;
   // TODO(akshitpatel) : [PH2][P3][Server] : This would need to change to
   // accomodate ServerMetadataHandle for the server side.
   RefCountedPtr<StreamDataQueue<ClientMetadataHandle>> data_queue;
@@ -23,6 +23,8 @@
 #include "src/core/util/shared_bit_gen.h"
 #include "src/core/util/time.h"
 #include "absl/random/random.h"
+#include "absl/strings/ascii.h"
+#include "absl/strings/str_split.h"
 
 namespace grpc_core {
 
@@ -32,4 +34,23 @@ Duration TarpitDuration(const int min_tarpit_duration_ms,
       SharedBitGen(), min_tarpit_duration_ms, max_tarpit_duration_ms));
 }
 
+namespace http2 {
+
+uint8_t ParseUrgency(absl::string_view priority) {
+  // The value is a structured field dictionary (RFC 8941): comma separated
+  // members, of which only "u" is of interest. Invalid members are ignored,
+  // and so is an invalid urgency (RFC 9218 section 4).
+  uint8_t urgency = kDefaultUrgency;
+  for (absl::string_view member : absl::StrSplit(priority, ',')) {
+    member = absl::StripAsciiWhitespace(member);
+    if (member.size() == 3 && member[0] == 'u' && member[1] == '=' &&
+        member[2] >= '0' && member[2] < '0' + kNumUrgencies) {
+      urgency = member[2] - '0';
+    }
+  }
+  return urgency;
+}
+
+}  // namespace http2
+
 }  // namespace grpc_core
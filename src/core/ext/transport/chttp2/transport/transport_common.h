@@ -20,8 +20,10 @@
 #define GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_TRANSPORT_COMMON_H
 
 #include <cstdint>
+#include <string>
 
 #include "src/core/util/time.h"
+#include "absl/strings/string_view.h"
 
 // For an HTTP2 connection, this must be sent before the settings frame is sent.
 #define GRPC_CHTTP2_CLIENT_CONNECT_STRING "PRI * HTTP/2.0\r\n\r\nSM\r\n\r\n"
@@ -58,6 +60,19 @@ enum class WritableStreamPriority : uint8_t {
   kLastPriority
 };
 
+// Urgency of a stream, as in RFC 9218 extensible priorities: 0 is the most
+// urgent and 7 the least. Among the streams of priority kDefault, the more
+// urgent get a larger share of each write.
+inline constexpr uint8_t kNumUrgencies = 8;
+inline constexpr uint8_t kDefaultUrgency = 3;
+
+// The header field that carries the priority of a request, as in RFC 9218.
+inline constexpr absl::string_view kPriorityHeader = "priority";
+
+// Returns the urgency from the value of a priority header field, such as
+// "u=1, i", or kDefaultUrgency if it has no valid urgency.
+uint8_t ParseUrgency(absl::string_view priority);
+
 // Debug helper function to convert a WritableStreamPriority to a string.
 inline std::string GetWritableStreamPriorityString(
     const WritableStreamPriority priority) {
@@ -19,6 +19,8 @@
 #ifndef GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_WRITABLE_STREAMS_H
 #define GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_WRITABLE_STREAMS_H
 
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <limits>
 #include <optional>
@@ -54,6 +56,18 @@ struct HasGetStreamId<
                      uint32_t>;
 };
 
+template <typename StreamPtr, typename = void>
+struct HasGetUrgency {
+  static constexpr bool value = false;
+};
+
+template <typename StreamPtr>
+struct HasGetUrgency<
+    StreamPtr, absl::void_t<decltype(std::declval<StreamPtr>()->GetUrgency())>> {
+  static constexpr bool value = std::is_same_v<
+      decltype(std::declval<StreamPtr>()->GetUrgency()), uint8_t>;
+};
+
 }  // namespace writable_streams_internal
 
 #define GRPC_WRITABLE_STREAMS_DEBUG VLOG(2)
@@ -239,6 +253,13 @@ class WritableStreams {
                                "Failed to enqueue to list of writable streams");
   }
 
+  // Charges the bytes just written for the stream last returned by Next() or
+  // ImmediateNext() to its urgency, if it was of priority kDefault. This MUST
+  // be called before the next stream is dequeued.
+  void RecordBytesWritten(const size_t bytes) {
+    prioritized_queue_.RecordBytesWritten(bytes);
+  }
+
   bool TestOnlyPriorityQueueHasWritableStreams(
       const bool transport_tokens_available) const {
     return !prioritized_queue_.HasNoWritableStreams(transport_tokens_available);
@@ -247,7 +268,7 @@ class WritableStreams {
  private:
   class PrioritizedQueue {
    public:
-    PrioritizedQueue() : buckets_(kLastPriority) {}
+    PrioritizedQueue() : buckets_(kDefaultIndex) {}
 
     // Pushes a stream id with the given priority to the queue. Sorting is done
     // based on the priority. If the priority is higher than the max priority,
@@ -262,16 +283,22 @@ class WritableStreams {
           << "Pushing stream id: " << stream->GetStreamId() << " with priority "
           << GetWritableStreamPriorityString(priority) << " with total streams "
           << total_streams_;
+      if (priority == WritableStreamPriority::kDefault) {
+        urgency_buckets_[GetUrgency(stream)].push(stream);
+        return;
+      }
       buckets_[static_cast<uint8_t>(priority)].push(stream);
     }
 
     // Pops a stream id from the queue based on the priority. If the priority is
     // kWaitForTransportFlowControl, transport_tokens_available is checked to
-    // see if the stream id can be popped.
+    // see if the stream id can be popped. Streams of priority kDefault are
+    // popped by urgency.
     std::optional<StreamPtr> Pop(const bool transport_tokens_available) {
       if (HasNoWritableStreams(transport_tokens_available)) {
         return std::nullopt;
       }
+      last_popped_urgency_ = kNumUrgencies;
       for (uint8_t i = 0; i < buckets_.size(); ++i) {
         auto& bucket = buckets_[i];
         if (!bucket.empty()) {
@@ -295,7 +322,13 @@ class WritableStreams {
           return stream;
         }
       }
-      return std::nullopt;
+      return PopByUrgency();
+    }
+
+    void RecordBytesWritten(const size_t bytes) {
+      if (last_popped_urgency_ < kNumUrgencies) {
+        deficits_[last_popped_urgency_] -= static_cast<int64_t>(bytes);
+      }
     }
 
     // Returns true if the queue does not have any stream that can be popped.
@@ -310,12 +343,82 @@ class WritableStreams {
                     0);
     }
 
-    static constexpr uint8_t kLastPriority =
-        static_cast<uint8_t>(WritableStreamPriority::kLastPriority);
+   private:
+    static uint8_t GetUrgency(const StreamPtr& stream) {
+      if constexpr (writable_streams_internal::HasGetUrgency<
+                        StreamPtr>::value) {
+        return std::min<uint8_t>(stream->GetUrgency(), kNumUrgencies - 1);
+      } else {
+        return kDefaultUrgency;
+      }
+    }
+
+    // The bytes an urgency may write in each round: eight times as many for
+    // the most urgent streams as for the least.
+    static int64_t Quantum(const uint8_t urgency) {
+      return int64_t{kUrgencyQuantum} * (kNumUrgencies - urgency);
+    }
+
+    // Deficit round robin over the urgencies. In each round every urgency
+    // with streams waiting may write its quantum, the most urgent first;
+    // the bytes it writes beyond that are owed from its next rounds. Streams
+    // of the same urgency are popped in the order they were pushed.
+    std::optional<StreamPtr> PopByUrgency() {
+      while (true) {
+        for (uint8_t urgency = 0; urgency < kNumUrgencies; ++urgency) {
+          std::queue<StreamPtr>& bucket = urgency_buckets_[urgency];
+          if (bucket.empty() || deficits_[urgency] <= 0) continue;
+          StreamPtr stream = bucket.front();
+          bucket.pop();
+          total_streams_--;
+          last_popped_urgency_ = urgency;
+          GRPC_WRITABLE_STREAMS_DEBUG
+              << "Popping stream id: " << stream->GetStreamId()
+              << " with urgency " << static_cast<int>(urgency)
+              << " and deficit " << deficits_[urgency] << " with "
+              << total_streams_ << " streams remaining";
+          return stream;
+        }
+        if (!StartRound()) return std::nullopt;
+      }
+    }
+
+    // Skips ahead to the first round in which an urgency with streams
+    // waiting has bytes left to write. Urgencies without streams waiting do
+    // not save up their quantum, but still owe what they wrote. Returns false
+    // if no streams of priority kDefault are waiting.
+    bool StartRound() {
+      int64_t rounds = std::numeric_limits<int64_t>::max();
+      for (uint8_t urgency = 0; urgency < kNumUrgencies; ++urgency) {
+        if (urgency_buckets_[urgency].empty()) continue;
+        rounds =
+            std::min(rounds, -deficits_[urgency] / Quantum(urgency) + 1);
+      }
+      if (rounds == std::numeric_limits<int64_t>::max()) return false;
+      for (uint8_t urgency = 0; urgency < kNumUrgencies; ++urgency) {
+        if (urgency_buckets_[urgency].empty()) {
+          deficits_[urgency] = std::min<int64_t>(deficits_[urgency], 0);
+        } else {
+          deficits_[urgency] += rounds * Quantum(urgency);
+        }
+      }
+      return true;
+    }
+
+    static constexpr uint32_t kUrgencyQuantum = 16384u;
+    static constexpr uint8_t kDefaultIndex =
+        static_cast<uint8_t>(WritableStreamPriority::kDefault);
     static constexpr uint8_t kWaitForTransportFlowControlIndex =
         static_cast<uint8_t>(
             WritableStreamPriority::kWaitForTransportFlowControl);
+    // Streams of priorities other than kDefault.
     std::vector<std::queue<StreamPtr>> buckets_;
+    // Streams of priority kDefault, by urgency.
+    std::queue<StreamPtr> urgency_buckets_[kNumUrgencies];
+    int64_t deficits_[kNumUrgencies] = {};
+    // The urgency of the last stream popped, or kNumUrgencies if it was not
+    // of priority kDefault.
+    uint8_t last_popped_urgency_ = kNumUrgencies;
     uint32_t total_streams_ = 0u;
   };
 
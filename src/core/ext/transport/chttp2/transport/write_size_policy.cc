@@ -16,15 +16,118 @@
 
 #include <grpc/support/port_platform.h>
 
+#if defined(GPR_LINUX) && __has_include(<linux/tcp.h>)
+#define GRPC_HAVE_LINUX_TCP_INFO
+#include <linux/tcp.h>
+#include <netinet/in.h>
+#include <string.h>
+#include <sys/socket.h>
+
+#include <cstddef>
+#endif
+
 #include <algorithm>
 
 #include "src/core/util/grpc_check.h"
 
 namespace grpc_core {
 
-size_t Chttp2WriteSizePolicy::WriteTargetSize() { return current_target_; }
+namespace {
+
+// Target of writes before the link has been measured.
+constexpr size_t kInitialTarget = 128 * 1024;
+// Writes that end sooner than this are too quick to time, and writes smaller
+// than this fraction of the target are unlikely to have filled the socket.
+constexpr Duration kMinTimedWrite = Duration::Milliseconds(2);
+constexpr double kMinTimedWriteFraction = 0.7;
+
+}  // namespace
+
+#ifdef GRPC_HAVE_LINUX_TCP_INFO
+
+void ReadKernelLinkEstimate(int fd, Chttp2LinkEstimate* estimate) {
+  if (fd < 0) return;
+  tcp_info info;
+  memset(&info, 0, sizeof(info));
+  socklen_t length = sizeof(info);
+  if (getsockopt(fd, IPPROTO_TCP, TCP_INFO, &info, &length) != 0) return;
+  // Older kernels return a shorter struct.
+#define GRPC_TCP_INFO_HAS(field) \
+  (length >= offsetof(tcp_info, field) + sizeof(info.field))
+  if (GRPC_TCP_INFO_HAS(tcpi_rtt) && info.tcpi_rtt > 0) {
+    estimate->rtt = info.tcpi_rtt * 1e-6;
+  }
+  if (GRPC_TCP_INFO_HAS(tcpi_notsent_bytes)) {
+    estimate->unsent_bytes = info.tcpi_notsent_bytes;
+  }
+  if (GRPC_TCP_INFO_HAS(tcpi_delivery_rate) && info.tcpi_delivery_rate > 0) {
+    const double rate = static_cast<double>(info.tcpi_delivery_rate);
+    // A rate measured while we were not sending enough to fill the link only
+    // bounds its bandwidth from below.
+    estimate->bandwidth = info.tcpi_delivery_rate_app_limited
+                              ? std::max(estimate->bandwidth, rate)
+                              : rate;
+  }
+#undef GRPC_TCP_INFO_HAS
+}
+
+#else  // GRPC_HAVE_LINUX_TCP_INFO
+
+void ReadKernelLinkEstimate(int /*fd*/, Chttp2LinkEstimate* /*estimate*/) {}
+
+#endif  // GRPC_HAVE_LINUX_TCP_INFO
+
+size_t Chttp2ModelWriteSizePolicy::WriteTargetSize() {
+  const double bandwidth = std::max(link_.bandwidth, write_bandwidth_);
+  if (bandwidth <= 0) return kInitialTarget;
+  const double target = bandwidth * std::max(link_.rtt, MinRtt()) -
+                        static_cast<double>(link_.unsent_bytes);
+  return static_cast<size_t>(std::clamp(
+      target, static_cast<double>(Chttp2WriteSizePolicy::MinTarget()),
+      static_cast<double>(Chttp2WriteSizePolicy::MaxTarget())));
+}
+
+void Chttp2ModelWriteSizePolicy::BeginWrite(size_t size) {
+  GRPC_CHECK_EQ(write_start_time_, Timestamp::InfFuture());
+  if (size < WriteTargetSize() * kMinTimedWriteFraction) return;
+  write_start_time_ = Timestamp::Now();
+  write_size_ = size;
+}
+
+void Chttp2ModelWriteSizePolicy::EndWrite(bool success) {
+  if (write_start_time_ == Timestamp::InfFuture()) return;
+  const Duration elapsed = Timestamp::Now() - write_start_time_;
+  write_start_time_ = Timestamp::InfFuture();
+  // A write that took a while was held up by a full socket, so it went at the
+  // speed of the link.
+  if (!success || elapsed < kMinTimedWrite) return;
+  const double sample = write_size_ / elapsed.seconds();
+  write_bandwidth_ = write_bandwidth_ == 0
+                         ? sample
+                         : 0.75 * write_bandwidth_ + 0.25 * sample;
+}
+
+void Chttp2ModelWriteSizePolicy::UpdateLinkEstimate(
+    const Chttp2LinkEstimate& estimate) {
+  link_ = estimate;
+  link_update_time_ = Timestamp::Now();
+}
+
+bool Chttp2ModelWriteSizePolicy::LinkEstimateDue() const {
+  return Timestamp::Now() - link_update_time_ >=
+         Duration::FromSecondsAsDouble(std::max(link_.rtt, MinRtt()));
+}
+
+size_t Chttp2WriteSizePolicy::WriteTargetSize() {
+  if (model_.has_value()) return model_->WriteTargetSize();
+  return current_target_;
+}
 
 void Chttp2WriteSizePolicy::BeginWrite(size_t size) {
+  if (model_.has_value()) {
+    model_->BeginWrite(size);
+    return;
+  }
   GRPC_CHECK_EQ(experiment_start_time_, Timestamp::InfFuture());
   if (size < current_target_ * 7 / 10) {
     // If we were trending fast but stopped getting enough data to verify, then
@@ -36,6 +139,10 @@ void Chttp2WriteSizePolicy::BeginWrite(size_t size) {
 }
 
 void Chttp2WriteSizePolicy::EndWrite(bool success) {
+  if (model_.has_value()) {
+    model_->EndWrite(success);
+    return;
+  }
   if (experiment_start_time_ == Timestamp::InfFuture()) return;
   const auto elapsed = Timestamp::Now() - experiment_start_time_;
   experiment_start_time_ = Timestamp::InfFuture();
@@ -57,4 +164,24 @@ void Chttp2WriteSizePolicy::EndWrite(bool success) {
   }
 }
 
+void Chttp2WriteCombiner::RecordReady(Timestamp now) {
+  const auto elapsed = now - period_start_;
+  if (elapsed >= window_) {
+    // A period with nothing ready in it means the load has dropped.
+    ready_in_last_period_ = elapsed < 2 * window_ ? ready_in_period_ : 0;
+    ready_in_period_ = 0;
+    period_start_ = now;
+  }
+  ++ready_in_period_;
+}
+
+Duration Chttp2WriteCombiner::HoldTime() const {
+  if (!enabled() || write_now_ || Full() ||
+      std::max(ready_in_period_, ready_in_last_period_) <
+          MinReadyPerWindow()) {
+    return Duration::Zero();
+  }
+  return window_;
+}
+
 }  // namespace grpc_core
@@ -19,10 +19,57 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <optional>
+
 #include "src/core/util/time.h"
 
 namespace grpc_core {
 
+// What is known about the link a connection runs over. Quantities that have
+// not been measured are zero.
+struct Chttp2LinkEstimate {
+  // Bytes per second the link delivers.
+  double bandwidth = 0;
+  // Round trip time in seconds.
+  double rtt = 0;
+  // Bytes written to the socket that the kernel has not sent yet.
+  size_t unsent_bytes = 0;
+};
+
+// Fills in *estimate from the kernel's statistics for the TCP socket fd, where
+// it has them: on Linux, the delivery rate, smoothed round trip time and
+// unsent bytes of TCP_INFO. Measurements that are not available are left
+// unchanged.
+void ReadKernelLinkEstimate(int fd, Chttp2LinkEstimate* estimate);
+
+// Sizes writes from a model of the link rather than by trial: each write
+// should carry what the link delivers in a round trip, less what the kernel
+// still has queued, which keeps the socket's send queue just full. Until the
+// link has been measured, writes are of the step controller's initial size.
+class Chttp2ModelWriteSizePolicy {
+ public:
+  // Round trips shorter than this are treated as this long, so that writes
+  // stay large enough to amortize their cost.
+  static constexpr double MinRtt() { return 0.001; }
+
+  size_t WriteTargetSize();
+  void BeginWrite(size_t size);
+  void EndWrite(bool success);
+  // Updates the model with new measurements of the link.
+  void UpdateLinkEstimate(const Chttp2LinkEstimate& estimate);
+  // Whether the link is worth measuring again: the measurements change little
+  // within a round trip, so they are taken at most once per round trip.
+  bool LinkEstimateDue() const;
+
+ private:
+  Chttp2LinkEstimate link_;
+  Timestamp link_update_time_ = Timestamp::InfPast();
+  // Bandwidth measured from writes that filled the socket, smoothed.
+  double write_bandwidth_ = 0;
+  Timestamp write_start_time_ = Timestamp::InfFuture();
+  size_t write_size_ = 0;
+};
+
 class Chttp2WriteSizePolicy {
  public:
   // Smallest possible WriteTargetSize
@@ -47,7 +94,16 @@ class Chttp2WriteSizePolicy {
   // Notify the policy that a write of some size has ended.
   void EndWrite(bool success);
 
+  // Size writes with a Chttp2ModelWriteSizePolicy from now on.
+  void UseModel() { model_.emplace(); }
+  // The model writes are sized with, which should be kept up to date with
+  // measurements of the link; or nullptr if UseModel() was not called.
+  Chttp2ModelWriteSizePolicy* model() {
+    return model_.has_value() ? &*model_ : nullptr;
+  }
+
  private:
+  std::optional<Chttp2ModelWriteSizePolicy> model_;
   size_t current_target_ = 128 * 1024;
   Timestamp experiment_start_time_ = Timestamp::InfFuture();
   // State varies from -2...2
@@ -60,6 +116,54 @@ class Chttp2WriteSizePolicy {
   int8_t state_ = 0;
 };
 
+// Holds back writes of calls' frames for a short window, so that the frames
+// of other calls that become ready meanwhile go out in the same endpoint
+// write. Writes are held back only while frames became ready at least
+// MinReadyPerWindow() times in the current or the last window, which is when
+// waiting gathers the frames of several calls; at lower load they are started
+// at once.
+class Chttp2WriteCombiner {
+ public:
+  // Frames that become ready together for one call (initial metadata, a
+  // message and trailing metadata) count as up to three, so this is about
+  // five calls.
+  static constexpr int MinReadyPerWindow() { return 16; }
+
+  // Writes are not held back while window is zero.
+  void Configure(Duration window, size_t max_bytes) {
+    window_ = window;
+    max_bytes_ = max_bytes;
+  }
+  bool enabled() const { return window_ > Duration::Zero(); }
+
+  // Notes that frames of a call became ready to be written at now.
+  void RecordReady(Timestamp now);
+  // Notes that bytes of messages were queued to be written.
+  void AddPendingBytes(size_t bytes) { pending_bytes_ += bytes; }
+  // Notes that the next write has frames that should not be held back.
+  void WriteNow() { write_now_ = true; }
+  // How long to hold back a write that is needed now: the window while frames
+  // are becoming ready often and there is room for more, or else zero.
+  Duration HoldTime() const;
+  // Whether enough bytes are held back that they should be written at once.
+  bool Full() const { return pending_bytes_ >= max_bytes_; }
+  // Notes that a write has begun, and taken everything held back.
+  void BeginWrite() {
+    pending_bytes_ = 0;
+    write_now_ = false;
+  }
+
+ private:
+  Duration window_ = Duration::Zero();
+  size_t max_bytes_ = 0;
+  size_t pending_bytes_ = 0;
+  bool write_now_ = false;
+  // Frames are counted in consecutive periods a window long.
+  Timestamp period_start_;
+  int ready_in_period_ = 0;
+  int ready_in_last_period_ = 0;
+};
+
 }  // namespace grpc_core
 
 #endif  // GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_WRITE_SIZE_POLICY_H
@@ -428,6 +428,7 @@ class DataSendContext {
     grpc_chttp2_encode_data(s_->id, &s_->flow_controlled_buffer, send_bytes,
                             is_last_frame_, &s_->call_tracer_wrapper,
                             &t_->http2_ztrace_collector,
+                            &t_->data_frame_headers, t_->http2_stats.get(),
                             t_->outbuf.c_slice_buffer());
     sfc_upd_.SentData(send_bytes);
     s_->sending_bytes += send_bytes;
@@ -588,6 +589,7 @@ class StreamWriteContext {
       grpc_chttp2_encode_data(s_->id, &s_->flow_controlled_buffer, 0, true,
                               &s_->call_tracer_wrapper,
                               &t_->http2_ztrace_collector,
+                              &t_->data_frame_headers, t_->http2_stats.get(),
                               t_->outbuf.c_slice_buffer());
     } else {
       t_->hpack_compressor.EncodeHeaders(
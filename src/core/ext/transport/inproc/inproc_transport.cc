@@ -15,19 +15,24 @@
 #include "src/core/ext/transport/inproc/inproc_transport.h"
 
 #include <grpc/grpc.h>
+#include <grpc/impl/channel_arg_names.h>
 #include <grpc/support/port_platform.h>
 
+#include <algorithm>
 #include <atomic>
+#include <limits>
 #include <memory>
 
 #include "src/core/call/metadata.h"
 #include "src/core/config/core_configuration.h"
+#include "src/core/ext/filters/message_size/message_size_filter.h"
 #include "src/core/ext/transport/inproc/legacy_inproc_transport.h"
 #include "src/core/lib/event_engine/event_engine_context.h"
 #include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/promise/promise.h"
 #include "src/core/lib/promise/try_seq.h"
 #include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/lib/surface/call.h"
 #include "src/core/lib/surface/channel_create.h"
 #include "src/core/lib/transport/transport.h"
 #include "src/core/server/server.h"
@@ -42,11 +47,17 @@ namespace grpc_core {
 namespace {
 class InprocClientTransport;
 
+// Set on the arguments of the server transport of an in-process channel whose
+// calls pass message objects: the largest message the server passes.
+constexpr char kObjectPassingLimitArg[] =
+    "grpc.internal.inproc_object_passing_limit";
+
 class InprocServerTransport final : public ServerTransport {
  public:
   explicit InprocServerTransport(const ChannelArgs& args)
       : event_engine_(
             args.GetObjectRef<grpc_event_engine::experimental::EventEngine>()),
+        object_passing_limit_(args.GetInt(kObjectPassingLimitArg)),
         call_arena_allocator_(MakeRefCounted<CallArenaAllocator>(
             args.GetObject<ResourceQuota>()
                 ->memory_quota()
@@ -121,6 +132,11 @@ class InprocServerTransport final : public ServerTransport {
     auto arena = call_arena_allocator_->MakeArena();
     arena->SetContext<grpc_event_engine::experimental::EventEngine>(
         event_engine_.get());
+    if (object_passing_limit_.has_value()) {
+      arena->SetContext<InprocObjectPassing>(
+          arena->New<InprocObjectPassing>(
+              InprocObjectPassing{*object_passing_limit_}));
+    }
     auto server_call = MakeCallPair(std::move(md), std::move(arena));
     unstarted_call_handler_->StartCall(std::move(server_call.handler));
     return std::move(server_call.initiator);
@@ -178,6 +194,7 @@ class InprocServerTransport final : public ServerTransport {
       ABSL_GUARDED_BY(connected_state_mu_) = MakeRefCounted<ConnectedState>();
   const std::shared_ptr<grpc_event_engine::experimental::EventEngine>
       event_engine_;
+  const std::optional<int> object_passing_limit_;
   const RefCountedPtr<CallArenaAllocator> call_arena_allocator_;
 };
 
@@ -261,9 +278,34 @@ RefCountedPtr<Channel> MakeLameChannel(absl::string_view why,
       nullptr, status, std::string(why).c_str())));
 }
 
+// The largest message that one end of an in-process channel passes to the
+// other as an object. Larger messages are serialized, so that the message size
+// limits of the sender and of the receiver apply to them.
+int ObjectPassingLimit(const ChannelArgs& sender, const ChannelArgs& receiver) {
+  constexpr uint32_t kUnlimited = std::numeric_limits<int>::max();
+  return static_cast<int>(
+      std::min({GetMaxSendSizeFromChannelArgs(sender).value_or(kUnlimited),
+                GetMaxRecvSizeFromChannelArgs(receiver).value_or(kUnlimited),
+                kUnlimited}));
+}
+
+bool InprocChannelPassesObjects(const ChannelArgs& channel_args) {
+  // A service config may set limits per method, which are not known here.
+  return UsePromiseBasedTransport(channel_args) &&
+         channel_args.GetBool(GRPC_ARG_INPROC_OBJECT_PASSING)
+             .value_or(false) &&
+         !channel_args.Contains(GRPC_ARG_SERVICE_CONFIG);
+}
+
 RefCountedPtr<Channel> MakeInprocChannel(Server* server,
                                          ChannelArgs client_channel_args) {
-  auto transports = MakeInProcessTransportPair(server->channel_args());
+  ChannelArgs server_transport_args = server->channel_args();
+  if (InprocChannelPassesObjects(client_channel_args)) {
+    server_transport_args = server_transport_args.Set(
+        kObjectPassingLimitArg,
+        ObjectPassingLimit(server->channel_args(), client_channel_args));
+  }
+  auto transports = MakeInProcessTransportPair(server_transport_args);
   auto client_transport = std::move(transports.first);
   auto server_transport = std::move(transports.second);
   auto error =
@@ -287,6 +329,20 @@ RefCountedPtr<Channel> MakeInprocChannel(Server* server,
 }
 }  // namespace
 
+std::optional<int> InprocChannelObjectPassingLimit(
+    grpc_server* server, const ChannelArgs& channel_args) {
+  if (!InprocChannelPassesObjects(channel_args)) return std::nullopt;
+  return ObjectPassingLimit(channel_args,
+                            Server::FromC(server)->channel_args());
+}
+
+std::optional<int> InprocCallObjectPassingLimit(grpc_call* call) {
+  auto* object_passing =
+      grpc_call_get_arena(call)->GetContext<InprocObjectPassing>();
+  if (object_passing == nullptr) return std::nullopt;
+  return object_passing->max_message_size;
+}
+
 std::pair<OrphanablePtr<Transport>, OrphanablePtr<Transport>>
 MakeInProcessTransportPair(const ChannelArgs& server_channel_args) {
   auto server_transport =
@@ -18,7 +18,11 @@
 #include <grpc/grpc.h>
 #include <grpc/support/port_platform.h>
 
+#include <optional>
+
+#include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/debug/trace.h"
+#include "src/core/lib/resource_quota/arena.h"
 #include "src/core/lib/transport/transport.h"
 
 grpc_channel* grpc_inproc_channel_create(grpc_server* server,
@@ -30,6 +34,28 @@ namespace grpc_core {
 std::pair<OrphanablePtr<Transport>, OrphanablePtr<Transport>>
 MakeInProcessTransportPair(const ChannelArgs& server_channel_args);
 
-}
+// Set on the arena of each server call of an in-process channel whose calls
+// pass message objects (GRPC_ARG_INPROC_OBJECT_PASSING).
+struct InprocObjectPassing {
+  // The largest message, in serialized bytes, that the call passes to its
+  // client as an object.
+  int max_message_size;
+};
+
+template <>
+struct ArenaContextType<InprocObjectPassing> {
+  static void Destroy(InprocObjectPassing*) {}
+};
+
+// The largest message, in serialized bytes, that calls on the channel that
+// grpc_inproc_channel_create() makes with these args pass to the server as an
+// object; nullopt if they serialize every message.
+std::optional<int> InprocChannelObjectPassingLimit(
+    grpc_server* server, const ChannelArgs& channel_args);
+
+// The same, for the messages that a server call sends to its client.
+std::optional<int> InprocCallObjectPassingLimit(grpc_call* call);
+
+}  // namespace grpc_core
 
 #endif  // GRPC_SRC_CORE_EXT_TRANSPORT_INPROC_INPROC_TRANSPORT_H
@@ -75,6 +75,8 @@ class FrameProtector : public RefCounted<FrameProtector> {
                  const ChannelArgs& args)
       : protector_(protector),
         zero_copy_protector_(zero_copy_protector),
+        protect_is_passthrough_(
+            tsi_frame_protector_protect_is_passthrough(protector)),
         memory_owner_(args.GetObject<ResourceQuota>()
                           ->memory_quota()
                           ->CreateMemoryOwner()),
@@ -333,7 +335,10 @@ class FrameProtector : public RefCounted<FrameProtector> {
     TraceOp("Protect", slices);
 
     tsi_result result = TSI_OK;
-    if (zero_copy_protector_ != nullptr) {
+    if (protect_is_passthrough_) {
+      // The kernel protects the bytes written to the socket.
+      grpc_slice_buffer_move_into(slices, output_buffer_.c_slice_buffer());
+    } else if (zero_copy_protector_ != nullptr) {
       // Use zero-copy grpc protector to protect.
       // Break the input slices into chunks of size = max_frame_size and call
       // tsi_zero_copy_grpc_protector_protect on each chunk. This ensures that
@@ -434,6 +439,7 @@ class FrameProtector : public RefCounted<FrameProtector> {
  private:
   struct tsi_frame_protector* const protector_;
   struct tsi_zero_copy_grpc_protector* const zero_copy_protector_;
+  const bool protect_is_passthrough_;
   Mutex mu_;
   Mutex write_mu_;
   // The read mutex must be acquired after the write mutex for shutdown
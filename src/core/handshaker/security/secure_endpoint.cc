@@ -20,6 +20,7 @@
 
 #include <grpc/event_engine/memory_allocator.h>
 #include <grpc/event_engine/memory_request.h>
+#include <grpc/impl/channel_arg_names.h>
 #include <grpc/slice.h>
 #include <grpc/slice_buffer.h>
 #include <grpc/support/alloc.h>
@@ -85,6 +86,8 @@ class FrameProtector : public RefCounted<FrameProtector> {
                  const ChannelArgs& args)
       : protector_(protector),
         zero_copy_protector_(zero_copy_protector),
+        protect_is_passthrough_(
+            tsi_frame_protector_protect_is_passthrough(protector)),
         memory_owner_(args.GetObject<ResourceQuota>()
                           ->memory_quota()
                           ->CreateMemoryOwner()),
@@ -344,7 +347,10 @@ class FrameProtector : public RefCounted<FrameProtector> {
     TraceOp("Protect", slices);
 
     tsi_result result = TSI_OK;
-    if (zero_copy_protector_ != nullptr) {
+    if (protect_is_passthrough_) {
+      // The kernel protects the bytes written to the socket.
+      grpc_slice_buffer_move_into(slices, output_buffer_.c_slice_buffer());
+    } else if (zero_copy_protector_ != nullptr) {
       // Use zero-copy grpc protector to protect.
       // Break the input slices into chunks of size = max_frame_size and call
       // tsi_zero_copy_grpc_protector_protect on each chunk. This ensures that
@@ -449,6 +455,7 @@ class FrameProtector : public RefCounted<FrameProtector> {
  private:
   struct tsi_frame_protector* const protector_;
   struct tsi_zero_copy_grpc_protector* const zero_copy_protector_;
+  const bool protect_is_passthrough_;
   Mutex mu_;
   Mutex read_mu_;
   Mutex write_mu_;
@@ -1077,6 +1084,15 @@ class SecureEndpoint final : public EventEngine::Endpoint {
 }  // namespace
 }  // namespace grpc_event_engine::experimental
 
+bool grpc_secure_endpoint_kernel_tls_offload_enabled(
+    const grpc_core::ChannelArgs& channel_args) {
+  // Kernel TLS fails sends with MSG_ZEROCOPY (EOPNOTSUPP), so every write
+  // above the zerocopy threshold would fail.
+  return channel_args.GetBool(GRPC_ARG_KERNEL_TLS_OFFLOAD).value_or(false) &&
+         channel_args.GetInt(GRPC_ARG_TCP_TX_ZEROCOPY_ENABLED).value_or(0) ==
+             0;
+}
+
 grpc_core::OrphanablePtr<grpc_endpoint> grpc_secure_endpoint_create(
     struct tsi_frame_protector* protector,
     struct tsi_zero_copy_grpc_protector* zero_copy_protector,
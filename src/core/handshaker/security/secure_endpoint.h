@@ -37,6 +37,17 @@
   "grpc.secure_endpoint.encryption_offload_threshold"
 #define GRPC_ARG_ENCRYPTION_OFFLOAD_MAX_BUFFERED_WRITES \
   "grpc.secure_endpoint.encryption_offload_max_buffered_writes"
+// Boolean. If set, the security handshaker moves the record protection of a
+// connection into the kernel (Linux kernel TLS) where the TSI implementation
+// supports it, so that the secure endpoint passes the bytes through. Ignored
+// when GRPC_ARG_TCP_TX_ZEROCOPY_ENABLED is set: kernel TLS rejects zerocopy
+// sends.
+#define GRPC_ARG_KERNEL_TLS_OFFLOAD "grpc.secure_endpoint.kernel_tls_offload"
+
+// Whether channel_args ask for record protection to be moved into the kernel,
+// and allow it.
+bool grpc_secure_endpoint_kernel_tls_offload_enabled(
+    const grpc_core::ChannelArgs& channel_args);
 
 // Takes ownership of protector, zero_copy_protector, and to_wrap, and refs
 // leftover_slices. If zero_copy_protector is not NULL, protector will never be
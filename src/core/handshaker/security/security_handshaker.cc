@@ -230,6 +230,23 @@ void SecurityHandshaker::OnPeerCheckedFn(grpc_error_handle error) {
                      tsi_result_to_string(result), ")")));
     return;
   }
+  // Move record protection into the kernel, if requested. The handshake bytes
+  // have all been written by now.
+  bool protect_offloaded = false;
+  bool unprotect_offloaded = false;
+  if (grpc_secure_endpoint_kernel_tls_offload_enabled(args_->args)) {
+    const int fd = grpc_endpoint_get_fd(args_->endpoint.get());
+    if (fd >= 0) {
+      result = tsi_handshaker_result_offload_to_kernel(
+          handshaker_result_, fd, &protect_offloaded, &unprotect_offloaded);
+      if (result != TSI_OK && result != TSI_UNIMPLEMENTED) {
+        HandshakeFailedLocked(GRPC_ERROR_CREATE(
+            absl::StrCat("Kernel TLS offload failed (",
+                         tsi_result_to_string(result), ")")));
+        return;
+      }
+    }
+  }
   // Check whether we need to wrap the endpoint.
   tsi_frame_protector_type frame_protector_type;
   result = tsi_handshaker_result_get_frame_protector_type(
@@ -298,8 +315,9 @@ void SecurityHandshaker::OnPeerCheckedFn(grpc_error_handle error) {
   tsi_handshaker_result_destroy(handshaker_result_);
   handshaker_result_ = nullptr;
   args_->args = args_->args.SetObject(auth_context_);
-  // Add channelz channel args only if frame protector is created.
-  if (has_frame_protector) {
+  // Add channelz channel args only if frame protector is created, or if the
+  // kernel does all of its work.
+  if (has_frame_protector || unprotect_offloaded) {
     args_->args = args_->args.SetObject(
         MakeChannelzSecurityFromAuthContext(auth_context_.get()));
   }
@@ -22,9 +22,11 @@
 #include <atomic>
 #include <memory>
 
+#include "src/core/config/config_vars.h"
 #include "src/core/lib/event_engine/poller.h"
 #include "src/core/lib/event_engine/posix_engine/posix_interface.h"
 #include "src/core/lib/event_engine/time_util.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/iomgr/port.h"
 #include "src/core/util/crash.h"
 #include "src/core/util/grpc_check.h"
@@ -115,17 +117,17 @@ class Epoll1EventHandle : public EventHandle {
   void SetWritable() override;
   void SetHasError() override;
   bool IsHandleShutdown() override;
-  inline void ExecutePendingActions() {
+  inline void ExecutePendingActions(bool run_inline) {
     // These may execute in Parallel with ShutdownHandle. Thats not an issue
     // because the lockfree event implementation should be able to handle it.
     if (pending_read_.exchange(false, std::memory_order_acq_rel)) {
-      read_closure_.SetReady();
+      read_closure_.SetReady(run_inline);
     }
     if (pending_write_.exchange(false, std::memory_order_acq_rel)) {
-      write_closure_.SetReady();
+      write_closure_.SetReady(run_inline);
     }
     if (pending_error_.exchange(false, std::memory_order_acq_rel)) {
-      error_closure_.SetReady();
+      error_closure_.SetReady(run_inline);
     }
   }
   grpc_core::Mutex* mu() { return &mu_; }
@@ -244,7 +246,11 @@ void Epoll1EventHandle::HandleShutdownInternal(absl::Status why,
 }
 
 Epoll1Poller::Epoll1Poller(std::shared_ptr<ThreadPool> thread_pool)
-    : thread_pool_(thread_pool), was_kicked_(false), closed_(false) {
+    : thread_pool_(thread_pool),
+      busy_poll_us_(
+          grpc_core::ConfigVars::Get().ExperimentalEventEngineBusyPollUs()),
+      was_kicked_(false),
+      closed_(false) {
   g_epoll_set_.epfd = posix_interface().EpollCreateAndCloexec().value();
   wakeup_fd_ = CreateWakeupFd(&posix_interface()).value();
   GRPC_CHECK(wakeup_fd_ != nullptr);
@@ -256,6 +262,13 @@ Epoll1Poller::Epoll1Poller(std::shared_ptr<ThreadPool> thread_pool)
   GRPC_CHECK(result.ok()) << result.StrError();
   g_epoll_set_.num_events = 0;
   g_epoll_set_.cursor = 0;
+  // Readiness based writes are plain sendmsg calls, so batching saves no
+  // syscalls: it only pays off when the busy polling thread flushes the batch
+  // itself. Otherwise every write would just take a thread pool hop.
+  if (grpc_core::IsEventEngineWriteBatchingEnabled() && busy_poll_us_ > 0) {
+    write_batcher_ = std::make_shared<WriteBatcher>(thread_pool_.get(),
+                                                    /*end_batch=*/nullptr);
+  }
 }
 
 void Epoll1Poller::Close() {
@@ -296,6 +309,7 @@ EventHandle* Epoll1Poller::CreateHandle(FileDescriptor fd,
     fork_handles_set_.emplace(new_handle);
 #endif  // GRPC_ENABLE_FORK_SUPPORT
   }
+  if (busy_poll_us_ > 0) MaybeSetBusyPoll(fd);
   // Use the least significant bit of ev.data.ptr to store track_err. We expect
   // the addresses to be word aligned. We need to store track_err to avoid
   // synchronization issues when accessing it after receiving an event.
@@ -312,6 +326,34 @@ EventHandle* Epoll1Poller::CreateHandle(FileDescriptor fd,
   return new_handle;
 }
 
+// Asks the kernel to busy poll the device queue of a socket for up to
+// busy_poll_us_ when a read finds no data, instead of waiting for an interrupt.
+// Raising SO_BUSY_POLL above net.core.busy_read needs CAP_NET_ADMIN, so
+// failures are expected and only traced.
+void Epoll1Poller::MaybeSetBusyPoll(const FileDescriptor& fd) {
+#ifdef SO_BUSY_POLL
+  auto raw_fd = posix_interface().GetFd(fd);
+  if (!raw_fd.ok()) return;
+  int value = busy_poll_us_;
+  if (setsockopt(*raw_fd, SOL_SOCKET, SO_BUSY_POLL, &value, sizeof(value)) !=
+      0) {
+    if (errno != ENOTSOCK) {
+      GRPC_TRACE_LOG(event_engine_poller, INFO)
+          << "setsockopt(SO_BUSY_POLL): " << grpc_core::StrError(errno);
+    }
+    return;
+  }
+#ifdef SO_PREFER_BUSY_POLL
+  value = 1;
+  if (setsockopt(*raw_fd, SOL_SOCKET, SO_PREFER_BUSY_POLL, &value,
+                 sizeof(value)) != 0) {
+    GRPC_TRACE_LOG(event_engine_poller, INFO)
+        << "setsockopt(SO_PREFER_BUSY_POLL): " << grpc_core::StrError(errno);
+  }
+#endif  // SO_PREFER_BUSY_POLL
+#endif  // SO_BUSY_POLL
+}
+
 // Process the epoll events found by DoEpollWait() function.
 // - g_epoll_set.cursor points to the index of the first event to be processed
 // - This function then processes up-to max_epoll_events_to_handle and
@@ -440,10 +482,15 @@ Poller::WorkResult Epoll1Poller::Work(
   }
   // Run the provided callback.
   schedule_poll_again();
-  // Process all pending events inline.
+  // Process all pending events inline. In busy poll mode Work runs on a
+  // dedicated thread, which also runs the closures that become ready.
   for (auto& it : pending_events) {
-    it->ExecutePendingActions();
+    it->ExecutePendingActions(/*run_inline=*/busy_poll_us_ > 0);
   }
+  // The closures above may have started writes on several connections. The
+  // busy polling thread sends them now rather than waiting for the thread
+  // pool.
+  if (write_batcher_ != nullptr) write_batcher_->Flush();
   return was_kicked_ext ? Poller::WorkResult::kKicked : Poller::WorkResult::kOk;
 }
 
@@ -512,7 +559,8 @@ namespace grpc_event_engine::experimental {
 using ::grpc_event_engine::experimental::EventEngine;
 using ::grpc_event_engine::experimental::Poller;
 
-Epoll1Poller::Epoll1Poller(std::shared_ptr<ThreadPool> /* thread_pool */) {
+Epoll1Poller::Epoll1Poller(std::shared_ptr<ThreadPool> /* thread_pool */)
+    : busy_poll_us_(0) {
   grpc_core::Crash("unimplemented");
 }
 
@@ -25,6 +25,7 @@
 #include "src/core/lib/event_engine/posix_engine/event_poller.h"
 #include "src/core/lib/event_engine/posix_engine/internal_errqueue.h"
 #include "src/core/lib/event_engine/posix_engine/wakeup_fd_posix.h"
+#include "src/core/lib/event_engine/posix_engine/write_batcher.h"
 #include "src/core/lib/event_engine/thread_pool/thread_pool.h"
 #include "src/core/lib/iomgr/port.h"
 #include "src/core/util/sync.h"
@@ -71,6 +72,7 @@ class Epoll1Poller : public PosixEventPoller {
   void HandleForkInChild() override;
 #endif  // GRPC_ENABLE_FORK_SUPPORT
   void ResetKickState() override;
+  WriteBatcher* GetWriteBatcher() override { return write_batcher_.get(); }
 
  private:
   // This initial vector size may need to be tuned
@@ -91,6 +93,8 @@ class Epoll1Poller : public PosixEventPoller {
   // of events generated by epoll_wait.
   int DoEpollWait(
       grpc_event_engine::experimental::EventEngine::Duration timeout);
+  // Sets SO_BUSY_POLL and SO_PREFER_BUSY_POLL on \a fd if it is a socket.
+  void MaybeSetBusyPoll(const FileDescriptor& fd);
   friend class Epoll1EventHandle;
 #ifdef GRPC_LINUX_EPOLL
   struct EpollSet {
@@ -111,6 +115,13 @@ class Epoll1Poller : public PosixEventPoller {
 #endif
   grpc_core::Mutex mu_;
   std::shared_ptr<ThreadPool> thread_pool_;
+  // ConfigVars::ExperimentalEventEngineBusyPollUs(). If non-zero, Work is
+  // called from a dedicated busy polling thread and runs ready closures
+  // inline.
+  const int busy_poll_us_;
+  // Set if the event_engine_write_batching experiment is on and busy_poll_us_
+  // is non-zero.
+  std::shared_ptr<WriteBatcher> write_batcher_;
   // A singleton epoll set
   EpollSet g_epoll_set_;
   bool was_kicked_ ABSL_GUARDED_BY(mu_);
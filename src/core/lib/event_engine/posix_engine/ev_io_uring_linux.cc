@@ -0,0 +1,1007 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "src/core/lib/event_engine/posix_engine/ev_io_uring_linux.h"
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/status.h>
+#include <grpc/support/port_platform.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <memory>
+#include <utility>
+
+#include "src/core/lib/event_engine/poller.h"
+#include "src/core/lib/event_engine/posix_engine/posix_interface.h"
+#include "src/core/lib/iomgr/port.h"
+#include "src/core/util/crash.h"
+#include "src/core/util/grpc_check.h"
+#include "absl/log/log.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_format.h"
+
+// This polling engine is only relevant on linux kernels supporting io_uring.
+#ifdef GRPC_LINUX_IO_URING
+#include <endian.h>
+#include <errno.h>
+#include <poll.h>
+#include <sys/socket.h>
+
+#include "src/core/lib/event_engine/posix_engine/event_poller.h"
+#include "src/core/lib/event_engine/posix_engine/lockfree_event.h"
+#include "src/core/lib/event_engine/posix_engine/posix_engine_closure.h"
+#include "src/core/lib/event_engine/posix_engine/wakeup_fd_posix.h"
+#include "src/core/lib/event_engine/posix_engine/wakeup_fd_posix_default.h"
+#include "src/core/lib/experiments/experiments.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/util/status_helper.h"
+#include "src/core/util/strerror.h"
+#include "src/core/util/sync.h"
+
+namespace grpc_event_engine::experimental {
+
+namespace {
+
+// The low bits of an io_uring user_data identify which request a completion
+// belongs to; the remaining bits hold the IoUringEventHandle pointer (handles
+// are at least 8 byte aligned) or, for the wakeup fd, a generation counter.
+enum RequestTag : uint64_t {
+  kPollRequest = 0,
+  kRecvRequest = 1,
+  kSendRequest = 2,
+  // Completions of cancellation requests carry nothing we need. They are
+  // dropped without looking at the handle, which may already be reused.
+  kIgnoredRequest = 3,
+  kWakeupRequest = 4,
+  kRecvBuffersRequest = 5,
+};
+constexpr uint64_t kRequestTagMask = 7;
+
+// Submission queue size of the poller's ring. The completion queue is four
+// times as large (see IoUring::Init).
+constexpr uint32_t kRingEntries = 1024;
+
+#ifdef GRPC_LINUX_IO_URING_BUF_RING
+// Buffers shared by all sockets of a poller for RecvBuffers. Pages of the
+// ring are only committed once the kernel first writes to them.
+constexpr uint16_t kRecvBufferGroup = 0;
+constexpr uint32_t kNumRecvBuffers = 1024;
+constexpr uint32_t kRecvBufferSize = 16 * 1024;
+// Once this much received data is waiting for a RecvBuffers call, the
+// multishot receive is cancelled so that the rest stays in the socket and TCP
+// flow control applies.
+constexpr size_t kMaxUnreadRecvBytes = 256 * 1024;
+#endif  // GRPC_LINUX_IO_URING_BUF_RING
+
+// It is possible that the headers have io_uring but the kernel doesn't, or
+// that io_uring is disabled by the administrator (kernel.io_uring_disabled).
+bool InitIoUringPollerLinux() {
+  if (!grpc_event_engine::experimental::SupportsWakeupFd()) {
+    return false;
+  }
+  return IoUringSupported();
+}
+
+uint32_t PollMask() {
+  uint32_t mask = POLLIN | POLLOUT | POLLPRI;
+#if __BYTE_ORDER == __BIG_ENDIAN
+  // poll32_events shares storage with the 16 bit poll_events field, so the
+  // kernel expects the halves swapped on big endian machines.
+  mask = (mask << 16) | (mask >> 16);
+#endif
+  return mask;
+}
+
+void PrepMultishotPoll(io_uring_sqe* sqe, int fd, uint64_t user_data) {
+  sqe->opcode = IORING_OP_POLL_ADD;
+  sqe->fd = fd;
+  sqe->len = IORING_POLL_ADD_MULTI;
+  sqe->poll32_events = PollMask();
+  sqe->user_data = user_data;
+}
+
+#ifdef GRPC_LINUX_IO_URING_BUF_RING
+void PrepMultishotRecv(io_uring_sqe* sqe, int fd, uint16_t buffer_group,
+                       uint64_t user_data) {
+  sqe->opcode = IORING_OP_RECV;
+  sqe->fd = fd;
+  sqe->ioprio = IORING_RECV_MULTISHOT;
+  sqe->flags = IOSQE_BUFFER_SELECT;
+  sqe->buf_group = buffer_group;
+  sqe->user_data = user_data;
+}
+#endif  // GRPC_LINUX_IO_URING_BUF_RING
+
+void PrepCancel(io_uring_sqe* sqe, uint8_t opcode, uint64_t target) {
+  sqe->opcode = opcode;
+  sqe->fd = -1;
+  sqe->addr = target;
+  sqe->user_data = kIgnoredRequest;
+}
+
+}  // namespace
+
+class IoUringEventHandle : public EventHandle, public EventHandleAsyncIo {
+ public:
+  IoUringEventHandle(const FileDescriptor& fd, IoUringPoller* poller)
+      : fd_(fd),
+        poller_(poller),
+        read_closure_(poller->GetThreadPool()),
+        write_closure_(poller->GetThreadPool()),
+        error_closure_(poller->GetThreadPool()) {
+    ReInit(fd);
+  }
+  void ReInit(FileDescriptor fd) {
+    fd_ = fd;
+    read_closure_.InitEvent();
+    write_closure_.InitEvent();
+    error_closure_.InitEvent();
+    pending_read_.store(false, std::memory_order_relaxed);
+    pending_write_.store(false, std::memory_order_relaxed);
+    pending_error_.store(false, std::memory_order_relaxed);
+    // One reference owned by the user of the handle, dropped by OrphanHandle.
+    refs_.store(1, std::memory_order_relaxed);
+    grpc_core::MutexLock lock(&mu_);
+    shutdown_status_ = absl::OkStatus();
+    orphaned_ = false;
+    recv_multishot_armed_ = false;
+    recv_multishot_cancelled_ = false;
+    received_.Clear();
+    recv_eof_ = false;
+    recv_exhausted_ = false;
+    recv_error_ = absl::OkStatus();
+  }
+  IoUringPoller* Poller() override { return poller_; }
+  EventHandleAsyncIo* AsyncIo() override { return this; }
+  FileDescriptor WrappedFd() override { return fd_; }
+  void OrphanHandle(PosixEngineClosure* on_done, FileDescriptor* release_fd,
+                    absl::string_view reason) override;
+  void ShutdownHandle(absl::Status why) override;
+  void NotifyOnRead(PosixEngineClosure* on_read) override {
+    read_closure_.NotifyOn(on_read);
+  }
+  void NotifyOnWrite(PosixEngineClosure* on_write) override {
+    write_closure_.NotifyOn(on_write);
+  }
+  void NotifyOnError(PosixEngineClosure* on_error) override {
+    error_closure_.NotifyOn(on_error);
+  }
+  void SetReadable() override { read_closure_.SetReady(); }
+  void SetWritable() override { write_closure_.SetReady(); }
+  void SetHasError() override { error_closure_.SetReady(); }
+  bool IsHandleShutdown() override { return read_closure_.IsShutdown(); }
+
+  // EventHandleAsyncIo
+  void RecvMsg(
+      struct msghdr* msg,
+      absl::AnyInvocable<void(absl::StatusOr<int64_t>)> on_done) override;
+  void SendMsg(
+      struct msghdr* msg, int flags,
+      absl::AnyInvocable<void(absl::StatusOr<int64_t>)> on_done) override;
+  bool SupportsRecvBuffers() override;
+  void RecvBuffers(
+      SliceBuffer* buffer,
+      absl::AnyInvocable<void(absl::StatusOr<int64_t>)> on_done) override;
+
+  // Submits the multishot poll request which reports readiness edges for the
+  // lifetime of the handle.
+  void ArmPoll(bool track_err);
+  // See Epoll1EventHandle::SetPendingActions.
+  bool SetPendingActions(bool pending_read, bool pending_write,
+                         bool pending_error) {
+    if (pending_read) {
+      pending_read_.store(true, std::memory_order_release);
+    }
+    if (pending_write) {
+      pending_write_.store(true, std::memory_order_release);
+    }
+    if (pending_error) {
+      pending_error_.store(true, std::memory_order_release);
+    }
+    return pending_read || pending_write || pending_error;
+  }
+  void ExecutePendingActions() {
+    if (pending_read_.exchange(false, std::memory_order_acq_rel)) {
+      read_closure_.SetReady();
+    }
+    if (pending_write_.exchange(false, std::memory_order_acq_rel)) {
+      write_closure_.SetReady();
+    }
+    if (pending_error_.exchange(false, std::memory_order_acq_rel)) {
+      error_closure_.SetReady();
+    }
+  }
+  // Handles the final completion of the multishot poll request. Returns true
+  // if the request was re-armed.
+  bool OnPollTerminated(int res);
+  // Handles the completion of a RecvMsg/SendMsg request. Returns the callback
+  // to run, or nullptr if the request was transparently resubmitted.
+  absl::AnyInvocable<void()> OnIoComplete(RequestTag tag, int res);
+  // Handles a completion of the multishot receive started by RecvBuffers.
+  // Returns the callback to run, or nullptr if there is no caller to notify
+  // yet.
+  absl::AnyInvocable<void()> OnRecvBuffersComplete(const io_uring_cqe& cqe);
+  // Drops a reference. Returns true if this was the last one, at which point
+  // the handle may be returned to the poller's free list.
+  bool Unref() { return refs_.fetch_sub(1, std::memory_order_acq_rel) == 1; }
+  bool track_err() const { return track_err_; }
+  ~IoUringEventHandle() override = default;
+
+ private:
+  uint64_t UserData(RequestTag tag) {
+    return reinterpret_cast<uint64_t>(this) | tag;
+  }
+  // Submits the RecvMsg or SendMsg request described by the stored msghdr.
+  // Returns false if the submission queue could not take it.
+  bool SubmitIoLocked(RequestTag tag) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  // Submits the multishot receive into the poller's buffer ring. Returns false
+  // if the submission queue could not take it.
+  bool SubmitRecvBuffersLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void HandleShutdownInternal(absl::Status why) ABSL_LOCKS_EXCLUDED(mu_);
+
+  grpc_core::Mutex mu_;
+  FileDescriptor fd_;
+  bool track_err_ = false;
+  // See Epoll1Poller::SetPendingActions for explanation on why pending_<***>_
+  // need to be atomic.
+  std::atomic<bool> pending_read_{false};
+  std::atomic<bool> pending_write_{false};
+  std::atomic<bool> pending_error_{false};
+  // References held by the user of the handle and by every request the
+  // kernel has not completed yet. The handle can only be reused once all of
+  // them are gone, since completions carry a pointer to it.
+  std::atomic<intptr_t> refs_{1};
+  IoUringPoller* poller_;
+  LockfreeEvent read_closure_;
+  LockfreeEvent write_closure_;
+  LockfreeEvent error_closure_;
+  absl::Status shutdown_status_ ABSL_GUARDED_BY(mu_);
+  bool orphaned_ ABSL_GUARDED_BY(mu_) = false;
+  struct msghdr* recv_msg_ ABSL_GUARDED_BY(mu_) = nullptr;
+  struct msghdr* send_msg_ ABSL_GUARDED_BY(mu_) = nullptr;
+  int send_flags_ ABSL_GUARDED_BY(mu_) = 0;
+  absl::AnyInvocable<void(absl::StatusOr<int64_t>)> on_recv_
+      ABSL_GUARDED_BY(mu_);
+  absl::AnyInvocable<void(absl::StatusOr<int64_t>)> on_send_
+      ABSL_GUARDED_BY(mu_);
+  // State of RecvBuffers. While the multishot receive is armed, data lands in
+  // recv_buffer_ if a caller is waiting (on_recv_ is then its callback), and
+  // in received_ otherwise.
+  bool recv_multishot_armed_ ABSL_GUARDED_BY(mu_) = false;
+  // Set while a cancellation of the armed receive is in flight.
+  bool recv_multishot_cancelled_ ABSL_GUARDED_BY(mu_) = false;
+  SliceBuffer* recv_buffer_ ABSL_GUARDED_BY(mu_) = nullptr;
+  SliceBuffer received_ ABSL_GUARDED_BY(mu_);
+  bool recv_eof_ ABSL_GUARDED_BY(mu_) = false;
+  // The receive ended because the buffer ring was empty. Reported to the next
+  // RecvBuffers call, so that it falls back to RecvMsg.
+  bool recv_exhausted_ ABSL_GUARDED_BY(mu_) = false;
+  absl::Status recv_error_ ABSL_GUARDED_BY(mu_);
+};
+
+void IoUringEventHandle::ArmPoll(bool track_err) {
+  track_err_ = track_err;
+  auto fd = poller_->posix_interface().GetFd(fd_);
+  if (!fd.ok()) {
+    LOG(ERROR) << "io_uring poll add: " << fd.StrError();
+    return;
+  }
+  refs_.fetch_add(1, std::memory_order_relaxed);
+  if (!poller_->ring()->Prepare([&](io_uring_sqe* sqe) {
+        PrepMultishotPoll(sqe, *fd, UserData(kPollRequest));
+      })) {
+    LOG(ERROR) << "io_uring poll add: submission queue is full";
+    refs_.fetch_sub(1, std::memory_order_relaxed);
+    return;
+  }
+  auto result = poller_->ring()->Submit();
+  if (!result.ok()) {
+    LOG(ERROR) << "io_uring poll add: io_uring_enter failed: "
+               << result.StrError();
+  }
+}
+
+bool IoUringEventHandle::OnPollTerminated(int res) {
+  {
+    grpc_core::MutexLock lock(&mu_);
+    // The request was removed by OrphanHandle, or the fd is gone.
+    if (orphaned_ || res == -ECANCELED || res == -EBADF) return false;
+  }
+  // The kernel may end a multishot request on its own, for instance when the
+  // completion queue overflowed. Keep watching the fd.
+  auto fd = poller_->posix_interface().GetFd(fd_);
+  if (!fd.ok()) return false;
+  refs_.fetch_add(1, std::memory_order_relaxed);
+  if (!poller_->ring()->Prepare([&](io_uring_sqe* sqe) {
+        PrepMultishotPoll(sqe, *fd, UserData(kPollRequest));
+      })) {
+    refs_.fetch_sub(1, std::memory_order_relaxed);
+    return false;
+  }
+  // Submit now: readiness would otherwise wait for an unrelated submission.
+  poller_->ring()->Submit();
+  return true;
+}
+
+bool IoUringEventHandle::SubmitIoLocked(RequestTag tag) {
+  auto fd = poller_->posix_interface().GetFd(fd_);
+  if (!fd.ok()) return false;
+  refs_.fetch_add(1, std::memory_order_relaxed);
+  const bool is_recv = tag == kRecvRequest;
+  if (!poller_->ring()->Prepare([&](io_uring_sqe* sqe) {
+        sqe->opcode = is_recv ? IORING_OP_RECVMSG : IORING_OP_SENDMSG;
+        sqe->fd = *fd;
+        sqe->addr = reinterpret_cast<uint64_t>(is_recv ? recv_msg_ : send_msg_);
+        sqe->len = 1;
+        sqe->msg_flags = is_recv ? 0 : send_flags_;
+        sqe->user_data = UserData(tag);
+      })) {
+    refs_.fetch_sub(1, std::memory_order_relaxed);
+    return false;
+  }
+  return true;
+}
+
+void IoUringEventHandle::RecvMsg(
+    struct msghdr* msg,
+    absl::AnyInvocable<void(absl::StatusOr<int64_t>)> on_done) {
+  absl::Status error;
+  {
+    grpc_core::MutexLock lock(&mu_);
+    GRPC_CHECK(on_recv_ == nullptr);
+    if (!shutdown_status_.ok()) {
+      error = shutdown_status_;
+    } else {
+      recv_msg_ = msg;
+      on_recv_ = std::move(on_done);
+      if (!SubmitIoLocked(kRecvRequest)) {
+        on_done = std::move(on_recv_);
+        on_recv_ = nullptr;
+        error = absl::UnavailableError("io_uring submission queue is full");
+      }
+    }
+  }
+  if (!error.ok()) {
+    poller_->GetThreadPool()->Run(
+        [on_done = std::move(on_done), error = std::move(error)]() mutable {
+          on_done(std::move(error));
+        });
+    return;
+  }
+  grpc_core::global_stats().IncrementSyscallRead();
+  poller_->ring()->Submit();
+}
+
+void IoUringEventHandle::SendMsg(
+    struct msghdr* msg, int flags,
+    absl::AnyInvocable<void(absl::StatusOr<int64_t>)> on_done) {
+  absl::Status error;
+  {
+    grpc_core::MutexLock lock(&mu_);
+    GRPC_CHECK(on_send_ == nullptr);
+    if (!shutdown_status_.ok()) {
+      error = shutdown_status_;
+    } else {
+      send_msg_ = msg;
+      send_flags_ = flags;
+      on_send_ = std::move(on_done);
+      if (!SubmitIoLocked(kSendRequest)) {
+        on_done = std::move(on_send_);
+        on_send_ = nullptr;
+        error = absl::UnavailableError("io_uring submission queue is full");
+      }
+    }
+  }
+  if (!error.ok()) {
+    poller_->GetThreadPool()->Run(
+        [on_done = std::move(on_done), error = std::move(error)]() mutable {
+          on_done(std::move(error));
+        });
+    return;
+  }
+  // Within a batch the send is submitted, together with those of other
+  // connections, once the batch ends.
+  if (WriteBatcher::DeferSubmit(poller_->write_batcher_.get())) return;
+  grpc_core::global_stats().IncrementSyscallWrite();
+  grpc_core::global_stats().IncrementTcpWritesPerSyscall(1);
+  poller_->ring()->Submit();
+}
+
+bool IoUringEventHandle::SupportsRecvBuffers() {
+#ifdef GRPC_LINUX_IO_URING_BUF_RING
+  return poller_->buffer_ring_ != nullptr;
+#else
+  return false;
+#endif  // GRPC_LINUX_IO_URING_BUF_RING
+}
+
+bool IoUringEventHandle::SubmitRecvBuffersLocked() {
+#ifdef GRPC_LINUX_IO_URING_BUF_RING
+  auto fd = poller_->posix_interface().GetFd(fd_);
+  if (!fd.ok()) return false;
+  refs_.fetch_add(1, std::memory_order_relaxed);
+  if (!poller_->ring()->Prepare([&](io_uring_sqe* sqe) {
+        PrepMultishotRecv(sqe, *fd, poller_->buffer_ring_->group_id(),
+                          UserData(kRecvBuffersRequest));
+      })) {
+    refs_.fetch_sub(1, std::memory_order_relaxed);
+    return false;
+  }
+  recv_multishot_armed_ = true;
+  return true;
+#else
+  return false;
+#endif  // GRPC_LINUX_IO_URING_BUF_RING
+}
+
+void IoUringEventHandle::RecvBuffers(
+    SliceBuffer* buffer,
+    absl::AnyInvocable<void(absl::StatusOr<int64_t>)> on_done) {
+  absl::StatusOr<int64_t> result;
+  bool submitted = false;
+  {
+    grpc_core::MutexLock lock(&mu_);
+    GRPC_CHECK(on_recv_ == nullptr);
+    const bool was_armed = recv_multishot_armed_;
+    if (received_.Length() > 0) {
+      result = static_cast<int64_t>(received_.Length());
+      received_.MoveFirstNBytesIntoSliceBuffer(received_.Length(), *buffer);
+    } else if (recv_eof_) {
+      result = 0;
+    } else if (!recv_error_.ok()) {
+      result = recv_error_;
+    } else if (!shutdown_status_.ok()) {
+      result = shutdown_status_;
+    } else if (recv_exhausted_ || !SupportsRecvBuffers()) {
+      recv_exhausted_ = false;
+      result = absl::ResourceExhaustedError("io_uring buffer ring is empty");
+    } else if (!recv_multishot_armed_ && !SubmitRecvBuffersLocked()) {
+      result = absl::UnavailableError("io_uring submission queue is full");
+    } else {
+      // Wait for the data, with the receive either just submitted or still
+      // armed from an earlier call.
+      submitted = !was_armed;
+      recv_buffer_ = buffer;
+      on_recv_ = std::move(on_done);
+      on_done = nullptr;
+    }
+  }
+  if (on_done != nullptr) {
+    poller_->GetThreadPool()->Run(
+        [on_done = std::move(on_done), result = std::move(result)]() mutable {
+          on_done(std::move(result));
+        });
+    return;
+  }
+  if (submitted) {
+    grpc_core::global_stats().IncrementSyscallRead();
+    poller_->ring()->Submit();
+  }
+}
+
+absl::AnyInvocable<void()> IoUringEventHandle::OnRecvBuffersComplete(
+    const io_uring_cqe& cqe) {
+#ifdef GRPC_LINUX_IO_URING_BUF_RING
+  grpc_core::MutexLock lock(&mu_);
+  if ((cqe.flags & IORING_CQE_F_MORE) == 0) {
+    recv_multishot_armed_ = false;
+    recv_multishot_cancelled_ = false;
+  }
+  int64_t appended = 0;
+  if (cqe.flags & IORING_CQE_F_BUFFER) {
+    const uint16_t buffer_id =
+        static_cast<uint16_t>(cqe.flags >> IORING_CQE_BUFFER_SHIFT);
+    if (cqe.res > 0 && !orphaned_) {
+      SliceBuffer* out = recv_buffer_ != nullptr ? recv_buffer_ : &received_;
+      out->Append(poller_->buffer_ring_->TakeBuffer(buffer_id, cqe.res));
+      appended = cqe.res;
+    } else {
+      poller_->buffer_ring_->Recycle(buffer_id);
+    }
+  }
+  if (cqe.res == 0) {
+    recv_eof_ = true;
+  } else if (cqe.res == -ENOBUFS) {
+    recv_exhausted_ = true;
+  } else if (cqe.res < 0 && cqe.res != -ECANCELED && cqe.res != -EAGAIN &&
+             cqe.res != -EINTR) {
+    recv_error_ = absl::UnknownError(
+        absl::StrCat("recv: ", grpc_core::StrError(-cqe.res)));
+  }
+  if (recv_buffer_ == nullptr) {
+    // Nobody is reading. Stop receiving once enough is buffered.
+    if (recv_multishot_armed_ && !recv_multishot_cancelled_ &&
+        received_.Length() >= kMaxUnreadRecvBytes) {
+      recv_multishot_cancelled_ = true;
+      poller_->ring()->Prepare([&](io_uring_sqe* sqe) {
+        PrepCancel(sqe, IORING_OP_ASYNC_CANCEL, UserData(kRecvBuffersRequest));
+      });
+    }
+    return nullptr;
+  }
+  absl::StatusOr<int64_t> result;
+  if (appended > 0) {
+    result = appended;
+  } else if (recv_eof_) {
+    result = 0;
+  } else if (!recv_error_.ok()) {
+    result = recv_error_;
+  } else if (recv_exhausted_) {
+    recv_exhausted_ = false;
+    result = absl::ResourceExhaustedError("io_uring buffer ring is empty");
+  } else if (!shutdown_status_.ok()) {
+    if (recv_multishot_armed_) return nullptr;
+    result = shutdown_status_;
+  } else if (recv_multishot_armed_ || SubmitRecvBuffersLocked()) {
+    // The kernel ended the receive without data (a spurious wakeup, or the
+    // cancellation above); it is resubmitted by the next Work().
+    return nullptr;
+  } else {
+    result = absl::UnavailableError("io_uring submission queue is full");
+  }
+  recv_buffer_ = nullptr;
+  return [on_done = std::exchange(on_recv_, nullptr),
+          result = std::move(result)]() mutable { on_done(std::move(result)); };
+#else
+  (void)cqe;
+  return nullptr;
+#endif  // GRPC_LINUX_IO_URING_BUF_RING
+}
+
+absl::AnyInvocable<void()> IoUringEventHandle::OnIoComplete(RequestTag tag,
+                                                           int res) {
+  grpc_core::MutexLock lock(&mu_);
+  const bool is_recv = tag == kRecvRequest;
+  auto& on_done = is_recv ? on_recv_ : on_send_;
+  GRPC_CHECK(on_done != nullptr);
+  if ((res == -EAGAIN || res == -EINTR) && shutdown_status_.ok() &&
+      SubmitIoLocked(tag)) {
+    // Fast poll normally retries internally, but a spurious wakeup may still
+    // surface here. The submission is flushed by the next Work().
+    return nullptr;
+  }
+  absl::StatusOr<int64_t> result;
+  if (res >= 0) {
+    result = res;
+  } else if (!shutdown_status_.ok()) {
+    result = shutdown_status_;
+  } else {
+    result = absl::UnknownError(absl::StrCat(
+        is_recv ? "recvmsg: " : "sendmsg: ", grpc_core::StrError(-res)));
+  }
+  return [on_done = std::exchange(on_done, nullptr),
+          result = std::move(result)]() mutable { on_done(std::move(result)); };
+}
+
+void IoUringEventHandle::OrphanHandle(PosixEngineClosure* on_done,
+                                      FileDescriptor* release_fd,
+                                      absl::string_view reason) {
+  if (!read_closure_.IsShutdown()) {
+    HandleShutdownInternal(absl::Status(absl::StatusCode::kUnknown, reason));
+  }
+  {
+    grpc_core::MutexLock lock(&mu_);
+    orphaned_ = true;
+    // Hand the buffers of unread data back to the ring.
+    received_.Clear();
+  }
+  // Stop watching the fd before it is closed or handed back: the poll request
+  // holds a reference to the underlying file.
+  IoUring* ring = poller_->ring();
+  if (ring->Prepare([&](io_uring_sqe* sqe) {
+        PrepCancel(sqe, IORING_OP_POLL_REMOVE, UserData(kPollRequest));
+      })) {
+    ring->Submit();
+  }
+  auto& posix_interface = poller_->posix_interface();
+  if (release_fd != nullptr) {
+    *release_fd = fd_;
+  } else {
+    posix_interface.Shutdown(fd_, SHUT_RDWR);
+    posix_interface.Close(fd_);
+  }
+  {
+    // See Epoll1Poller::ShutdownHandle for explanation on why a mutex is
+    // required here.
+    grpc_core::MutexLock lock(&mu_);
+    read_closure_.DestroyEvent();
+    write_closure_.DestroyEvent();
+    error_closure_.DestroyEvent();
+  }
+  pending_read_.store(false, std::memory_order_release);
+  pending_write_.store(false, std::memory_order_release);
+  pending_error_.store(false, std::memory_order_release);
+  {
+    grpc_core::MutexLock lock(&poller_->mu_);
+#ifdef GRPC_ENABLE_FORK_SUPPORT
+    poller_->fork_handles_set_.erase(this);
+#endif  // GRPC_ENABLE_FORK_SUPPORT
+    if (Unref()) poller_->ReleaseHandleLocked(this);
+  }
+  if (on_done != nullptr) {
+    on_done->SetStatus(absl::OkStatus());
+    poller_->GetThreadPool()->Run(on_done);
+  }
+}
+
+void IoUringEventHandle::HandleShutdownInternal(absl::Status why) {
+  grpc_core::StatusSetInt(
+      &why, grpc_core::StatusIntProperty::kRpcStatus,
+      absl::IsCancelled(why) ? GRPC_STATUS_CANCELLED : GRPC_STATUS_UNAVAILABLE);
+  bool cancel_recv = false;
+  bool cancel_recv_buffers = false;
+  bool cancel_send = false;
+  {
+    grpc_core::MutexLock lock(&mu_);
+    if (!read_closure_.SetShutdown(why)) return;
+    write_closure_.SetShutdown(why);
+    error_closure_.SetShutdown(why);
+    shutdown_status_ = why;
+    cancel_recv_buffers = recv_multishot_armed_;
+    cancel_recv = on_recv_ != nullptr && recv_buffer_ == nullptr;
+    cancel_send = on_send_ != nullptr;
+  }
+  if (!cancel_recv && !cancel_recv_buffers && !cancel_send) return;
+  // Outstanding operations complete with -ECANCELED and report the shutdown
+  // status to their callers.
+  IoUring* ring = poller_->ring();
+  if (cancel_recv) {
+    ring->Prepare([&](io_uring_sqe* sqe) {
+      PrepCancel(sqe, IORING_OP_ASYNC_CANCEL, UserData(kRecvRequest));
+    });
+  }
+  if (cancel_recv_buffers) {
+    ring->Prepare([&](io_uring_sqe* sqe) {
+      PrepCancel(sqe, IORING_OP_ASYNC_CANCEL, UserData(kRecvBuffersRequest));
+    });
+  }
+  if (cancel_send) {
+    ring->Prepare([&](io_uring_sqe* sqe) {
+      PrepCancel(sqe, IORING_OP_ASYNC_CANCEL, UserData(kSendRequest));
+    });
+  }
+  ring->Submit();
+}
+
+// Might be called multiple times
+void IoUringEventHandle::ShutdownHandle(absl::Status why) {
+  HandleShutdownInternal(std::move(why));
+}
+
+IoUringPoller::IoUringPoller(std::shared_ptr<ThreadPool> thread_pool,
+                             uint32_t num_recv_buffers)
+    : thread_pool_(std::move(thread_pool)) {
+#ifdef GRPC_LINUX_IO_URING_BUF_RING
+  num_recv_buffers_ =
+      num_recv_buffers != 0 ? num_recv_buffers : kNumRecvBuffers;
+#else
+  (void)num_recv_buffers;
+#endif  // GRPC_LINUX_IO_URING_BUF_RING
+  auto ring = IoUring::Create(kRingEntries);
+  GRPC_CHECK(ring.ok()) << ring.status();
+  ring_ = std::move(*ring);
+  wakeup_fd_ = CreateWakeupFd(&posix_interface()).value();
+  GRPC_CHECK(wakeup_fd_ != nullptr);
+  GRPC_TRACE_LOG(event_engine_poller, INFO)
+      << "grpc io_uring fd: " << ring_->fd();
+  MaybeCreateBufferRing();
+  ArmWakeupFd();
+  if (grpc_core::IsEventEngineWriteBatchingEnabled()) {
+    write_batcher_ =
+        std::make_shared<WriteBatcher>(thread_pool_.get(), [this]() {
+          grpc_core::global_stats().IncrementSyscallWrite();
+          ring_->Submit();
+        });
+  }
+}
+
+void IoUringPoller::MaybeCreateBufferRing() {
+#ifdef GRPC_LINUX_IO_URING_BUF_RING
+  if (!grpc_core::IsEventEngineIoUringProvidedBuffersEnabled() ||
+      !IoUringBufferRingSupported()) {
+    return;
+  }
+  auto buffer_ring = IoUringBufferRing::Create(
+      ring_.get(), kRecvBufferGroup, num_recv_buffers_, kRecvBufferSize);
+  if (!buffer_ring.ok()) {
+    GRPC_TRACE_LOG(event_engine_poller, INFO)
+        << "io_uring provided buffers are not available: "
+        << buffer_ring.status();
+    return;
+  }
+  buffer_ring_ = std::move(*buffer_ring);
+#endif  // GRPC_LINUX_IO_URING_BUF_RING
+}
+
+void IoUringPoller::ArmWakeupFd() {
+  auto fd = posix_interface().GetFd(wakeup_fd_->ReadFd());
+  GRPC_CHECK(fd.ok()) << fd.StrError();
+  ++wakeup_generation_;
+  GRPC_CHECK(ring_->Prepare([&](io_uring_sqe* sqe) {
+    PrepMultishotPoll(sqe, *fd, (wakeup_generation_ << 3) | kWakeupRequest);
+  }));
+  auto result = ring_->Submit();
+  GRPC_CHECK(result.ok()) << result.StrError();
+}
+
+void IoUringPoller::Close() {
+  grpc_core::MutexLock lock(&mu_);
+  if (closed_) return;
+  // Flushes scheduled on the thread pool may outlive the poller: stop them
+  // from submitting to the ring before it goes away.
+  if (write_batcher_ != nullptr) write_batcher_->Shutdown();
+  ring_.reset();
+#ifdef GRPC_LINUX_IO_URING_BUF_RING
+  // Closing the ring unregistered the buffers. Slices still referring to them
+  // keep the memory alive.
+  buffer_ring_.reset();
+#endif  // GRPC_LINUX_IO_URING_BUF_RING
+  while (!free_handles_list_.empty()) {
+    IoUringEventHandle* handle = free_handles_list_.front();
+    free_handles_list_.pop_front();
+    delete handle;
+  }
+  closed_ = true;
+}
+
+IoUringPoller::~IoUringPoller() { Close(); }
+
+void IoUringPoller::ReleaseHandleLocked(IoUringEventHandle* handle) {
+  free_handles_list_.push_back(handle);
+}
+
+EventHandle* IoUringPoller::CreateHandle(FileDescriptor fd,
+                                         absl::string_view /*name*/,
+                                         bool track_err) {
+  IoUringEventHandle* new_handle = nullptr;
+  {
+    grpc_core::MutexLock lock(&mu_);
+    if (free_handles_list_.empty()) {
+      new_handle = new IoUringEventHandle(fd, this);
+    } else {
+      new_handle = free_handles_list_.front();
+      free_handles_list_.pop_front();
+      new_handle->ReInit(fd);
+    }
+#ifdef GRPC_ENABLE_FORK_SUPPORT
+    fork_handles_set_.emplace(new_handle);
+#endif  // GRPC_ENABLE_FORK_SUPPORT
+  }
+  new_handle->ArmPoll(track_err);
+  return new_handle;
+}
+
+bool IoUringPoller::ProcessCompletion(const io_uring_cqe& cqe,
+                                      Events& pending_events,
+                                      Completions& completions) {
+  const auto tag = static_cast<RequestTag>(cqe.user_data & kRequestTagMask);
+  const bool more = (cqe.flags & IORING_CQE_F_MORE) != 0;
+  switch (tag) {
+    case kIgnoredRequest:
+      return false;
+    case kWakeupRequest: {
+      if ((cqe.user_data >> 3) != wakeup_generation_) {
+        // Completion of a wakeup fd replaced by ResetKickState.
+        return false;
+      }
+      if (!more) ArmWakeupFd();
+      GRPC_CHECK(wakeup_fd_->ConsumeWakeup().ok());
+      return true;
+    }
+    default:
+      break;
+  }
+  auto* handle = reinterpret_cast<IoUringEventHandle*>(cqe.user_data &
+                                                       ~kRequestTagMask);
+  if (tag == kPollRequest) {
+    if (cqe.res > 0) {
+      const uint32_t events = static_cast<uint32_t>(cqe.res);
+      bool cancel = (events & POLLHUP) != 0;
+      bool error = (events & POLLERR) != 0;
+      bool read_ev = (events & (POLLIN | POLLPRI)) != 0;
+      bool write_ev = (events & POLLOUT) != 0;
+      bool err_fallback = error && !handle->track_err();
+      if (handle->SetPendingActions(read_ev || cancel || err_fallback,
+                                    write_ev || cancel || err_fallback,
+                                    error && !err_fallback)) {
+        pending_events.push_back(handle);
+      }
+    }
+    if (!more) {
+      handle->OnPollTerminated(cqe.res);
+      if (handle->Unref()) ReleaseHandleLocked(handle);
+    }
+    return false;
+  }
+  if (tag == kRecvBuffersRequest) {
+    auto on_done = handle->OnRecvBuffersComplete(cqe);
+    if (on_done != nullptr) completions.push_back(std::move(on_done));
+    if (!more && handle->Unref()) ReleaseHandleLocked(handle);
+    return false;
+  }
+  auto on_done = handle->OnIoComplete(tag, cqe.res);
+  if (on_done != nullptr) completions.push_back(std::move(on_done));
+  if (handle->Unref()) ReleaseHandleLocked(handle);
+  return false;
+}
+
+// Waits on the ring until a completion is available, the timeout expires or
+// there is a Kick(). Readiness edges are delivered through the handles'
+// lockfree events and completed I/O operations are handed to the thread pool.
+Poller::WorkResult IoUringPoller::Work(
+    EventEngine::Duration timeout,
+    absl::FunctionRef<void()> schedule_poll_again) {
+  Events pending_events;
+  Completions completions;
+  bool was_kicked_ext = false;
+  while (pending_events.empty() && completions.empty()) {
+    if (!ring_->HasCompletions()) {
+      PosixError result;
+      do {
+        result = ring_->SubmitAndWait(timeout);
+      } while (result.IsPosixError(EINTR));
+      if (!result.ok() && !result.IsPosixError(ETIME) &&
+          !result.IsPosixError(EBUSY)) {
+        grpc_core::Crash(absl::StrFormat(
+            "(event_engine) IoUringPoller:%p encountered io_uring_enter "
+            "error: %s",
+            this, result.StrError()));
+      }
+      if (!ring_->HasCompletions()) {
+        return Poller::WorkResult::kDeadlineExceeded;
+      }
+    }
+    grpc_core::MutexLock lock(&mu_);
+    bool was_kicked = false;
+    ring_->ReapCompletions([&](const io_uring_cqe& cqe) {
+      if (ProcessCompletion(cqe, pending_events, completions)) {
+        was_kicked = true;
+      }
+    });
+    if (was_kicked && was_kicked_) {
+      was_kicked_ = false;
+      was_kicked_ext = true;
+    }
+    if (was_kicked_ext && pending_events.empty() && completions.empty()) {
+      return Poller::WorkResult::kKicked;
+    }
+  }
+  // Run the provided callback.
+  schedule_poll_again();
+  // Process all pending events inline.
+  for (auto& it : pending_events) {
+    it->ExecutePendingActions();
+  }
+  for (auto& on_done : completions) {
+    thread_pool_->Run(std::move(on_done));
+  }
+  return was_kicked_ext ? Poller::WorkResult::kKicked : Poller::WorkResult::kOk;
+}
+
+void IoUringPoller::Kick() {
+  grpc_core::MutexLock lock(&mu_);
+  if (was_kicked_ || closed_) {
+    return;
+  }
+  was_kicked_ = true;
+  GRPC_CHECK(wakeup_fd_->Wakeup().ok());
+}
+
+#ifdef GRPC_ENABLE_FORK_SUPPORT
+
+void IoUringPoller::HandleForkInChild() {
+  if (grpc_core::IsEventEngineForkEnabled()) {
+    posix_interface().AdvanceGeneration();
+  }
+  {
+    grpc_core::MutexLock lock(&mu_);
+    for (EventHandle* handle : fork_handles_set_) {
+      handle->ShutdownHandle(absl::CancelledError("Closed on fork"));
+    }
+  }
+  // The ring and its mappings are shared with the parent. Start over with a
+  // ring of our own; requests queued on the old one are never completed, so
+  // handles created before the fork are leaked rather than reused.
+  auto ring = IoUring::Create(kRingEntries);
+  GRPC_CHECK(ring.ok()) << ring.status();
+  grpc_core::MutexLock lock(&mu_);
+  ring_ = std::move(*ring);
+#ifdef GRPC_LINUX_IO_URING_BUF_RING
+  buffer_ring_.reset();
+  MaybeCreateBufferRing();
+#endif  // GRPC_LINUX_IO_URING_BUF_RING
+  free_handles_list_.clear();
+  GRPC_TRACE_LOG(event_engine_poller, INFO)
+      << "Post-fork grpc io_uring fd: " << ring_->fd();
+}
+
+#endif  // GRPC_ENABLE_FORK_SUPPORT
+
+void IoUringPoller::ResetKickState() {
+  // Wakeup fd is always recreated to ensure FD state is reset. The poll
+  // request on the previous wakeup fd (if the ring survived) is removed; its
+  // completions are recognized as stale by their generation.
+  const uint64_t old_wakeup = (wakeup_generation_ << 3) | kWakeupRequest;
+  if (ring_->Prepare([&](io_uring_sqe* sqe) {
+        PrepCancel(sqe, IORING_OP_POLL_REMOVE, old_wakeup);
+      })) {
+    ring_->Submit();
+  }
+  wakeup_fd_ = *CreateWakeupFd(&posix_interface());
+  ArmWakeupFd();
+  grpc_core::MutexLock lock(&mu_);
+  was_kicked_ = false;
+}
+
+std::shared_ptr<IoUringPoller> MakeIoUringPoller(
+    std::shared_ptr<ThreadPool> thread_pool, uint32_t num_recv_buffers) {
+  static bool kIoUringPollerSupported = InitIoUringPollerLinux();
+  if (kIoUringPollerSupported) {
+    return std::make_shared<IoUringPoller>(std::move(thread_pool),
+                                           num_recv_buffers);
+  }
+  return nullptr;
+}
+
+}  // namespace grpc_event_engine::experimental
+
+#else  // defined(GRPC_LINUX_IO_URING)
+
+namespace grpc_event_engine::experimental {
+
+using ::grpc_event_engine::experimental::EventEngine;
+using ::grpc_event_engine::experimental::Poller;
+
+IoUringPoller::IoUringPoller(std::shared_ptr<ThreadPool> /* thread_pool */,
+                             uint32_t /* num_recv_buffers */) {
+  grpc_core::Crash("unimplemented");
+}
+
+IoUringPoller::~IoUringPoller() { grpc_core::Crash("unimplemented"); }
+
+EventHandle* IoUringPoller::CreateHandle(FileDescriptor /*fd*/,
+                                         absl::string_view /*name*/,
+                                         bool /*track_err*/) {
+  grpc_core::Crash("unimplemented");
+}
+
+Poller::WorkResult IoUringPoller::Work(
+    EventEngine::Duration /*timeout*/,
+    absl::FunctionRef<void()> /*schedule_poll_again*/) {
+  grpc_core::Crash("unimplemented");
+}
+
+void IoUringPoller::Kick() { grpc_core::Crash("unimplemented"); }
+
+void IoUringPoller::Close() { grpc_core::Crash("unimplemented"); }
+
+#if GRPC_ENABLE_FORK_SUPPORT
+void IoUringPoller::HandleForkInChild() { grpc_core::Crash("unimplemented"); }
+#endif  // GRPC_ENABLE_FORK_SUPPORT
+
+void IoUringPoller::ResetKickState() { grpc_core::Crash("unimplemented"); }
+
+// If GRPC_LINUX_IO_URING is not defined, it means io_uring is not available.
+// Return nullptr.
+std::shared_ptr<IoUringPoller> MakeIoUringPoller(
+    std::shared_ptr<ThreadPool> /*thread_pool*/,
+    uint32_t /*num_recv_buffers*/) {
+  return nullptr;
+}
+
+}  // namespace grpc_event_engine::experimental
+
+#endif  // !defined(GRPC_LINUX_IO_URING)
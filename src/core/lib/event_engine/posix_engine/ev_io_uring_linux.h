@@ -0,0 +1,158 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_EV_IO_URING_LINUX_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_EV_IO_URING_LINUX_H
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <string>
+
+#include "src/core/lib/event_engine/poller.h"
+#include "src/core/lib/event_engine/posix_engine/event_poller.h"
+#include "src/core/lib/event_engine/posix_engine/internal_errqueue.h"
+#include "src/core/lib/event_engine/posix_engine/io_uring.h"
+#include "src/core/lib/event_engine/posix_engine/wakeup_fd_posix.h"
+#include "src/core/lib/event_engine/posix_engine/write_batcher.h"
+#include "src/core/lib/event_engine/thread_pool/thread_pool.h"
+#include "src/core/lib/iomgr/port.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/sync.h"
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_set.h"
+#include "absl/container/inlined_vector.h"
+#include "absl/functional/any_invocable.h"
+#include "absl/functional/function_ref.h"
+#include "absl/strings/string_view.h"
+
+namespace grpc_event_engine::experimental {
+
+class IoUringEventHandle;
+
+// Definition of an io_uring based poller.
+//
+// Readiness of each file descriptor is tracked with a single multishot poll
+// request, so after CreateHandle() no further system calls are needed to keep
+// receiving edges. In addition, handles created by this poller implement
+// EventHandleAsyncIo: endpoints hand their recvmsg/sendmsg to the ring and
+// are notified on completion, which merges the readiness wait with the data
+// transfer and lets a single io_uring_enter submit the operations of many
+// connections at once.
+//
+// Two things are deliberately left out:
+// - Accepts and connects stay readiness based. The listener and the connect
+//   path are shared by all pollers and only use EventHandle::NotifyOnRead /
+//   NotifyOnWrite. The multishot poll delivers those edges without system
+//   calls, and the listener drains every pending connection per edge, so an
+//   IORING_OP_ACCEPT would only save the accept4() itself, once per
+//   connection rather than per message.
+// - Registered (fixed) buffers are not used. Sends go out of the caller's
+//   slices, and copying them into registered memory costs more than pinning
+//   their pages per request. Receives use the provided buffer ring instead
+//   (see IoUringBufferRing), which shares one pinned pool between all sockets
+//   of the poller, which is what registered buffers would buy here.
+class IoUringPoller : public PosixEventPoller {
+ public:
+  // \a num_recv_buffers sets the number of buffers in the ring shared by the
+  // handles for RecvBuffers; 0 picks the default. Tests use a small ring to
+  // run it dry.
+  explicit IoUringPoller(std::shared_ptr<ThreadPool> thread_pool,
+                         uint32_t num_recv_buffers = 0);
+  EventHandle* CreateHandle(FileDescriptor fd, absl::string_view name,
+                            bool track_err) override;
+  Poller::WorkResult Work(
+      grpc_event_engine::experimental::EventEngine::Duration timeout,
+      absl::FunctionRef<void()> schedule_poll_again) override;
+  std::string Name() override { return "io_uring"; }
+  void Kick() override;
+  ThreadPool* GetThreadPool() { return thread_pool_.get(); }
+  bool CanTrackErrors() const override {
+#ifdef GRPC_POSIX_SOCKET_TCP
+    return KernelSupportsErrqueue();
+#else
+    return false;
+#endif
+  }
+  ~IoUringPoller() override;
+
+  void Close();
+
+#ifdef GRPC_ENABLE_FORK_SUPPORT
+  void HandleForkInChild() override;
+#endif  // GRPC_ENABLE_FORK_SUPPORT
+  void ResetKickState() override;
+  WriteBatcher* GetWriteBatcher() override { return write_batcher_.get(); }
+
+ private:
+  friend class IoUringEventHandle;
+
+#ifdef GRPC_LINUX_IO_URING
+  using Events = absl::InlinedVector<IoUringEventHandle*, 5>;
+  using Completions = absl::InlinedVector<absl::AnyInvocable<void()>, 5>;
+
+  // Arms the multishot poll request watching the wakeup fd.
+  void ArmWakeupFd();
+  // Sets up the buffer ring used by IoUringEventHandle::RecvBuffers, if the
+  // experiment is on and the kernel supports it.
+  void MaybeCreateBufferRing();
+  // Sorts a single completion into the readiness events and I/O completion
+  // callbacks to run once schedule_poll_again has been invoked. Returns true
+  // if the completion was for the wakeup fd.
+  bool ProcessCompletion(const io_uring_cqe& cqe, Events& pending_events,
+                         Completions& completions)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  // Returns an orphaned handle whose kernel requests have all completed to
+  // the free list.
+  void ReleaseHandleLocked(IoUringEventHandle* handle)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  IoUring* ring() { return ring_.get(); }
+
+  std::unique_ptr<IoUring> ring_;
+#ifdef GRPC_LINUX_IO_URING_BUF_RING
+  uint32_t num_recv_buffers_ = 0;
+  grpc_core::RefCountedPtr<IoUringBufferRing> buffer_ring_;
+#endif  // GRPC_LINUX_IO_URING_BUF_RING
+  // Incremented each time the wakeup fd is (re)armed, and encoded into the
+  // user_data of its poll request so completions of a replaced wakeup fd can
+  // be told apart.
+  uint64_t wakeup_generation_ = 0;
+#endif  // GRPC_LINUX_IO_URING
+  grpc_core::Mutex mu_;
+  std::shared_ptr<ThreadPool> thread_pool_;
+  bool was_kicked_ ABSL_GUARDED_BY(mu_) = false;
+  std::list<IoUringEventHandle*> free_handles_list_ ABSL_GUARDED_BY(mu_);
+#if GRPC_ENABLE_FORK_SUPPORT
+  absl::flat_hash_set<EventHandle*> fork_handles_set_ ABSL_GUARDED_BY(mu_);
+#endif  // GRPC_ENABLE_FORK_SUPPORT
+  std::unique_ptr<WakeupFd> wakeup_fd_;
+  bool closed_ ABSL_GUARDED_BY(mu_) = false;
+  // Set if the event_engine_write_batching experiment is on. Sends queued
+  // while it flushes are submitted together at the end of the batch.
+  std::shared_ptr<WriteBatcher> write_batcher_;
+};
+
+// Return an instance of an io_uring based poller tied to the specified thread
+// pool, or nullptr if the running kernel does not support io_uring (or the
+// features of it that the poller needs). See IoUringPoller for
+// \a num_recv_buffers.
+std::shared_ptr<IoUringPoller> MakeIoUringPoller(
+    std::shared_ptr<ThreadPool> thread_pool, uint32_t num_recv_buffers = 0);
+
+}  // namespace grpc_event_engine::experimental
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_EV_IO_URING_LINUX_H
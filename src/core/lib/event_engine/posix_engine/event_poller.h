@@ -15,19 +15,62 @@
 #ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_EVENT_POLLER_H
 #define GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_EVENT_POLLER_H
 #include <grpc/event_engine/event_engine.h>
+#include <grpc/event_engine/slice_buffer.h>
 #include <grpc/support/port_platform.h>
 
+#include <cstdint>
 #include <string>
 
 #include "src/core/lib/event_engine/poller.h"
 #include "src/core/lib/event_engine/posix_engine/posix_engine_closure.h"
 #include "src/core/lib/event_engine/posix_engine/posix_interface.h"
+#include "absl/functional/any_invocable.h"
 #include "absl/status/status.h"
+#include "absl/status/statusor.h"
 #include "absl/strings/string_view.h"
 
+struct msghdr;
+
 namespace grpc_event_engine::experimental {
 
 class PosixEventPoller;
+class WriteBatcher;
+
+// Completion based socket I/O, offered by handles of pollers that can perform
+// recvmsg/sendmsg on the caller's behalf (io_uring). Instead of waiting for
+// readiness and then issuing the system call, the caller submits the operation
+// and is notified once the kernel has transferred the data.
+//
+// At most one RecvMsg and one SendMsg may be outstanding on a handle at any
+// time. The msghdr (and the buffers it refers to) must remain valid until
+// on_done runs. on_done is run on the poller's thread pool with either the
+// number of bytes transferred (0 meaning end of stream for RecvMsg) or an
+// error. If the handle is shut down while an operation is outstanding, the
+// operation is cancelled and on_done receives the shutdown status.
+//
+// Handles for which SupportsRecvBuffers() returns true can also receive into
+// buffers owned by the poller: RecvBuffers appends whatever has arrived to
+// \a buffer as slices of those buffers, so the caller needs no memory of its
+// own while it waits. on_done receives the number of bytes appended (0 meaning
+// end of stream). A kResourceExhausted error means the poller ran out of
+// buffers; the caller should retry with RecvMsg. RecvBuffers counts as the
+// outstanding RecvMsg, and \a buffer must remain valid until on_done runs.
+class EventHandleAsyncIo {
+ public:
+  virtual void RecvMsg(
+      struct msghdr* msg,
+      absl::AnyInvocable<void(absl::StatusOr<int64_t>)> on_done) = 0;
+  virtual void SendMsg(
+      struct msghdr* msg, int flags,
+      absl::AnyInvocable<void(absl::StatusOr<int64_t>)> on_done) = 0;
+  virtual bool SupportsRecvBuffers() = 0;
+  virtual void RecvBuffers(
+      SliceBuffer* buffer,
+      absl::AnyInvocable<void(absl::StatusOr<int64_t>)> on_done) = 0;
+
+ protected:
+  ~EventHandleAsyncIo() = default;
+};
 
 class EventHandle {
  public:
@@ -74,6 +117,9 @@ class EventHandle {
   virtual bool IsHandleShutdown() = 0;
   // Returns the poller which was used to create this handle.
   virtual PosixEventPoller* Poller() = 0;
+  // Returns the completion based I/O interface of this handle, or nullptr if
+  // the poller only reports readiness.
+  virtual EventHandleAsyncIo* AsyncIo() { return nullptr; }
   virtual ~EventHandle() = default;
 };
 
@@ -92,6 +138,9 @@ class PosixEventPoller : public grpc_event_engine::experimental::Poller {
   virtual void HandleForkInChild() = 0;
 #endif  // GRPC_ENABLE_FORK_SUPPORT
   virtual void ResetKickState() = 0;
+  // Returns the batcher that endpoints on this poller hand their writes to,
+  // or nullptr if writes are not batched.
+  virtual WriteBatcher* GetWriteBatcher() { return nullptr; }
   EventEnginePosixInterface& posix_interface() { return posix_interface_; }
   ~PosixEventPoller() override = default;
 
@@ -19,6 +19,7 @@
 
 #include "src/core/config/config_vars.h"
 #include "src/core/lib/event_engine/posix_engine/ev_epoll1_linux.h"
+#include "src/core/lib/event_engine/posix_engine/ev_io_uring_linux.h"
 #include "src/core/lib/event_engine/posix_engine/ev_poll_posix.h"
 #include "src/core/lib/event_engine/posix_engine/event_poller.h"
 #include "src/core/lib/iomgr/port.h"
@@ -45,7 +46,12 @@ std::shared_ptr<PosixEventPoller> MakeDefaultPoller(
       absl::StrSplit(grpc_core::ConfigVars::Get().PollStrategy(), ',');
   for (auto it = strings.begin(); it != strings.end() && poller == nullptr;
        it++) {
-    if (PollStrategyMatches(*it, "epoll1")) {
+    // The io_uring poller is opt-in: it is not selected by "all", only when
+    // named explicitly (e.g. GRPC_POLL_STRATEGY=io_uring,epoll1).
+    if (*it == "io_uring") {
+      poller = MakeIoUringPoller(thread_pool);
+    }
+    if (poller == nullptr && PollStrategyMatches(*it, "epoll1")) {
       poller = MakeEpoll1Poller(thread_pool);
     }
     if (poller == nullptr && PollStrategyMatches(*it, "poll")) {
@@ -0,0 +1,463 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/event_engine/posix_engine/io_uring.h"
+
+#include <grpc/support/port_platform.h>
+#include <grpc/support/time.h>
+
+#include "src/core/lib/iomgr/port.h"
+
+#ifdef GRPC_LINUX_IO_URING
+
+#include <errno.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <new>
+
+#include "src/core/lib/debug/trace.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
+#include "src/core/util/grpc_check.h"
+#include "src/core/util/strerror.h"
+#include "absl/log/log.h"
+#include "absl/numeric/bits.h"
+#include "absl/status/status.h"
+#include "absl/strings/str_cat.h"
+
+namespace grpc_event_engine::experimental {
+
+namespace {
+
+// Features without which the poller cannot work:
+//  - SINGLE_MMAP (5.4): the SQ and CQ rings share one mapping.
+//  - NODROP (5.5): completions are never dropped on CQ overflow.
+//  - FAST_POLL (5.7): socket operations that would block are retried
+//    internally instead of being punted to a worker thread.
+//  - EXT_ARG (5.11): io_uring_enter accepts a timeout.
+//  - RSRC_TAGS (5.13): landed in the same release as multishot poll, which
+//    has no feature bit of its own.
+constexpr uint32_t kRequiredFeatures =
+    IORING_FEAT_SINGLE_MMAP | IORING_FEAT_NODROP | IORING_FEAT_FAST_POLL |
+    IORING_FEAT_EXT_ARG | IORING_FEAT_RSRC_TAGS;
+
+int IoUringSetup(uint32_t entries, io_uring_params* params) {
+  return static_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+}
+
+int IoUringEnter(int fd, uint32_t to_submit, uint32_t min_complete,
+                 uint32_t flags, void* arg, size_t arg_size) {
+  return static_cast<int>(syscall(__NR_io_uring_enter, fd, to_submit,
+                                  min_complete, flags, arg, arg_size));
+}
+
+int IoUringRegister(int fd, uint32_t opcode, const void* arg,
+                    uint32_t nr_args) {
+  return static_cast<int>(
+      syscall(__NR_io_uring_register, fd, opcode, arg, nr_args));
+}
+
+template <typename T>
+T* RingPtr(void* ring, uint32_t offset) {
+  return reinterpret_cast<T*>(static_cast<char*>(ring) + offset);
+}
+
+}  // namespace
+
+absl::StatusOr<std::unique_ptr<IoUring>> IoUring::Create(uint32_t entries) {
+  std::unique_ptr<IoUring> ring(new IoUring());
+  absl::Status status = ring->Init(entries);
+  if (!status.ok()) return status;
+  return ring;
+}
+
+absl::Status IoUring::Init(uint32_t entries) {
+  io_uring_params params;
+  memset(&params, 0, sizeof(params));
+  // Completions for multishot operations can outnumber submissions by a
+  // large factor, so size the CQ generously.
+  params.flags = IORING_SETUP_CQSIZE | IORING_SETUP_CLAMP;
+  params.cq_entries = entries * 4;
+  ring_fd_ = IoUringSetup(entries, &params);
+  if (ring_fd_ < 0) {
+    return absl::UnavailableError(
+        absl::StrCat("io_uring_setup: ", grpc_core::StrError(errno)));
+  }
+  features_ = params.features;
+  if ((features_ & kRequiredFeatures) != kRequiredFeatures) {
+    return absl::UnavailableError(
+        absl::StrCat("io_uring: kernel is missing required features, have 0x",
+                     absl::Hex(features_)));
+  }
+  sq_ring_size_ = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+  cq_ring_size_ =
+      params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+  // With IORING_FEAT_SINGLE_MMAP the completion ring lives in the same
+  // mapping as the submission ring.
+  sq_ring_size_ = std::max(sq_ring_size_, cq_ring_size_);
+  cq_ring_size_ = 0;
+  sq_ring_ptr_ = mmap(nullptr, sq_ring_size_, PROT_READ | PROT_WRITE,
+                      MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQ_RING);
+  if (sq_ring_ptr_ == MAP_FAILED) {
+    sq_ring_ptr_ = nullptr;
+    return absl::UnavailableError(
+        absl::StrCat("io_uring: mmap sq ring: ", grpc_core::StrError(errno)));
+  }
+  cq_ring_ptr_ = sq_ring_ptr_;
+  sqes_size_ = params.sq_entries * sizeof(io_uring_sqe);
+  void* sqes = mmap(nullptr, sqes_size_, PROT_READ | PROT_WRITE,
+                    MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQES);
+  if (sqes == MAP_FAILED) {
+    return absl::UnavailableError(
+        absl::StrCat("io_uring: mmap sqes: ", grpc_core::StrError(errno)));
+  }
+  sqes_ = static_cast<io_uring_sqe*>(sqes);
+
+  sq_khead_ = RingPtr<std::atomic<uint32_t>>(sq_ring_ptr_, params.sq_off.head);
+  sq_ktail_ = RingPtr<std::atomic<uint32_t>>(sq_ring_ptr_, params.sq_off.tail);
+  sq_mask_ = *RingPtr<uint32_t>(sq_ring_ptr_, params.sq_off.ring_mask);
+  sq_entries_ = *RingPtr<uint32_t>(sq_ring_ptr_, params.sq_off.ring_entries);
+  sq_array_ = RingPtr<uint32_t>(sq_ring_ptr_, params.sq_off.array);
+  sq_tail_ = sq_ktail_->load(std::memory_order_relaxed);
+
+  cq_khead_ = RingPtr<std::atomic<uint32_t>>(cq_ring_ptr_, params.cq_off.head);
+  cq_ktail_ = RingPtr<std::atomic<uint32_t>>(cq_ring_ptr_, params.cq_off.tail);
+  cq_mask_ = *RingPtr<uint32_t>(cq_ring_ptr_, params.cq_off.ring_mask);
+  cqes_ = RingPtr<io_uring_cqe>(cq_ring_ptr_, params.cq_off.cqes);
+
+  ProbeOps();
+  GRPC_TRACE_LOG(event_engine_poller, INFO)
+      << "io_uring ring fd " << ring_fd_ << " created with "
+      << params.sq_entries << " sq entries and " << params.cq_entries
+      << " cq entries, features 0x" << absl::StrCat(absl::Hex(features_));
+  return absl::OkStatus();
+}
+
+void IoUring::ProbeOps() {
+  const size_t probe_size =
+      sizeof(io_uring_probe) + kMaxOps * sizeof(io_uring_probe_op);
+  auto probe_buf = std::make_unique<char[]>(probe_size);
+  memset(probe_buf.get(), 0, probe_size);
+  auto* probe = reinterpret_cast<io_uring_probe*>(probe_buf.get());
+  if (IoUringRegister(ring_fd_, IORING_REGISTER_PROBE, probe, kMaxOps) < 0) {
+    return;
+  }
+  const size_t num_ops =
+      std::min<size_t>(static_cast<size_t>(probe->last_op) + 1, kMaxOps);
+  for (size_t i = 0; i < num_ops; ++i) {
+    supported_ops_[i] = (probe->ops[i].flags & IO_URING_OP_SUPPORTED) != 0;
+  }
+}
+
+IoUring::~IoUring() {
+  if (sqes_ != nullptr) munmap(sqes_, sqes_size_);
+  if (sq_ring_ptr_ != nullptr) munmap(sq_ring_ptr_, sq_ring_size_);
+  if (ring_fd_ >= 0) close(ring_fd_);
+}
+
+uint32_t IoUring::PendingLocked() const {
+  return sq_tail_ - sq_khead_->load(std::memory_order_acquire);
+}
+
+bool IoUring::Prepare(absl::FunctionRef<void(io_uring_sqe*)> prep) {
+  grpc_core::MutexLock lock(&sq_mu_);
+  if (PendingLocked() >= sq_entries_) {
+    // The kernel has not consumed the queue yet; push the backlog in so that
+    // there is room for this entry.
+    (void)Enter(PendingLocked(), 0, 0, nullptr, 0);
+    if (PendingLocked() >= sq_entries_) return false;
+  }
+  const uint32_t index = sq_tail_ & sq_mask_;
+  io_uring_sqe* sqe = &sqes_[index];
+  memset(sqe, 0, sizeof(*sqe));
+  prep(sqe);
+  sq_array_[index] = index;
+  ++sq_tail_;
+  // Publish the entry. The kernel only looks at it during the next
+  // io_uring_enter, whoever issues it.
+  sq_ktail_->store(sq_tail_, std::memory_order_release);
+  return true;
+}
+
+PosixErrorOr<int64_t> IoUring::Submit() {
+  const uint32_t pending = sq_ktail_->load(std::memory_order_acquire) -
+                           sq_khead_->load(std::memory_order_acquire);
+  if (pending == 0) return int64_t{0};
+  return Enter(pending, 0, 0, nullptr, 0);
+}
+
+PosixError IoUring::SubmitAndWait(EventEngine::Duration timeout) {
+  const uint32_t pending = sq_ktail_->load(std::memory_order_acquire) -
+                           sq_khead_->load(std::memory_order_acquire);
+  PosixErrorOr<int64_t> result;
+  if (timeout < EventEngine::Duration::zero()) {
+    result = Enter(pending, 1, IORING_ENTER_GETEVENTS, nullptr, 0);
+  } else {
+    __kernel_timespec ts;
+    const int64_t nanos =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(timeout).count();
+    ts.tv_sec = nanos / GPR_NS_PER_SEC;
+    ts.tv_nsec = nanos % GPR_NS_PER_SEC;
+    io_uring_getevents_arg arg;
+    memset(&arg, 0, sizeof(arg));
+    arg.sigmask = 0;
+    arg.sigmask_sz = _NSIG / 8;
+    arg.ts = reinterpret_cast<uint64_t>(&ts);
+    result = Enter(pending, 1, IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG,
+                   &arg, sizeof(arg));
+  }
+  if (result.ok()) return PosixError::Ok();
+  return PosixError::Error(result.errno_value().value_or(EINVAL));
+}
+
+PosixErrorOr<int64_t> IoUring::Enter(uint32_t to_submit, uint32_t min_complete,
+                                     uint32_t flags, void* arg,
+                                     size_t arg_size) {
+  int r = IoUringEnter(ring_fd_, to_submit, min_complete, flags, arg, arg_size);
+  if (r < 0) return PosixError::Error(errno);
+  return int64_t{r};
+}
+
+size_t IoUring::ReapCompletions(
+    absl::FunctionRef<void(const io_uring_cqe&)> fn, size_t max_completions) {
+  uint32_t head = cq_khead_->load(std::memory_order_relaxed);
+  const uint32_t tail = cq_ktail_->load(std::memory_order_acquire);
+  size_t reaped = 0;
+  while (head != tail && reaped < max_completions) {
+    fn(cqes_[head & cq_mask_]);
+    ++head;
+    ++reaped;
+  }
+  if (reaped > 0) cq_khead_->store(head, std::memory_order_release);
+  return reaped;
+}
+
+bool IoUring::HasCompletions() const {
+  return cq_khead_->load(std::memory_order_relaxed) !=
+         cq_ktail_->load(std::memory_order_acquire);
+}
+
+#ifdef GRPC_LINUX_IO_URING_BUF_RING
+
+PosixError IoUring::RegisterBufferRing(const io_uring_buf_reg& reg) {
+  if (IoUringRegister(ring_fd_, IORING_REGISTER_PBUF_RING, &reg, 1) < 0) {
+    return PosixError::Error(errno);
+  }
+  return PosixError::Ok();
+}
+
+PosixError IoUring::UnregisterBufferRing(uint16_t group_id) {
+  io_uring_buf_reg reg;
+  memset(&reg, 0, sizeof(reg));
+  reg.bgid = group_id;
+  if (IoUringRegister(ring_fd_, IORING_UNREGISTER_PBUF_RING, &reg, 1) < 0) {
+    return PosixError::Error(errno);
+  }
+  return PosixError::Ok();
+}
+
+absl::StatusOr<grpc_core::RefCountedPtr<IoUringBufferRing>>
+IoUringBufferRing::Create(IoUring* ring, uint16_t group_id,
+                          uint32_t num_buffers, uint32_t buffer_size) {
+  GRPC_CHECK(absl::has_single_bit(num_buffers));
+  GRPC_CHECK_LE(num_buffers, 32768u);
+  grpc_core::RefCountedPtr<IoUringBufferRing> buffer_ring(
+      new IoUringBufferRing(group_id, num_buffers, buffer_size));
+  absl::Status status = buffer_ring->Init(ring);
+  if (!status.ok()) return status;
+  return buffer_ring;
+}
+
+IoUringBufferRing::IoUringBufferRing(uint16_t group_id, uint32_t num_buffers,
+                                     uint32_t buffer_size)
+    : group_id_(group_id),
+      num_buffers_(num_buffers),
+      buffer_size_(buffer_size),
+      refs_(std::make_unique<BufferRefCount[]>(num_buffers)) {}
+
+absl::Status IoUringBufferRing::Init(IoUring* ring) {
+  // The kernel requires the ring of entries to be page aligned. The buffers
+  // are mapped separately: untouched pages are never committed, so a ring
+  // that only ever sees small reads stays small.
+  ring_size_ = num_buffers_ * sizeof(io_uring_buf);
+  void* ring_mem = mmap(nullptr, ring_size_, PROT_READ | PROT_WRITE,
+                        MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (ring_mem == MAP_FAILED) {
+    return absl::ResourceExhaustedError(absl::StrCat(
+        "io_uring: mmap buffer ring: ", grpc_core::StrError(errno)));
+  }
+  ring_ = static_cast<io_uring_buf_ring*>(ring_mem);
+  buffers_size_ = static_cast<size_t>(num_buffers_) * buffer_size_;
+  void* buffers = mmap(nullptr, buffers_size_, PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (buffers == MAP_FAILED) {
+    return absl::ResourceExhaustedError(absl::StrCat(
+        "io_uring: mmap provided buffers: ", grpc_core::StrError(errno)));
+  }
+  buffers_ = static_cast<char*>(buffers);
+  io_uring_buf_reg reg;
+  memset(&reg, 0, sizeof(reg));
+  reg.ring_addr = reinterpret_cast<uint64_t>(ring_);
+  reg.ring_entries = num_buffers_;
+  reg.bgid = group_id_;
+  PosixError error = ring->RegisterBufferRing(reg);
+  if (!error.ok()) {
+    return absl::UnavailableError(
+        absl::StrCat("io_uring: register buffer ring: ", error.StrError()));
+  }
+  for (uint32_t i = 0; i < num_buffers_; ++i) {
+    Recycle(static_cast<uint16_t>(i));
+  }
+  return absl::OkStatus();
+}
+
+IoUringBufferRing::~IoUringBufferRing() {
+  // The registration goes away with the ring's fd; by the time the last lent
+  // buffer has come back the owning poller has closed it.
+  if (buffers_ != nullptr) munmap(buffers_, buffers_size_);
+  if (ring_ != nullptr) munmap(ring_, ring_size_);
+}
+
+void IoUringBufferRing::Recycle(uint16_t buffer_id) {
+  grpc_core::MutexLock lock(&mu_);
+  // The entries are indexed by hand: in C++ the empty struct that
+  // __DECLARE_FLEX_ARRAY puts in front of io_uring_buf_ring::bufs takes a
+  // byte, which moves bufs 8 bytes past where the kernel reads the entries.
+  io_uring_buf* bufs = reinterpret_cast<io_uring_buf*>(ring_);
+  io_uring_buf* buf = &bufs[tail_ & (num_buffers_ - 1)];
+  buf->addr = reinterpret_cast<uint64_t>(BufferAt(buffer_id));
+  buf->len = buffer_size_;
+  buf->bid = buffer_id;
+  ++tail_;
+  // The tail overlays the reserved field of the first entry; publishing it
+  // makes the buffer visible to the kernel.
+  reinterpret_cast<std::atomic<uint16_t>*>(&bufs[0].resv)
+      ->store(tail_, std::memory_order_release);
+}
+
+Slice IoUringBufferRing::TakeBuffer(uint16_t buffer_id, size_t length) {
+  GRPC_DCHECK_LT(buffer_id, num_buffers_);
+  GRPC_DCHECK_LE(length, buffer_size_);
+  if (lent_.load(std::memory_order_relaxed) >= num_buffers_ / 2) {
+    grpc_core::global_stats().IncrementIoUringRecvBufferCopies();
+    Slice copy = Slice::FromCopiedBuffer(BufferAt(buffer_id), length);
+    Recycle(buffer_id);
+    return copy;
+  }
+  lent_.fetch_add(1, std::memory_order_relaxed);
+  BufferRefCount* refcount =
+      new (&refs_[buffer_id]) BufferRefCount(this, buffer_id);
+  Ref().release();
+  grpc_slice slice;
+  slice.refcount = refcount;
+  slice.data.refcounted.bytes = reinterpret_cast<uint8_t*>(BufferAt(buffer_id));
+  slice.data.refcounted.length = length;
+  return Slice(slice);
+}
+
+void IoUringBufferRing::BufferRefCount::Destroy(grpc_slice_refcount* p) {
+  auto* refcount = static_cast<BufferRefCount*>(p);
+  IoUringBufferRing* ring = refcount->ring;
+  ring->lent_.fetch_sub(1, std::memory_order_relaxed);
+  ring->Recycle(refcount->buffer_id);
+  ring->Unref();
+}
+
+bool IoUringBufferRingSupported() {
+  static const bool kSupported = []() {
+    if (!IoUringSupported()) return false;
+    auto ring = IoUring::Create(8);
+    if (!ring.ok()) return false;
+    auto buffer_ring = IoUringBufferRing::Create(ring->get(), 0, 1, 64);
+    if (!buffer_ring.ok()) {
+      GRPC_TRACE_LOG(event_engine_poller, INFO)
+          << "io_uring buffer rings are not available: "
+          << buffer_ring.status();
+      return false;
+    }
+    // Multishot receive has no feature bit or opcode of its own, and some
+    // kernels accept the ring registration without ever selecting from it.
+    // Receive one byte over a socketpair to find out.
+    int sv[2];
+    if (socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, sv) != 0) {
+      return false;
+    }
+    int res = -EINVAL;
+    uint32_t flags = 0;
+    if (write(sv[1], "x", 1) == 1 &&
+        (*ring)->Prepare([&](io_uring_sqe* sqe) {
+          sqe->opcode = IORING_OP_RECV;
+          sqe->fd = sv[0];
+          sqe->ioprio = IORING_RECV_MULTISHOT;
+          sqe->flags = IOSQE_BUFFER_SELECT;
+          sqe->buf_group = 0;
+        }) &&
+        (*ring)->SubmitAndWait(std::chrono::seconds(1)).ok()) {
+      (*ring)->ReapCompletions(
+          [&](const io_uring_cqe& cqe) {
+            res = cqe.res;
+            flags = cqe.flags;
+          },
+          1);
+    }
+    close(sv[0]);
+    close(sv[1]);
+    if (res != 1 || (flags & IORING_CQE_F_BUFFER) == 0) {
+      GRPC_TRACE_LOG(event_engine_poller, INFO)
+          << "io_uring multishot receive into a buffer ring is not "
+             "available: "
+          << (res < 0 ? grpc_core::StrError(-res) : absl::StrCat(res));
+      return false;
+    }
+    return true;
+  }();
+  return kSupported;
+}
+
+#endif  // GRPC_LINUX_IO_URING_BUF_RING
+
+bool IoUringSupported() {
+  static const bool kSupported = []() {
+    auto ring = IoUring::Create(8);
+    if (!ring.ok()) {
+      GRPC_TRACE_LOG(event_engine_poller, INFO)
+          << "io_uring is not available: " << ring.status();
+      return false;
+    }
+    for (uint8_t op : {IORING_OP_POLL_ADD, IORING_OP_POLL_REMOVE,
+                       IORING_OP_RECVMSG, IORING_OP_SENDMSG,
+                       IORING_OP_ASYNC_CANCEL}) {
+      if (!(*ring)->SupportsOp(op)) {
+        GRPC_TRACE_LOG(event_engine_poller, INFO)
+            << "io_uring is not available: opcode " << static_cast<int>(op)
+            << " is not supported";
+        return false;
+      }
+    }
+    return true;
+  }();
+  return kSupported;
+}
+
+}  // namespace grpc_event_engine::experimental
+
+#endif  // GRPC_LINUX_IO_URING
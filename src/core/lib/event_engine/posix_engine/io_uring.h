@@ -0,0 +1,228 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_IO_URING_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_IO_URING_H
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/event_engine/slice.h>
+#include <grpc/support/port_platform.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "src/core/lib/event_engine/posix_engine/file_descriptor_collection.h"
+#include "src/core/lib/iomgr/port.h"
+#include "src/core/lib/slice/slice_refcount.h"
+#include "src/core/util/ref_counted.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/sync.h"
+#include "absl/base/thread_annotations.h"
+#include "absl/functional/function_ref.h"
+#include "absl/status/statusor.h"
+
+#ifdef GRPC_LINUX_IO_URING
+#include <linux/io_uring.h>
+#endif  // GRPC_LINUX_IO_URING
+
+namespace grpc_event_engine::experimental {
+
+#ifdef GRPC_LINUX_IO_URING
+
+// A thin wrapper around an io_uring instance, driven through the raw
+// io_uring_setup/io_uring_enter/io_uring_register system calls so that no
+// additional library dependency is needed.
+//
+// Submission queue entries may be prepared from any thread: filling in an
+// entry and publishing it are serialized by an internal mutex. Completions
+// must only be reaped by one thread at a time; the poller guarantees this by
+// reaping from within Work().
+class IoUring {
+ public:
+  // Creates a ring with room for at least \a entries submissions. Returns an
+  // error if the running kernel does not provide io_uring or lacks one of the
+  // features the event engine relies on (a single ring mmap, enter with a
+  // timeout argument, fast poll and multishot poll).
+  static absl::StatusOr<std::unique_ptr<IoUring>> Create(uint32_t entries);
+
+  IoUring(const IoUring&) = delete;
+  IoUring& operator=(const IoUring&) = delete;
+  ~IoUring();
+
+  // Prepares a submission under the ring's submission lock. \a prep is handed a
+  // zeroed submission queue entry to fill in. If the submission queue is full,
+  // the already queued entries are submitted to make room. Returns false if no
+  // entry could be obtained.
+  bool Prepare(absl::FunctionRef<void(io_uring_sqe*)> prep);
+
+  // Submits every entry prepared so far with a single io_uring_enter. Entries
+  // prepared concurrently by other threads are submitted together with ours,
+  // so a burst of Prepare() calls costs one system call. Returns the number of
+  // entries consumed by the kernel.
+  PosixErrorOr<int64_t> Submit();
+
+  // Submits pending entries and blocks until at least one completion is
+  // available or \a timeout expires. A negative timeout waits forever.
+  PosixError SubmitAndWait(EventEngine::Duration timeout);
+
+  // Invokes \a fn for up to \a max_completions available completions and
+  // releases them back to the kernel. Returns the number of completions
+  // processed.
+  size_t ReapCompletions(absl::FunctionRef<void(const io_uring_cqe&)> fn,
+                         size_t max_completions = SIZE_MAX);
+
+  // Returns true if there are completions waiting to be reaped.
+  bool HasCompletions() const;
+
+#ifdef GRPC_LINUX_IO_URING_BUF_RING
+  // Registers a ring of provided buffers (see IoUringBufferRing) under
+  // buffer group \a group_id.
+  PosixError RegisterBufferRing(const io_uring_buf_reg& reg);
+  PosixError UnregisterBufferRing(uint16_t group_id);
+#endif  // GRPC_LINUX_IO_URING_BUF_RING
+
+  // Returns true if the kernel advertised support for \a opcode.
+  bool SupportsOp(uint8_t opcode) const {
+    return opcode < kMaxOps && supported_ops_[opcode];
+  }
+
+  int fd() const { return ring_fd_; }
+  uint32_t features() const { return features_; }
+
+ private:
+  static constexpr size_t kMaxOps = 64;
+
+  IoUring() = default;
+  absl::Status Init(uint32_t entries);
+  void ProbeOps();
+  uint32_t PendingLocked() const ABSL_EXCLUSIVE_LOCKS_REQUIRED(sq_mu_);
+  PosixErrorOr<int64_t> Enter(uint32_t to_submit, uint32_t min_complete,
+                              uint32_t flags, void* arg, size_t arg_size);
+
+  int ring_fd_ = -1;
+  uint32_t features_ = 0;
+  bool supported_ops_[kMaxOps] = {};
+
+  // Submission queue.
+  grpc_core::Mutex sq_mu_;
+  void* sq_ring_ptr_ = nullptr;
+  size_t sq_ring_size_ = 0;
+  io_uring_sqe* sqes_ = nullptr;
+  size_t sqes_size_ = 0;
+  std::atomic<uint32_t>* sq_khead_ = nullptr;
+  std::atomic<uint32_t>* sq_ktail_ = nullptr;
+  uint32_t* sq_array_ = nullptr;
+  uint32_t sq_mask_ = 0;
+  uint32_t sq_entries_ = 0;
+  // Local tail: entries up to here have been filled in but possibly not yet
+  // published to the kernel.
+  uint32_t sq_tail_ ABSL_GUARDED_BY(sq_mu_) = 0;
+
+  // Completion queue.
+  void* cq_ring_ptr_ = nullptr;
+  size_t cq_ring_size_ = 0;
+  std::atomic<uint32_t>* cq_khead_ = nullptr;
+  std::atomic<uint32_t>* cq_ktail_ = nullptr;
+  io_uring_cqe* cqes_ = nullptr;
+  uint32_t cq_mask_ = 0;
+};
+
+#ifdef GRPC_LINUX_IO_URING_BUF_RING
+
+// A ring of receive buffers shared with the kernel. Requests submitted with
+// IOSQE_BUFFER_SELECT and the ring's group id let the kernel pick a buffer
+// only once data has arrived, so no memory is set aside for sockets that are
+// waiting. The buffer is named in the completion and remains ours until it is
+// handed back to the ring.
+//
+// Buffers are lent out as slices and return to the ring when the last
+// reference to the slice is dropped, from any thread. The ring stays alive
+// until every lent buffer has come back.
+class IoUringBufferRing final
+    : public grpc_core::RefCounted<IoUringBufferRing,
+                                   grpc_core::NonPolymorphicRefCount> {
+ public:
+  // Creates \a num_buffers buffers of \a buffer_size bytes and registers them
+  // with \a ring. \a num_buffers must be a power of two no larger than 32768.
+  // Fails if the kernel does not support provided buffer rings.
+  static absl::StatusOr<grpc_core::RefCountedPtr<IoUringBufferRing>> Create(
+      IoUring* ring, uint16_t group_id, uint32_t num_buffers,
+      uint32_t buffer_size);
+
+  IoUringBufferRing(const IoUringBufferRing&) = delete;
+  IoUringBufferRing& operator=(const IoUringBufferRing&) = delete;
+  ~IoUringBufferRing();
+
+  uint16_t group_id() const { return group_id_; }
+
+  // Returns a slice of the first \a length bytes received into buffer
+  // \a buffer_id. Once half of the buffers are lent out, the data is copied
+  // instead and the buffer goes straight back to the ring, so that readers
+  // holding on to their data cannot starve every other socket.
+  Slice TakeBuffer(uint16_t buffer_id, size_t length);
+  // Hands buffer \a buffer_id back to the kernel without lending it out.
+  void Recycle(uint16_t buffer_id);
+
+ private:
+  // Reference count of a lent buffer. It is reconstructed in place each time
+  // the buffer is lent out.
+  struct BufferRefCount : public grpc_slice_refcount {
+    BufferRefCount() : grpc_slice_refcount(Destroy) {}
+    BufferRefCount(IoUringBufferRing* ring, uint16_t buffer_id)
+        : grpc_slice_refcount(Destroy), ring(ring), buffer_id(buffer_id) {}
+    static void Destroy(grpc_slice_refcount* p);
+
+    IoUringBufferRing* ring = nullptr;
+    uint16_t buffer_id = 0;
+  };
+
+  IoUringBufferRing(uint16_t group_id, uint32_t num_buffers,
+                    uint32_t buffer_size);
+  absl::Status Init(IoUring* ring);
+  char* BufferAt(uint16_t buffer_id) const {
+    return buffers_ + static_cast<size_t>(buffer_id) * buffer_size_;
+  }
+
+  const uint16_t group_id_;
+  const uint32_t num_buffers_;
+  const uint32_t buffer_size_;
+  // The ring of io_uring_buf entries read by the kernel, and the memory of
+  // the buffers they point to.
+  io_uring_buf_ring* ring_ = nullptr;
+  size_t ring_size_ = 0;
+  char* buffers_ = nullptr;
+  size_t buffers_size_ = 0;
+  std::unique_ptr<BufferRefCount[]> refs_;
+  std::atomic<uint32_t> lent_{0};
+  grpc_core::Mutex mu_;
+  uint16_t tail_ ABSL_GUARDED_BY(mu_) = 0;
+};
+
+// Returns true if multishot receives into an IoUringBufferRing work on the
+// running kernel. The result is computed once and cached.
+bool IoUringBufferRingSupported();
+
+#endif  // GRPC_LINUX_IO_URING_BUF_RING
+
+// Returns true if the running kernel supports the io_uring features needed by
+// the io_uring poller. The result is computed once and cached.
+bool IoUringSupported();
+
+#endif  // GRPC_LINUX_IO_URING
+
+}  // namespace grpc_event_engine::experimental
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_IO_URING_H
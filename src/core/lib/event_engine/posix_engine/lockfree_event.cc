@@ -199,7 +199,7 @@ bool LockfreeEvent::SetShutdown(absl::Status shutdown_error) {
   GPR_UNREACHABLE_CODE(return false);
 }
 
-void LockfreeEvent::SetReady() {
+void LockfreeEvent::SetReady(bool run_inline) {
   // The load() needs to be performed only once before entry
   // into the loop. This is because if any of the compare_exchange_strong
   // operations inside the loop return false, they automatically update curr
@@ -234,7 +234,11 @@ void LockfreeEvent::SetReady() {
           // notify_on (or set_shutdown)
           auto closure = reinterpret_cast<PosixEngineClosure*>(curr);
           closure->SetStatus(absl::OkStatus());
-          thread_pool_->Run(closure);
+          if (run_inline) {
+            closure->Run();
+          } else {
+            thread_pool_->Run(closure);
+          }
           return;
         }
         // else the state changed again (only possible by either a racing
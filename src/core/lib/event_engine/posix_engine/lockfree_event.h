@@ -54,8 +54,10 @@ class LockfreeEvent {
   // not yet been scheduled, it will be scheduled with \a shutdown_error.
   bool SetShutdown(absl::Status shutdown_error);
 
-  // Signals that the event has been received.
-  void SetReady();
+  // Signals that the event has been received. If \a run_inline, a closure
+  // waiting for the event is run on the calling thread instead of being
+  // scheduled on the thread pool.
+  void SetReady(bool run_inline = false);
 
  private:
   enum State { kClosureNotReady = 0, kClosureReady = 2, kShutdownBit = 1 };
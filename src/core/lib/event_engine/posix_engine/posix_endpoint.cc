@@ -26,18 +26,22 @@
 #include <cctype>
 #include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include <memory>
 #include <optional>
 #include <string>
+#include <utility>
 
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/event_engine/posix_engine/event_poller.h"
 #include "src/core/lib/event_engine/posix_engine/internal_errqueue.h"
 #include "src/core/lib/event_engine/posix_engine/posix_interface.h"
+#include "src/core/lib/event_engine/posix_engine/write_batcher.h"
 #include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/resource_quota/resource_quota.h"
 #include "src/core/lib/slice/slice.h"
+#include "src/core/lib/slice/slice_refcount.h"
 #include "src/core/telemetry/stats.h"
 #include "src/core/util/debug_location.h"
 #include "src/core/util/grpc_check.h"
@@ -62,6 +66,10 @@
 #include <sys/resource.h>      // IWYU pragma: keep
 #endif
 #include <netinet/in.h>  // IWYU pragma: keep
+#ifdef GRPC_LINUX_TCP_ZEROCOPY_RECEIVE
+#include <sys/mman.h>
+#include <unistd.h>
+#endif  // GRPC_LINUX_TCP_ZEROCOPY_RECEIVE
 
 #ifndef SOL_TCP
 #define SOL_TCP IPPROTO_TCP
@@ -89,6 +97,12 @@
 
 #define MAX_READ_IOVEC 64
 
+#ifdef GRPC_LINUX_TCP_ZEROCOPY_RECEIVE
+#ifndef TCP_ZEROCOPY_RECEIVE
+#define TCP_ZEROCOPY_RECEIVE 35
+#endif
+#endif  // GRPC_LINUX_TCP_ZEROCOPY_RECEIVE
+
 namespace grpc_event_engine::experimental {
 
 namespace {
@@ -103,6 +117,7 @@ PosixErrorOr<int64_t> TcpSend(EventEnginePosixInterface* posix_interface,
   PosixErrorOr<int64_t> send_result;
   do {
     grpc_core::global_stats().IncrementSyscallWrite();
+    grpc_core::global_stats().IncrementTcpWritesPerSyscall(1);
     send_result =
         posix_interface->SendMsg(fd, msg, SENDMSG_FLAGS | additional_flags);
     *saved_errno = send_result.errno_value().value_or(0);
@@ -212,6 +227,17 @@ bool CmsgIsZeroCopy(const cmsghdr& cmsg) {
 }
 #endif  // GRPC_LINUX_ERRQUEUE
 
+#ifdef GRPC_LINUX_TCP_ZEROCOPY_RECEIVE
+// The leading fields of struct tcp_zerocopy_receive. <linux/tcp.h> cannot be
+// included alongside <netinet/tcp.h>, and the kernel accepts the shorter
+// struct.
+struct TcpZerocopyReceiveArgs {
+  uint64_t address;
+  uint32_t length;
+  uint32_t recv_skip_hint;
+};
+#endif  // GRPC_LINUX_TCP_ZEROCOPY_RECEIVE
+
 absl::Status PosixOSError(const PosixErrorOr<int64_t>& error_no,
                           absl::string_view call_name) {
   if (error_no.IsPosixError()) {
@@ -313,6 +339,17 @@ bool PosixEndpointImpl::TcpDoRead(absl::Status& status) {
   GRPC_CHECK_NE(incoming_buffer_->Length(), 0u);
   GRPC_DCHECK_GT(min_progress_size_, 0);
 
+  size_t zerocopy_bytes = 0;
+#ifdef GRPC_LINUX_TCP_ZEROCOPY_RECEIVE
+  if (rx_zerocopy_enabled_ &&
+      std::max({inq_, min_progress_size_, static_cast<int>(target_length_)}) >=
+          rx_zerocopy_threshold_) {
+    // Whatever could not be mapped, such as a trailing partial page, is
+    // copied by the recvmsg below.
+    zerocopy_bytes = TcpZerocopyReceive();
+  }
+#endif  // GRPC_LINUX_TCP_ZEROCOPY_RECEIVE
+
   do {
     // Assume there is something on the queue. If we receive TCP_INQ from
     // kernel, we will update this value, otherwise, we have to assume there is
@@ -345,7 +382,7 @@ bool PosixEndpointImpl::TcpDoRead(absl::Status& status) {
     if (res.IsPosixError(EAGAIN)) {
       // NB: After calling call_read_cb a parallel call of the read handler may
       // be running.
-      if (total_read_bytes > 0) {
+      if (total_read_bytes > 0 || zerocopy_bytes > 0) {
         break;
       }
       FinishEstimate();
@@ -355,7 +392,7 @@ bool PosixEndpointImpl::TcpDoRead(absl::Status& status) {
     ssize_t read_bytes = res.value_or(-1);
     // We have read something in previous reads. We need to deliver those bytes
     // to the upper layer.
-    if (read_bytes <= 0 && total_read_bytes >= 1) {
+    if (read_bytes <= 0 && total_read_bytes + zerocopy_bytes >= 1) {
       break;
     }
 
@@ -431,12 +468,20 @@ bool PosixEndpointImpl::TcpDoRead(absl::Status& status) {
     inq_ = 1;
   }
 
-  GRPC_DCHECK_GT(total_read_bytes, 0u);
   status = absl::OkStatus();
+  return FinishRead(total_read_bytes);
+}
+
+bool PosixEndpointImpl::FinishRead(size_t total_read_bytes) {
+  const size_t zerocopy_bytes = zerocopy_read_buffer_.Length();
+  GRPC_DCHECK_GT(total_read_bytes + zerocopy_bytes, 0u);
   if (grpc_core::IsTcpFrameSizeTuningEnabled()) {
     // Update min progress size based on the total number of bytes read in
     // this round.
-    min_progress_size_ -= total_read_bytes;
+    min_progress_size_ -= total_read_bytes + zerocopy_bytes;
+    // Mapped pages precede the bytes copied into incoming_buffer_.
+    zerocopy_read_buffer_.MoveFirstNBytesIntoSliceBuffer(zerocopy_bytes,
+                                                         last_read_buffer_);
     if (min_progress_size_ > 0) {
       // There is still some bytes left to be read before we can signal
       // the read as complete. Append the bytes read so far into
@@ -463,12 +508,266 @@ bool PosixEndpointImpl::TcpDoRead(absl::Status& status) {
     incoming_buffer_->MoveLastNBytesIntoSliceBuffer(
         incoming_buffer_->Length() - total_read_bytes, last_read_buffer_);
   }
+  if (zerocopy_bytes > 0) {
+    incoming_buffer_->MoveFirstNBytesIntoSliceBuffer(total_read_bytes,
+                                                     zerocopy_read_buffer_);
+    incoming_buffer_->Swap(zerocopy_read_buffer_);
+  }
   return true;
 }
 
+#ifdef GRPC_LINUX_TCP_ZEROCOPY_RECEIVE
+Slice ZerocopyReceiveMapping::MakeSlice() {
+  grpc_slice slice;
+  slice.refcount = this;
+  slice.data.refcounted.bytes = static_cast<uint8_t*>(address_);
+  slice.data.refcounted.length = length_;
+  return Slice(slice);
+}
+
+void ZerocopyReceiveMapping::Destroy(grpc_slice_refcount* p) {
+  auto* mapping = static_cast<ZerocopyReceiveMapping*>(p);
+  munmap(mapping->address_, mapping->length_);
+  delete mapping;
+}
+
+size_t PosixEndpointImpl::TcpZerocopyReceive() {
+  // Large enough for the biggest tensors we expect in one read, without
+  // reserving an unbounded amount of address space.
+  static constexpr size_t kMaxZerocopyReceiveBytes = 16 * 1024 * 1024;
+  static constexpr int kMaxZerocopyReceiveMisses = 16;
+  static const size_t kPageSize = sysconf(_SC_PAGESIZE);
+  const size_t expected = static_cast<size_t>(
+      std::max({inq_, min_progress_size_, static_cast<int>(target_length_)}));
+  const size_t length =
+      std::min(expected, kMaxZerocopyReceiveBytes) / kPageSize * kPageSize;
+  if (length == 0) return 0;
+  EventEnginePosixInterface& posix_interface = poller_->posix_interface();
+  auto fd = posix_interface.GetFd(handle_->WrappedFd());
+  if (!fd.ok()) return 0;
+  // The kernel maps received pages into this region of address space.
+  void* address = mmap(nullptr, length, PROT_READ, MAP_SHARED, *fd, 0);
+  if (address == MAP_FAILED) {
+    // Not a TCP socket, or the kernel does not support mapping it.
+    GRPC_TRACE_LOG(event_engine_endpoint, INFO)
+        << "Endpoint[" << this
+        << "]: Rx zero-copy disabled: mmap: " << grpc_core::StrError(errno);
+    rx_zerocopy_enabled_ = false;
+    return 0;
+  }
+  TcpZerocopyReceiveArgs zc = {};
+  zc.address = reinterpret_cast<uintptr_t>(address);
+  zc.length = static_cast<uint32_t>(length);
+  socklen_t zc_len = sizeof(zc);
+  PosixError result;
+  do {
+    grpc_core::global_stats().IncrementSyscallRead();
+    result = posix_interface.GetSockOpt(handle_->WrappedFd(), IPPROTO_TCP,
+                                        TCP_ZEROCOPY_RECEIVE, &zc, &zc_len);
+  } while (result.IsPosixError(EINTR));
+  if (!result.ok() || zc.length == 0) {
+    munmap(address, length);
+    if (result.ok()) {
+      // Less than a page is queued, or it is not page aligned: copy it.
+      // Alignment depends on the path the data takes (MTU, header split), so
+      // if it keeps failing, stop paying for the extra syscalls.
+      grpc_core::global_stats().IncrementTcpReadZerocopyFallback();
+      if (++rx_zerocopy_misses_ >= kMaxZerocopyReceiveMisses) {
+        GRPC_TRACE_LOG(event_engine_endpoint, INFO)
+            << "Endpoint[" << this
+            << "]: Rx zero-copy disabled: received data is not page aligned";
+        rx_zerocopy_enabled_ = false;
+      }
+    } else if (!result.IsPosixError(EAGAIN) &&
+               !result.IsWrongGenerationError()) {
+      GRPC_TRACE_LOG(event_engine_endpoint, INFO)
+          << "Endpoint[" << this
+          << "]: Rx zero-copy disabled: getsockopt(TCP_ZEROCOPY_RECEIVE): "
+          << result.StrError();
+      rx_zerocopy_enabled_ = false;
+    }
+    return 0;
+  }
+  rx_zerocopy_misses_ = 0;
+  if (zc.length < length) {
+    munmap(static_cast<char*>(address) + zc.length, length - zc.length);
+  }
+  grpc_core::global_stats().IncrementTcpReadZerocopySize(zc.length);
+  AddToEstimate(zc.length);
+  zerocopy_read_buffer_.Append(
+      (new ZerocopyReceiveMapping(address, zc.length))->MakeSlice());
+  return zc.length;
+}
+#endif  // GRPC_LINUX_TCP_ZEROCOPY_RECEIVE
+
+absl::Status PosixEndpointImpl::AsyncIoError(absl::Status error) const {
+  // Operations interrupted by ShutdownHandle report the shutdown status, which
+  // is already annotated.
+  if (handle_->IsHandleShutdown()) return error;
+  return TcpAnnotateError(std::move(error));
+}
+
+void PosixEndpointImpl::StartAsyncRead() {
+  if (!memory_owner_.is_valid()) {
+    engine_->Run([this]() {
+      OnAsyncRead(absl::UnknownError("Shutting down endpoint"));
+    });
+    return;
+  }
+  if (recv_buffers_ && !recv_buffers_exhausted_) {
+    async_io_->RecvBuffers(incoming_buffer_,
+                           [this](absl::StatusOr<int64_t> result) {
+                             OnAsyncRead(std::move(result));
+                           });
+    return;
+  }
+  MaybeMakeReadSlices();
+  const size_t iov_len =
+      std::min<size_t>(MAX_READ_IOVEC, incoming_buffer_->Count());
+  async_read_iov_.resize(iov_len);
+  for (size_t i = 0; i < iov_len; i++) {
+    MutableSlice& slice =
+        internal::SliceCast<MutableSlice>(incoming_buffer_->MutableSliceAt(i));
+    async_read_iov_[i].iov_base = slice.begin();
+    async_read_iov_[i].iov_len = slice.length();
+  }
+  memset(&async_read_msg_, 0, sizeof(async_read_msg_));
+  async_read_msg_.msg_iov = async_read_iov_.data();
+  async_read_msg_.msg_iovlen = static_cast<msg_iovlen_type>(iov_len);
+  grpc_core::global_stats().IncrementTcpReadOffer(incoming_buffer_->Length());
+  grpc_core::global_stats().IncrementTcpReadOfferIovSize(
+      incoming_buffer_->Count());
+  async_io_->RecvMsg(&async_read_msg_,
+                     [this](absl::StatusOr<int64_t> result) {
+                       OnAsyncRead(std::move(result));
+                     });
+}
+
+void PosixEndpointImpl::OnAsyncRead(absl::StatusOr<int64_t> result) {
+  absl::Status status;
+  absl::AnyInvocable<void(absl::Status)> cb = nullptr;
+  grpc_core::EnsureRunInExecCtx([&, this]() mutable {
+    grpc_core::MutexLock lock(&read_mu_);
+    if (result.ok() && *result > 0) {
+      grpc_core::global_stats().IncrementTcpReadSize(*result);
+      AddToEstimate(static_cast<size_t>(*result));
+      // Each completion is a full read round: the kernel only completes the
+      // request once data is available.
+      FinishEstimate();
+      const bool done = recv_buffers_ && !recv_buffers_exhausted_
+                            ? FinishBufferRead(static_cast<size_t>(*result))
+                            : FinishRead(static_cast<size_t>(*result));
+      if (!done) {
+        StartAsyncRead();
+        return;
+      }
+      status = absl::OkStatus();
+    } else if (recv_buffers_ && absl::IsResourceExhausted(result.status())) {
+      // The poller is out of buffers. Finish this read into our own memory,
+      // with whatever arrived so far staged in last_read_buffer_ the way
+      // FinishRead expects.
+      grpc_core::global_stats().IncrementIoUringRecvBufferExhausted();
+      recv_buffers_exhausted_ = true;
+      incoming_buffer_->Swap(last_read_buffer_);
+      StartAsyncRead();
+      return;
+    } else {
+      incoming_buffer_->Clear();
+      if (result.ok()) {
+        status = TcpAnnotateError(absl::InternalError("Socket closed"));
+      } else {
+        status = AsyncIoError(result.status());
+      }
+    }
+    GRPC_TRACE_LOG(event_engine_endpoint, INFO)
+        << "Endpoint[" << this << "]: Read complete";
+    cb = std::move(read_cb_);
+    read_cb_ = nullptr;
+    incoming_buffer_ = nullptr;
+  });
+  if (cb == nullptr) return;
+  cb(status);
+  Unref();
+}
+
+bool PosixEndpointImpl::FinishBufferRead(size_t read_bytes) {
+  GRPC_DCHECK_GT(read_bytes, 0u);
+  // Received data is appended to incoming_buffer_ directly, so unlike
+  // FinishRead there is no spare space to set aside.
+  if (grpc_core::IsTcpFrameSizeTuningEnabled()) {
+    min_progress_size_ -= read_bytes;
+    if (min_progress_size_ > 0) return false;
+  }
+  min_progress_size_ = 1;
+  return true;
+}
+
+void PosixEndpointImpl::StartAsyncWrite() {
+  const size_t iov_len = std::min<size_t>(MAX_WRITE_IOVEC,
+                                          outgoing_buffer_->Count());
+  size_t sending_length = 0;
+  async_write_iov_.clear();
+  for (size_t i = 0; i < iov_len; i++) {
+    MutableSlice& slice =
+        internal::SliceCast<MutableSlice>(outgoing_buffer_->MutableSliceAt(i));
+    const size_t offset = i == 0 ? outgoing_byte_idx_ : 0;
+    struct iovec iov;
+    iov.iov_base = slice.begin() + offset;
+    iov.iov_len = slice.length() - offset;
+    sending_length += iov.iov_len;
+    async_write_iov_.push_back(iov);
+  }
+  GRPC_CHECK(!async_write_iov_.empty());
+  memset(&async_write_msg_, 0, sizeof(async_write_msg_));
+  async_write_msg_.msg_iov = async_write_iov_.data();
+  async_write_msg_.msg_iovlen =
+      static_cast<msg_iovlen_type>(async_write_iov_.size());
+  grpc_core::global_stats().IncrementTcpWriteSize(sending_length);
+  grpc_core::global_stats().IncrementTcpWriteIovSize(async_write_iov_.size());
+  async_io_->SendMsg(&async_write_msg_, SENDMSG_FLAGS,
+                     [this](absl::StatusOr<int64_t> result) {
+                       OnAsyncWrite(std::move(result));
+                     });
+}
+
+void PosixEndpointImpl::OnAsyncWrite(absl::StatusOr<int64_t> result) {
+  absl::Status status = absl::OkStatus();
+  if (!result.ok()) {
+    status = AsyncIoError(result.status());
+    outgoing_buffer_->Clear();
+  } else {
+    bytes_counter_ += *result;
+    // Drop what was written. A partial write leaves the remainder of the
+    // first slice to be sent from outgoing_byte_idx_.
+    size_t written = static_cast<size_t>(*result);
+    while (written > 0) {
+      const size_t remaining =
+          outgoing_buffer_->RefSlice(0).length() - outgoing_byte_idx_;
+      if (written < remaining) {
+        outgoing_byte_idx_ += written;
+        break;
+      }
+      written -= remaining;
+      outgoing_buffer_->TakeFirst();
+      outgoing_byte_idx_ = 0;
+    }
+    if (outgoing_buffer_->Count() > 0) {
+      StartAsyncWrite();
+      return;
+    }
+  }
+  GRPC_TRACE_LOG(event_engine_endpoint, INFO)
+      << "Endpoint[" << this << "]: Write complete: " << status;
+  absl::AnyInvocable<void(absl::Status)> cb = std::move(write_cb_);
+  write_cb_ = nullptr;
+  cb(status);
+  Unref();
+}
+
 void PosixEndpointImpl::PerformReclamation() {
   read_mu_.Lock();
-  if (incoming_buffer_ != nullptr) {
+  // With async_io_ the handle may be filling incoming_buffer_ right now.
+  if (incoming_buffer_ != nullptr && async_io_ == nullptr) {
     incoming_buffer_->Clear();
   }
   has_posted_reclaimer_ = false;
@@ -617,13 +916,27 @@ bool PosixEndpointImpl::Read(absl::AnyInvocable<void(absl::Status)> on_read,
   GRPC_CHECK(read_cb_ == nullptr);
   incoming_buffer_ = buffer;
   incoming_buffer_->Clear();
-  incoming_buffer_->Swap(last_read_buffer_);
+  if (recv_buffers_) {
+    // Spare space left over from a read that ran out of poller buffers is
+    // not needed.
+    last_read_buffer_.Clear();
+    recv_buffers_exhausted_ = false;
+  } else {
+    incoming_buffer_->Swap(last_read_buffer_);
+  }
   if (grpc_core::IsTcpFrameSizeTuningEnabled()) {
     min_progress_size_ = std::max(static_cast<int>(args.read_hint_bytes()), 1);
   } else {
     min_progress_size_ = 1;
   }
   Ref().release();
+  if (async_io_ != nullptr) {
+    // The handle reads for us and reports completion, so there is no
+    // readiness edge to wait for.
+    read_cb_ = std::move(on_read);
+    StartAsyncRead();
+    return false;
+  }
   if (is_first_read_) {
     read_cb_ = std::move(on_read);
     UpdateRcvLowat();
@@ -1223,6 +1536,29 @@ bool PosixEndpointImpl::Write(
   if (args.has_metrics_sink() && poller_->CanTrackErrors()) {
     outgoing_buffer_write_event_sink_ = args.TakeMetricsSink();
   }
+  if (write_batcher_ != nullptr && zerocopy_send_record == nullptr &&
+      !outgoing_buffer_write_event_sink_.has_value()) {
+    // Sent together with the writes of other connections on this poller.
+    Ref().release();
+    write_cb_ = std::move(on_writable);
+    write_batcher_->Add([this]() {
+      if (async_io_ != nullptr) {
+        StartAsyncWrite();
+      } else {
+        HandleWrite(absl::OkStatus());
+      }
+    });
+    return false;
+  }
+  if (async_io_ != nullptr && zerocopy_send_record == nullptr &&
+      !outgoing_buffer_write_event_sink_.has_value()) {
+    // Zerocopy and timestamped writes need the error queue and stay on the
+    // readiness based path below.
+    Ref().release();
+    write_cb_ = std::move(on_writable);
+    StartAsyncWrite();
+    return false;
+  }
 
   bool flush_result = zerocopy_send_record != nullptr
                           ? TcpFlushZerocopy(zerocopy_send_record, status)
@@ -1361,6 +1697,18 @@ PosixEndpointImpl::PosixEndpointImpl(EventHandle* handle,
   on_error_ = PosixEngineClosure::ToPermanentClosure(
       [this](absl::Status status) { HandleError(std::move(status)); });
 
+  async_io_ = handle_->AsyncIo();
+  if (grpc_core::IsEventEngineWriteBatchingEnabled()) {
+    write_batcher_ = poller_->GetWriteBatcher();
+  }
+  recv_buffers_ = async_io_ != nullptr && async_io_->SupportsRecvBuffers();
+#ifdef GRPC_LINUX_TCP_ZEROCOPY_RECEIVE
+  // Reads through async_io_ never reach TcpDoRead.
+  rx_zerocopy_enabled_ =
+      options.tcp_rx_zero_copy_enabled && async_io_ == nullptr;
+  rx_zerocopy_threshold_ = options.tcp_rx_zerocopy_recv_bytes_threshold;
+#endif  // GRPC_LINUX_TCP_ZEROCOPY_RECEIVE
+
   // Start being notified on errors if poller can track errors.
   if (poller_->CanTrackErrors()) {
     Ref().release();
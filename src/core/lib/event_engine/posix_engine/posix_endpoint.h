@@ -21,6 +21,7 @@
 
 #include <grpc/event_engine/event_engine.h>
 #include <grpc/event_engine/memory_allocator.h>
+#include <grpc/event_engine/slice.h>
 #include <grpc/event_engine/slice_buffer.h>
 #include <grpc/support/alloc.h>
 
@@ -28,6 +29,7 @@
 #include <cstdint>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "src/core/lib/event_engine/posix.h"
 #include "src/core/lib/event_engine/posix_engine/event_poller.h"
@@ -36,6 +38,7 @@
 #include "src/core/lib/event_engine/posix_engine/traced_buffer_list.h"
 #include "src/core/lib/iomgr/port.h"
 #include "src/core/lib/resource_quota/memory_quota.h"
+#include "src/core/lib/slice/slice_refcount.h"
 #include "src/core/util/crash.h"
 #include "src/core/util/grpc_check.h"
 #include "src/core/util/ref_counted.h"
@@ -459,6 +462,25 @@ class TcpZerocopySendCtx {
   OptMemState zcopy_enobuf_state_ ABSL_GUARDED_BY(mu_) = OptMemState::kOpen;
 };
 
+#ifdef GRPC_LINUX_TCP_ZEROCOPY_RECEIVE
+// Pages mapped by TCP_ZEROCOPY_RECEIVE, unmapped when the last slice
+// referring to them is released.
+class ZerocopyReceiveMapping final : public grpc_slice_refcount {
+ public:
+  ZerocopyReceiveMapping(void* address, size_t length)
+      : grpc_slice_refcount(Destroy), address_(address), length_(length) {}
+
+  // Takes ownership of the mapping.
+  Slice MakeSlice();
+
+ private:
+  static void Destroy(grpc_slice_refcount* p);
+
+  void* const address_;
+  const size_t length_;
+};
+#endif  // GRPC_LINUX_TCP_ZEROCOPY_RECEIVE
+
 class PosixEndpointImpl : public grpc_core::RefCounted<PosixEndpointImpl> {
  public:
   PosixEndpointImpl(
@@ -501,6 +523,28 @@ class PosixEndpointImpl : public grpc_core::RefCounted<PosixEndpointImpl> {
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
   void MaybeMakeReadSlices() ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
   bool TcpDoRead(absl::Status& status) ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
+  // Accounts for the pages in zerocopy_read_buffer_ and the \a
+  // total_read_bytes read into incoming_buffer_ in this round. Returns false if
+  // min_progress_size_ has not been reached yet and more data must be read
+  // before the read callback can run.
+  bool FinishRead(size_t total_read_bytes)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
+#ifdef GRPC_LINUX_TCP_ZEROCOPY_RECEIVE
+  // Maps whole pages from the front of the receive queue into the process
+  // with TCP_ZEROCOPY_RECEIVE and appends them to zerocopy_read_buffer_.
+  // Returns the number of bytes mapped.
+  size_t TcpZerocopyReceive() ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
+#endif  // GRPC_LINUX_TCP_ZEROCOPY_RECEIVE
+  // Completion-based I/O, used when the handle implements EventHandleAsyncIo.
+  void StartAsyncRead() ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
+  void OnAsyncRead(absl::StatusOr<int64_t> result);
+  // As FinishRead, for \a read_bytes appended to incoming_buffer_ by
+  // EventHandleAsyncIo::RecvBuffers.
+  bool FinishBufferRead(size_t read_bytes)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
+  void StartAsyncWrite();
+  void OnAsyncWrite(absl::StatusOr<int64_t> result);
+  absl::Status AsyncIoError(absl::Status error) const;
   void FinishEstimate();
   void AddToEstimate(size_t bytes);
   void MaybePostReclaimer() ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
@@ -544,6 +588,18 @@ class PosixEndpointImpl : public grpc_core::RefCounted<PosixEndpointImpl> {
   // cache whether kernel supports inq.
   bool inq_capable_ = false;
 
+  // Set if reads expected to return at least rx_zerocopy_threshold_ bytes map
+  // the received pages instead of copying them. Cleared if the socket turns
+  // out not to support TCP_ZEROCOPY_RECEIVE.
+  bool rx_zerocopy_enabled_ = false;
+  int rx_zerocopy_threshold_ = 0;
+  // Consecutive attempts that could not map anything.
+  int rx_zerocopy_misses_ = 0;
+  // Pages mapped by the current TcpDoRead. They precede the bytes copied into
+  // incoming_buffer_.
+  grpc_event_engine::experimental::SliceBuffer zerocopy_read_buffer_
+      ABSL_GUARDED_BY(read_mu_);
+
   grpc_event_engine::experimental::SliceBuffer* outgoing_buffer_ = nullptr;
   // byte within outgoing_buffer's slices[0] to write next.
   size_t outgoing_byte_idx_ = 0;
@@ -555,6 +611,23 @@ class PosixEndpointImpl : public grpc_core::RefCounted<PosixEndpointImpl> {
   absl::AnyInvocable<void(absl::Status)> read_cb_ ABSL_GUARDED_BY(read_mu_);
   absl::AnyInvocable<void(absl::Status)> write_cb_;
 
+  // Non-null if the handle performs reads and writes on our behalf. The
+  // message headers below are handed to it and must stay valid until the
+  // corresponding operation completes.
+  EventHandleAsyncIo* async_io_ = nullptr;
+  // Set if async_io_ can receive into buffers owned by the poller. Then reads
+  // use RecvBuffers and no read memory is allocated per connection, unless
+  // the poller's buffers ran out during the current read.
+  bool recv_buffers_ = false;
+  bool recv_buffers_exhausted_ ABSL_GUARDED_BY(read_mu_) = false;
+  struct msghdr async_read_msg_ ABSL_GUARDED_BY(read_mu_);
+  std::vector<struct iovec> async_read_iov_ ABSL_GUARDED_BY(read_mu_);
+  struct msghdr async_write_msg_;
+  std::vector<struct iovec> async_write_iov_;
+  // Non-null if writes are handed to the poller's WriteBatcher rather than
+  // started by Write itself.
+  WriteBatcher* write_batcher_ = nullptr;
+
   grpc_event_engine::experimental::EventEngine::ResolvedAddress peer_address_;
   grpc_event_engine::experimental::EventEngine::ResolvedAddress local_address_;
 
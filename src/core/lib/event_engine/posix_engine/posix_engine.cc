@@ -21,6 +21,7 @@
 
 #include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <cstdint>
 #include <cstring>
 #include <memory>
@@ -29,6 +30,7 @@
 #include <utility>
 #include <vector>
 
+#include "src/core/config/config_vars.h"
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/event_engine/ares_resolver.h"
 #include "src/core/lib/event_engine/poller.h"
@@ -209,16 +211,30 @@ void RegisterEventEngineForFork(
 PosixEventEngine::PollingCycle::PollingCycle(
     std::shared_ptr<ThreadPool> executor,
     std::shared_ptr<PosixEventPoller> poller)
-    : executor_(std::move(executor)),
-      poller_(std::move(poller)),
-      is_scheduled_(1) {
+    : executor_(std::move(executor)), poller_(std::move(poller)) {
   GRPC_CHECK_NE(poller_, nullptr);
+  if (grpc_core::ConfigVars::Get().ExperimentalEventEngineBusyPollUs() > 0) {
+    busy_poll_thread_.emplace(
+        "event_engine_busy_poll",
+        [](void* arg) { static_cast<PollingCycle*>(arg)->BusyPollLoop(); },
+        this);
+    busy_poll_thread_->Start();
+    return;
+  }
+  {
+    grpc_core::MutexLock lock(&mu_);
+    is_scheduled_ = 1;
+  }
   executor_->Run([this]() { PollerWorkInternal(); });
 }
 
 PosixEventEngine::PollingCycle::~PollingCycle() {
   done_ = true;
   poller_->Kick();
+  if (busy_poll_thread_.has_value()) {
+    busy_poll_thread_->Join();
+    return;
+  }
   grpc_core::MutexLock lock(&mu_);
   while (is_scheduled_ > 0) {
     cond_.Wait(&mu_);
@@ -246,6 +262,22 @@ void PosixEventEngine::PollingCycle::PollerWorkInternal() {
   cond_.SignalAll();
 }
 
+void PosixEventEngine::PollingCycle::BusyPollLoop() {
+  const auto spin_budget = std::chrono::microseconds(
+      grpc_core::ConfigVars::Get().ExperimentalEventEngineBusyPollUs());
+  auto spin_until = std::chrono::steady_clock::now() + spin_budget;
+  while (!done_) {
+    const bool spin = std::chrono::steady_clock::now() < spin_until;
+    // The poller runs ready closures on this thread, so there is nothing to
+    // schedule between rounds.
+    auto result = poller_->Work(spin ? EventEngine::Duration::zero() : 24h,
+                                []() {});
+    if (result == Poller::WorkResult::kOk) {
+      spin_until = std::chrono::steady_clock::now() + spin_budget;
+    }
+  }
+}
+
 void AsyncConnect::Start(EventEngine::Duration timeout) {
   on_writable_ = PosixEngineClosure::ToPermanentClosure(
       [this](absl::Status status) { OnWritable(std::move(status)); });
@@ -470,6 +502,10 @@ PosixEventEngine::~PosixEventEngine() {
     GRPC_CHECK(GPR_LIKELY(known_handles_.empty()));
   }
 #if defined(GRPC_POSIX_SOCKET_TCP)
+  {
+    grpc_core::MutexLock lock(&mu_);
+    shard_polling_cycles_.clear();
+  }
   polling_cycle_.reset();
 #endif  // defined(GRPC_POSIX_SOCKET_TCP)
   timer_manager_->Shutdown();
@@ -836,7 +872,9 @@ PosixEventEngine::CreateListener(
       };
   return std::make_unique<PosixEngineListener>(
       std::move(posix_on_accept), std::move(on_shutdown), config,
-      std::move(memory_allocator_factory), poller_.get(), shared_from_this());
+      std::move(memory_allocator_factory), poller_.get(), shared_from_this(),
+      ListenerShardPollers(
+          TcpOptionsFromEndpointConfig(config).listener_shards));
 }
 
 absl::StatusOr<std::unique_ptr<EventEngine::Listener>>
@@ -847,7 +885,31 @@ PosixEventEngine::CreatePosixListener(
     std::unique_ptr<MemoryAllocatorFactory> memory_allocator_factory) {
   return std::make_unique<PosixEngineListener>(
       std::move(on_accept), std::move(on_shutdown), config,
-      std::move(memory_allocator_factory), poller_.get(), shared_from_this());
+      std::move(memory_allocator_factory), poller_.get(), shared_from_this(),
+      ListenerShardPollers(
+          TcpOptionsFromEndpointConfig(config).listener_shards));
+}
+
+std::vector<PosixEventPoller*> PosixEventEngine::ListenerShardPollers(
+    int num_shards) {
+  std::vector<PosixEventPoller*> pollers;
+  if (num_shards <= 1 || poller_ == nullptr) return pollers;
+  grpc_core::MutexLock lock(&mu_);
+  // Engines made by MakeTestOnlyPosixEventEngine leave polling to the test.
+  if (!polling_cycle_.has_value()) return pollers;
+  while (shard_pollers_.size() < static_cast<size_t>(num_shards - 1)) {
+    auto poller = MakeDefaultPoller(executor_);
+    if (poller == nullptr) break;
+    shard_polling_cycles_.push_back(
+        std::make_unique<PollingCycle>(executor_, poller));
+    shard_pollers_.push_back(std::move(poller));
+  }
+  for (int i = 0; i < num_shards - 1 &&
+                  static_cast<size_t>(i) < shard_pollers_.size();
+       ++i) {
+    pollers.push_back(shard_pollers_[i].get());
+  }
+  return pollers;
 }
 
 void PosixEventEngine::SchedulePoller() {
@@ -857,10 +919,16 @@ void PosixEventEngine::SchedulePoller() {
   grpc_core::MutexLock lock(&mu_);
   GRPC_CHECK(!polling_cycle_.has_value());
   polling_cycle_.emplace(executor_, poller_);
+  GRPC_CHECK(shard_polling_cycles_.empty());
+  for (const auto& poller : shard_pollers_) {
+    shard_polling_cycles_.push_back(
+        std::make_unique<PollingCycle>(executor_, poller));
+  }
 }
 
 void PosixEventEngine::ResetPollCycle() {
   grpc_core::MutexLock lock(&mu_);
+  shard_polling_cycles_.clear();
   polling_cycle_.reset();
 }
 
@@ -928,10 +996,20 @@ void PosixEventEngine::AfterFork(OnForkRole on_fork_role) {
       if (poller_ != nullptr) {
         poller_->HandleForkInChild();
       }
+      grpc_core::MutexLock lock(&mu_);
+      for (const auto& poller : shard_pollers_) {
+        poller->HandleForkInChild();
+      }
     }
   }
   if (poller_ != nullptr) {
     poller_->ResetKickState();
+    {
+      grpc_core::MutexLock lock(&mu_);
+      for (const auto& poller : shard_pollers_) {
+        poller->ResetKickState();
+      }
+    }
     SchedulePoller();
   }
 }
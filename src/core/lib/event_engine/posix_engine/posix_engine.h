@@ -21,6 +21,7 @@
 #include <atomic>
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -35,6 +36,7 @@
 #include "src/core/lib/iomgr/port.h"
 #include "src/core/util/orphanable.h"
 #include "src/core/util/sync.h"
+#include "src/core/util/thd.h"
 #include "absl/base/thread_annotations.h"
 #include "absl/container/flat_hash_map.h"
 #include "absl/container/inlined_vector.h"
@@ -206,6 +208,12 @@ class PosixEventEngine final : public PosixEventEngineWithFdSupport {
 
   // RAII wrapper for a polling cycle. Starts a new one in ctor and stops
   // in dtor.
+  //
+  // Normally each round of polling is a closure on the executor that
+  // schedules the next round before processing events. In busy poll mode
+  // (ConfigVars::ExperimentalEventEngineBusyPollUs() > 0) a dedicated thread
+  // polls without blocking until the spin budget has passed without an event,
+  // and only then blocks in the poller.
   class PollingCycle {
    public:
     explicit PollingCycle(
@@ -216,6 +224,7 @@ class PosixEventEngine final : public PosixEventEngineWithFdSupport {
 
    private:
     void PollerWorkInternal();
+    void BusyPollLoop();
 
     std::shared_ptr<ThreadPool> executor_;
     std::shared_ptr<grpc_event_engine::experimental::PosixEventPoller> poller_;
@@ -223,10 +232,17 @@ class PosixEventEngine final : public PosixEventEngineWithFdSupport {
     std::atomic_bool done_{false};
     int is_scheduled_ ABSL_GUARDED_BY(&mu_) = 0;
     grpc_core::CondVar cond_;
+    // Set in busy poll mode.
+    std::optional<grpc_core::Thread> busy_poll_thread_;
   };
 
   void SchedulePoller();
   void ResetPollCycle();
+  // Returns pollers for shards 1 and up of a listener with \a num_shards
+  // SO_REUSEPORT shards, creating them on first use. Each is driven by its
+  // own polling cycle so that the shards accept in parallel. Returns an empty
+  // list if this engine does not drive its own poller.
+  std::vector<PosixEventPoller*> ListenerShardPollers(int num_shards);
 
   ConnectionHandle CreateEndpointFromUnconnectedFdInternal(
       const FileDescriptor& fd, EventEngine::OnConnectCallback on_connect,
@@ -239,6 +255,11 @@ class PosixEventEngine final : public PosixEventEngineWithFdSupport {
 
   // Ensures there's ever only one of these.
   std::optional<PollingCycle> polling_cycle_ ABSL_GUARDED_BY(&mu_);
+  // Pollers created by ListenerShardPollers, and their polling cycles.
+  std::vector<std::shared_ptr<PosixEventPoller>> shard_pollers_
+      ABSL_GUARDED_BY(&mu_);
+  std::vector<std::unique_ptr<PollingCycle>> shard_polling_cycles_
+      ABSL_GUARDED_BY(&mu_);
 #endif  // GRPC_POSIX_SOCKET_TCP
 
   EventEngine::TaskHandle RunAfterInternal(Duration when,
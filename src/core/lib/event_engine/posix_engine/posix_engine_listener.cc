@@ -31,6 +31,7 @@
 #include <string>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/event_engine/posix_engine/event_poller.h"
@@ -58,8 +59,10 @@ PosixEngineListenerImpl::PosixEngineListenerImpl(
     const grpc_event_engine::experimental::EndpointConfig& config,
     std::unique_ptr<grpc_event_engine::experimental::MemoryAllocatorFactory>
         memory_allocator_factory,
-    PosixEventPoller* poller, std::shared_ptr<EventEngine> engine)
+    PosixEventPoller* poller, std::shared_ptr<EventEngine> engine,
+    std::vector<PosixEventPoller*> shard_pollers)
     : poller_(poller),
+      shard_pollers_(std::move(shard_pollers)),
       options_(TcpOptionsFromEndpointConfig(config)),
       engine_(std::move(engine)),
       acceptors_(this),
@@ -117,6 +120,52 @@ absl::StatusOr<int> PosixEngineListenerImpl::Bind(
   return result->port;
 }
 
+PosixEventPoller* PosixEngineListenerImpl::ShardPoller(int shard) const {
+  if (shard == 0 || static_cast<size_t>(shard) > shard_pollers_.size()) {
+    return poller_;
+  }
+  return shard_pollers_[shard - 1];
+}
+
+void PosixEngineListenerImpl::ListenerAsyncAcceptors::Append(
+    ListenerSocket socket) {
+  acceptors_.push_back(new AsyncConnectionAcceptor(
+      listener_->engine_, listener_->shared_from_this(), socket,
+      listener_->poller_));
+  if (on_append_) {
+    on_append_(socket.sock.fd());
+  }
+  const int num_shards = listener_->options_.listener_shards;
+  const int family = socket.addr.address()->sa_family;
+  if (num_shards <= 1 || (family != AF_INET && family != AF_INET6)) return;
+  int created = 1;
+  for (int shard = 1; shard < num_shards; ++shard) {
+    PosixEventPoller* poller = listener_->ShardPoller(shard);
+    auto shard_socket = CreateListenerSocketShard(
+        &poller->posix_interface(), listener_->options_, socket);
+    if (!shard_socket.ok()) {
+      // The shards created so far keep accepting; the port still works.
+      LOG(ERROR) << "Failed to create listener shard " << shard << ": "
+                 << shard_socket.status();
+      break;
+    }
+    acceptors_.push_back(new AsyncConnectionAcceptor(
+        listener_->engine_, listener_->shared_from_this(), *shard_socket,
+        poller));
+    if (on_append_) {
+      on_append_(shard_socket->sock.fd());
+    }
+    ++created;
+  }
+  if (listener_->options_.listener_cpu_steering && created == num_shards) {
+    auto status = AttachReusePortCpuSteering(
+        &listener_->poller_->posix_interface(), socket, num_shards);
+    if (!status.ok()) {
+      LOG(INFO) << "Listener CPU steering not enabled: " << status;
+    }
+  }
+}
+
 void PosixEngineListenerImpl::AsyncConnectionAcceptor::Start() {
   Ref();
   handle_->NotifyOnRead(notify_on_accept_);
@@ -233,8 +282,8 @@ void PosixEngineListenerImpl::AsyncConnectionAcceptor::NotifyOnAccept(
       return;
     }
     auto endpoint = CreatePosixEndpoint(
-        /*handle=*/listener_->poller_->CreateHandle(
-            fd.value(), *peer_name, listener_->poller_->CanTrackErrors()),
+        /*handle=*/handle_->Poller()->CreateHandle(
+            fd.value(), *peer_name, handle_->Poller()->CanTrackErrors()),
         /*on_shutdown=*/nullptr, /*engine=*/listener_->engine_,
         // allocator=
         listener_->memory_allocator_factory_->CreateMemoryAllocator(
@@ -25,6 +25,7 @@
 #include <list>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "src/core/lib/event_engine/posix.h"
 #include "src/core/lib/event_engine/posix_engine/posix_interface.h"
@@ -55,7 +56,8 @@ class PosixEngineListenerImpl
       const grpc_event_engine::experimental::EndpointConfig& config,
       std::unique_ptr<grpc_event_engine::experimental::MemoryAllocatorFactory>
           memory_allocator_factory,
-      PosixEventPoller* poller, std::shared_ptr<EventEngine> engine);
+      PosixEventPoller* poller, std::shared_ptr<EventEngine> engine,
+      std::vector<PosixEventPoller*> shard_pollers = {});
   // Binds an address to the listener. This creates a ListenerSocket
   // and sets its fields appropriately.
   absl::StatusOr<int> Bind(
@@ -80,15 +82,16 @@ class PosixEngineListenerImpl
    public:
     AsyncConnectionAcceptor(std::shared_ptr<EventEngine> engine,
                             std::shared_ptr<PosixEngineListenerImpl> listener,
-                            ListenerSocketsContainer::ListenerSocket socket)
+                            ListenerSocketsContainer::ListenerSocket socket,
+                            PosixEventPoller* poller)
         : engine_(std::move(engine)),
           listener_(std::move(listener)),
           socket_(socket),
-          handle_(listener_->poller_->CreateHandle(
+          handle_(poller->CreateHandle(
               socket_.sock,
               *grpc_event_engine::experimental::
                   ResolvedAddressToNormalizedString(socket_.addr),
-              listener_->poller_->CanTrackErrors())),
+              poller->CanTrackErrors())),
           notify_on_accept_(PosixEngineClosure::ToPermanentClosure(
               [this](absl::Status status) { NotifyOnAccept(status); })) {};
     // Start listening for incoming connections on the socket.
@@ -138,13 +141,9 @@ class PosixEngineListenerImpl
       on_append_ = std::move(on_append);
     }
 
-    void Append(ListenerSocket socket) override {
-      acceptors_.push_back(new AsyncConnectionAcceptor(
-          listener_->engine_, listener_->shared_from_this(), socket));
-      if (on_append_) {
-        on_append_(socket.sock.fd());
-      }
-    }
+    // Also creates the listener's extra shards of \a socket, if any, each
+    // accepting on its own poller.
+    void Append(ListenerSocket socket) override;
 
     absl::StatusOr<ListenerSocket> Find(
         const grpc_event_engine::experimental::EventEngine::ResolvedAddress&
@@ -175,10 +174,15 @@ class PosixEngineListenerImpl
   };
   friend class ListenerAsyncAcceptors;
   friend class AsyncConnectionAcceptor;
+  // Returns the poller that accepts on shard \a shard of each bound socket.
+  // Shard 0 is the socket created by Bind.
+  PosixEventPoller* ShardPoller(int shard) const;
   // The mutex ensures thread safety when multiple threads try to call Bind
   // and Start in parallel.
   grpc_core::Mutex mu_;
   PosixEventPoller* poller_;
+  // Pollers for shards 1 and up. Shards without one use poller_.
+  std::vector<PosixEventPoller*> shard_pollers_;
   PosixTcpOptions options_;
   std::shared_ptr<EventEngine> engine_;
   // Linked list of sockets. One is created upon each successful bind
@@ -205,10 +209,12 @@ class PosixEngineListener : public PosixListenerWithFdSupport {
       const grpc_event_engine::experimental::EndpointConfig& config,
       std::unique_ptr<grpc_event_engine::experimental::MemoryAllocatorFactory>
           memory_allocator_factory,
-      PosixEventPoller* poller, std::shared_ptr<EventEngine> engine)
+      PosixEventPoller* poller, std::shared_ptr<EventEngine> engine,
+      std::vector<PosixEventPoller*> shard_pollers = {})
       : impl_(std::make_shared<PosixEngineListenerImpl>(
             std::move(on_accept), std::move(on_shutdown), config,
-            std::move(memory_allocator_factory), poller, std::move(engine))) {}
+            std::move(memory_allocator_factory), poller, std::move(engine),
+            std::move(shard_pollers))) {}
   ~PosixEngineListener() override { ShutdownListeningFds(); };
   absl::StatusOr<int> Bind(
       const grpc_event_engine::experimental::EventEngine::ResolvedAddress& addr)
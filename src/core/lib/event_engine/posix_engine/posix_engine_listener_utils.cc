@@ -31,6 +31,7 @@
 #include "src/core/util/crash.h"  // IWYU pragma: keep
 #include "src/core/util/grpc_check.h"
 #include "src/core/util/status_helper.h"
+#include "src/core/util/strerror.h"
 #include "absl/cleanup/cleanup.h"
 #include "absl/log/log.h"
 #include "absl/status/status.h"
@@ -44,6 +45,10 @@
 #include <unistd.h>      // IWYU pragma: keep
 #endif
 
+#ifdef GRPC_LINUX_REUSEPORT_CBPF
+#include <linux/filter.h>
+#endif  // GRPC_LINUX_REUSEPORT_CBPF
+
 namespace grpc_event_engine::experimental {
 
 #ifdef GRPC_POSIX_SOCKET_UTILS_COMMON
@@ -404,6 +409,46 @@ absl::StatusOr<int> ListenerContainerAddWildcardAddresses(
   }
 }
 
+absl::StatusOr<ListenerSocket> CreateListenerSocketShard(
+    EventEnginePosixInterface* posix_interface, const PosixTcpOptions& options,
+    const ListenerSocket& socket) {
+  ResolvedAddress addr = socket.addr;
+  ResolvedAddressSetPort(addr, socket.port);
+  return CreateAndPrepareListenerSocket(posix_interface, options, addr);
+}
+
+absl::Status AttachReusePortCpuSteering(
+    EventEnginePosixInterface* posix_interface, const ListenerSocket& socket,
+    int num_shards) {
+#ifdef GRPC_LINUX_REUSEPORT_CBPF
+  // A = cpu; A = A % num_shards; return A.
+  struct sock_filter code[] = {
+      {BPF_LD | BPF_W | BPF_ABS, 0, 0,
+       static_cast<uint32_t>(SKF_AD_OFF + SKF_AD_CPU)},
+      {BPF_ALU | BPF_MOD | BPF_K, 0, 0, static_cast<uint32_t>(num_shards)},
+      {BPF_RET | BPF_A, 0, 0, 0},
+  };
+  struct sock_fprog prog = {sizeof(code) / sizeof(code[0]), code};
+  auto fd = posix_interface->GetFd(socket.sock);
+  if (!fd.ok()) {
+    return absl::InternalError(
+        "AttachReusePortCpuSteering: file descriptor from wrong generation");
+  }
+  if (setsockopt(*fd, SOL_SOCKET, SO_ATTACH_REUSEPORT_CBPF, &prog,
+                 sizeof(prog)) != 0) {
+    return absl::InternalError(absl::StrCat(
+        "setsockopt(SO_ATTACH_REUSEPORT_CBPF): ", grpc_core::StrError(errno)));
+  }
+  return absl::OkStatus();
+#else   // GRPC_LINUX_REUSEPORT_CBPF
+  (void)posix_interface;
+  (void)socket;
+  (void)num_shards;
+  return absl::UnimplementedError(
+      "SO_ATTACH_REUSEPORT_CBPF is not supported on this platform");
+#endif  // GRPC_LINUX_REUSEPORT_CBPF
+}
+
 #else  // GRPC_POSIX_SOCKET_UTILS_COMMON
 
 absl::StatusOr<ListenerSocketsContainer::ListenerSocket>
@@ -414,6 +459,23 @@ CreateAndPrepareListenerSocket(const PosixTcpOptions& /*options*/,
       "CreateAndPrepareListenerSocket is not supported on this platform");
 }
 
+absl::StatusOr<ListenerSocketsContainer::ListenerSocket>
+CreateListenerSocketShard(
+    EventEnginePosixInterface* /*posix_interface*/,
+    const PosixTcpOptions& /*options*/,
+    const ListenerSocketsContainer::ListenerSocket& /*socket*/) {
+  grpc_core::Crash(
+      "CreateListenerSocketShard is not supported on this platform");
+}
+
+absl::Status AttachReusePortCpuSteering(
+    EventEnginePosixInterface* /*posix_interface*/,
+    const ListenerSocketsContainer::ListenerSocket& /*socket*/,
+    int /*num_shards*/) {
+  grpc_core::Crash(
+      "AttachReusePortCpuSteering is not supported on this platform");
+}
+
 absl::StatusOr<int> ListenerContainerAddWildcardAddresses(
     ListenerSocketsContainer& /*listener_sockets*/,
     const PosixTcpOptions& /*options*/, int /*requested_port*/) {
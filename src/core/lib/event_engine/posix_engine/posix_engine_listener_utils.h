@@ -75,6 +75,22 @@ CreateAndPrepareListenerSocket(
     EventEnginePosixInterface* posix_interface, const PosixTcpOptions& options,
     const grpc_event_engine::experimental::EventEngine::ResolvedAddress& addr);
 
+// Creates another socket listening on the same address and port as \a
+// socket, which must have been created with SO_REUSEPORT. The kernel spreads
+// incoming connections across all sockets listening on the port.
+absl::StatusOr<ListenerSocketsContainer::ListenerSocket>
+CreateListenerSocketShard(
+    EventEnginePosixInterface* posix_interface, const PosixTcpOptions& options,
+    const ListenerSocketsContainer::ListenerSocket& socket);
+
+// Makes the kernel hand each new connection on the port of \a socket to the
+// listening socket with index (cpu % num_shards) in its SO_REUSEPORT group,
+// where cpu is the CPU that processed the connection's SYN. Sockets are
+// indexed in the order they were bound. Linux only.
+absl::Status AttachReusePortCpuSteering(
+    EventEnginePosixInterface* posix_interface,
+    const ListenerSocketsContainer::ListenerSocket& socket, int num_shards);
+
 // Instead of creating and adding a socket bound to specific address, this
 // function creates and adds a socket bound to the wildcard address on the
 // server. The newly created socket is configured according to the passed
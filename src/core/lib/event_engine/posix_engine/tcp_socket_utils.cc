@@ -96,6 +96,12 @@ PosixTcpOptions TcpOptionsFromEndpointConfig(const EndpointConfig& config) {
   options.tcp_tx_zero_copy_enabled =
       (AdjustValue(PosixTcpOptions::kZerocpTxEnabledDefault, 0, 1,
                    config.GetInt(GRPC_ARG_TCP_TX_ZEROCOPY_ENABLED)) != 0);
+  options.tcp_rx_zero_copy_enabled =
+      (AdjustValue(PosixTcpOptions::kZerocpRxEnabledDefault, 0, 1,
+                   config.GetInt(GRPC_ARG_TCP_RX_ZEROCOPY_ENABLED)) != 0);
+  options.tcp_rx_zerocopy_recv_bytes_threshold = AdjustValue(
+      PosixTcpOptions::kDefaultRecvBytesThreshold, 0, INT_MAX,
+      config.GetInt(GRPC_ARG_TCP_RX_ZEROCOPY_RECV_BYTES_THRESHOLD));
   options.keep_alive_time_ms =
       AdjustValue(0, 1, INT_MAX, config.GetInt(GRPC_ARG_KEEPALIVE_TIME_MS));
   options.keep_alive_timeout_ms =
@@ -112,6 +118,17 @@ PosixTcpOptions TcpOptionsFromEndpointConfig(const EndpointConfig& config) {
         (AdjustValue(0, 1, INT_MAX, config.GetInt(GRPC_ARG_ALLOW_REUSEPORT)) !=
          0);
   }
+  // Shards share their port through SO_REUSEPORT.
+  if (options.allow_reuse_port) {
+    options.listener_shards = AdjustValue(
+        PosixTcpOptions::kDefaultListenerShards, 1,
+        PosixTcpOptions::kMaxListenerShards,
+        config.GetInt(GRPC_ARG_EXPERIMENTAL_TCP_LISTENER_SHARDS));
+  }
+  options.listener_cpu_steering =
+      (AdjustValue(0, 1, INT_MAX,
+                   config.GetInt(
+                       GRPC_ARG_EXPERIMENTAL_TCP_LISTENER_CPU_STEERING)) != 0);
   if (options.tcp_min_read_chunk_size > options.tcp_max_read_chunk_size) {
     options.tcp_min_read_chunk_size = options.tcp_max_read_chunk_size;
   }
@@ -0,0 +1,234 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/event_engine/posix_engine/timer_wheel.h"
+
+#include <grpc/support/cpu.h>
+#include <grpc/support/port_platform.h>
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <utility>
+
+#include "src/core/util/time.h"
+#include "src/core/util/useful.h"
+#include "absl/numeric/bits.h"
+
+namespace grpc_event_engine::experimental {
+
+namespace {
+
+// Wheel times are unsigned milliseconds after the process epoch.
+uint64_t ToWheelTime(grpc_core::Timestamp t) {
+  return static_cast<uint64_t>(
+      std::max<int64_t>(t.milliseconds_after_process_epoch(), 0));
+}
+
+grpc_core::Timestamp FromWheelTime(uint64_t t) {
+  return grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(
+      static_cast<int64_t>(std::min<uint64_t>(
+          t, std::numeric_limits<int64_t>::max())));
+}
+
+}  // namespace
+
+TimerWheel::TimerWheel(TimerListHost* host)
+    : host_(host),
+      num_shards_(grpc_core::Clamp(2 * gpr_cpu_num_cores(), 1u, 32u)),
+      shards_(new Shard[num_shards_]) {
+  const uint64_t now = ToWheelTime(host_->Now());
+  min_deadline_.store(now, std::memory_order_relaxed);
+  for (size_t i = 0; i < num_shards_; i++) {
+    grpc_core::MutexLock lock(&shards_[i].mu);
+    shards_[i].now = now;
+  }
+}
+
+void TimerWheel::Shard::Add(Timer* timer) {
+  const uint64_t deadline =
+      std::max<uint64_t>(std::max<int64_t>(timer->deadline, 0), now);
+  const uint64_t diff = deadline ^ now;
+  const size_t level =
+      diff == 0 ? 0 : (63 - absl::countl_zero(diff)) / kBitsPerLevel;
+  size_t index = kOverflowSlot;
+  if (level < kLevels) {
+    const size_t slot =
+        (deadline >> (level * kBitsPerLevel)) & (kSlotsPerLevel - 1);
+    occupied[level] |= uint64_t{1} << slot;
+    index = level * kSlotsPerLevel + slot;
+  }
+  timer->heap_index = index;
+  timer->prev = nullptr;
+  timer->next = slots[index];
+  if (timer->next != nullptr) timer->next->prev = timer;
+  slots[index] = timer;
+}
+
+void TimerWheel::Shard::Remove(Timer* timer) {
+  const size_t index = timer->heap_index;
+  if (timer->prev != nullptr) {
+    timer->prev->next = timer->next;
+  } else {
+    slots[index] = timer->next;
+  }
+  if (timer->next != nullptr) timer->next->prev = timer->prev;
+  if (index != kOverflowSlot && slots[index] == nullptr) {
+    occupied[index / kSlotsPerLevel] &=
+        ~(uint64_t{1} << (index % kSlotsPerLevel));
+  }
+}
+
+uint64_t TimerWheel::Shard::NextEvent() {
+  uint64_t next = std::numeric_limits<uint64_t>::max();
+  for (size_t level = 0; level < kLevels; ++level) {
+    const size_t shift = level * kBitsPerLevel;
+    const uint64_t current = (now >> shift) & (kSlotsPerLevel - 1);
+    // Every occupied slot is at or after the current one.
+    const uint64_t pending = occupied[level] >> current << current;
+    if (pending == 0) continue;
+    const uint64_t slot = absl::countr_zero(pending);
+    const uint64_t span_start =
+        now >> (shift + kBitsPerLevel) << (shift + kBitsPerLevel);
+    next = std::min(next, std::max(now, span_start | (slot << shift)));
+  }
+  if (slots[kOverflowSlot] != nullptr) {
+    constexpr size_t kTopShift = kLevels * kBitsPerLevel;
+    next = std::min(next, ((now >> kTopShift) + 1) << kTopShift);
+  }
+  return next;
+}
+
+void TimerWheel::Shard::Cascade(size_t index) {
+  Timer* timer = std::exchange(slots[index], nullptr);
+  if (index != kOverflowSlot) {
+    occupied[index / kSlotsPerLevel] &=
+        ~(uint64_t{1} << (index % kSlotsPerLevel));
+  }
+  while (timer != nullptr) {
+    Timer* next = timer->next;
+    Add(timer);
+    timer = next;
+  }
+}
+
+void TimerWheel::Shard::Advance(
+    uint64_t target, std::vector<experimental::EventEngine::Closure*>* out) {
+  constexpr uint64_t kTopMask =
+      (uint64_t{1} << (kLevels * kBitsPerLevel)) - 1;
+  for (uint64_t event = NextEvent(); event <= target; event = NextEvent()) {
+    now = event;
+    if ((now & kTopMask) == 0 && slots[kOverflowSlot] != nullptr) {
+      Cascade(kOverflowSlot);
+    }
+    // Cascading from the top down leaves timers due now in level 0.
+    for (size_t level = kLevels - 1; level > 0; --level) {
+      const size_t slot =
+          (now >> (level * kBitsPerLevel)) & (kSlotsPerLevel - 1);
+      if (occupied[level] & (uint64_t{1} << slot)) {
+        Cascade(level * kSlotsPerLevel + slot);
+      }
+    }
+    const size_t slot = now & (kSlotsPerLevel - 1);
+    Timer* timer = std::exchange(slots[slot], nullptr);
+    occupied[0] &= ~(uint64_t{1} << slot);
+    for (; timer != nullptr; timer = timer->next) {
+      timer->pending = false;
+      out->push_back(timer->closure);
+    }
+  }
+  now = std::max(now, target);
+}
+
+void TimerWheel::TimerInit(Timer* timer, grpc_core::Timestamp deadline,
+                           experimental::EventEngine::Closure* closure) {
+  Shard* shard = &shards_[grpc_core::HashPointer(timer, num_shards_)];
+  timer->closure = closure;
+  timer->deadline = deadline.milliseconds_after_process_epoch();
+
+#ifndef NDEBUG
+  timer->hash_table_next = nullptr;
+#endif
+
+  bool is_first_timer = false;
+  uint64_t when;
+  {
+    grpc_core::MutexLock lock(&shard->mu);
+    timer->pending = true;
+    when = std::max({ToWheelTime(deadline), ToWheelTime(host_->Now()),
+                     shard->now});
+    shard->Add(timer);
+    if (when < shard->next_event) {
+      shard->next_event = when;
+      is_first_timer = true;
+    }
+  }
+
+  // As in TimerList, a concurrent TimerCheck may already have picked up the
+  // new deadline; publishing it again is harmless.
+  if (is_first_timer) {
+    grpc_core::MutexLock lock(&mu_);
+    if (when < shard->published_next_event) {
+      shard->published_next_event = when;
+      if (when < min_deadline_.load(std::memory_order_relaxed)) {
+        min_deadline_.store(when, std::memory_order_relaxed);
+        host_->Kick();
+      }
+    }
+  }
+}
+
+bool TimerWheel::TimerCancel(Timer* timer) {
+  Shard* shard = &shards_[grpc_core::HashPointer(timer, num_shards_)];
+  grpc_core::MutexLock lock(&shard->mu);
+  if (!timer->pending) return false;
+  timer->pending = false;
+  shard->Remove(timer);
+  return true;
+}
+
+std::optional<std::vector<experimental::EventEngine::Closure*>>
+TimerWheel::TimerCheck(grpc_core::Timestamp* next) {
+  const uint64_t now = ToWheelTime(host_->Now());
+  const uint64_t min_deadline = min_deadline_.load(std::memory_order_relaxed);
+  if (now < min_deadline) {
+    if (next != nullptr) *next = std::min(*next, FromWheelTime(min_deadline));
+    return std::vector<experimental::EventEngine::Closure*>();
+  }
+
+  if (!checker_mu_.TryLock()) return std::nullopt;
+  std::vector<experimental::EventEngine::Closure*> done;
+  {
+    grpc_core::MutexLock lock(&mu_);
+    uint64_t new_min_deadline = std::numeric_limits<uint64_t>::max();
+    for (size_t i = 0; i < num_shards_; i++) {
+      Shard& shard = shards_[i];
+      if (shard.published_next_event <= now) {
+        grpc_core::MutexLock shard_lock(&shard.mu);
+        shard.Advance(now, &done);
+        shard.next_event = shard.NextEvent();
+        shard.published_next_event = shard.next_event;
+      }
+      new_min_deadline = std::min(new_min_deadline, shard.published_next_event);
+    }
+    min_deadline_.store(new_min_deadline, std::memory_order_relaxed);
+    if (next != nullptr) {
+      *next = std::min(*next, FromWheelTime(new_min_deadline));
+    }
+  }
+  checker_mu_.Unlock();
+  return std::move(done);
+}
+
+}  // namespace grpc_event_engine::experimental
@@ -0,0 +1,114 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_TIMER_WHEEL_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_TIMER_WHEEL_H
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+#include <stddef.h>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "src/core/lib/event_engine/posix_engine/timer.h"
+#include "src/core/util/sync.h"
+#include "src/core/util/time.h"
+#include "absl/base/thread_annotations.h"
+
+namespace grpc_event_engine::experimental {
+
+// Timers kept in hierarchical timing wheels, with O(1) TimerInit and
+// TimerCancel.
+//
+// Each shard has kLevels wheels of kSlotsPerLevel slots. A slot of level L
+// spans kSlotsPerLevel^L milliseconds, and a timer is placed in the level of
+// the highest group of kBitsPerLevel bits in which its deadline differs from
+// the shard's current time. As time advances past the start of an upper level
+// slot, its timers are cascaded into the levels below; level 0 slots hold
+// timers due at exactly one millisecond, which fire when it is reached. Each
+// timer is cascaded at most kLevels - 1 times, and most timers are cancelled
+// long before they are.
+class TimerWheel final : public TimerListInterface {
+ public:
+  explicit TimerWheel(TimerListHost* host);
+
+  TimerWheel(const TimerWheel&) = delete;
+  TimerWheel& operator=(const TimerWheel&) = delete;
+
+  void TimerInit(Timer* timer, grpc_core::Timestamp deadline,
+                 experimental::EventEngine::Closure* closure) override;
+  bool TimerCancel(Timer* timer) override;
+  std::optional<std::vector<experimental::EventEngine::Closure*>> TimerCheck(
+      grpc_core::Timestamp* next) override;
+
+ private:
+  static constexpr size_t kBitsPerLevel = 6;
+  static constexpr size_t kSlotsPerLevel = size_t{1} << kBitsPerLevel;
+  // Seven levels span 2^42 milliseconds (about 139 years); later deadlines go
+  // to an overflow slot that is re-sorted whenever the top level wraps.
+  static constexpr size_t kLevels = 7;
+  static constexpr size_t kOverflowSlot = kLevels * kSlotsPerLevel;
+
+  struct Shard {
+    // Adds `timer` to the slot for its deadline.
+    void Add(Timer* timer) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu);
+    void Remove(Timer* timer) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu);
+    // Returns the earliest time at which Advance has work to do: a level 0
+    // slot is due, or an upper level slot must be cascaded. This is a lower
+    // bound on the deadline of every timer in the shard.
+    uint64_t NextEvent() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu);
+    // Empties slot `index`, re-adding its timers relative to the current
+    // time.
+    void Cascade(size_t index) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu);
+    // Moves the current time to `target`, appending the closures of timers
+    // due by then to `out`.
+    void Advance(uint64_t target,
+                 std::vector<experimental::EventEngine::Closure*>* out)
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu);
+
+    grpc_core::Mutex mu;
+    // The time, in milliseconds after the process epoch, that the wheels have
+    // been advanced to.
+    uint64_t now ABSL_GUARDED_BY(mu) = 0;
+    // A lower bound on the deadline of every timer in the shard, used to
+    // decide whether TimerInit must update the TimerWheel-wide minimum.
+    uint64_t next_event ABSL_GUARDED_BY(mu) = UINT64_MAX;
+    // Bit i of occupied[L] is set iff slot i of level L is non-empty.
+    uint64_t occupied[kLevels] ABSL_GUARDED_BY(mu) = {};
+    // Heads of the doubly linked lists of timers in each slot, level by
+    // level, followed by the overflow slot.
+    Timer* slots[kOverflowSlot + 1] ABSL_GUARDED_BY(mu) = {};
+    // The value of next_event last published to TimerWheel::min_deadline_.
+    uint64_t published_next_event ABSL_GUARDED_BY(&TimerWheel::mu_) =
+        UINT64_MAX;
+  };
+
+  TimerListHost* const host_;
+  const size_t num_shards_;
+  grpc_core::Mutex mu_;
+  // The earliest next_event across all shards, in milliseconds after the
+  // process epoch.
+  std::atomic<uint64_t> min_deadline_;
+  // Allow only one TimerCheck at once.
+  grpc_core::Mutex checker_mu_;
+  const std::unique_ptr<Shard[]> shards_;
+};
+
+}  // namespace grpc_event_engine::experimental
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_TIMER_WHEEL_H
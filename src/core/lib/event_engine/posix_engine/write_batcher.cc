@@ -0,0 +1,85 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/event_engine/posix_engine/write_batcher.h"
+
+#include <grpc/support/port_platform.h>
+#include <stddef.h>
+
+#include <utility>
+
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
+
+namespace grpc_event_engine::experimental {
+
+namespace {
+
+// The batch being flushed by this thread, if any, and the number of
+// submissions deferred to its end.
+thread_local WriteBatcher* g_flushing = nullptr;
+thread_local size_t g_deferred = 0;
+
+}  // namespace
+
+WriteBatcher::WriteBatcher(ThreadPool* thread_pool,
+                           absl::AnyInvocable<void()> end_batch)
+    : thread_pool_(thread_pool), end_batch_(std::move(end_batch)) {}
+
+void WriteBatcher::Add(absl::AnyInvocable<void()> write) {
+  {
+    grpc_core::MutexLock lock(&mu_);
+    pending_.push_back(std::move(write));
+    if (flush_scheduled_) return;
+    flush_scheduled_ = true;
+  }
+  thread_pool_->Run([self = shared_from_this()]() { self->Flush(); });
+}
+
+void WriteBatcher::Flush() {
+  std::vector<absl::AnyInvocable<void()>> writes;
+  {
+    grpc_core::MutexLock lock(&mu_);
+    if (pending_.empty()) return;
+    writes.swap(pending_);
+    flush_scheduled_ = false;
+  }
+  WriteBatcher* const previous = std::exchange(g_flushing, this);
+  const size_t previous_deferred = std::exchange(g_deferred, 0);
+  for (auto& write : writes) {
+    write();
+  }
+  const size_t deferred = std::exchange(g_deferred, previous_deferred);
+  g_flushing = previous;
+  if (deferred > 0) {
+    {
+      grpc_core::MutexLock lock(&end_batch_mu_);
+      if (end_batch_ != nullptr) end_batch_();
+    }
+    grpc_core::global_stats().IncrementTcpWritesPerSyscall(deferred);
+  }
+}
+
+void WriteBatcher::Shutdown() {
+  grpc_core::MutexLock lock(&end_batch_mu_);
+  end_batch_ = nullptr;
+}
+
+bool WriteBatcher::DeferSubmit(WriteBatcher* batcher) {
+  if (batcher == nullptr || g_flushing != batcher) return false;
+  ++g_deferred;
+  return true;
+}
+
+}  // namespace grpc_event_engine::experimental
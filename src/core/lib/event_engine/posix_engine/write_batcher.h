@@ -0,0 +1,73 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_WRITE_BATCHER_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_WRITE_BATCHER_H
+
+#include <grpc/support/port_platform.h>
+
+#include <memory>
+#include <vector>
+
+#include "src/core/lib/event_engine/thread_pool/thread_pool.h"
+#include "src/core/util/sync.h"
+#include "absl/base/thread_annotations.h"
+#include "absl/functional/any_invocable.h"
+
+namespace grpc_event_engine::experimental {
+
+// Collects the endpoint writes that become ready on the connections of one
+// poller, and runs them together.
+//
+// The first write added to an empty batch schedules a flush on the thread
+// pool; the poller may also flush at the end of its Work. Writes that reach a
+// completion based poller while a batch is being flushed only queue their
+// submission (see DeferSubmit), and end_batch then submits all of them with a
+// single system call.
+class WriteBatcher : public std::enable_shared_from_this<WriteBatcher> {
+ public:
+  // end_batch, if set, is invoked at the end of a flush in which at least one
+  // submission was deferred.
+  WriteBatcher(ThreadPool* thread_pool, absl::AnyInvocable<void()> end_batch);
+
+  WriteBatcher(const WriteBatcher&) = delete;
+  WriteBatcher& operator=(const WriteBatcher&) = delete;
+
+  // Queues `write` to run in the next flush.
+  void Add(absl::AnyInvocable<void()> write);
+  // Runs all queued writes on the calling thread.
+  void Flush();
+  // Drops end_batch, waiting for a call to it in progress to return. The
+  // owner of the state that end_batch uses calls this before releasing it:
+  // flushes already scheduled hold the batcher and may still run.
+  void Shutdown();
+
+  // Returns true if the calling thread is flushing `batcher`, in which case
+  // the caller must leave the submission of its write to the end of the
+  // batch.
+  static bool DeferSubmit(WriteBatcher* batcher);
+
+ private:
+  ThreadPool* const thread_pool_;
+  grpc_core::Mutex end_batch_mu_;
+  absl::AnyInvocable<void()> end_batch_ ABSL_GUARDED_BY(end_batch_mu_);
+  grpc_core::Mutex mu_;
+  std::vector<absl::AnyInvocable<void()>> pending_ ABSL_GUARDED_BY(mu_);
+  // Whether a flush has been scheduled on the thread pool and not yet run.
+  bool flush_scheduled_ ABSL_GUARDED_BY(mu_) = false;
+};
+
+}  // namespace grpc_event_engine::experimental
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_WRITE_BATCHER_H
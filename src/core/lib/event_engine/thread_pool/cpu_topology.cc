@@ -0,0 +1,207 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif  // _GNU_SOURCE
+
+#include "src/core/lib/event_engine/thread_pool/cpu_topology.h"
+
+#include <grpc/support/cpu.h>
+#include <grpc/support/port_platform.h>
+
+#include <algorithm>
+#include <string>
+#include <utility>
+
+#include "absl/strings/numbers.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_split.h"
+#include "absl/strings/string_view.h"
+#include "absl/strings/strip.h"
+
+#ifdef GPR_LINUX
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#endif  // GPR_LINUX
+
+namespace grpc_event_engine::experimental {
+
+namespace {
+
+#ifdef GPR_LINUX
+// Reads the first line of a small sysfs file.
+std::optional<std::string> ReadSysFile(const std::string& path) {
+  FILE* fp = fopen(path.c_str(), "r");
+  if (fp == nullptr) return std::nullopt;
+  char buf[4096];
+  std::optional<std::string> result;
+  if (fgets(buf, sizeof(buf), fp) != nullptr) result = buf;
+  fclose(fp);
+  return result;
+}
+
+// Reads the CPUs of every online node, and the distances between them, into
+// `node_cpus` and `distances`. Both are indexed in order of the online list.
+void ReadNodes(std::vector<std::vector<int>>& node_cpus,
+               std::vector<std::vector<int>>& distances) {
+  auto online = ReadSysFile("/sys/devices/system/node/online");
+  if (!online.has_value()) return;
+  auto nodes = ParseCpuList(*online);
+  if (!nodes.has_value()) return;
+  cpu_set_t allowed;
+  CPU_ZERO(&allowed);
+  const bool have_mask = sched_getaffinity(0, sizeof(allowed), &allowed) == 0;
+  bool have_distances = true;
+  for (int node : *nodes) {
+    const std::string dir = absl::StrCat("/sys/devices/system/node/node", node);
+    auto cpu_list = ReadSysFile(absl::StrCat(dir, "/cpulist"));
+    std::optional<std::vector<int>> cpus;
+    if (cpu_list.has_value()) cpus = ParseCpuList(*cpu_list);
+    if (!cpus.has_value()) cpus.emplace();
+    if (have_mask) {
+      cpus->erase(std::remove_if(cpus->begin(), cpus->end(),
+                                 [&allowed](int cpu) {
+                                   return cpu >= CPU_SETSIZE ||
+                                          !CPU_ISSET(cpu, &allowed);
+                                 }),
+                  cpus->end());
+    }
+    node_cpus.push_back(std::move(*cpus));
+    std::vector<int> row;
+    if (auto line = ReadSysFile(absl::StrCat(dir, "/distance"))) {
+      for (absl::string_view d : absl::StrSplit(
+               absl::StripAsciiWhitespace(*line), ' ', absl::SkipEmpty())) {
+        int distance;
+        if (!absl::SimpleAtoi(d, &distance)) break;
+        row.push_back(distance);
+      }
+    }
+    if (row.size() != nodes->size()) have_distances = false;
+    distances.push_back(std::move(row));
+  }
+  if (!have_distances) distances.clear();
+}
+#endif  // GPR_LINUX
+
+}  // namespace
+
+CpuTopology CpuTopology::Detect() {
+  std::vector<std::vector<int>> node_cpus;
+  std::vector<std::vector<int>> distances;
+#ifdef GPR_LINUX
+  ReadNodes(node_cpus, distances);
+#endif  // GPR_LINUX
+  bool any_cpu = false;
+  for (const auto& cpus : node_cpus) any_cpu |= !cpus.empty();
+  if (!any_cpu) {
+    node_cpus.assign(1, {});
+    distances.clear();
+    for (unsigned i = 0; i < gpr_cpu_num_cores(); ++i) {
+      node_cpus.back().push_back(static_cast<int>(i));
+    }
+  }
+  return CpuTopology(std::move(node_cpus), std::move(distances));
+}
+
+CpuTopology::CpuTopology(std::vector<std::vector<int>> node_cpus,
+                         std::vector<std::vector<int>> distances) {
+  // Indices (into the arguments) of the nodes that are kept.
+  std::vector<size_t> kept;
+  for (size_t i = 0; i < node_cpus.size(); ++i) {
+    if (node_cpus[i].empty()) continue;
+    for (int cpu : node_cpus[i]) {
+      if (cpu < 0) continue;
+      if (static_cast<size_t>(cpu) >= cpu_to_node_.size()) {
+        cpu_to_node_.resize(cpu + 1, 0);
+      }
+      cpu_to_node_[cpu] = node_cpus_.size();
+    }
+    node_cpus_.push_back(std::move(node_cpus[i]));
+    kept.push_back(i);
+  }
+  if (node_cpus_.empty()) {
+    node_cpus_.push_back({0});
+    kept.push_back(0);
+  }
+  const bool have_distances =
+      distances.size() == node_cpus.size() &&
+      std::all_of(distances.begin(), distances.end(),
+                  [&](const std::vector<int>& row) {
+                    return row.size() == node_cpus.size();
+                  });
+  other_nodes_.resize(node_cpus_.size());
+  for (size_t node = 0; node < node_cpus_.size(); ++node) {
+    for (size_t i = 1; i < node_cpus_.size(); ++i) {
+      other_nodes_[node].push_back((node + i) % node_cpus_.size());
+    }
+    if (!have_distances) continue;
+    const std::vector<int>& row = distances[kept[node]];
+    std::stable_sort(other_nodes_[node].begin(), other_nodes_[node].end(),
+                     [&](size_t a, size_t b) {
+                       return row[kept[a]] < row[kept[b]];
+                     });
+  }
+}
+
+size_t CpuTopology::NodeForCpu(int cpu) const {
+  if (cpu < 0 || static_cast<size_t>(cpu) >= cpu_to_node_.size()) return 0;
+  return cpu_to_node_[cpu];
+}
+
+size_t CpuTopology::CurrentNode() const {
+  if (node_cpus_.size() == 1) return 0;
+  return NodeForCpu(static_cast<int>(gpr_cpu_current_cpu()));
+}
+
+std::optional<std::vector<int>> ParseCpuList(absl::string_view cpu_list) {
+  std::vector<int> cpus;
+  cpu_list = absl::StripAsciiWhitespace(cpu_list);
+  if (cpu_list.empty()) return cpus;
+  for (absl::string_view range : absl::StrSplit(cpu_list, ',')) {
+    const size_t dash = range.find('-');
+    int first;
+    if (!absl::SimpleAtoi(range.substr(0, dash), &first) || first < 0) {
+      return std::nullopt;
+    }
+    int last = first;
+    if (dash != absl::string_view::npos &&
+        (!absl::SimpleAtoi(range.substr(dash + 1), &last) || last < first)) {
+      return std::nullopt;
+    }
+    for (int cpu = first; cpu <= last; ++cpu) cpus.push_back(cpu);
+  }
+  return cpus;
+}
+
+bool SetCurrentThreadAffinity(absl::Span<const int> cpus) {
+#ifdef GPR_LINUX
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  bool any = false;
+  for (int cpu : cpus) {
+    if (cpu < 0 || cpu >= CPU_SETSIZE) continue;
+    CPU_SET(cpu, &set);
+    any = true;
+  }
+  if (!any) return false;
+  return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+  (void)cpus;
+  return false;
+#endif  // GPR_LINUX
+}
+
+}  // namespace grpc_event_engine::experimental
@@ -0,0 +1,73 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_THREAD_POOL_CPU_TOPOLOGY_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_THREAD_POOL_CPU_TOPOLOGY_H
+
+#include <grpc/support/port_platform.h>
+#include <stddef.h>
+
+#include <optional>
+#include <vector>
+
+#include "absl/strings/string_view.h"
+#include "absl/types/span.h"
+
+namespace grpc_event_engine::experimental {
+
+// How the CPUs that this process may run on are grouped into NUMA nodes.
+class CpuTopology {
+ public:
+  // Reads the topology of the running machine. On Linux the nodes are read
+  // from /sys/devices/system/node and restricted to the CPUs in the process's
+  // affinity mask. If that fails, or on other platforms, every CPU is reported
+  // as belonging to a single node.
+  static CpuTopology Detect();
+
+  // Builds a topology from explicit per-node CPU lists and, optionally, the
+  // matrix of distances between nodes (as in the sysfs node distance files).
+  // Nodes without CPUs are dropped; if no node has a CPU, a single node
+  // holding CPU 0 is assumed.
+  explicit CpuTopology(std::vector<std::vector<int>> node_cpus,
+                       std::vector<std::vector<int>> distances = {});
+
+  size_t num_nodes() const { return node_cpus_.size(); }
+  const std::vector<int>& cpus(size_t node) const { return node_cpus_[node]; }
+  // Returns the node that `cpu` belongs to, or 0 if it is unknown.
+  size_t NodeForCpu(int cpu) const;
+  // Returns the node of the CPU that the calling thread is running on.
+  size_t CurrentNode() const;
+  // Returns every node other than `node`, nearest first. Without distance
+  // information, nodes are ordered by index starting after `node`.
+  const std::vector<size_t>& OtherNodes(size_t node) const {
+    return other_nodes_[node];
+  }
+
+ private:
+  std::vector<std::vector<int>> node_cpus_;
+  std::vector<std::vector<size_t>> other_nodes_;
+  // Indexed by CPU number.
+  std::vector<size_t> cpu_to_node_;
+};
+
+// Parses a Linux cpulist (e.g. "0-3,8,10-11"), as found in sysfs. Returns
+// std::nullopt if `cpu_list` is malformed.
+std::optional<std::vector<int>> ParseCpuList(absl::string_view cpu_list);
+
+// Restricts the calling thread to run on `cpus`. Returns false if thread
+// affinity is not supported on this platform or could not be set.
+bool SetCurrentThreadAffinity(absl::Span<const int> cpus);
+
+}  // namespace grpc_event_engine::experimental
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_THREAD_POOL_CPU_TOPOLOGY_H
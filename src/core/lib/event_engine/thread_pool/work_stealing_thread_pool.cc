@@ -17,6 +17,7 @@
 //
 #include "src/core/lib/event_engine/thread_pool/work_stealing_thread_pool.h"
 
+#include <grpc/support/cpu.h>
 #include <grpc/support/port_platform.h>
 #include <grpc/support/thd_id.h>
 #include <inttypes.h>
@@ -26,13 +27,18 @@
 #include <cstddef>
 #include <memory>
 #include <optional>
+#include <thread>
 #include <utility>
 
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/event_engine/common_closures.h"
 #include "src/core/lib/event_engine/thread_local.h"
+#include "src/core/lib/event_engine/thread_pool/cpu_topology.h"
 #include "src/core/lib/event_engine/work_queue/basic_work_queue.h"
+#include "src/core/lib/event_engine/work_queue/chase_lev_work_queue.h"
 #include "src/core/lib/event_engine/work_queue/work_queue.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
 #include "src/core/util/backoff.h"
 #include "src/core/util/crash.h"
 #include "src/core/util/env.h"
@@ -100,6 +106,18 @@
 // enable advanced debugging. When the pool takes too long to quiesce, a
 // backtrace will be printed for every running thread, and the process will
 // abort.
+//
+// ## NUMA and CPU affinity
+//
+// Set the environment variable GRPC_THREAD_POOL_AFFINITY=numa to partition the
+// worker threads across the machine's NUMA nodes, restricting each thread to
+// the CPUs of its node, or GRPC_THREAD_POOL_AFFINITY=core to additionally pin
+// each thread to a single core. Every node then has its own global queue and
+// theft registry. Closures scheduled from outside the pool go to the queue of
+// the node the caller is running on, so the closures of a poller (and of the
+// connections it accepted) stay on the node that started them. Idle threads
+// look for work on their own node first, and only then on other nodes, nearest
+// first.
 
 namespace grpc_event_engine::experimental {
 
@@ -150,6 +168,30 @@ constexpr int kDumpStackSignal = -1;
 
 std::atomic<size_t> g_reported_dump_count{0};
 
+using ThreadAffinity = WorkStealingThreadPool::ThreadAffinity;
+
+ThreadAffinity ThreadAffinityFromEnv() {
+  auto value = grpc_core::GetEnv("GRPC_THREAD_POOL_AFFINITY");
+  if (!value.has_value() || value->empty() || *value == "none") {
+    return ThreadAffinity::kNone;
+  }
+  if (*value == "numa") return ThreadAffinity::kNumaNode;
+  if (*value == "core") return ThreadAffinity::kCore;
+  LOG(ERROR) << "Unknown GRPC_THREAD_POOL_AFFINITY value: " << *value;
+  return ThreadAffinity::kNone;
+}
+
+// Without thread affinity, all CPUs form a single node and no topology needs
+// to be read.
+CpuTopology MakeTopology(ThreadAffinity affinity) {
+  if (affinity != ThreadAffinity::kNone) return CpuTopology::Detect();
+  std::vector<int> cpus;
+  for (unsigned i = 0; i < gpr_cpu_num_cores(); ++i) {
+    cpus.push_back(static_cast<int>(i));
+  }
+  return CpuTopology({std::move(cpus)});
+}
+
 void DumpSignalHandler(int /* sig */) {
   const auto trace = grpc_core::GetCurrentStackTrace();
   if (!trace.has_value()) {
@@ -169,7 +211,12 @@ thread_local WorkQueue* g_local_queue = nullptr;
 // -------- WorkStealingThreadPool --------
 
 WorkStealingThreadPool::WorkStealingThreadPool(size_t reserve_threads)
-    : pool_{std::make_shared<WorkStealingThreadPoolImpl>(reserve_threads)} {
+    : WorkStealingThreadPool(reserve_threads, ThreadAffinityFromEnv()) {}
+
+WorkStealingThreadPool::WorkStealingThreadPool(size_t reserve_threads,
+                                               ThreadAffinity affinity)
+    : pool_{std::make_shared<WorkStealingThreadPoolImpl>(reserve_threads,
+                                                         affinity)} {
   if (g_log_verbose_failures) {
     GRPC_TRACE_LOG(event_engine, INFO)
         << "WorkStealingThreadPool verbose failures are enabled";
@@ -191,28 +238,128 @@ void WorkStealingThreadPool::Run(EventEngine::Closure* closure) {
   pool_->Run(closure);
 }
 
+std::vector<WorkStealingThreadPool::NodeStats>
+WorkStealingThreadPool::GetNodeStats() {
+  return pool_->GetNodeStats();
+}
+
 // -------- WorkStealingThreadPool::TheftRegistry --------
 
+WorkStealingThreadPool::TheftRegistry::~TheftRegistry() {
+  Segment* segment = head_.next.load(std::memory_order_relaxed);
+  while (segment != nullptr) {
+    Segment* next = segment->next.load(std::memory_order_relaxed);
+    delete segment;
+    segment = next;
+  }
+}
+
 void WorkStealingThreadPool::TheftRegistry::Enroll(WorkQueue* queue) {
   grpc_core::MutexLock lock(&mu_);
-  queues_.emplace(queue);
+  const size_t num_slots = num_slots_.load(std::memory_order_relaxed);
+  size_t index = 0;
+  Segment* segment = &head_;
+  while (true) {
+    for (Slot& slot : segment->slots) {
+      if (index == num_slots) {
+        slot.queue.store(queue, std::memory_order_release);
+        num_slots_.store(num_slots + 1, std::memory_order_release);
+        return;
+      }
+      // Reuse the slot of a queue that has been unenrolled.
+      if (slot.queue.load(std::memory_order_relaxed) == nullptr) {
+        slot.queue.store(queue, std::memory_order_release);
+        return;
+      }
+      ++index;
+    }
+    Segment* next = segment->next.load(std::memory_order_relaxed);
+    if (next == nullptr) {
+      next = new Segment();
+      segment->next.store(next, std::memory_order_release);
+    }
+    segment = next;
+  }
 }
 
 void WorkStealingThreadPool::TheftRegistry::Unenroll(WorkQueue* queue) {
   grpc_core::MutexLock lock(&mu_);
-  queues_.erase(queue);
+  const size_t num_slots = num_slots_.load(std::memory_order_relaxed);
+  size_t index = 0;
+  for (Segment* segment = &head_; segment != nullptr && index < num_slots;
+       segment = segment->next.load(std::memory_order_relaxed)) {
+    for (Slot& slot : segment->slots) {
+      if (index++ == num_slots) return;
+      if (slot.queue.load(std::memory_order_relaxed) != queue) continue;
+      slot.queue.store(nullptr, std::memory_order_seq_cst);
+      // A thief announces itself before loading the queue pointer, so any
+      // thief that could still see the queue is counted here.
+      while (slot.thieves.load(std::memory_order_seq_cst) != 0) {
+        std::this_thread::yield();
+      }
+      return;
+    }
+  }
+}
+
+template <typename T, typename F>
+T WorkStealingThreadPool::TheftRegistry::WithQueue(Slot& slot, T empty, F f) {
+  if (slot.queue.load(std::memory_order_relaxed) == nullptr) return empty;
+  slot.thieves.fetch_add(1, std::memory_order_seq_cst);
+  WorkQueue* queue = slot.queue.load(std::memory_order_seq_cst);
+  T result = queue == nullptr ? empty : f(queue);
+  slot.thieves.fetch_sub(1, std::memory_order_release);
+  return result;
 }
 
 EventEngine::Closure* WorkStealingThreadPool::TheftRegistry::StealOne() {
-  grpc_core::MutexLock lock(&mu_);
-  EventEngine::Closure* closure;
-  for (auto* queue : queues_) {
-    closure = queue->PopMostRecent();
-    if (closure != nullptr) return closure;
+  const size_t num_slots = num_slots_.load(std::memory_order_acquire);
+  if (num_slots == 0) return nullptr;
+  // Rotate the starting slot so that idle threads don't all converge on the
+  // same victim.
+  static thread_local size_t cursor = 0;
+  const size_t start = cursor++ % num_slots;
+  EventEngine::Closure* closure = nullptr;
+  auto try_steal = [&closure](Slot& slot) {
+    closure = WithQueue<EventEngine::Closure*>(
+        slot, nullptr, [](WorkQueue* queue) -> EventEngine::Closure* {
+          if (queue == g_local_queue) return nullptr;
+          return queue->PopOldest();
+        });
+    return closure != nullptr;
+  };
+  // Scan [start, num_slots) and then [0, start).
+  for (size_t pass = 0; pass < 2; ++pass) {
+    const size_t begin = pass == 0 ? start : 0;
+    const size_t end = pass == 0 ? num_slots : start;
+    Segment* segment = &head_;
+    for (size_t i = 0; i + kSlotsPerSegment <= begin; i += kSlotsPerSegment) {
+      segment = segment->next.load(std::memory_order_acquire);
+    }
+    for (size_t index = begin; index < end; ++index) {
+      if (index != begin && index % kSlotsPerSegment == 0) {
+        segment = segment->next.load(std::memory_order_acquire);
+      }
+      if (try_steal(segment->slots[index % kSlotsPerSegment])) return closure;
+    }
   }
   return nullptr;
 }
 
+size_t WorkStealingThreadPool::TheftRegistry::QueuedClosures() {
+  const size_t num_slots = num_slots_.load(std::memory_order_acquire);
+  size_t total = 0;
+  Segment* segment = &head_;
+  for (size_t index = 0; index < num_slots; ++index) {
+    if (index != 0 && index % kSlotsPerSegment == 0) {
+      segment = segment->next.load(std::memory_order_acquire);
+    }
+    total += WithQueue<size_t>(segment->slots[index % kSlotsPerSegment], 0,
+                               [](WorkQueue* queue) { return queue->Size(); });
+  }
+  return total;
+}
+
 #if GRPC_ENABLE_FORK_SUPPORT
 
 void WorkStealingThreadPool::PrepareFork() { pool_->PrepareFork(); }
@@ -224,8 +371,19 @@ void WorkStealingThreadPool::PostFork() { pool_->Postfork(); }
 // -------- WorkStealingThreadPool::WorkStealingThreadPoolImpl --------
 
 WorkStealingThreadPool::WorkStealingThreadPoolImpl::WorkStealingThreadPoolImpl(
-    size_t reserve_threads)
-    : reserve_threads_(reserve_threads), queue_(this) {}
+    size_t reserve_threads, ThreadAffinity affinity)
+    : reserve_threads_(reserve_threads),
+      affinity_(affinity),
+      topology_(MakeTopology(affinity)) {
+  for (size_t i = 0; i < topology_.num_nodes(); ++i) {
+    nodes_.push_back(std::make_unique<Node>(this));
+  }
+  if (affinity_ != ThreadAffinity::kNone) {
+    GRPC_TRACE_LOG(event_engine, INFO)
+        << "WorkStealingThreadPool partitioned across " << nodes_.size()
+        << " NUMA node(s)";
+  }
+}
 
 void WorkStealingThreadPool::WorkStealingThreadPoolImpl::Start() {
   for (size_t i = 0; i < reserve_threads_; i++) {
@@ -241,7 +399,7 @@ void WorkStealingThreadPool::WorkStealingThreadPoolImpl::Run(
   if (g_local_queue != nullptr && g_local_queue->owner() == this) {
     g_local_queue->Add(closure);
   } else {
-    queue_.Add(closure);
+    nodes_[topology_.CurrentNode()]->queue.Add(closure);
   }
   // Signal a worker in any case, even if work was added to a local queue. This
   // improves performance on 32-core streaming benchmarks with small payloads.
@@ -279,7 +437,7 @@ void WorkStealingThreadPool::WorkStealingThreadPoolImpl::Quiesce() {
   if (!threads_were_shut_down.ok() && g_log_verbose_failures) {
     DumpStacksAndCrash();
   }
-  GRPC_CHECK(queue_.Empty());
+  GRPC_CHECK(GlobalQueuesEmpty());
   quiesced_.store(true, std::memory_order_relaxed);
   grpc_core::MutexLock lock(&lifeguard_ptr_mu_);
   lifeguard_.reset();
@@ -346,6 +504,101 @@ void WorkStealingThreadPool::WorkStealingThreadPoolImpl::UntrackThread(
   thds_.erase(tid);
 }
 
+size_t WorkStealingThreadPool::WorkStealingThreadPoolImpl::AssignNode() {
+  size_t best = 0;
+  size_t best_count = nodes_[0]->thread_count.load(std::memory_order_relaxed);
+  for (size_t i = 1; i < nodes_.size(); ++i) {
+    const size_t count =
+        nodes_[i]->thread_count.load(std::memory_order_relaxed);
+    if (count < best_count) {
+      best = i;
+      best_count = count;
+    }
+  }
+  nodes_[best]->thread_count.fetch_add(1, std::memory_order_relaxed);
+  return best;
+}
+
+void WorkStealingThreadPool::WorkStealingThreadPoolImpl::PinCurrentThread(
+    size_t node) {
+  if (affinity_ == ThreadAffinity::kNone) return;
+  const std::vector<int>& cpus = topology_.cpus(node);
+  bool pinned;
+  if (affinity_ == ThreadAffinity::kCore) {
+    const size_t core =
+        nodes_[node]->next_core.fetch_add(1, std::memory_order_relaxed);
+    pinned = SetCurrentThreadAffinity({cpus[core % cpus.size()]});
+  } else {
+    pinned = SetCurrentThreadAffinity(cpus);
+  }
+  if (!pinned) {
+    GRPC_TRACE_LOG(event_engine, INFO)
+        << "Could not set the CPU affinity of a thread pool thread on node "
+        << node;
+  }
+}
+
+EventEngine::Closure* WorkStealingThreadPool::WorkStealingThreadPoolImpl::
+    PopGlobal(size_t node) {
+  EventEngine::Closure* closure = nodes_[node]->queue.PopMostRecent();
+  if (closure != nullptr) return closure;
+  for (size_t other : topology_.OtherNodes(node)) {
+    closure = nodes_[other]->queue.PopMostRecent();
+    if (closure != nullptr) {
+      nodes_[node]->cross_node_steals.fetch_add(1, std::memory_order_relaxed);
+      grpc_core::global_stats().IncrementThreadPoolCrossNodeSteals();
+      return closure;
+    }
+  }
+  return nullptr;
+}
+
+EventEngine::Closure* WorkStealingThreadPool::WorkStealingThreadPoolImpl::Steal(
+    size_t node) {
+  EventEngine::Closure* closure = nodes_[node]->theft_registry.StealOne();
+  if (closure != nullptr) {
+    grpc_core::global_stats().IncrementThreadPoolSameNodeSteals();
+    return closure;
+  }
+  for (size_t other : topology_.OtherNodes(node)) {
+    closure = nodes_[other]->theft_registry.StealOne();
+    if (closure != nullptr) {
+      nodes_[node]->cross_node_steals.fetch_add(1, std::memory_order_relaxed);
+      grpc_core::global_stats().IncrementThreadPoolCrossNodeSteals();
+      return closure;
+    }
+  }
+  return nullptr;
+}
+
+bool WorkStealingThreadPool::WorkStealingThreadPoolImpl::GlobalQueuesEmpty() {
+  for (const auto& node : nodes_) {
+    if (!node->queue.Empty()) return false;
+  }
+  return true;
+}
+
+std::vector<WorkStealingThreadPool::NodeStats>
+WorkStealingThreadPool::WorkStealingThreadPoolImpl::GetNodeStats() {
+  std::vector<NodeStats> stats;
+  for (size_t i = 0; i < nodes_.size(); ++i) {
+    Node& node = *nodes_[i];
+    stats.push_back(NodeStats{
+        topology_.cpus(i),
+        node.queue.Size() + node.theft_registry.QueuedClosures(),
+        node.thread_count.load(std::memory_order_relaxed),
+        node.cross_node_steals.load(std::memory_order_relaxed)});
+  }
+  return stats;
+}
+
+void WorkStealingThreadPool::WorkStealingThreadPoolImpl::RecordQueueDepths() {
+  for (const auto& node : nodes_) {
+    grpc_core::global_stats().IncrementThreadPoolNodeQueueDepth(
+        node->queue.Size() + node->theft_registry.QueuedClosures());
+  }
+}
+
 void WorkStealingThreadPool::WorkStealingThreadPoolImpl::DumpStacksAndCrash() {
   grpc_core::MutexLock lock(&thd_set_mu_);
   LOG(ERROR) << "Pool did not quiesce in time, gRPC will not shut down "
@@ -408,6 +661,7 @@ void WorkStealingThreadPool::WorkStealingThreadPoolImpl::Lifeguard::
     }
     lifeguard_should_shut_down_->WaitForNotificationWithTimeout(
         absl::Milliseconds(backoff_.NextAttemptDelay().millis()));
+    pool_->RecordQueueDepths();
     MaybeStartNewThread();
   }
   lifeguard_running_.store(false, std::memory_order_relaxed);
@@ -439,7 +693,7 @@ bool WorkStealingThreadPool::WorkStealingThreadPoolImpl::Lifeguard::
   const auto living_thread_count = pool_->living_thread_count()->count();
   // Wake an idle worker thread if there's global work to be had.
   if (pool_->busy_thread_count()->count() < living_thread_count) {
-    if (!pool_->queue_.Empty()) {
+    if (!pool_->GlobalQueuesEmpty()) {
       pool_->work_signal()->Signal();
       backoff_.Reset();
     }
@@ -480,7 +734,12 @@ WorkStealingThreadPool::ThreadState::ThreadState(
                    .set_initial_backoff(kWorkerThreadMinSleepBetweenChecks)
                    .set_max_backoff(kWorkerThreadMaxSleepBetweenChecks)
                    .set_multiplier(1.3)),
-      busy_count_idx_(pool_->busy_thread_count()->NextIndex()) {}
+      busy_count_idx_(pool_->busy_thread_count()->NextIndex()),
+      node_(pool_->AssignNode()) {}
+
+WorkStealingThreadPool::ThreadState::~ThreadState() {
+  pool_->node(node_)->thread_count.fetch_sub(1, std::memory_order_relaxed);
+}
 
 void WorkStealingThreadPool::ThreadState::ThreadBody() {
   if (g_log_verbose_failures) {
@@ -491,8 +750,10 @@ void WorkStealingThreadPool::ThreadState::ThreadBody() {
 #endif
     pool_->TrackThread(gpr_thd_currentid());
   }
-  g_local_queue = new BasicWorkQueue(pool_.get());
-  pool_->theft_registry()->Enroll(g_local_queue);
+  pool_->PinCurrentThread(node_);
+  WorkStealingThreadPoolImpl::Node* node = pool_->node(node_);
+  g_local_queue = new ChaseLevWorkQueue(pool_.get(), &node->queue);
+  node->theft_registry.Enroll(g_local_queue);
   ThreadLocal::SetIsEventEngineThread(true);
   while (Step()) {
     // loop until the thread should no longer run
@@ -504,14 +765,14 @@ void WorkStealingThreadPool::ThreadState::ThreadBody() {
     while (!g_local_queue->Empty()) {
       closure = g_local_queue->PopMostRecent();
       if (closure != nullptr) {
-        pool_->queue()->Add(closure);
+        node->queue.Add(closure);
       }
     }
   } else if (pool_->IsShutdown()) {
     FinishDraining();
   }
   GRPC_CHECK(g_local_queue->Empty());
-  pool_->theft_registry()->Unenroll(g_local_queue);
+  node->theft_registry.Unenroll(g_local_queue);
   delete g_local_queue;
   if (g_log_verbose_failures) {
     pool_->UntrackThread(gpr_thd_currentid());
@@ -547,13 +808,13 @@ bool WorkStealingThreadPool::ThreadState::Step() {
     // TODO(hork): consider an empty check for performance wins. Depends on the
     // queue implementation, the BasicWorkQueue takes two locks when you do an
     // empty check then pop.
-    closure = pool_->queue()->PopMostRecent();
+    closure = pool_->PopGlobal(node_);
     if (closure != nullptr) {
       should_run_again = true;
       break;
     };
     // Try stealing if the queue is empty
-    closure = pool_->theft_registry()->StealOne();
+    closure = pool_->Steal(node_);
     if (closure != nullptr) {
       should_run_again = true;
       break;
@@ -600,8 +861,8 @@ void WorkStealingThreadPool::ThreadState::FinishDraining() {
       }
       continue;
     }
-    if (!pool_->queue()->Empty()) {
-      auto* closure = pool_->queue()->PopMostRecent();
+    if (!pool_->GlobalQueuesEmpty()) {
+      auto* closure = pool_->PopGlobal(node_);
       if (closure != nullptr) {
         closure->Run();
       }
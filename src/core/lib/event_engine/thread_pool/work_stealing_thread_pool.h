@@ -26,7 +26,9 @@
 
 #include <atomic>
 #include <memory>
+#include <vector>
 
+#include "src/core/lib/event_engine/thread_pool/cpu_topology.h"
 #include "src/core/lib/event_engine/thread_pool/thread_count.h"
 #include "src/core/lib/event_engine/thread_pool/thread_pool.h"
 #include "src/core/lib/event_engine/work_queue/basic_work_queue.h"
@@ -43,7 +45,33 @@ namespace grpc_event_engine::experimental {
 
 class WorkStealingThreadPool final : public ThreadPool {
  public:
+  // How worker threads are placed on CPUs.
+  enum class ThreadAffinity {
+    // Threads may run on any CPU, and form a single group.
+    kNone,
+    // Threads are partitioned across the NUMA nodes of the machine and may
+    // run on any CPU of their node.
+    kNumaNode,
+    // As kNumaNode, but each thread is also pinned to one core of its node.
+    kCore,
+  };
+
+  // Per-NUMA-node statistics. Without thread affinity, the whole pool is
+  // reported as a single node.
+  struct NodeStats {
+    std::vector<int> cpus;
+    // Closures waiting in the node's global queue and its threads' local
+    // queues.
+    size_t queued_closures;
+    size_t threads;
+    // Closures that threads of this node took from other nodes' queues.
+    uint64_t cross_node_steals;
+  };
+
+  // The thread affinity is read from the GRPC_THREAD_POOL_AFFINITY
+  // environment variable.
   explicit WorkStealingThreadPool(size_t reserve_threads);
+  WorkStealingThreadPool(size_t reserve_threads, ThreadAffinity affinity);
   // Asserts Quiesce was called.
   ~WorkStealingThreadPool() override;
   // Shut down the pool, and wait for all threads to exit.
@@ -52,6 +80,7 @@ class WorkStealingThreadPool final : public ThreadPool {
   // Run must not be called after Quiesce completes
   void Run(absl::AnyInvocable<void()> callback) override;
   void Run(EventEngine::Closure* closure) override;
+  std::vector<NodeStats> GetNodeStats();
 
 #if GRPC_ENABLE_FORK_SUPPORT
   // Forkable
@@ -80,19 +109,49 @@ class WorkStealingThreadPool final : public ThreadPool {
   // Every worker thread registers and unregisters its thread-local thread pool
   // here, and steals closures from other threads when work is otherwise
   // unavailable.
+  //
+  // StealOne is lock-free: queues live in slots of a segmented array that only
+  // grows, and each slot counts the thieves currently inside it so that
+  // Unenroll can wait for them to leave before the queue is destroyed.
+  // Enroll and Unenroll are rare and serialize on a mutex among themselves.
   class TheftRegistry {
    public:
+    TheftRegistry() = default;
+    TheftRegistry(const TheftRegistry&) = delete;
+    TheftRegistry& operator=(const TheftRegistry&) = delete;
+    ~TheftRegistry();
     // Allow any member of the registry to steal from the provided queue.
     void Enroll(WorkQueue* queue) ABSL_LOCKS_EXCLUDED(mu_);
-    // Disallow work stealing from the provided queue.
+    // Disallow work stealing from the provided queue. Once this returns, no
+    // thief is accessing the queue.
     void Unenroll(WorkQueue* queue) ABSL_LOCKS_EXCLUDED(mu_);
     // Returns one closure from another thread, or nullptr if none are
     // available.
-    EventEngine::Closure* StealOne() ABSL_LOCKS_EXCLUDED(mu_);
+    EventEngine::Closure* StealOne();
+    // Returns the number of closures in all enrolled queues.
+    size_t QueuedClosures();
 
    private:
+    static constexpr size_t kSlotsPerSegment = 64;
+    struct alignas(GPR_CACHELINE_SIZE) Slot {
+      std::atomic<WorkQueue*> queue{nullptr};
+      std::atomic<uint32_t> thieves{0};
+    };
+    struct Segment {
+      Slot slots[kSlotsPerSegment];
+      std::atomic<Segment*> next{nullptr};
+    };
+
+    // Runs `f` on the queue in `slot`, if any, while keeping Unenroll from
+    // destroying it. Returns the result of `f`, or `empty` if there is no
+    // queue.
+    template <typename T, typename F>
+    static T WithQueue(Slot& slot, T empty, F f);
+
     grpc_core::Mutex mu_;
-    absl::flat_hash_set<WorkQueue*> queues_ ABSL_GUARDED_BY(mu_);
+    Segment head_;
+    // Slots handed out so far; bounds the scan in StealOne.
+    std::atomic<size_t> num_slots_{0};
   };
 
   // An implementation of the ThreadPool
@@ -102,11 +161,25 @@ class WorkStealingThreadPool final : public ThreadPool {
   class WorkStealingThreadPoolImpl
       : public std::enable_shared_from_this<WorkStealingThreadPoolImpl> {
    public:
-    explicit WorkStealingThreadPoolImpl(size_t reserve_threads);
+    // Per-NUMA-node state. Without thread affinity there is a single node.
+    struct Node {
+      explicit Node(WorkStealingThreadPoolImpl* pool) : queue(pool) {}
+      // Closures scheduled from outside the pool while running on this node.
+      BasicWorkQueue queue;
+      // The local queues of this node's threads.
+      TheftRegistry theft_registry;
+      std::atomic<size_t> thread_count{0};
+      // Used to hand out cores round-robin under ThreadAffinity::kCore.
+      std::atomic<size_t> next_core{0};
+      std::atomic<uint64_t> cross_node_steals{0};
+    };
+
+    WorkStealingThreadPoolImpl(size_t reserve_threads,
+                               ThreadAffinity affinity);
     // Start all threads.
     void Start();
     // Add a closure to a work queue, preferably a thread-local queue if
-    // available, otherwise the global queue.
+    // available, otherwise the global queue of the current node.
     void Run(EventEngine::Closure* closure);
     // Start a new thread.
     // The reason argument determines whether thread creation is rate-limited;
@@ -133,6 +206,22 @@ class WorkStealingThreadPool final : public ThreadPool {
     // Thread ID tracking
     void TrackThread(gpr_thd_id tid);
     void UntrackThread(gpr_thd_id tid);
+    // NUMA placement
+    // Picks the node with the fewest threads for a new thread.
+    size_t AssignNode();
+    // Applies the pool's thread affinity to the calling thread, which lives
+    // on `node`.
+    void PinCurrentThread(size_t node);
+    // Returns a closure from the global queue of `node`, or else of the
+    // nearest node that has one.
+    EventEngine::Closure* PopGlobal(size_t node);
+    // Steals a closure from a thread of `node`, or else of the nearest node
+    // that has one.
+    EventEngine::Closure* Steal(size_t node);
+    bool GlobalQueuesEmpty();
+    std::vector<NodeStats> GetNodeStats();
+    // Records the depth of each node's queues in the global stats.
+    void RecordQueueDepths();
     // Accessor methods
     bool IsShutdown();
     bool IsForking();
@@ -140,8 +229,7 @@ class WorkStealingThreadPool final : public ThreadPool {
     size_t reserve_threads() { return reserve_threads_; }
     BusyThreadCount* busy_thread_count() { return &busy_thread_count_; }
     LivingThreadCount* living_thread_count() { return &living_thread_count_; }
-    TheftRegistry* theft_registry() { return &theft_registry_; }
-    WorkQueue* queue() { return &queue_; }
+    Node* node(size_t index) { return nodes_[index].get(); }
     WorkSignal* work_signal() { return &work_signal_; }
 
    private:
@@ -173,10 +261,11 @@ class WorkStealingThreadPool final : public ThreadPool {
     void DumpStacksAndCrash();
 
     const size_t reserve_threads_;
+    const ThreadAffinity affinity_;
+    const CpuTopology topology_;
     BusyThreadCount busy_thread_count_;
     LivingThreadCount living_thread_count_;
-    TheftRegistry theft_registry_;
-    BasicWorkQueue queue_;
+    std::vector<std::unique_ptr<Node>> nodes_;
     // Track shutdown and fork bits separately.
     // It's possible for a ThreadPool to initiate shut down while fork handlers
     // are running, and similarly possible for a fork event to occur during
@@ -199,6 +288,7 @@ class WorkStealingThreadPool final : public ThreadPool {
   class ThreadState {
    public:
     explicit ThreadState(std::shared_ptr<WorkStealingThreadPoolImpl> pool);
+    ~ThreadState();
     void ThreadBody();
     void SleepIfRunning();
     bool Step();
@@ -216,6 +306,8 @@ class WorkStealingThreadPool final : public ThreadPool {
     LivingThreadCount::AutoThreadCounter auto_thread_counter_;
     grpc_core::BackOff backoff_;
     size_t busy_count_idx_;
+    // The NUMA node this thread lives on.
+    const size_t node_;
   };
 
   const std::shared_ptr<WorkStealingThreadPoolImpl> pool_;
@@ -0,0 +1,111 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "src/core/lib/event_engine/work_queue/chase_lev_work_queue.h"
+
+#include <grpc/support/port_platform.h>
+
+#include <utility>
+
+#include "src/core/lib/event_engine/common_closures.h"
+#include "src/core/util/grpc_check.h"
+
+namespace grpc_event_engine::experimental {
+
+namespace {
+size_t RoundUpToPowerOfTwo(size_t n) {
+  size_t result = 1;
+  while (result < n) result <<= 1;
+  return result;
+}
+}  // namespace
+
+ChaseLevWorkQueue::ChaseLevWorkQueue(void* owner, WorkQueue* overflow,
+                                     size_t capacity)
+    : mask_(static_cast<int64_t>(RoundUpToPowerOfTwo(capacity)) - 1),
+      buffer_(new std::atomic<EventEngine::Closure*>[mask_ + 1]),
+      overflow_(overflow),
+      owner_(owner) {
+  for (int64_t i = 0; i <= mask_; ++i) {
+    buffer_[i].store(nullptr, std::memory_order_relaxed);
+  }
+}
+
+bool ChaseLevWorkQueue::Empty() const { return Size() == 0; }
+
+size_t ChaseLevWorkQueue::Size() const {
+  const int64_t t = top_.load(std::memory_order_acquire);
+  const int64_t b = bottom_.load(std::memory_order_acquire);
+  // The owner transiently decrements bottom_ below top_ while popping the
+  // last element.
+  return b > t ? static_cast<size_t>(b - t) : 0;
+}
+
+void ChaseLevWorkQueue::Add(EventEngine::Closure* closure) {
+  const int64_t b = bottom_.load(std::memory_order_relaxed);
+  const int64_t t = top_.load(std::memory_order_acquire);
+  if (b - t > mask_) {
+    GRPC_CHECK_NE(overflow_, nullptr) << "ChaseLevWorkQueue is full";
+    overflow_->Add(closure);
+    return;
+  }
+  buffer_[b & mask_].store(closure, std::memory_order_relaxed);
+  // Publish the element to thieves.
+  bottom_.store(b + 1, std::memory_order_release);
+}
+
+void ChaseLevWorkQueue::Add(absl::AnyInvocable<void()> invocable) {
+  Add(SelfDeletingClosure::Create(std::move(invocable)));
+}
+
+EventEngine::Closure* ChaseLevWorkQueue::PopMostRecent() {
+  const int64_t b = bottom_.load(std::memory_order_relaxed) - 1;
+  bottom_.store(b, std::memory_order_relaxed);
+  // Order the bottom_ reservation before reading top_: either a concurrent
+  // thief sees the reservation, or we see its increment of top_.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  int64_t t = top_.load(std::memory_order_relaxed);
+  if (t > b) {
+    // Empty.
+    bottom_.store(b + 1, std::memory_order_relaxed);
+    return nullptr;
+  }
+  EventEngine::Closure* closure =
+      buffer_[b & mask_].load(std::memory_order_relaxed);
+  if (t == b) {
+    // Last element: race thieves for it.
+    if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                      std::memory_order_relaxed)) {
+      closure = nullptr;
+    }
+    bottom_.store(b + 1, std::memory_order_relaxed);
+  }
+  return closure;
+}
+
+EventEngine::Closure* ChaseLevWorkQueue::PopOldest() {
+  int64_t t = top_.load(std::memory_order_acquire);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  const int64_t b = bottom_.load(std::memory_order_acquire);
+  if (t >= b) return nullptr;
+  EventEngine::Closure* closure =
+      buffer_[t & mask_].load(std::memory_order_relaxed);
+  if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                    std::memory_order_relaxed)) {
+    // Lost the race to the owner or another thief.
+    return nullptr;
+  }
+  return closure;
+}
+
+}  // namespace grpc_event_engine::experimental
@@ -0,0 +1,82 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_WORK_QUEUE_CHASE_LEV_WORK_QUEUE_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_WORK_QUEUE_CHASE_LEV_WORK_QUEUE_H
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <memory>
+
+#include "src/core/lib/event_engine/work_queue/work_queue.h"
+#include "absl/functional/any_invocable.h"
+
+namespace grpc_event_engine::experimental {
+
+// A bounded, lock-free work-stealing deque (Chase & Lev, "Dynamic Circular
+// Work-Stealing Deque", with the memory orderings from Lê et al., "Correct and
+// Efficient Work-Stealing for Weak Memory Models").
+//
+// Unlike other WorkQueues, this queue has a single owner: Add and
+// PopMostRecent may only be called from the owning thread, and never
+// concurrently with each other. PopOldest may be called from any thread and is
+// how other threads steal work. The owner's operations need no atomic
+// read-modify-write unless they race with a thief for the last element; steals
+// claim an element with a single compare-and-swap.
+//
+// The deque holds at most `capacity` closures. Closures added to a full deque
+// are forwarded to the `overflow` queue, which must be safe to use from any
+// thread.
+//
+// Empty() and Size() may be called from any thread, but are only a snapshot
+// when called concurrently with other operations.
+class ChaseLevWorkQueue : public WorkQueue {
+ public:
+  static constexpr size_t kDefaultCapacity = 1024;
+
+  // `capacity` is rounded up to a power of two. `overflow` may be nullptr if
+  // the caller guarantees that the deque is never filled beyond capacity.
+  explicit ChaseLevWorkQueue(void* owner = nullptr,
+                             WorkQueue* overflow = nullptr,
+                             size_t capacity = kDefaultCapacity);
+  bool Empty() const override;
+  size_t Size() const override;
+  // Owner only. Returns the most recently added closure, or nullptr if the
+  // queue is empty or a thief claimed the last closure first.
+  EventEngine::Closure* PopMostRecent() override;
+  // Any thread. Returns the oldest closure, or nullptr if the queue is empty or
+  // another thread claimed it first.
+  EventEngine::Closure* PopOldest() override;
+  // Owner only.
+  void Add(EventEngine::Closure* closure) override;
+  // Owner only. Wraps an AnyInvocable and adds it to the the queue.
+  void Add(absl::AnyInvocable<void()> invocable) override;
+  const void* owner() override { return owner_; }
+
+ private:
+  // top_ and bottom_ are written by different parties (thieves and the owner
+  // respectively); keep them on separate cache lines.
+  alignas(GPR_CACHELINE_SIZE) std::atomic<int64_t> top_{0};
+  alignas(GPR_CACHELINE_SIZE) std::atomic<int64_t> bottom_{0};
+  alignas(GPR_CACHELINE_SIZE) const int64_t mask_;
+  const std::unique_ptr<std::atomic<EventEngine::Closure*>[]> buffer_;
+  WorkQueue* const overflow_;
+  const void* const owner_;
+};
+
+}  // namespace grpc_event_engine::experimental
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_WORK_QUEUE_CHASE_LEV_WORK_QUEUE_H
@@ -26,6 +26,10 @@ namespace {
 const char* const description_buffer_list_deletion_prep =
     "Gate the removal of old TCP timestamp collection mechanism.";
 const char* const additional_constraints_buffer_list_deletion_prep = "{}";
+const char* const description_call_arena_recycling =
+    "Recycle the storage of destroyed call arenas for new calls on the same "
+    "channel, instead of freeing and reallocating it per call.";
+const char* const additional_constraints_call_arena_recycling = "{}";
 const char* const description_call_tracer_in_transport =
     "Transport directly passes byte counts to CallTracer.";
 const char* const additional_constraints_call_tracer_in_transport = "{}";
@@ -47,6 +51,25 @@ const char* const additional_constraints_chaotic_good_connect_deadline = "{}";
 const char* const description_chaotic_good_framing_layer =
     "Enable the chaotic good framing layer.";
 const char* const additional_constraints_chaotic_good_framing_layer = "{}";
+const char* const description_chttp2_adaptive_stream_window =
+    "Size the flow control window of each chttp2 stream from the rate at which "
+    "the application reads it, instead of from the bandwidth-delay product of "
+    "the transport.";
+const char* const additional_constraints_chttp2_adaptive_stream_window = "{}";
+const char* const description_chttp2_model_write_sizing =
+    "Size chttp2 writes from the measured bandwidth and round trip time of the "
+    "link and the bytes queued in the kernel, instead of by timing writes.";
+const char* const additional_constraints_chttp2_model_write_sizing = "{}";
+const char* const description_chttp2_pipelined_reads =
+    "Read the next bytes of a chttp2 connection from the endpoint while the "
+    "last ones are parsed, so that endpoint work such as decryption runs in "
+    "parallel with parsing.";
+const char* const additional_constraints_chttp2_pipelined_reads = "{}";
+const char* const description_chttp2_write_combining =
+    "Hold back chttp2 writes of call frames for a short window while many "
+    "calls are active, so that the frames of concurrent calls share endpoint "
+    "writes.";
+const char* const additional_constraints_chttp2_write_combining = "{}";
 const char* const description_error_flatten =
     "Flatten errors to ordinary absl::Status form.";
 const char* const additional_constraints_error_flatten = "{}";
@@ -65,6 +88,11 @@ const char* const description_event_engine_fork =
     "Enables event engine fork handling, including onfork events and file "
     "descriptor generations";
 const char* const additional_constraints_event_engine_fork = "{}";
+const char* const description_event_engine_io_uring_provided_buffers =
+    "Let the io_uring poller receive into a buffer ring shared by all of its "
+    "sockets instead of into memory reserved per connection.";
+const char* const
+    additional_constraints_event_engine_io_uring_provided_buffers = "{}";
 const char* const description_event_engine_listener =
     "Use EventEngine listeners instead of iomgr's grpc_tcp_server";
 const char* const additional_constraints_event_engine_listener = "{}";
@@ -88,6 +116,14 @@ const uint8_t required_experiments_event_engine_for_all_other_endpoints[] = {
 const char* const description_event_engine_poller_for_python =
     "Enable event engine poller in gRPC Python";
 const char* const additional_constraints_event_engine_poller_for_python = "{}";
+const char* const description_event_engine_timer_wheel =
+    "Use a hierarchical timing wheel instead of sharded heaps for EventEngine "
+    "timers.";
+const char* const additional_constraints_event_engine_timer_wheel = "{}";
+const char* const description_event_engine_write_batching =
+    "Coalesce POSIX EventEngine endpoint writes that become ready in the same "
+    "poller iteration, and submit them together.";
+const char* const additional_constraints_event_engine_write_batching = "{}";
 const char* const description_fail_recv_metadata_on_deadline_exceeded =
     "Fail recv initial metadata when the deadline is exceeded.";
 const char* const
@@ -98,6 +134,10 @@ const char* const additional_constraints_free_large_allocator = "{}";
 const char* const description_fuse_filters =
     "If set, individual filters are merged into fused filters";
 const char* const additional_constraints_fuse_filters = "{}";
+const char* const description_hpack_adaptive_indexing =
+    "Only add headers to the HPACK dynamic table when they were sent on the "
+    "connection before, or when adding them evicts nothing.";
+const char* const additional_constraints_hpack_adaptive_indexing = "{}";
 const char* const description_keep_alive_ping_timer_batch =
     "Avoid explicitly cancelling the keepalive timer. Instead adjust the "
     "callback to re-schedule itself to the next ping interval.";
@@ -246,6 +286,8 @@ namespace grpc_core {
 const ExperimentMetadata g_experiment_metadata[] = {
     {"buffer_list_deletion_prep", description_buffer_list_deletion_prep,
      additional_constraints_buffer_list_deletion_prep, nullptr, 0, false, true},
+    {"call_arena_recycling", description_call_arena_recycling,
+     additional_constraints_call_arena_recycling, nullptr, 0, false, true},
     {"call_tracer_in_transport", description_call_tracer_in_transport,
      additional_constraints_call_tracer_in_transport, nullptr, 0, true, false},
     {"call_tracer_send_initial_metadata_is_an_annotation",
@@ -262,6 +304,15 @@ const ExperimentMetadata g_experiment_metadata[] = {
     {"chaotic_good_framing_layer", description_chaotic_good_framing_layer,
      additional_constraints_chaotic_good_framing_layer, nullptr, 0, true,
      false},
+    {"chttp2_adaptive_stream_window", description_chttp2_adaptive_stream_window,
+     additional_constraints_chttp2_adaptive_stream_window, nullptr, 0, false,
+     true},
+    {"chttp2_model_write_sizing", description_chttp2_model_write_sizing,
+     additional_constraints_chttp2_model_write_sizing, nullptr, 0, false, true},
+    {"chttp2_pipelined_reads", description_chttp2_pipelined_reads,
+     additional_constraints_chttp2_pipelined_reads, nullptr, 0, false, true},
+    {"chttp2_write_combining", description_chttp2_write_combining,
+     additional_constraints_chttp2_write_combining, nullptr, 0, false, true},
     {"error_flatten", description_error_flatten,
      additional_constraints_error_flatten, nullptr, 0, false, false},
     {"event_engine_client", description_event_engine_client,
@@ -274,6 +325,10 @@ const ExperimentMetadata g_experiment_metadata[] = {
      true, false},
     {"event_engine_fork", description_event_engine_fork,
      additional_constraints_event_engine_fork, nullptr, 0, false, false},
+    {"event_engine_io_uring_provided_buffers",
+     description_event_engine_io_uring_provided_buffers,
+     additional_constraints_event_engine_io_uring_provided_buffers, nullptr, 0,
+     false, true},
     {"event_engine_listener", description_event_engine_listener,
      additional_constraints_event_engine_listener, nullptr, 0, true, false},
     {"event_engine_callback_cq", description_event_engine_callback_cq,
@@ -287,6 +342,11 @@ const ExperimentMetadata g_experiment_metadata[] = {
      description_event_engine_poller_for_python,
      additional_constraints_event_engine_poller_for_python, nullptr, 0, false,
      true},
+    {"event_engine_timer_wheel", description_event_engine_timer_wheel,
+     additional_constraints_event_engine_timer_wheel, nullptr, 0, false, true},
+    {"event_engine_write_batching", description_event_engine_write_batching,
+     additional_constraints_event_engine_write_batching, nullptr, 0, false,
+     true},
     {"fail_recv_metadata_on_deadline_exceeded",
      description_fail_recv_metadata_on_deadline_exceeded,
      additional_constraints_fail_recv_metadata_on_deadline_exceeded, nullptr, 0,
@@ -295,6 +355,8 @@ const ExperimentMetadata g_experiment_metadata[] = {
      additional_constraints_free_large_allocator, nullptr, 0, false, true},
     {"fuse_filters", description_fuse_filters,
      additional_constraints_fuse_filters, nullptr, 0, false, false},
+    {"hpack_adaptive_indexing", description_hpack_adaptive_indexing,
+     additional_constraints_hpack_adaptive_indexing, nullptr, 0, false, true},
     {"keep_alive_ping_timer_batch", description_keep_alive_ping_timer_batch,
      additional_constraints_keep_alive_ping_timer_batch, nullptr, 0, false,
      true},
@@ -418,6 +480,10 @@ namespace {
 const char* const description_buffer_list_deletion_prep =
     "Gate the removal of old TCP timestamp collection mechanism.";
 const char* const additional_constraints_buffer_list_deletion_prep = "{}";
+const char* const description_call_arena_recycling =
+    "Recycle the storage of destroyed call arenas for new calls on the same "
+    "channel, instead of freeing and reallocating it per call.";
+const char* const additional_constraints_call_arena_recycling = "{}";
 const char* const description_call_tracer_in_transport =
     "Transport directly passes byte counts to CallTracer.";
 const char* const additional_constraints_call_tracer_in_transport = "{}";
@@ -439,6 +505,25 @@ const char* const additional_constraints_chaotic_good_connect_deadline = "{}";
 const char* const description_chaotic_good_framing_layer =
     "Enable the chaotic good framing layer.";
 const char* const additional_constraints_chaotic_good_framing_layer = "{}";
+const char* const description_chttp2_adaptive_stream_window =
+    "Size the flow control window of each chttp2 stream from the rate at which "
+    "the application reads it, instead of from the bandwidth-delay product of "
+    "the transport.";
+const char* const additional_constraints_chttp2_adaptive_stream_window = "{}";
+const char* const description_chttp2_model_write_sizing =
+    "Size chttp2 writes from the measured bandwidth and round trip time of the "
+    "link and the bytes queued in the kernel, instead of by timing writes.";
+const char* const additional_constraints_chttp2_model_write_sizing = "{}";
+const char* const description_chttp2_pipelined_reads =
+    "Read the next bytes of a chttp2 connection from the endpoint while the "
+    "last ones are parsed, so that endpoint work such as decryption runs in "
+    "parallel with parsing.";
+const char* const additional_constraints_chttp2_pipelined_reads = "{}";
+const char* const description_chttp2_write_combining =
+    "Hold back chttp2 writes of call frames for a short window while many "
+    "calls are active, so that the frames of concurrent calls share endpoint "
+    "writes.";
+const char* const additional_constraints_chttp2_write_combining = "{}";
 const char* const description_error_flatten =
     "Flatten errors to ordinary absl::Status form.";
 const char* const additional_constraints_error_flatten = "{}";
@@ -457,6 +542,11 @@ const char* const description_event_engine_fork =
     "Enables event engine fork handling, including onfork events and file "
     "descriptor generations";
 const char* const additional_constraints_event_engine_fork = "{}";
+const char* const description_event_engine_io_uring_provided_buffers =
+    "Let the io_uring poller receive into a buffer ring shared by all of its "
+    "sockets instead of into memory reserved per connection.";
+const char* const
+    additional_constraints_event_engine_io_uring_provided_buffers = "{}";
 const char* const description_event_engine_listener =
     "Use EventEngine listeners instead of iomgr's grpc_tcp_server";
 const char* const additional_constraints_event_engine_listener = "{}";
@@ -480,6 +570,14 @@ const uint8_t required_experiments_event_engine_for_all_other_endpoints[] = {
 const char* const description_event_engine_poller_for_python =
     "Enable event engine poller in gRPC Python";
 const char* const additional_constraints_event_engine_poller_for_python = "{}";
+const char* const description_event_engine_timer_wheel =
+    "Use a hierarchical timing wheel instead of sharded heaps for EventEngine "
+    "timers.";
+const char* const additional_constraints_event_engine_timer_wheel = "{}";
+const char* const description_event_engine_write_batching =
+    "Coalesce POSIX EventEngine endpoint writes that become ready in the same "
+    "poller iteration, and submit them together.";
+const char* const additional_constraints_event_engine_write_batching = "{}";
 const char* const description_fail_recv_metadata_on_deadline_exceeded =
     "Fail recv initial metadata when the deadline is exceeded.";
 const char* const
@@ -490,6 +588,10 @@ const char* const additional_constraints_free_large_allocator = "{}";
 const char* const description_fuse_filters =
     "If set, individual filters are merged into fused filters";
 const char* const additional_constraints_fuse_filters = "{}";
+const char* const description_hpack_adaptive_indexing =
+    "Only add headers to the HPACK dynamic table when they were sent on the "
+    "connection before, or when adding them evicts nothing.";
+const char* const additional_constraints_hpack_adaptive_indexing = "{}";
 const char* const description_keep_alive_ping_timer_batch =
     "Avoid explicitly cancelling the keepalive timer. Instead adjust the "
     "callback to re-schedule itself to the next ping interval.";
@@ -638,6 +740,8 @@ namespace grpc_core {
 const ExperimentMetadata g_experiment_metadata[] = {
     {"buffer_list_deletion_prep", description_buffer_list_deletion_prep,
      additional_constraints_buffer_list_deletion_prep, nullptr, 0, false, true},
+    {"call_arena_recycling", description_call_arena_recycling,
+     additional_constraints_call_arena_recycling, nullptr, 0, false, true},
     {"call_tracer_in_transport", description_call_tracer_in_transport,
      additional_constraints_call_tracer_in_transport, nullptr, 0, true, false},
     {"call_tracer_send_initial_metadata_is_an_annotation",
@@ -654,6 +758,15 @@ const ExperimentMetadata g_experiment_metadata[] = {
     {"chaotic_good_framing_layer", description_chaotic_good_framing_layer,
      additional_constraints_chaotic_good_framing_layer, nullptr, 0, true,
      false},
+    {"chttp2_adaptive_stream_window", description_chttp2_adaptive_stream_window,
+     additional_constraints_chttp2_adaptive_stream_window, nullptr, 0, false,
+     true},
+    {"chttp2_model_write_sizing", description_chttp2_model_write_sizing,
+     additional_constraints_chttp2_model_write_sizing, nullptr, 0, false, true},
+    {"chttp2_pipelined_reads", description_chttp2_pipelined_reads,
+     additional_constraints_chttp2_pipelined_reads, nullptr, 0, false, true},
+    {"chttp2_write_combining", description_chttp2_write_combining,
+     additional_constraints_chttp2_write_combining, nullptr, 0, false, true},
     {"error_flatten", description_error_flatten,
      additional_constraints_error_flatten, nullptr, 0, false, false},
     {"event_engine_client", description_event_engine_client,
@@ -666,6 +779,10 @@ const ExperimentMetadata g_experiment_metadata[] = {
      true, false},
     {"event_engine_fork", description_event_engine_fork,
      additional_constraints_event_engine_fork, nullptr, 0, false, false},
+    {"event_engine_io_uring_provided_buffers",
+     description_event_engine_io_uring_provided_buffers,
+     additional_constraints_event_engine_io_uring_provided_buffers, nullptr, 0,
+     false, true},
     {"event_engine_listener", description_event_engine_listener,
      additional_constraints_event_engine_listener, nullptr, 0, true, false},
     {"event_engine_callback_cq", description_event_engine_callback_cq,
@@ -679,6 +796,11 @@ const ExperimentMetadata g_experiment_metadata[] = {
      description_event_engine_poller_for_python,
      additional_constraints_event_engine_poller_for_python, nullptr, 0, false,
      true},
+    {"event_engine_timer_wheel", description_event_engine_timer_wheel,
+     additional_constraints_event_engine_timer_wheel, nullptr, 0, false, true},
+    {"event_engine_write_batching", description_event_engine_write_batching,
+     additional_constraints_event_engine_write_batching, nullptr, 0, false,
+     true},
     {"fail_recv_metadata_on_deadline_exceeded",
      description_fail_recv_metadata_on_deadline_exceeded,
      additional_constraints_fail_recv_metadata_on_deadline_exceeded, nullptr, 0,
@@ -687,6 +809,8 @@ const ExperimentMetadata g_experiment_metadata[] = {
      additional_constraints_free_large_allocator, nullptr, 0, false, true},
     {"fuse_filters", description_fuse_filters,
      additional_constraints_fuse_filters, nullptr, 0, false, false},
+    {"hpack_adaptive_indexing", description_hpack_adaptive_indexing,
+     additional_constraints_hpack_adaptive_indexing, nullptr, 0, false, true},
     {"keep_alive_ping_timer_batch", description_keep_alive_ping_timer_batch,
      additional_constraints_keep_alive_ping_timer_batch, nullptr, 0, false,
      true},
@@ -810,6 +934,10 @@ namespace {
 const char* const description_buffer_list_deletion_prep =
     "Gate the removal of old TCP timestamp collection mechanism.";
 const char* const additional_constraints_buffer_list_deletion_prep = "{}";
+const char* const description_call_arena_recycling =
+    "Recycle the storage of destroyed call arenas for new calls on the same "
+    "channel, instead of freeing and reallocating it per call.";
+const char* const additional_constraints_call_arena_recycling = "{}";
 const char* const description_call_tracer_in_transport =
     "Transport directly passes byte counts to CallTracer.";
 const char* const additional_constraints_call_tracer_in_transport = "{}";
@@ -831,6 +959,25 @@ const char* const additional_constraints_chaotic_good_connect_deadline = "{}";
 const char* const description_chaotic_good_framing_layer =
     "Enable the chaotic good framing layer.";
 const char* const additional_constraints_chaotic_good_framing_layer = "{}";
+const char* const description_chttp2_adaptive_stream_window =
+    "Size the flow control window of each chttp2 stream from the rate at which "
+    "the application reads it, instead of from the bandwidth-delay product of "
+    "the transport.";
+const char* const additional_constraints_chttp2_adaptive_stream_window = "{}";
+const char* const description_chttp2_model_write_sizing =
+    "Size chttp2 writes from the measured bandwidth and round trip time of the "
+    "link and the bytes queued in the kernel, instead of by timing writes.";
+const char* const additional_constraints_chttp2_model_write_sizing = "{}";
+const char* const description_chttp2_pipelined_reads =
+    "Read the next bytes of a chttp2 connection from the endpoint while the "
+    "last ones are parsed, so that endpoint work such as decryption runs in "
+    "parallel with parsing.";
+const char* const additional_constraints_chttp2_pipelined_reads = "{}";
+const char* const description_chttp2_write_combining =
+    "Hold back chttp2 writes of call frames for a short window while many "
+    "calls are active, so that the frames of concurrent calls share endpoint "
+    "writes.";
+const char* const additional_constraints_chttp2_write_combining = "{}";
 const char* const description_error_flatten =
     "Flatten errors to ordinary absl::Status form.";
 const char* const additional_constraints_error_flatten = "{}";
@@ -849,6 +996,11 @@ const char* const description_event_engine_fork =
     "Enables event engine fork handling, including onfork events and file "
     "descriptor generations";
 const char* const additional_constraints_event_engine_fork = "{}";
+const char* const description_event_engine_io_uring_provided_buffers =
+    "Let the io_uring poller receive into a buffer ring shared by all of its "
+    "sockets instead of into memory reserved per connection.";
+const char* const
+    additional_constraints_event_engine_io_uring_provided_buffers = "{}";
 const char* const description_event_engine_listener =
     "Use EventEngine listeners instead of iomgr's grpc_tcp_server";
 const char* const additional_constraints_event_engine_listener = "{}";
@@ -872,6 +1024,14 @@ const uint8_t required_experiments_event_engine_for_all_other_endpoints[] = {
 const char* const description_event_engine_poller_for_python =
     "Enable event engine poller in gRPC Python";
 const char* const additional_constraints_event_engine_poller_for_python = "{}";
+const char* const description_event_engine_timer_wheel =
+    "Use a hierarchical timing wheel instead of sharded heaps for EventEngine "
+    "timers.";
+const char* const additional_constraints_event_engine_timer_wheel = "{}";
+const char* const description_event_engine_write_batching =
+    "Coalesce POSIX EventEngine endpoint writes that become ready in the same "
+    "poller iteration, and submit them together.";
+const char* const additional_constraints_event_engine_write_batching = "{}";
 const char* const description_fail_recv_metadata_on_deadline_exceeded =
     "Fail recv initial metadata when the deadline is exceeded.";
 const char* const
@@ -882,6 +1042,10 @@ const char* const additional_constraints_free_large_allocator = "{}";
 const char* const description_fuse_filters =
     "If set, individual filters are merged into fused filters";
 const char* const additional_constraints_fuse_filters = "{}";
+const char* const description_hpack_adaptive_indexing =
+    "Only add headers to the HPACK dynamic table when they were sent on the "
+    "connection before, or when adding them evicts nothing.";
+const char* const additional_constraints_hpack_adaptive_indexing = "{}";
 const char* const description_keep_alive_ping_timer_batch =
     "Avoid explicitly cancelling the keepalive timer. Instead adjust the "
     "callback to re-schedule itself to the next ping interval.";
@@ -1030,6 +1194,8 @@ namespace grpc_core {
 const ExperimentMetadata g_experiment_metadata[] = {
     {"buffer_list_deletion_prep", description_buffer_list_deletion_prep,
      additional_constraints_buffer_list_deletion_prep, nullptr, 0, false, true},
+    {"call_arena_recycling", description_call_arena_recycling,
+     additional_constraints_call_arena_recycling, nullptr, 0, false, true},
     {"call_tracer_in_transport", description_call_tracer_in_transport,
      additional_constraints_call_tracer_in_transport, nullptr, 0, true, false},
     {"call_tracer_send_initial_metadata_is_an_annotation",
@@ -1046,6 +1212,15 @@ const ExperimentMetadata g_experiment_metadata[] = {
     {"chaotic_good_framing_layer", description_chaotic_good_framing_layer,
      additional_constraints_chaotic_good_framing_layer, nullptr, 0, true,
      false},
+    {"chttp2_adaptive_stream_window", description_chttp2_adaptive_stream_window,
+     additional_constraints_chttp2_adaptive_stream_window, nullptr, 0, false,
+     true},
+    {"chttp2_model_write_sizing", description_chttp2_model_write_sizing,
+     additional_constraints_chttp2_model_write_sizing, nullptr, 0, false, true},
+    {"chttp2_pipelined_reads", description_chttp2_pipelined_reads,
+     additional_constraints_chttp2_pipelined_reads, nullptr, 0, false, true},
+    {"chttp2_write_combining", description_chttp2_write_combining,
+     additional_constraints_chttp2_write_combining, nullptr, 0, false, true},
     {"error_flatten", description_error_flatten,
      additional_constraints_error_flatten, nullptr, 0, false, false},
     {"event_engine_client", description_event_engine_client,
@@ -1058,6 +1233,10 @@ const ExperimentMetadata g_experiment_metadata[] = {
      true, false},
     {"event_engine_fork", description_event_engine_fork,
      additional_constraints_event_engine_fork, nullptr, 0, false, false},
+    {"event_engine_io_uring_provided_buffers",
+     description_event_engine_io_uring_provided_buffers,
+     additional_constraints_event_engine_io_uring_provided_buffers, nullptr, 0,
+     false, true},
     {"event_engine_listener", description_event_engine_listener,
      additional_constraints_event_engine_listener, nullptr, 0, true, false},
     {"event_engine_callback_cq", description_event_engine_callback_cq,
@@ -1071,6 +1250,11 @@ const ExperimentMetadata g_experiment_metadata[] = {
      description_event_engine_poller_for_python,
      additional_constraints_event_engine_poller_for_python, nullptr, 0, false,
      true},
+    {"event_engine_timer_wheel", description_event_engine_timer_wheel,
+     additional_constraints_event_engine_timer_wheel, nullptr, 0, false, true},
+    {"event_engine_write_batching", description_event_engine_write_batching,
+     additional_constraints_event_engine_write_batching, nullptr, 0, false,
+     true},
     {"fail_recv_metadata_on_deadline_exceeded",
      description_fail_recv_metadata_on_deadline_exceeded,
      additional_constraints_fail_recv_metadata_on_deadline_exceeded, nullptr, 0,
@@ -1079,6 +1263,8 @@ const ExperimentMetadata g_experiment_metadata[] = {
      additional_constraints_free_large_allocator, nullptr, 0, false, true},
     {"fuse_filters", description_fuse_filters,
      additional_constraints_fuse_filters, nullptr, 0, false, false},
+    {"hpack_adaptive_indexing", description_hpack_adaptive_indexing,
+     additional_constraints_hpack_adaptive_indexing, nullptr, 0, false, true},
     {"keep_alive_ping_timer_batch", description_keep_alive_ping_timer_batch,
      additional_constraints_keep_alive_ping_timer_batch, nullptr, 0, false,
      true},
@@ -58,6 +58,7 @@ namespace grpc_core {
 
 #if defined(GRPC_CFSTREAM)
 inline bool IsBufferListDeletionPrepEnabled() { return false; }
+inline bool IsCallArenaRecyclingEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_CALL_TRACER_IN_TRANSPORT
 inline bool IsCallTracerInTransportEnabled() { return true; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_CALL_TRACER_SEND_INITIAL_METADATA_IS_AN_ANNOTATION
@@ -71,6 +72,10 @@ inline bool IsCallTracerSendTrailingMetadataIsAnAnnotationEnabled() {
 inline bool IsChaoticGoodConnectDeadlineEnabled() { return true; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_CHAOTIC_GOOD_FRAMING_LAYER
 inline bool IsChaoticGoodFramingLayerEnabled() { return true; }
+inline bool IsChttp2AdaptiveStreamWindowEnabled() { return false; }
+inline bool IsChttp2ModelWriteSizingEnabled() { return false; }
+inline bool IsChttp2PipelinedReadsEnabled() { return false; }
+inline bool IsChttp2WriteCombiningEnabled() { return false; }
 inline bool IsErrorFlattenEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_CLIENT
 inline bool IsEventEngineClientEnabled() { return true; }
@@ -79,6 +84,7 @@ inline bool IsEventEngineDnsEnabled() { return true; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_DNS_NON_CLIENT_CHANNEL
 inline bool IsEventEngineDnsNonClientChannelEnabled() { return true; }
 inline bool IsEventEngineForkEnabled() { return false; }
+inline bool IsEventEngineIoUringProvidedBuffersEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_LISTENER
 inline bool IsEventEngineListenerEnabled() { return true; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_CALLBACK_CQ
@@ -86,9 +92,12 @@ inline bool IsEventEngineCallbackCqEnabled() { return true; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_FOR_ALL_OTHER_ENDPOINTS
 inline bool IsEventEngineForAllOtherEndpointsEnabled() { return true; }
 inline bool IsEventEnginePollerForPythonEnabled() { return false; }
+inline bool IsEventEngineTimerWheelEnabled() { return false; }
+inline bool IsEventEngineWriteBatchingEnabled() { return false; }
 inline bool IsFailRecvMetadataOnDeadlineExceededEnabled() { return false; }
 inline bool IsFreeLargeAllocatorEnabled() { return false; }
 inline bool IsFuseFiltersEnabled() { return false; }
+inline bool IsHpackAdaptiveIndexingEnabled() { return false; }
 inline bool IsKeepAlivePingTimerBatchEnabled() { return false; }
 inline bool IsLocalConnectorSecureEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_MAX_INFLIGHT_PINGS_STRICT_LIMIT
@@ -133,6 +142,7 @@ inline bool IsXdsChannelFilterChainPerRouteEnabled() { return true; }
 
 #elif defined(GPR_WINDOWS)
 inline bool IsBufferListDeletionPrepEnabled() { return false; }
+inline bool IsCallArenaRecyclingEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_CALL_TRACER_IN_TRANSPORT
 inline bool IsCallTracerInTransportEnabled() { return true; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_CALL_TRACER_SEND_INITIAL_METADATA_IS_AN_ANNOTATION
@@ -146,6 +156,10 @@ inline bool IsCallTracerSendTrailingMetadataIsAnAnnotationEnabled() {
 inline bool IsChaoticGoodConnectDeadlineEnabled() { return true; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_CHAOTIC_GOOD_FRAMING_LAYER
 inline bool IsChaoticGoodFramingLayerEnabled() { return true; }
+inline bool IsChttp2AdaptiveStreamWindowEnabled() { return false; }
+inline bool IsChttp2ModelWriteSizingEnabled() { return false; }
+inline bool IsChttp2PipelinedReadsEnabled() { return false; }
+inline bool IsChttp2WriteCombiningEnabled() { return false; }
 inline bool IsErrorFlattenEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_CLIENT
 inline bool IsEventEngineClientEnabled() { return true; }
@@ -154,6 +168,7 @@ inline bool IsEventEngineDnsEnabled() { return true; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_DNS_NON_CLIENT_CHANNEL
 inline bool IsEventEngineDnsNonClientChannelEnabled() { return true; }
 inline bool IsEventEngineForkEnabled() { return false; }
+inline bool IsEventEngineIoUringProvidedBuffersEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_LISTENER
 inline bool IsEventEngineListenerEnabled() { return true; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_CALLBACK_CQ
@@ -161,9 +176,12 @@ inline bool IsEventEngineCallbackCqEnabled() { return true; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_FOR_ALL_OTHER_ENDPOINTS
 inline bool IsEventEngineForAllOtherEndpointsEnabled() { return true; }
 inline bool IsEventEnginePollerForPythonEnabled() { return false; }
+inline bool IsEventEngineTimerWheelEnabled() { return false; }
+inline bool IsEventEngineWriteBatchingEnabled() { return false; }
 inline bool IsFailRecvMetadataOnDeadlineExceededEnabled() { return false; }
 inline bool IsFreeLargeAllocatorEnabled() { return false; }
 inline bool IsFuseFiltersEnabled() { return false; }
+inline bool IsHpackAdaptiveIndexingEnabled() { return false; }
 inline bool IsKeepAlivePingTimerBatchEnabled() { return false; }
 inline bool IsLocalConnectorSecureEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_MAX_INFLIGHT_PINGS_STRICT_LIMIT
@@ -208,6 +226,7 @@ inline bool IsXdsChannelFilterChainPerRouteEnabled() { return true; }
 
 #else
 inline bool IsBufferListDeletionPrepEnabled() { return false; }
+inline bool IsCallArenaRecyclingEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_CALL_TRACER_IN_TRANSPORT
 inline bool IsCallTracerInTransportEnabled() { return true; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_CALL_TRACER_SEND_INITIAL_METADATA_IS_AN_ANNOTATION
@@ -221,6 +240,10 @@ inline bool IsCallTracerSendTrailingMetadataIsAnAnnotationEnabled() {
 inline bool IsChaoticGoodConnectDeadlineEnabled() { return true; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_CHAOTIC_GOOD_FRAMING_LAYER
 inline bool IsChaoticGoodFramingLayerEnabled() { return true; }
+inline bool IsChttp2AdaptiveStreamWindowEnabled() { return false; }
+inline bool IsChttp2ModelWriteSizingEnabled() { return false; }
+inline bool IsChttp2PipelinedReadsEnabled() { return false; }
+inline bool IsChttp2WriteCombiningEnabled() { return false; }
 inline bool IsErrorFlattenEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_CLIENT
 inline bool IsEventEngineClientEnabled() { return true; }
@@ -229,6 +252,7 @@ inline bool IsEventEngineDnsEnabled() { return true; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_DNS_NON_CLIENT_CHANNEL
 inline bool IsEventEngineDnsNonClientChannelEnabled() { return true; }
 inline bool IsEventEngineForkEnabled() { return false; }
+inline bool IsEventEngineIoUringProvidedBuffersEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_LISTENER
 inline bool IsEventEngineListenerEnabled() { return true; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_CALLBACK_CQ
@@ -236,9 +260,12 @@ inline bool IsEventEngineCallbackCqEnabled() { return true; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_FOR_ALL_OTHER_ENDPOINTS
 inline bool IsEventEngineForAllOtherEndpointsEnabled() { return true; }
 inline bool IsEventEnginePollerForPythonEnabled() { return false; }
+inline bool IsEventEngineTimerWheelEnabled() { return false; }
+inline bool IsEventEngineWriteBatchingEnabled() { return false; }
 inline bool IsFailRecvMetadataOnDeadlineExceededEnabled() { return false; }
 inline bool IsFreeLargeAllocatorEnabled() { return false; }
 inline bool IsFuseFiltersEnabled() { return false; }
+inline bool IsHpackAdaptiveIndexingEnabled() { return false; }
 inline bool IsKeepAlivePingTimerBatchEnabled() { return false; }
 inline bool IsLocalConnectorSecureEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_MAX_INFLIGHT_PINGS_STRICT_LIMIT
@@ -285,23 +312,32 @@ inline bool IsXdsChannelFilterChainPerRouteEnabled() { return true; }
 #else
 enum ExperimentIds {
   kExperimentIdBufferListDeletionPrep,
+  kExperimentIdCallArenaRecycling,
   kExperimentIdCallTracerInTransport,
   kExperimentIdCallTracerSendInitialMetadataIsAnAnnotation,
   kExperimentIdCallTracerSendTrailingMetadataIsAnAnnotation,
   kExperimentIdChaoticGoodConnectDeadline,
   kExperimentIdChaoticGoodFramingLayer,
+  kExperimentIdChttp2AdaptiveStreamWindow,
+  kExperimentIdChttp2ModelWriteSizing,
+  kExperimentIdChttp2PipelinedReads,
+  kExperimentIdChttp2WriteCombining,
   kExperimentIdErrorFlatten,
   kExperimentIdEventEngineClient,
   kExperimentIdEventEngineDns,
   kExperimentIdEventEngineDnsNonClientChannel,
   kExperimentIdEventEngineFork,
+  kExperimentIdEventEngineIoUringProvidedBuffers,
   kExperimentIdEventEngineListener,
   kExperimentIdEventEngineCallbackCq,
   kExperimentIdEventEngineForAllOtherEndpoints,
   kExperimentIdEventEnginePollerForPython,
+  kExperimentIdEventEngineTimerWheel,
+  kExperimentIdEventEngineWriteBatching,
   kExperimentIdFailRecvMetadataOnDeadlineExceeded,
   kExperimentIdFreeLargeAllocator,
   kExperimentIdFuseFilters,
+  kExperimentIdHpackAdaptiveIndexing,
   kExperimentIdKeepAlivePingTimerBatch,
   kExperimentIdLocalConnectorSecure,
   kExperimentIdMaxInflightPingsStrictLimit,
@@ -342,6 +378,10 @@ enum ExperimentIds {
 inline bool IsBufferListDeletionPrepEnabled() {
   return IsExperimentEnabled<kExperimentIdBufferListDeletionPrep>();
 }
+#define GRPC_EXPERIMENT_IS_INCLUDED_CALL_ARENA_RECYCLING
+inline bool IsCallArenaRecyclingEnabled() {
+  return IsExperimentEnabled<kExperimentIdCallArenaRecycling>();
+}
 #define GRPC_EXPERIMENT_IS_INCLUDED_CALL_TRACER_IN_TRANSPORT
 inline bool IsCallTracerInTransportEnabled() {
   return IsExperimentEnabled<kExperimentIdCallTracerInTransport>();
@@ -364,6 +404,22 @@ inline bool IsChaoticGoodConnectDeadlineEnabled() {
 inline bool IsChaoticGoodFramingLayerEnabled() {
   return IsExperimentEnabled<kExperimentIdChaoticGoodFramingLayer>();
 }
+#define GRPC_EXPERIMENT_IS_INCLUDED_CHTTP2_ADAPTIVE_STREAM_WINDOW
+inline bool IsChttp2AdaptiveStreamWindowEnabled() {
+  return IsExperimentEnabled<kExperimentIdChttp2AdaptiveStreamWindow>();
+}
+#define GRPC_EXPERIMENT_IS_INCLUDED_CHTTP2_MODEL_WRITE_SIZING
+inline bool IsChttp2ModelWriteSizingEnabled() {
+  return IsExperimentEnabled<kExperimentIdChttp2ModelWriteSizing>();
+}
+#define GRPC_EXPERIMENT_IS_INCLUDED_CHTTP2_PIPELINED_READS
+inline bool IsChttp2PipelinedReadsEnabled() {
+  return IsExperimentEnabled<kExperimentIdChttp2PipelinedReads>();
+}
+#define GRPC_EXPERIMENT_IS_INCLUDED_CHTTP2_WRITE_COMBINING
+inline bool IsChttp2WriteCombiningEnabled() {
+  return IsExperimentEnabled<kExperimentIdChttp2WriteCombining>();
+}
 #define GRPC_EXPERIMENT_IS_INCLUDED_ERROR_FLATTEN
 inline bool IsErrorFlattenEnabled() {
   return IsExperimentEnabled<kExperimentIdErrorFlatten>();
@@ -384,6 +440,10 @@ inline bool IsEventEngineDnsNonClientChannelEnabled() {
 inline bool IsEventEngineForkEnabled() {
   return IsExperimentEnabled<kExperimentIdEventEngineFork>();
 }
+#define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_IO_URING_PROVIDED_BUFFERS
+inline bool IsEventEngineIoUringProvidedBuffersEnabled() {
+  return IsExperimentEnabled<kExperimentIdEventEngineIoUringProvidedBuffers>();
+}
 #define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_LISTENER
 inline bool IsEventEngineListenerEnabled() {
   return IsExperimentEnabled<kExperimentIdEventEngineListener>();
@@ -400,6 +460,14 @@ inline bool IsEventEngineForAllOtherEndpointsEnabled() {
 inline bool IsEventEnginePollerForPythonEnabled() {
   return IsExperimentEnabled<kExperimentIdEventEnginePollerForPython>();
 }
+#define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_TIMER_WHEEL
+inline bool IsEventEngineTimerWheelEnabled() {
+  return IsExperimentEnabled<kExperimentIdEventEngineTimerWheel>();
+}
+#define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_WRITE_BATCHING
+inline bool IsEventEngineWriteBatchingEnabled() {
+  return IsExperimentEnabled<kExperimentIdEventEngineWriteBatching>();
+}
 #define GRPC_EXPERIMENT_IS_INCLUDED_FAIL_RECV_METADATA_ON_DEADLINE_EXCEEDED
 inline bool IsFailRecvMetadataOnDeadlineExceededEnabled() {
   return IsExperimentEnabled<kExperimentIdFailRecvMetadataOnDeadlineExceeded>();
@@ -412,6 +480,10 @@ inline bool IsFreeLargeAllocatorEnabled() {
 inline bool IsFuseFiltersEnabled() {
   return IsExperimentEnabled<kExperimentIdFuseFilters>();
 }
+#define GRPC_EXPERIMENT_IS_INCLUDED_HPACK_ADAPTIVE_INDEXING
+inline bool IsHpackAdaptiveIndexingEnabled() {
+  return IsExperimentEnabled<kExperimentIdHpackAdaptiveIndexing>();
+}
 #define GRPC_EXPERIMENT_IS_INCLUDED_KEEP_ALIVE_PING_TIMER_BATCH
 inline bool IsKeepAlivePingTimerBatchEnabled() {
   return IsExperimentEnabled<kExperimentIdKeepAlivePingTimerBatch>();
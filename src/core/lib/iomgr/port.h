@@ -63,6 +63,24 @@
 #if LINUX_VERSION_CODE >= KERNEL_VERSION(4, 0, 0)
 #define GRPC_LINUX_ERRQUEUE 1
 #endif  // LINUX_VERSION_CODE >= KERNEL_VERSION(4, 0, 0)
+// SO_ATTACH_REUSEPORT_CBPF first appeared in the 4.5 headers.
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(4, 5, 0)
+#define GRPC_LINUX_REUSEPORT_CBPF 1
+#endif  // LINUX_VERSION_CODE >= KERNEL_VERSION(4, 5, 0)
+// struct tcp_zerocopy_receive gained recv_skip_hint in 4.19.
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(4, 19, 0)
+#define GRPC_LINUX_TCP_ZEROCOPY_RECEIVE 1
+#endif  // LINUX_VERSION_CODE >= KERNEL_VERSION(4, 19, 0)
+// Multishot poll requests and IORING_FEAT_RSRC_TAGS first appeared in the
+// 5.13 headers. Whether the running kernel supports io_uring is checked at
+// runtime.
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 13, 0)
+#define GRPC_LINUX_IO_URING 1
+#endif  // LINUX_VERSION_CODE >= KERNEL_VERSION(5, 13, 0)
+// Multishot recv into provided buffer rings needs the 6.0 headers.
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(6, 0, 0)
+#define GRPC_LINUX_IO_URING_BUF_RING 1
+#endif  // LINUX_VERSION_CODE >= KERNEL_VERSION(6, 0, 0)
 #endif  // LINUX_VERSION_CODE
 #if defined(LINUX_VERSION_CODE) && defined(__GLIBC_PREREQ)
 #if LINUX_VERSION_CODE >= KERNEL_VERSION(3, 9, 0) && __GLIBC_PREREQ(2, 18)
@@ -17,16 +17,21 @@
 #include <grpc/support/port_platform.h>
 
 #include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <limits>
+#include <utility>
 
 #include "src/core/channelz/property_list.h"
 #include "src/core/lib/event_engine/event_engine_context.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/promise/activity.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
 #include "src/core/util/grpc_check.h"
 #include "src/core/util/json/json_writer.h"
 #include "src/core/util/latent_see.h"
+#include "src/core/util/no_destruct.h"
 #include "src/core/util/sync.h"
 #include "absl/base/thread_annotations.h"
 #include "absl/log/log.h"
@@ -134,6 +139,203 @@ class Party::Handle final : public Wakeable {
   Party* party_ ABSL_GUARDED_BY(mu_);
 };
 
+///////////////////////////////////////////////////////////////////////////////
+// Participant allocation
+
+namespace party_detail {
+
+#ifndef GRPC_ASAN_ENABLED
+
+namespace {
+
+// Participants of up to kMaxBlockSize bytes are allocated as blocks of one of
+// kNumSizeClasses power of two sizes, starting at kMinBlockSize.
+constexpr size_t kMinBlockSize = 64;
+constexpr size_t kNumSizeClasses = 5;
+constexpr size_t kMaxBlockSize = kMinBlockSize << (kNumSizeClasses - 1);
+// A thread keeps up to twice this many free blocks of each size class, and
+// shares them with other threads in batches of this many.
+constexpr size_t kBatchSize = 32;
+// The shared pool keeps up to this many batches of each size class; blocks
+// freed beyond that are returned to the heap.
+constexpr size_t kMaxSharedBatches = 16;
+
+size_t SizeClass(size_t size) {
+  size_t size_class = 0;
+  while ((kMinBlockSize << size_class) < size) ++size_class;
+  return size_class;
+}
+
+size_t BlockSize(size_t size_class) { return kMinBlockSize << size_class; }
+
+struct FreeBlock {
+  FreeBlock* next;
+  // Only used by the first block of a batch in the shared pool.
+  FreeBlock* next_batch;
+  size_t batch_size;
+};
+static_assert(sizeof(FreeBlock) <= kMinBlockSize);
+
+void DeleteBlocks(FreeBlock* blocks) {
+  while (blocks != nullptr) {
+    ::operator delete(std::exchange(blocks, blocks->next));
+  }
+}
+
+// Free blocks that no thread holds.
+class SharedPool {
+ public:
+  // Returns a list of free blocks and its length, or nullptr if there are
+  // none.
+  FreeBlock* TakeBatch(size_t size_class, size_t* batch_size) {
+    MutexLock lock(&mu_);
+    FreeBlock* batch = batches_[size_class];
+    if (batch != nullptr) {
+      batches_[size_class] = batch->next_batch;
+      *batch_size = batch->batch_size;
+      --num_batches_[size_class];
+    }
+    return batch;
+  }
+
+  void PutBatch(size_t size_class, FreeBlock* batch, size_t batch_size) {
+    batch->batch_size = batch_size;
+    {
+      MutexLock lock(&mu_);
+      if (num_batches_[size_class] < kMaxSharedBatches) {
+        batch->next_batch = batches_[size_class];
+        batches_[size_class] = batch;
+        ++num_batches_[size_class];
+        return;
+      }
+    }
+    DeleteBlocks(batch);
+  }
+
+  size_t NumBlocks() {
+    MutexLock lock(&mu_);
+    size_t blocks = 0;
+    for (FreeBlock* batch : batches_) {
+      for (; batch != nullptr; batch = batch->next_batch) {
+        blocks += batch->batch_size;
+      }
+    }
+    return blocks;
+  }
+
+ private:
+  Mutex mu_;
+  FreeBlock* batches_[kNumSizeClasses] ABSL_GUARDED_BY(mu_) = {};
+  size_t num_batches_[kNumSizeClasses] ABSL_GUARDED_BY(mu_) = {};
+};
+
+SharedPool* shared_pool() {
+  static NoDestruct<SharedPool> pool;
+  return pool.get();
+}
+
+// The blocks a thread allocates from and frees to without synchronization.
+class ThreadCache {
+ public:
+  ThreadCache() = default;
+  ThreadCache(const ThreadCache&) = delete;
+  ThreadCache& operator=(const ThreadCache&) = delete;
+
+  ~ThreadCache() {
+    destroyed_ = true;
+    for (size_t size_class = 0; size_class < kNumSizeClasses; ++size_class) {
+      FreeList& list = lists_[size_class];
+      if (list.free_count > 0) {
+        shared_pool()->PutBatch(size_class, list.free, list.free_count);
+      }
+    }
+  }
+
+  // Blocks are not recycled once the thread's cache is destroyed.
+  static bool destroyed() { return destroyed_; }
+
+  void* Allocate(size_t size_class) {
+    FreeList& list = lists_[size_class];
+    if (list.free == nullptr) {
+      list.free = shared_pool()->TakeBatch(size_class, &list.free_count);
+    }
+    if (list.free == nullptr) return ::operator new(BlockSize(size_class));
+    global_stats().IncrementPartyParticipantsRecycled();
+    FreeBlock* block = list.free;
+    list.free = block->next;
+    --list.free_count;
+    return block;
+  }
+
+  void Free(size_t size_class, void* p) {
+    FreeList& list = lists_[size_class];
+    auto* block = static_cast<FreeBlock*>(p);
+    block->next = list.free;
+    list.free = block;
+    if (++list.free_count < 2 * kBatchSize) return;
+    // Hand the most recently freed blocks to other threads, keeping the rest.
+    FreeBlock* last = block;
+    for (size_t i = 1; i < kBatchSize; ++i) last = last->next;
+    list.free = last->next;
+    list.free_count -= kBatchSize;
+    last->next = nullptr;
+    shared_pool()->PutBatch(size_class, block, kBatchSize);
+  }
+
+ private:
+  struct FreeList {
+    FreeBlock* free = nullptr;
+    size_t free_count = 0;
+  };
+
+  static thread_local bool destroyed_;
+  FreeList lists_[kNumSizeClasses];
+};
+
+thread_local bool ThreadCache::destroyed_ = false;
+
+ThreadCache& thread_cache() {
+  static thread_local ThreadCache cache;
+  return cache;
+}
+
+}  // namespace
+
+void* AllocateParticipant(size_t size) {
+  global_stats().IncrementPartyParticipantsAllocated();
+  if (size > kMaxBlockSize) return ::operator new(size);
+  const size_t size_class = SizeClass(size);
+  if (ThreadCache::destroyed()) return ::operator new(BlockSize(size_class));
+  return thread_cache().Allocate(size_class);
+}
+
+void FreeParticipant(void* p, size_t size) {
+  if (size > kMaxBlockSize || ThreadCache::destroyed()) {
+    ::operator delete(p);
+    return;
+  }
+  thread_cache().Free(SizeClass(size), p);
+}
+
+size_t SharedParticipantBlocks() { return shared_pool()->NumBlocks(); }
+
+#else  // GRPC_ASAN_ENABLED
+
+// Recycled blocks would hide use after free of participants from ASAN.
+
+void* AllocateParticipant(size_t size) {
+  global_stats().IncrementPartyParticipantsAllocated();
+  return ::operator new(size);
+}
+
+void FreeParticipant(void* p, size_t) { ::operator delete(p); }
+
+size_t SharedParticipantBlocks() { return 0; }
+
+#endif  // GRPC_ASAN_ENABLED
+
+}  // namespace party_detail
+
 ///////////////////////////////////////////////////////////////////////////////
 // Party::Participant
 
@@ -21,6 +21,7 @@
 #include <stdint.h>
 
 #include <atomic>
+#include <cstddef>
 #include <limits>
 #include <string>
 #include <utility>
@@ -154,6 +155,18 @@ namespace party_detail {
 // number to be 16 always.
 static constexpr size_t kMaxParticipants = 16;
 
+// Spawned participants are allocated with these. Parties spawn and retire
+// many small participants, so those of up to 1KiB are served from per thread
+// free lists of fixed size blocks. Threads share surplus freed blocks through
+// a pool of bounded size, and the heap gets back what does not fit. Under
+// ASAN every participant comes from the heap, so that use after free is
+// still caught.
+void* AllocateParticipant(size_t size);
+void FreeParticipant(void* p, size_t size);
+
+// Number of free blocks held by the shared pool. For tests.
+size_t SharedParticipantBlocks();
+
 }  // namespace party_detail
 
 class Party : public Activity, private Wakeable {
@@ -443,6 +456,14 @@ class Party : public Activity, private Wakeable {
       }
     }
 
+    static void* operator new(size_t size) {
+      static_assert(alignof(ParticipantImpl) <= alignof(std::max_align_t));
+      return party_detail::AllocateParticipant(size);
+    }
+    static void operator delete(void* p, size_t size) {
+      party_detail::FreeParticipant(p, size);
+    }
+
     bool PollParticipantPromise() override {
       GRPC_LATENT_SEE_SCOPE(TypeName<SuppliedFactory>());
       if (!started_) {
@@ -510,6 +531,15 @@ class Party : public Activity, private Wakeable {
       }
     }
 
+    static void* operator new(size_t size) {
+      static_assert(alignof(PromiseParticipantImpl) <=
+                    alignof(std::max_align_t));
+      return party_detail::AllocateParticipant(size);
+    }
+    static void operator delete(void* p, size_t size) {
+      party_detail::FreeParticipant(p, size);
+    }
+
     // Inside party poll: drive from factory -> promise -> result
     bool PollParticipantPromise() override {
       GRPC_LATENT_SEE_SCOPE(TypeName<SuppliedFactory>());
@@ -31,43 +31,36 @@ namespace grpc_core {
 
 namespace {
 
-void* ArenaStorage(size_t& initial_size) {
+size_t ArenaStorageSize(size_t initial_size) {
   size_t base_size = Arena::ArenaOverhead() +
                      GPR_ROUND_UP_TO_ALIGNMENT_SIZE(
                          arena_detail::BaseArenaContextTraits::ContextSize());
-  initial_size =
-      std::max(GPR_ROUND_UP_TO_ALIGNMENT_SIZE(initial_size), base_size);
+  return std::max(GPR_ROUND_UP_TO_ALIGNMENT_SIZE(initial_size), base_size);
+}
+
+}  // namespace
+
+void* ArenaFactory::AllocateArenaStorage(size_t initial_size) {
   static constexpr size_t alignment =
       (GPR_CACHELINE_SIZE > GPR_MAX_ALIGNMENT &&
        GPR_CACHELINE_SIZE % GPR_MAX_ALIGNMENT == 0)
           ? GPR_CACHELINE_SIZE
           : GPR_MAX_ALIGNMENT;
+  allocator_.Reserve(initial_size);
   return gpr_malloc_aligned(initial_size, alignment);
 }
 
-}  // namespace
-
-Arena::~Arena() {
-  for (size_t i = 0; i < arena_detail::BaseArenaContextTraits::NumContexts();
-       ++i) {
-    arena_detail::BaseArenaContextTraits::Destroy(i, contexts()[i]);
-  }
-  DestroyManagedNewObjects();
-  arena_factory_->FinalizeArena(this);
-  arena_factory_->allocator().Release(
-      total_allocated_.load(std::memory_order_relaxed));
-  Zone* z = last_zone_;
-  while (z) {
-    Zone* prev_z = z->prev;
-    Destruct(z);
-    gpr_free_aligned(z);
-    z = prev_z;
-  }
+void ArenaFactory::FreeArenaStorage(void* storage, size_t initial_size) {
+  allocator_.Release(initial_size);
+  gpr_free_aligned(storage);
 }
 
+Arena::~Arena() = default;
+
 RefCountedPtr<Arena> Arena::Create(size_t initial_size,
                                    RefCountedPtr<ArenaFactory> arena_factory) {
-  void* p = ArenaStorage(initial_size);
+  initial_size = ArenaStorageSize(initial_size);
+  void* p = arena_factory->AllocateArenaStorage(initial_size);
   return RefCountedPtr<Arena>(
       new (p) Arena(initial_size, std::move(arena_factory)));
 }
@@ -83,7 +76,6 @@ Arena::Arena(size_t initial_size, RefCountedPtr<ArenaFactory> arena_factory)
     contexts()[i] = nullptr;
   }
   CHECK_GE(initial_size, arena_detail::BaseArenaContextTraits::ContextSize());
-  arena_factory_->allocator().Reserve(initial_size);
 }
 
 void Arena::DestroyManagedNewObjects() {
@@ -100,8 +92,30 @@ void Arena::DestroyManagedNewObjects() {
 }
 
 void Arena::Destroy() const {
-  this->~Arena();
-  gpr_free_aligned(const_cast<Arena*>(this));
+  Arena* arena = const_cast<Arena*>(this);
+  for (size_t i = 0; i < arena_detail::BaseArenaContextTraits::NumContexts();
+       ++i) {
+    arena_detail::BaseArenaContextTraits::Destroy(i, arena->contexts()[i]);
+  }
+  arena->DestroyManagedNewObjects();
+  // The factory outlives the arena, to take back its storage.
+  ArenaFactory* arena_factory = arena->arena_factory_.release();
+  arena_factory->FinalizeArena(arena);
+  // Extra zones are freed here: the factory only ever sees the initial zone,
+  // so an arena that grew is trimmed back to it.
+  arena_factory->allocator().Release(
+      total_allocated_.load(std::memory_order_relaxed) - initial_zone_size_);
+  Zone* z = last_zone_;
+  while (z) {
+    Zone* prev_z = z->prev;
+    Destruct(z);
+    gpr_free_aligned(z);
+    z = prev_z;
+  }
+  const size_t initial_zone_size = initial_zone_size_;
+  arena->~Arena();
+  arena_factory->FreeArenaStorage(arena, initial_zone_size);
+  arena_factory->Unref();
 }
 
 void* Arena::AllocZone(size_t size) {
@@ -137,6 +137,12 @@ class ArenaFactory : public RefCounted<ArenaFactory> {
   virtual RefCountedPtr<Arena> MakeArena() = 0;
   virtual void FinalizeArena(Arena* arena) = 0;
 
+  // Returns storage for an arena whose initial zone is initial_size bytes,
+  // with those bytes reserved from allocator().
+  virtual void* AllocateArenaStorage(size_t initial_size);
+  // Takes back storage from AllocateArenaStorage once its arena is destroyed.
+  virtual void FreeArenaStorage(void* storage, size_t initial_size);
+
   MemoryAllocator& allocator() { return allocator_; }
 
  protected:
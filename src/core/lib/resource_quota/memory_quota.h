@@ -615,6 +615,11 @@ class MemoryQuota final
   // Resize the quota to new_size.
   void SetSize(size_t new_size) { memory_quota_->SetSize(new_size); }
 
+  // Instantaneous memory pressure in the quota.
+  BasicMemoryQuota::PressureInfo GetPressureInfo() const {
+    return memory_quota_->GetPressureInfo();
+  }
+
   // Return true if the controlled memory pressure is high enough to reject new
   // connections.
   bool RejectNewConnectionsUnderHighMemoryPressure() const {
@@ -64,6 +64,10 @@ struct grpc_slice_refcount {
   // instance, no other instance could be created during this call.
   bool IsUnique() const { return ref_.load(std::memory_order_relaxed) == 1; }
 
+  // The function that destroys this refcount, which identifies the kind of
+  // slice it belongs to.
+  DestroyerFn destroyer_fn() const { return destroyer_fn_; }
+
  private:
   std::atomic<size_t> ref_{1};
   DestroyerFn destroyer_fn_ = nullptr;
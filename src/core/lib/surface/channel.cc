@@ -27,6 +27,7 @@
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/compression/compression_internal.h"
 #include "src/core/lib/debug/trace.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/telemetry/stats.h"
 #include "src/core/telemetry/stats_data.h"
@@ -67,7 +68,10 @@ Channel::Channel(std::string target, const ChannelArgs& channel_args)
           channel_args.GetObject<ResourceQuota>()
               ->memory_quota()
               ->CreateMemoryOwner(),
-          1024)),
+          1024,
+          IsCallArenaRecyclingEnabled()
+              ? channel_args.GetObject<ResourceQuota>()->memory_quota()
+              : nullptr)),
       memory_allocator_(&call_arena_allocator_->allocator()) {}
 
 Channel::RegisteredCall* Channel::RegisterCall(const char* method,
@@ -37,6 +37,7 @@ BdpEstimator::BdpEstimator(absl::string_view name)
       stable_estimate_count_(0),
       ping_state_(PingState::UNSCHEDULED),
       bw_est_(0),
+      rtt_est_(0),
       name_(name) {}
 
 Timestamp BdpEstimator::CompletePing() {
@@ -51,6 +52,7 @@ Timestamp BdpEstimator::CompletePing() {
       << " est=" << estimate_ << " dt=" << dt << " bw=" << bw / 125000.0
       << "Mbs bw_est=" << bw_est_ / 125000.0 << "Mbs";
   GRPC_CHECK(ping_state_ == PingState::STARTED);
+  if (dt > 0 && (rtt_est_ == 0 || dt < rtt_est_)) rtt_est_ = dt;
   if (accumulator_ > 2 * estimate_ / 3 && bw > bw_est_) {
     estimate_ = std::max(accumulator_, estimate_ * 2);
     bw_est_ = bw;
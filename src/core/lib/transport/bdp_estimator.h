@@ -40,6 +40,9 @@ class BdpEstimator {
 
   int64_t EstimateBdp() const { return estimate_; }
   double EstimateBandwidth() const { return bw_est_; }
+  // The shortest round trip time of a BDP ping so far in seconds, or zero if
+  // no ping has completed yet.
+  double EstimateRtt() const { return rtt_est_; }
 
   void AddIncomingBytes(int64_t num_bytes) { accumulator_ += num_bytes; }
 
@@ -83,6 +86,7 @@ class BdpEstimator {
   int stable_estimate_count_;
   PingState ping_state_;
   double bw_est_;
+  double rtt_est_;
   absl::string_view name_;
 };
 
@@ -412,6 +412,14 @@ const absl::string_view
         "enobufs_count",
         "uncommon_io_error_count",
         "msg_errqueue_error_count",
+        "thread_pool_same_node_steals",
+        "thread_pool_cross_node_steals",
+        "io_uring_recv_buffer_copies",
+        "io_uring_recv_buffer_exhausted",
+        "tcp_read_zerocopy_fallback",
+        "party_participants_allocated",
+        "party_participants_recycled",
+        "boxed_messages",
 };
 const absl::string_view GlobalStats::counter_doc[static_cast<int>(
     Counter::COUNT)] = {
@@ -446,6 +454,21 @@ const absl::string_view GlobalStats::counter_doc[static_cast<int>(
     "Number of ENOBUFS errors",
     "Number of uncommon io errors",
     "Number of uncommon errors returned by MSG_ERRQUEUE",
+    "Number of closures a thread pool thread stole from another thread on its "
+    "own NUMA node",
+    "Number of closures a thread pool thread took from the queues of another "
+    "NUMA node",
+    "Number of reads whose data was copied out of the io_uring provided buffer "
+    "ring because too many of its buffers were lent out",
+    "Number of endpoint reads that fell back to recvmsg because the io_uring "
+    "provided buffer ring was empty",
+    "Number of TCP_ZEROCOPY_RECEIVE attempts that mapped no pages, so the data "
+    "was copied with recvmsg instead",
+    "Number of party participants allocated",
+    "Number of party participants allocated in a block freed by an earlier "
+    "participant",
+    "Number of messages passed over in-process channels as objects rather "
+    "than serialized",
 };
 const absl::string_view
     GlobalStats::histogram_name[static_cast<int>(Histogram::COUNT)] = {
@@ -475,6 +498,9 @@ const absl::string_view
         "chaotic_good_tcp_read_offer_control",
         "chaotic_good_tcp_write_size_data",
         "chaotic_good_tcp_write_size_control",
+        "thread_pool_node_queue_depth",
+        "tcp_read_zerocopy_size",
+        "tcp_writes_per_syscall",
 };
 const absl::string_view GlobalStats::histogram_doc[static_cast<int>(
     Histogram::COUNT)] = {
@@ -505,6 +531,10 @@ const absl::string_view GlobalStats::histogram_doc[static_cast<int>(
     "Number of bytes offered to each syscall_read in the control channel",
     "Number of bytes offered to each syscall_write in the data channel",
     "Number of bytes offered to each syscall_write in the control channel",
+    "Number of closures queued on a NUMA node of a thread pool, sampled "
+    "periodically",
+    "Number of bytes mapped by each TCP_ZEROCOPY_RECEIVE",
+    "Number of endpoint writes submitted by each write syscall",
 };
 GlobalStats::GlobalStats()
     : client_calls_created{0},
@@ -533,7 +563,15 @@ GlobalStats::GlobalStats()
       enotconn_count{0},
       enobufs_count{0},
       uncommon_io_error_count{0},
-      msg_errqueue_error_count{0} {}
+      msg_errqueue_error_count{0},
+      thread_pool_same_node_steals{0},
+      thread_pool_cross_node_steals{0},
+      io_uring_recv_buffer_copies{0},
+      io_uring_recv_buffer_exhausted{0},
+      tcp_read_zerocopy_fallback{0},
+      party_participants_allocated{0},
+      party_participants_recycled{0},
+      boxed_messages{0} {}
 HistogramView GlobalStats::histogram(Histogram which) const {
   switch (which) {
     default:
@@ -617,6 +655,15 @@ HistogramView GlobalStats::histogram(Histogram which) const {
     case Histogram::kChaoticGoodTcpWriteSizeControl:
       return HistogramView{&Histogram_16777216_20_64::BucketFor, kStatsTable14,
                            20, chaotic_good_tcp_write_size_control.buckets()};
+    case Histogram::kThreadPoolNodeQueueDepth:
+      return HistogramView{&Histogram_10000_20_64::BucketFor, kStatsTable4, 20,
+                           thread_pool_node_queue_depth.buckets()};
+    case Histogram::kTcpReadZerocopySize:
+      return HistogramView{&Histogram_16777216_20_64::BucketFor, kStatsTable14,
+                           20, tcp_read_zerocopy_size.buckets()};
+    case Histogram::kTcpWritesPerSyscall:
+      return HistogramView{&Histogram_100_20_64::BucketFor, kStatsTable2, 20,
+                           tcp_writes_per_syscall.buckets()};
   }
 }
 std::unique_ptr<GlobalStats> GlobalStatsCollector::Collect() const {
@@ -670,6 +717,22 @@ std::unique_ptr<GlobalStats> GlobalStatsCollector::Collect() const {
         data.uncommon_io_error_count.load(std::memory_order_relaxed);
     result->msg_errqueue_error_count +=
         data.msg_errqueue_error_count.load(std::memory_order_relaxed);
+    result->thread_pool_same_node_steals +=
+        data.thread_pool_same_node_steals.load(std::memory_order_relaxed);
+    result->thread_pool_cross_node_steals +=
+        data.thread_pool_cross_node_steals.load(std::memory_order_relaxed);
+    result->io_uring_recv_buffer_copies +=
+        data.io_uring_recv_buffer_copies.load(std::memory_order_relaxed);
+    result->io_uring_recv_buffer_exhausted +=
+        data.io_uring_recv_buffer_exhausted.load(std::memory_order_relaxed);
+    result->tcp_read_zerocopy_fallback +=
+        data.tcp_read_zerocopy_fallback.load(std::memory_order_relaxed);
+    result->party_participants_allocated +=
+        data.party_participants_allocated.load(std::memory_order_relaxed);
+    result->party_participants_recycled +=
+        data.party_participants_recycled.load(std::memory_order_relaxed);
+    result->boxed_messages +=
+        data.boxed_messages.load(std::memory_order_relaxed);
     data.call_initial_size.Collect(&result->call_initial_size);
     data.tcp_write_size.Collect(&result->tcp_write_size);
     data.tcp_write_iov_size.Collect(&result->tcp_write_iov_size);
@@ -714,6 +777,10 @@ std::unique_ptr<GlobalStats> GlobalStatsCollector::Collect() const {
         &result->chaotic_good_tcp_write_size_data);
     data.chaotic_good_tcp_write_size_control.Collect(
         &result->chaotic_good_tcp_write_size_control);
+    data.thread_pool_node_queue_depth.Collect(
+        &result->thread_pool_node_queue_depth);
+    data.tcp_read_zerocopy_size.Collect(&result->tcp_read_zerocopy_size);
+    data.tcp_writes_per_syscall.Collect(&result->tcp_writes_per_syscall);
   }
   return result;
 }
@@ -756,6 +823,21 @@ std::unique_ptr<GlobalStats> GlobalStats::Diff(const GlobalStats& other) const {
       uncommon_io_error_count - other.uncommon_io_error_count;
   result->msg_errqueue_error_count =
       msg_errqueue_error_count - other.msg_errqueue_error_count;
+  result->thread_pool_same_node_steals =
+      thread_pool_same_node_steals - other.thread_pool_same_node_steals;
+  result->thread_pool_cross_node_steals =
+      thread_pool_cross_node_steals - other.thread_pool_cross_node_steals;
+  result->io_uring_recv_buffer_copies =
+      io_uring_recv_buffer_copies - other.io_uring_recv_buffer_copies;
+  result->io_uring_recv_buffer_exhausted =
+      io_uring_recv_buffer_exhausted - other.io_uring_recv_buffer_exhausted;
+  result->tcp_read_zerocopy_fallback =
+      tcp_read_zerocopy_fallback - other.tcp_read_zerocopy_fallback;
+  result->party_participants_allocated =
+      party_participants_allocated - other.party_participants_allocated;
+  result->party_participants_recycled =
+      party_participants_recycled - other.party_participants_recycled;
+  result->boxed_messages = boxed_messages - other.boxed_messages;
   result->call_initial_size = call_initial_size - other.call_initial_size;
   result->tcp_write_size = tcp_write_size - other.tcp_write_size;
   result->tcp_write_iov_size = tcp_write_iov_size - other.tcp_write_iov_size;
@@ -815,13 +897,25 @@ std::unique_ptr<GlobalStats> GlobalStats::Diff(const GlobalStats& other) const {
   result->chaotic_good_tcp_write_size_control =
       chaotic_good_tcp_write_size_control -
       other.chaotic_good_tcp_write_size_control;
+  result->thread_pool_node_queue_depth =
+      thread_pool_node_queue_depth - other.thread_pool_node_queue_depth;
+  result->tcp_read_zerocopy_size =
+      tcp_read_zerocopy_size - other.tcp_read_zerocopy_size;
+  result->tcp_writes_per_syscall =
+      tcp_writes_per_syscall - other.tcp_writes_per_syscall;
   return result;
 }
 const absl::string_view
     Http2GlobalStats::counter_name[static_cast<int>(Counter::COUNT)] = {
-        "http2_settings_writes", "http2_pings_sent", "http2_transport_stalls",
-        "http2_stream_stalls",   "http2_hpack_hits", "http2_hpack_misses",
+        "http2_settings_writes",
+        "http2_pings_sent",
+        "http2_transport_stalls",
+        "http2_stream_stalls",
+        "http2_hpack_hits",
+        "http2_hpack_misses",
         "http2_writes_begun",
+        "http2_data_payload_copies",
+        "http2_data_payload_references",
 };
 const absl::string_view
     Http2GlobalStats::counter_doc[static_cast<int>(Counter::COUNT)] = {
@@ -834,6 +928,9 @@ const absl::string_view
         "Number of HPACK cache hits",
         "Number of HPACK cache misses (entries added but never used)",
         "Number of HTTP2 writes initiated",
+        "Number of DATA frame payload slices copied, rather than referenced, "
+        "when framing them for writing",
+        "Number of DATA frame payload slices written by reference",
 };
 const absl::string_view
     Http2GlobalStats::histogram_name[static_cast<int>(Histogram::COUNT)] = {
@@ -881,7 +978,9 @@ Http2GlobalStats::Http2GlobalStats()
       http2_stream_stalls{0},
       http2_hpack_hits{0},
       http2_hpack_misses{0},
-      http2_writes_begun{0} {}
+      http2_writes_begun{0},
+      http2_data_payload_copies{0},
+      http2_data_payload_references{0} {}
 HistogramView Http2GlobalStats::histogram(Histogram which) const {
   switch (which) {
     default:
@@ -954,6 +1053,10 @@ std::unique_ptr<Http2GlobalStats> Http2GlobalStatsCollector::Collect() const {
         data.http2_hpack_misses.load(std::memory_order_relaxed);
     result->http2_writes_begun +=
         data.http2_writes_begun.load(std::memory_order_relaxed);
+    result->http2_data_payload_copies +=
+        data.http2_data_payload_copies.load(std::memory_order_relaxed);
+    result->http2_data_payload_references +=
+        data.http2_data_payload_references.load(std::memory_order_relaxed);
     data.http2_send_message_size.Collect(&result->http2_send_message_size);
     data.http2_metadata_size.Collect(&result->http2_metadata_size);
     data.http2_hpack_entry_lifetime.Collect(
@@ -995,6 +1098,10 @@ std::unique_ptr<Http2GlobalStats> Http2GlobalStats::Diff(
   result->http2_hpack_hits = http2_hpack_hits - other.http2_hpack_hits;
   result->http2_hpack_misses = http2_hpack_misses - other.http2_hpack_misses;
   result->http2_writes_begun = http2_writes_begun - other.http2_writes_begun;
+  result->http2_data_payload_copies =
+      http2_data_payload_copies - other.http2_data_payload_copies;
+  result->http2_data_payload_references =
+      http2_data_payload_references - other.http2_data_payload_references;
   result->http2_send_message_size =
       http2_send_message_size - other.http2_send_message_size;
   result->http2_metadata_size = http2_metadata_size - other.http2_metadata_size;
@@ -1036,10 +1143,15 @@ std::unique_ptr<Http2GlobalStats> Http2GlobalStats::Diff(
 const absl::string_view
     Http2Stats::counter_name[static_cast<int>(Counter::COUNT)] = {
         "http2_writes_begun",
+        "http2_data_payload_copies",
+        "http2_data_payload_references",
 };
 const absl::string_view
     Http2Stats::counter_doc[static_cast<int>(Counter::COUNT)] = {
         "Number of HTTP2 writes initiated",
+        "Number of DATA frame payload slices copied, rather than referenced, "
+        "when framing them for writing",
+        "Number of DATA frame payload slices written by reference",
 };
 const absl::string_view
     Http2Stats::histogram_name[static_cast<int>(Histogram::COUNT)] = {
@@ -1049,5 +1161,8 @@ const absl::string_view
     Http2Stats::histogram_doc[static_cast<int>(Histogram::COUNT)] = {
         "Number of bytes targeted for http2 writes",
 };
-Http2Stats::Http2Stats() : http2_writes_begun{0} {}
+Http2Stats::Http2Stats()
+    : http2_writes_begun{0},
+      http2_data_payload_copies{0},
+      http2_data_payload_references{0} {}
 }  // namespace grpc_core
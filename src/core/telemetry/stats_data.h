@@ -298,6 +298,14 @@ struct GlobalStats {
     kEnobufsCount,
     kUncommonIoErrorCount,
     kMsgErrqueueErrorCount,
+    kThreadPoolSameNodeSteals,
+    kThreadPoolCrossNodeSteals,
+    kIoUringRecvBufferCopies,
+    kIoUringRecvBufferExhausted,
+    kTcpReadZerocopyFallback,
+    kPartyParticipantsAllocated,
+    kPartyParticipantsRecycled,
+    kBoxedMessages,
     COUNT
   };
   enum class Histogram {
@@ -327,6 +335,9 @@ struct GlobalStats {
     kChaoticGoodTcpReadOfferControl,
     kChaoticGoodTcpWriteSizeData,
     kChaoticGoodTcpWriteSizeControl,
+    kThreadPoolNodeQueueDepth,
+    kTcpReadZerocopySize,
+    kTcpWritesPerSyscall,
     COUNT
   };
   GlobalStats();
@@ -365,6 +376,14 @@ struct GlobalStats {
       uint64_t enobufs_count;
       uint64_t uncommon_io_error_count;
       uint64_t msg_errqueue_error_count;
+      uint64_t thread_pool_same_node_steals;
+      uint64_t thread_pool_cross_node_steals;
+      uint64_t io_uring_recv_buffer_copies;
+      uint64_t io_uring_recv_buffer_exhausted;
+      uint64_t tcp_read_zerocopy_fallback;
+      uint64_t party_participants_allocated;
+      uint64_t party_participants_recycled;
+      uint64_t boxed_messages;
     };
     uint64_t counters[static_cast<int>(Counter::COUNT)];
   };
@@ -394,6 +413,9 @@ struct GlobalStats {
   Histogram_16777216_20_64 chaotic_good_tcp_read_offer_control;
   Histogram_16777216_20_64 chaotic_good_tcp_write_size_data;
   Histogram_16777216_20_64 chaotic_good_tcp_write_size_control;
+  Histogram_10000_20_64 thread_pool_node_queue_depth;
+  Histogram_16777216_20_64 tcp_read_zerocopy_size;
+  Histogram_100_20_64 tcp_writes_per_syscall;
   HistogramView histogram(Histogram which) const;
   std::unique_ptr<GlobalStats> Diff(const GlobalStats& other) const;
 };
@@ -492,6 +514,37 @@ class GlobalStatsCollector {
     data_.this_cpu().msg_errqueue_error_count.fetch_add(
         1, std::memory_order_relaxed);
   }
+  void IncrementThreadPoolSameNodeSteals() {
+    data_.this_cpu().thread_pool_same_node_steals.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementThreadPoolCrossNodeSteals() {
+    data_.this_cpu().thread_pool_cross_node_steals.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementIoUringRecvBufferCopies() {
+    data_.this_cpu().io_uring_recv_buffer_copies.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementIoUringRecvBufferExhausted() {
+    data_.this_cpu().io_uring_recv_buffer_exhausted.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementTcpReadZerocopyFallback() {
+    data_.this_cpu().tcp_read_zerocopy_fallback.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementPartyParticipantsAllocated() {
+    data_.this_cpu().party_participants_allocated.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementPartyParticipantsRecycled() {
+    data_.this_cpu().party_participants_recycled.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementBoxedMessages() {
+    data_.this_cpu().boxed_messages.fetch_add(1, std::memory_order_relaxed);
+  }
   void IncrementCallInitialSize(int value) {
     data_.this_cpu().call_initial_size.Increment(value);
   }
@@ -571,6 +624,15 @@ class GlobalStatsCollector {
   void IncrementChaoticGoodTcpWriteSizeControl(int value) {
     data_.this_cpu().chaotic_good_tcp_write_size_control.Increment(value);
   }
+  void IncrementThreadPoolNodeQueueDepth(int value) {
+    data_.this_cpu().thread_pool_node_queue_depth.Increment(value);
+  }
+  void IncrementTcpReadZerocopySize(int value) {
+    data_.this_cpu().tcp_read_zerocopy_size.Increment(value);
+  }
+  void IncrementTcpWritesPerSyscall(int value) {
+    data_.this_cpu().tcp_writes_per_syscall.Increment(value);
+  }
 
  private:
   friend class Http2GlobalStatsCollector;
@@ -603,6 +665,14 @@ class GlobalStatsCollector {
     std::atomic<uint64_t> enobufs_count{0};
     std::atomic<uint64_t> uncommon_io_error_count{0};
     std::atomic<uint64_t> msg_errqueue_error_count{0};
+    std::atomic<uint64_t> thread_pool_same_node_steals{0};
+    std::atomic<uint64_t> thread_pool_cross_node_steals{0};
+    std::atomic<uint64_t> io_uring_recv_buffer_copies{0};
+    std::atomic<uint64_t> io_uring_recv_buffer_exhausted{0};
+    std::atomic<uint64_t> tcp_read_zerocopy_fallback{0};
+    std::atomic<uint64_t> party_participants_allocated{0};
+    std::atomic<uint64_t> party_participants_recycled{0};
+    std::atomic<uint64_t> boxed_messages{0};
     HistogramCollector_65536_26_64 call_initial_size;
     HistogramCollector_16777216_20_64 tcp_write_size;
     HistogramCollector_80_10_64 tcp_write_iov_size;
@@ -629,6 +699,9 @@ class GlobalStatsCollector {
     HistogramCollector_16777216_20_64 chaotic_good_tcp_read_offer_control;
     HistogramCollector_16777216_20_64 chaotic_good_tcp_write_size_data;
     HistogramCollector_16777216_20_64 chaotic_good_tcp_write_size_control;
+    HistogramCollector_10000_20_64 thread_pool_node_queue_depth;
+    HistogramCollector_16777216_20_64 tcp_read_zerocopy_size;
+    HistogramCollector_100_20_64 tcp_writes_per_syscall;
   };
   PerCpu<Data> data_{PerCpuOptions().SetCpusPerShard(4).SetMaxShards(32)};
 };
@@ -644,6 +717,8 @@ struct Http2GlobalStats {
     kHttp2HpackHits,
     kHttp2HpackMisses,
     kHttp2WritesBegun,
+    kHttp2DataPayloadCopies,
+    kHttp2DataPayloadReferences,
     COUNT
   };
   enum class Histogram {
@@ -681,6 +756,8 @@ struct Http2GlobalStats {
       uint64_t http2_hpack_hits;
       uint64_t http2_hpack_misses;
       uint64_t http2_writes_begun;
+      uint64_t http2_data_payload_copies;
+      uint64_t http2_data_payload_references;
     };
     uint64_t counters[static_cast<int>(Counter::COUNT)];
   };
@@ -732,6 +809,14 @@ class Http2GlobalStatsCollector {
   void IncrementHttp2WritesBegun() {
     data_.this_cpu().http2_writes_begun.fetch_add(1, std::memory_order_relaxed);
   }
+  void IncrementHttp2DataPayloadCopies() {
+    data_.this_cpu().http2_data_payload_copies.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementHttp2DataPayloadReferences() {
+    data_.this_cpu().http2_data_payload_references.fetch_add(
+        1, std::memory_order_relaxed);
+  }
 
  public:
   void IncrementHttp2SendMessageSize(int value) {
@@ -795,6 +880,8 @@ class Http2GlobalStatsCollector {
     std::atomic<uint64_t> http2_hpack_hits{0};
     std::atomic<uint64_t> http2_hpack_misses{0};
     std::atomic<uint64_t> http2_writes_begun{0};
+    std::atomic<uint64_t> http2_data_payload_copies{0};
+    std::atomic<uint64_t> http2_data_payload_references{0};
     HistogramCollector_16777216_20_64 http2_send_message_size;
     HistogramCollector_65536_26_64 http2_metadata_size;
     HistogramCollector_1800000_40_64 http2_hpack_entry_lifetime;
@@ -819,7 +906,12 @@ inline Http2GlobalStatsCollector& http2_global_stats() {
   return *NoDestructSingleton<Http2GlobalStatsCollector>::Get();
 }
 struct Http2Stats {
-  enum class Counter { kHttp2WritesBegun, COUNT };
+  enum class Counter {
+    kHttp2WritesBegun,
+    kHttp2DataPayloadCopies,
+    kHttp2DataPayloadReferences,
+    COUNT
+  };
   enum class Histogram { kHttp2WriteTargetSize, COUNT };
   Http2Stats();
   static const absl::string_view counter_name[static_cast<int>(Counter::COUNT)];
@@ -831,6 +923,8 @@ struct Http2Stats {
   union {
     struct {
       uint64_t http2_writes_begun;
+      uint64_t http2_data_payload_copies;
+      uint64_t http2_data_payload_references;
     };
     uint64_t counters[static_cast<int>(Counter::COUNT)];
   };
@@ -861,6 +955,14 @@ class Http2StatsCollector {
     ++data_.http2_writes_begun;
     http2_global_stats().IncrementHttp2WritesBegun();
   }
+  void IncrementHttp2DataPayloadCopies() {
+    ++data_.http2_data_payload_copies;
+    http2_global_stats().IncrementHttp2DataPayloadCopies();
+  }
+  void IncrementHttp2DataPayloadReferences() {
+    ++data_.http2_data_payload_references;
+    http2_global_stats().IncrementHttp2DataPayloadReferences();
+  }
   void IncrementHttp2SendMessageSize(int value) {
     http2_global_stats().IncrementHttp2SendMessageSize(value);
   }
@@ -0,0 +1,226 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/tsi/ssl/ktls/ssl_ktls.h"
+
+#include <grpc/support/port_platform.h>
+
+// The traffic keys can only be read back from BoringSSL.
+#if defined(GPR_LINUX) && defined(OPENSSL_IS_BORINGSSL)
+#if __has_include(<linux/tls.h>)
+#define GRPC_HAVE_KTLS
+#endif
+#endif
+
+#ifdef GRPC_HAVE_KTLS
+#include <errno.h>
+#include <linux/tls.h>
+#include <netinet/tcp.h>
+#include <openssl/digest.h>
+#include <openssl/hkdf.h>
+#include <openssl/mem.h>
+#include <string.h>
+#include <sys/socket.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "absl/log/log.h"
+#endif  // GRPC_HAVE_KTLS
+
+namespace tsi {
+
+#ifdef GRPC_HAVE_KTLS
+
+namespace {
+
+constexpr size_t kSaltSize = 4;
+constexpr size_t kIvSize = 8;
+constexpr size_t kRecSeqSize = 8;
+
+// The keys of one direction of a connection, in the layout of the kernel's
+// crypto info.
+struct DirectionKeys {
+  uint8_t key[32];
+  uint8_t salt[kSaltSize];
+  uint8_t iv[kIvSize];
+  uint8_t rec_seq[kRecSeqSize];
+};
+
+void StoreBigEndian64(uint64_t value, uint8_t* out) {
+  for (int i = 7; i >= 0; --i) {
+    out[i] = static_cast<uint8_t>(value & 0xff);
+    value >>= 8;
+  }
+}
+
+// HKDF-Expand-Label from RFC 8446 section 7.1, with an empty context.
+bool HkdfExpandLabel(const EVP_MD* digest, const uint8_t* secret,
+                     size_t secret_len, const char* label, uint8_t* out,
+                     size_t out_len) {
+  static constexpr char kPrefix[] = "tls13 ";
+  const size_t prefix_len = sizeof(kPrefix) - 1;
+  const size_t label_len = strlen(label);
+  std::vector<uint8_t> info;
+  info.push_back(static_cast<uint8_t>(out_len >> 8));
+  info.push_back(static_cast<uint8_t>(out_len & 0xff));
+  info.push_back(static_cast<uint8_t>(prefix_len + label_len));
+  info.insert(info.end(), kPrefix, kPrefix + prefix_len);
+  info.insert(info.end(), label, label + label_len);
+  info.push_back(0);
+  return HKDF_expand(out, out_len, digest, secret, secret_len, info.data(),
+                     info.size()) == 1;
+}
+
+// In TLS 1.3 both directions derive their key and 12 byte IV from the current
+// traffic secret. The kernel splits the IV into salt and iv.
+bool GetTls13Keys(SSL* ssl, bool write, size_t key_len, DirectionKeys* keys) {
+  const uint8_t* read_secret;
+  size_t read_secret_len;
+  const uint8_t* write_secret;
+  size_t write_secret_len;
+  if (!SSL_get_traffic_secrets(ssl, &read_secret, &read_secret_len,
+                               &write_secret, &write_secret_len)) {
+    return false;
+  }
+  const uint8_t* secret = write ? write_secret : read_secret;
+  const size_t secret_len = write ? write_secret_len : read_secret_len;
+  const EVP_MD* digest = key_len == 16 ? EVP_sha256() : EVP_sha384();
+  uint8_t iv[kSaltSize + kIvSize];
+  if (!HkdfExpandLabel(digest, secret, secret_len, "key", keys->key,
+                       key_len) ||
+      !HkdfExpandLabel(digest, secret, secret_len, "iv", iv, sizeof(iv))) {
+    return false;
+  }
+  memcpy(keys->salt, iv, kSaltSize);
+  memcpy(keys->iv, iv + kSaltSize, kIvSize);
+  OPENSSL_cleanse(iv, sizeof(iv));
+  return true;
+}
+
+// In TLS 1.2 the AES-GCM key block holds the client and server write keys
+// followed by their 4 byte implicit IVs; there are no MAC keys. BoringSSL uses
+// the record sequence number as the explicit nonce, and so does the kernel
+// when given it as iv.
+bool GetTls12Keys(SSL* ssl, bool write, size_t key_len, uint64_t seq,
+                  DirectionKeys* keys) {
+  const size_t block_len = SSL_get_key_block_len(ssl);
+  if (block_len != 2 * (key_len + kSaltSize)) return false;
+  std::vector<uint8_t> block(block_len);
+  if (!SSL_generate_key_block(ssl, block.data(), block.size())) return false;
+  const bool client_keys = (SSL_is_server(ssl) == 0) == write;
+  memcpy(keys->key, block.data() + (client_keys ? 0 : key_len), key_len);
+  memcpy(keys->salt,
+         block.data() + 2 * key_len + (client_keys ? 0 : kSaltSize),
+         kSaltSize);
+  StoreBigEndian64(seq, keys->iv);
+  OPENSSL_cleanse(block.data(), block.size());
+  return true;
+}
+
+template <typename CryptoInfo>
+bool SetCryptoInfo(int fd, int direction, uint16_t version,
+                   uint16_t cipher_type, const DirectionKeys& keys) {
+  CryptoInfo info;
+  memset(&info, 0, sizeof(info));
+  info.info.version = version;
+  info.info.cipher_type = cipher_type;
+  memcpy(info.key, keys.key, sizeof(info.key));
+  memcpy(info.salt, keys.salt, sizeof(info.salt));
+  memcpy(info.iv, keys.iv, sizeof(info.iv));
+  memcpy(info.rec_seq, keys.rec_seq, sizeof(info.rec_seq));
+  const bool ok = setsockopt(fd, SOL_TLS, direction, &info, sizeof(info)) == 0;
+  if (!ok) {
+    VLOG(2) << "Could not set kernel TLS "
+            << (direction == TLS_TX ? "TX" : "RX")
+            << " keys: " << strerror(errno);
+  }
+  OPENSSL_cleanse(&info, sizeof(info));
+  return ok;
+}
+
+bool InstallKeys(SSL* ssl, int fd, bool write, uint16_t version,
+                 size_t key_len) {
+  const uint64_t seq =
+      write ? SSL_get_write_sequence(ssl) : SSL_get_read_sequence(ssl);
+  DirectionKeys keys;
+  bool ok = version == TLS_1_3_VERSION
+                ? GetTls13Keys(ssl, write, key_len, &keys)
+                : GetTls12Keys(ssl, write, key_len, seq, &keys);
+  if (ok) {
+    StoreBigEndian64(seq, keys.rec_seq);
+    const int direction = write ? TLS_TX : TLS_RX;
+    ok = key_len == 16 ? SetCryptoInfo<tls12_crypto_info_aes_gcm_128>(
+                             fd, direction, version, TLS_CIPHER_AES_GCM_128,
+                             keys)
+                       : SetCryptoInfo<tls12_crypto_info_aes_gcm_256>(
+                             fd, direction, version, TLS_CIPHER_AES_GCM_256,
+                             keys);
+  }
+  OPENSSL_cleanse(&keys, sizeof(keys));
+  return ok;
+}
+
+}  // namespace
+
+KernelTlsOffload OffloadTlsToKernel(SSL* ssl, int fd, bool rx) {
+  KernelTlsOffload offload;
+  const SSL_CIPHER* cipher = SSL_get_current_cipher(ssl);
+  if (fd < 0 || cipher == nullptr) return offload;
+  size_t key_len;
+  switch (SSL_CIPHER_get_cipher_nid(cipher)) {
+    case NID_aes_128_gcm:
+      key_len = 16;
+      break;
+    case NID_aes_256_gcm:
+      key_len = 32;
+      break;
+    default:
+      return offload;
+  }
+  uint16_t version;
+  switch (SSL_version(ssl)) {
+    case TLS1_2_VERSION:
+      version = TLS_1_2_VERSION;
+      break;
+    case TLS1_3_VERSION:
+      version = TLS_1_3_VERSION;
+      break;
+    default:
+      return offload;
+  }
+  // Without keys, the tls ULP passes data through unchanged, so a connection
+  // on which installing them fails below keeps working in user space.
+  if (setsockopt(fd, SOL_TCP, TCP_ULP, "tls", sizeof("tls")) != 0) {
+    VLOG(2) << "Kernel TLS is not available: " << strerror(errno);
+    return offload;
+  }
+  offload.tx = InstallKeys(ssl, fd, /*write=*/true, version, key_len);
+  // Receiving is only offloaded along with sending, so that the caller never
+  // has to deal with a connection that is offloaded in the RX direction only.
+  if (offload.tx && rx) {
+    offload.rx = InstallKeys(ssl, fd, /*write=*/false, version, key_len);
+  }
+  return offload;
+}
+
+#else  // GRPC_HAVE_KTLS
+
+KernelTlsOffload OffloadTlsToKernel(SSL* /*ssl*/, int /*fd*/, bool /*rx*/) {
+  return KernelTlsOffload();
+}
+
+#endif  // GRPC_HAVE_KTLS
+
+}  // namespace tsi
@@ -0,0 +1,44 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_TSI_SSL_KTLS_SSL_KTLS_H
+#define GRPC_SRC_CORE_TSI_SSL_KTLS_SSL_KTLS_H
+
+#include <grpc/support/port_platform.h>
+#include <openssl/ssl.h>
+
+namespace tsi {
+
+// The directions of a TLS connection whose record protection has been moved
+// into the kernel.
+struct KernelTlsOffload {
+  bool tx = false;
+  bool rx = false;
+};
+
+// Installs the traffic keys of the established TLS connection |ssl| on the
+// socket |fd| with Linux kernel TLS, so that the kernel encrypts everything
+// written to the socket and, if |rx| is set, decrypts everything read from it.
+//
+// Offloading is best effort: it is only possible on Linux with BoringSSL, for
+// the AES-GCM cipher suites of TLS 1.2 and 1.3, and when the kernel has the tls
+// module. The returned value says which directions were offloaded; the caller
+// must keep protecting the others with |ssl|. Nothing may be pending in either
+// direction of |ssl| when this is called. Once a direction is offloaded, |ssl|
+// must not be used for it any more.
+KernelTlsOffload OffloadTlsToKernel(SSL* ssl, int fd, bool rx);
+
+}  // namespace tsi
+
+#endif  // GRPC_SRC_CORE_TSI_SSL_KTLS_SSL_KTLS_H
@@ -22,6 +22,7 @@
 #include <limits.h>
 #include <string.h>
 
+#include <algorithm>
 #include <cstdlib>
 
 // TODO(jboeuf): refactor inet_ntop into a portability header.
@@ -57,6 +58,7 @@
 #include "src/core/credentials/transport/tls/ssl_utils.h"
 #include "src/core/lib/surface/init.h"
 #include "src/core/tsi/ssl/key_logging/ssl_key_logging.h"
+#include "src/core/tsi/ssl/ktls/ssl_ktls.h"
 #include "src/core/tsi/ssl/session_cache/ssl_session_cache.h"
 #include "src/core/tsi/ssl_transport_security_utils.h"
 #include "src/core/tsi/ssl_types.h"
@@ -151,6 +153,9 @@ struct tsi_ssl_handshaker_result {
   BIO* network_io;
   unsigned char* unused_bytes;
   size_t unused_bytes_size;
+  // Which directions of record protection the kernel has taken over.
+  bool protect_offloaded;
+  bool unprotect_offloaded;
 };
 struct tsi_ssl_frame_protector {
   tsi_frame_protector base;
@@ -159,6 +164,9 @@ struct tsi_ssl_frame_protector {
   unsigned char* buffer;
   size_t buffer_size;
   size_t buffer_offset;
+  // Set when the kernel protects the bytes written to the socket, in which
+  // case protect only copies its input.
+  bool protect_offloaded;
   // Ensures that protect, protect_flush, and unprotect are not called
   // concurrently.
   gpr_mu mu;
@@ -1508,6 +1516,14 @@ static tsi_result ssl_protector_protect(tsi_frame_protector* self,
                                         size_t* protected_output_frames_size) {
   tsi_ssl_frame_protector* impl =
       reinterpret_cast<tsi_ssl_frame_protector*>(self);
+  if (impl->protect_offloaded) {
+    size_t size =
+        std::min(*unprotected_bytes_size, *protected_output_frames_size);
+    memcpy(protected_output_frames, unprotected_bytes, size);
+    *unprotected_bytes_size = size;
+    *protected_output_frames_size = size;
+    return TSI_OK;
+  }
   gpr_mu_lock(&impl->mu);
   tsi_result result = grpc_core::SslProtectorProtect(
       unprotected_bytes, impl->buffer_size, impl->buffer_offset, impl->buffer,
@@ -1522,6 +1538,11 @@ static tsi_result ssl_protector_protect_flush(
     size_t* protected_output_frames_size, size_t* still_pending_size) {
   tsi_ssl_frame_protector* impl =
       reinterpret_cast<tsi_ssl_frame_protector*>(self);
+  if (impl->protect_offloaded) {
+    *protected_output_frames_size = 0;
+    *still_pending_size = 0;
+    return TSI_OK;
+  }
   gpr_mu_lock(&impl->mu);
   tsi_result result = grpc_core::SslProtectorProtectFlush(
       impl->buffer_offset, impl->buffer, impl->ssl, impl->network_io,
@@ -1555,11 +1576,18 @@ static void ssl_protector_destroy(tsi_frame_protector* self) {
   gpr_free(self);
 }
 
+static bool ssl_protector_protect_is_passthrough(
+    const tsi_frame_protector* self) {
+  return reinterpret_cast<const tsi_ssl_frame_protector*>(self)
+      ->protect_offloaded;
+}
+
 static const tsi_frame_protector_vtable frame_protector_vtable = {
     ssl_protector_protect,
     ssl_protector_protect_flush,
     ssl_protector_unprotect,
     ssl_protector_destroy,
+    ssl_protector_protect_is_passthrough,
 };
 
 // --- tsi_server_handshaker_factory methods implementation. ---
@@ -1712,9 +1740,15 @@ static tsi_result ssl_handshaker_result_extract_peer(
 }
 
 static tsi_result ssl_handshaker_result_get_frame_protector_type(
-    const tsi_handshaker_result* /*self*/,
+    const tsi_handshaker_result* self,
     tsi_frame_protector_type* frame_protector_type) {
-  *frame_protector_type = TSI_FRAME_PROTECTOR_NORMAL;
+  const tsi_ssl_handshaker_result* impl =
+      reinterpret_cast<const tsi_ssl_handshaker_result*>(self);
+  // Unprotection is only offloaded along with protection, after which the
+  // kernel does all of the work.
+  *frame_protector_type = impl->unprotect_offloaded
+                              ? TSI_FRAME_PROTECTOR_NONE
+                              : TSI_FRAME_PROTECTOR_NORMAL;
   return TSI_OK;
 }
 
@@ -1757,6 +1791,7 @@ static tsi_result ssl_handshaker_result_create_frame_protector(
   impl->ssl = nullptr;
   protector_impl->network_io = impl->network_io;
   impl->network_io = nullptr;
+  protector_impl->protect_offloaded = impl->protect_offloaded;
   gpr_mu_init(&protector_impl->mu);
   protector_impl->base.vtable = &frame_protector_vtable;
   *protector = &protector_impl->base;
@@ -1773,6 +1808,31 @@ static tsi_result ssl_handshaker_result_get_unused_bytes(
   return TSI_OK;
 }
 
+static tsi_result ssl_handshaker_result_offload_to_kernel(
+    tsi_handshaker_result* self, int fd, bool* protect_offloaded,
+    bool* unprotect_offloaded) {
+  tsi_ssl_handshaker_result* impl =
+      reinterpret_cast<tsi_ssl_handshaker_result*>(self);
+  if (impl->ssl == nullptr) return TSI_FAILED_PRECONDITION;
+  // Protected bytes that were not sent yet would be overtaken by the ones the
+  // kernel protects.
+  if (BIO_pending(impl->network_io) > 0) return TSI_OK;
+  // The kernel must see every record that follows the handshake, and they
+  // must all be application data: a TLS 1.3 server sends session tickets after
+  // the handshake, which kernel TLS turns into read errors, so only servers
+  // offload unprotection.
+  const bool rx = SSL_is_server(impl->ssl) && impl->unused_bytes_size == 0 &&
+                  BIO_pending(SSL_get_rbio(impl->ssl)) == 0 &&
+                  !SSL_has_pending(impl->ssl);
+  tsi::KernelTlsOffload offload =
+      tsi::OffloadTlsToKernel(impl->ssl, fd, rx);
+  impl->protect_offloaded = offload.tx;
+  impl->unprotect_offloaded = offload.rx;
+  *protect_offloaded = offload.tx;
+  *unprotect_offloaded = offload.rx;
+  return TSI_OK;
+}
+
 static void ssl_handshaker_result_destroy(tsi_handshaker_result* self) {
   tsi_ssl_handshaker_result* impl =
       reinterpret_cast<tsi_ssl_handshaker_result*>(self);
@@ -1789,6 +1849,7 @@ static const tsi_handshaker_result_vtable handshaker_result_vtable = {
     ssl_handshaker_result_create_frame_protector,
     ssl_handshaker_result_get_unused_bytes,
     ssl_handshaker_result_destroy,
+    ssl_handshaker_result_offload_to_kernel,
 };
 
 static tsi_result ssl_handshaker_result_create(
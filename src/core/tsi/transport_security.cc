@@ -126,6 +126,15 @@ tsi_result tsi_frame_protector_unprotect(
                                  unprotected_bytes_size);
 }
 
+bool tsi_frame_protector_protect_is_passthrough(
+    const tsi_frame_protector* self) {
+  if (self == nullptr || self->vtable == nullptr ||
+      self->vtable->protect_is_passthrough == nullptr) {
+    return false;
+  }
+  return self->vtable->protect_is_passthrough(self);
+}
+
 void tsi_frame_protector_destroy(tsi_frame_protector* self) {
   if (self == nullptr) return;
   self->vtable->destroy(self);
@@ -291,6 +300,21 @@ tsi_result tsi_handshaker_result_get_unused_bytes(
   return self->vtable->get_unused_bytes(self, bytes, bytes_size);
 }
 
+tsi_result tsi_handshaker_result_offload_to_kernel(tsi_handshaker_result* self,
+                                                   int fd,
+                                                   bool* protect_offloaded,
+                                                   bool* unprotect_offloaded) {
+  if (self == nullptr || self->vtable == nullptr ||
+      protect_offloaded == nullptr || unprotect_offloaded == nullptr) {
+    return TSI_INVALID_ARGUMENT;
+  }
+  *protect_offloaded = false;
+  *unprotect_offloaded = false;
+  if (self->vtable->offload_to_kernel == nullptr) return TSI_UNIMPLEMENTED;
+  return self->vtable->offload_to_kernel(self, fd, protect_offloaded,
+                                         unprotect_offloaded);
+}
+
 void tsi_handshaker_result_destroy(tsi_handshaker_result* self) {
   if (self == nullptr) return;
   self->vtable->destroy(self);
@@ -47,6 +47,8 @@ struct tsi_frame_protector_vtable {
                           unsigned char* unprotected_bytes,
                           size_t* unprotected_bytes_size);
   void (*destroy)(tsi_frame_protector* self);
+  // May be null, which means false.
+  bool (*protect_is_passthrough)(const tsi_frame_protector* self);
 };
 struct tsi_frame_protector {
   const tsi_frame_protector_vtable* vtable;
@@ -118,6 +120,11 @@ struct tsi_handshaker_result_vtable {
                                  const unsigned char** bytes,
                                  size_t* bytes_size);
   void (*destroy)(tsi_handshaker_result* self);
+  // May be null if the implementation cannot offload record protection to
+  // the kernel.
+  tsi_result (*offload_to_kernel)(tsi_handshaker_result* self, int fd,
+                                  bool* protect_offloaded,
+                                  bool* unprotect_offloaded);
 };
 struct tsi_handshaker_result {
   const tsi_handshaker_result_vtable* vtable;
@@ -214,6 +214,12 @@ tsi_result tsi_frame_protector_unprotect(
     size_t* protected_frames_bytes_size, unsigned char* unprotected_bytes,
     size_t* unprotected_bytes_size);
 
+// Returns true if tsi_frame_protector_protect() only copies the unprotected
+// bytes to the output, because their protection has been offloaded to the
+// kernel. The caller may then send the unprotected bytes as they are.
+bool tsi_frame_protector_protect_is_passthrough(
+    const tsi_frame_protector* self);
+
 // Destroys the tsi_frame_protector object.
 void tsi_frame_protector_destroy(tsi_frame_protector* self);
 
@@ -279,6 +285,23 @@ tsi_result tsi_handshaker_result_get_unused_bytes(
     const tsi_handshaker_result* self, const unsigned char** bytes,
     size_t* bytes_size);
 
+// This method moves the record protection of the connection into the kernel
+// of the socket |fd| the handshake ran on, where possible. It must be called
+// before the frame protector is created, and only once all bytes to send from
+// the handshake have been written to the socket.
+// - protect_offloaded is set to whether the kernel now protects the bytes
+//   written to the socket. The frame protector then passes them through.
+// - unprotect_offloaded is set to whether the kernel now also unprotects the
+//   bytes read from the socket. It is only ever set along with
+//   protect_offloaded, and get_frame_protector_type then returns
+//   TSI_FRAME_PROTECTOR_NONE.
+// It returns TSI_UNIMPLEMENTED if the TSI implementation does not support
+// kernel offload, and TSI_OK otherwise, even if nothing was offloaded.
+tsi_result tsi_handshaker_result_offload_to_kernel(tsi_handshaker_result* self,
+                                                   int fd,
+                                                   bool* protect_offloaded,
+                                                   bool* unprotect_offloaded);
+
 // This method releases the tsi_handshaker_handshaker object. After this method
 // is called, no other method can be called on the object.
 void tsi_handshaker_result_destroy(tsi_handshaker_result* self);
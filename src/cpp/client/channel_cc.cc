@@ -163,7 +163,9 @@ grpc::internal::Call Channel::CreateCallInternal(
       interceptor_creators_, interceptor_pos);
   context->set_call(c_call, shared_from_this());
 
-  return grpc::internal::Call(c_call, cq, info);
+  grpc::internal::Call call(c_call, cq, info);
+  call.set_max_boxed_message_size(max_boxed_message_size_);
+  return call;
 }
 
 grpc::internal::Call Channel::CreateCall(
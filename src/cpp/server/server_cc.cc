@@ -66,6 +66,7 @@
 #include <vector>
 
 #include "src/core/ext/transport/inproc/inproc_transport.h"
+#include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/iomgr/iomgr.h"
@@ -427,6 +428,8 @@ class Server::SyncRequest final : public grpc::internal::CompletionQueueTag {
         call_, &cq_, server_->max_receive_message_size(),
         ctx_->ctx.set_server_rpc_info(method_->name(), method_->method_type(),
                                       server_->interceptor_creators_));
+    wrapped_call_->set_max_boxed_message_size(
+        grpc_core::InprocCallObjectPassingLimit(call_).value_or(0));
     ctx_->ctx.set_call(call_, server_->call_metric_recording_enabled(),
                        server_->server_metric_recorder(),
                        server_->memory_allocator());
@@ -679,6 +682,8 @@ class Server::CallbackRequest final
                           ? req_->method_->method_type()
                           : grpc::internal::RpcMethod::BIDI_STREAMING,
                       req_->server_->interceptor_creators_));
+      call_->set_max_boxed_message_size(
+          grpc_core::InprocCallObjectPassingLimit(req_->call_).value_or(0));
 
       req_->interceptor_methods_.SetCall(call_);
       req_->interceptor_methods_.SetReverse();
@@ -1015,11 +1020,9 @@ grpc_server* Server::c_server() { return server_; }
 
 std::shared_ptr<grpc::Channel> Server::InProcessChannel(
     const grpc::ChannelArguments& args) {
-  grpc_channel_args channel_args = args.c_channel_args();
-  return grpc::CreateChannelInternal(
-      "inproc", grpc_inproc_channel_create(server_, &channel_args, nullptr),
-      std::vector<std::unique_ptr<
-          grpc::experimental::ClientInterceptorFactoryInterface>>());
+  return CreateInProcessChannel(
+      args, std::vector<std::unique_ptr<
+                grpc::experimental::ClientInterceptorFactoryInterface>>());
 }
 
 std::shared_ptr<grpc::Channel>
@@ -1028,11 +1031,24 @@ Server::experimental_type::InProcessChannelWithInterceptors(
     std::vector<
         std::unique_ptr<grpc::experimental::ClientInterceptorFactoryInterface>>
         interceptor_creators) {
+  return server_->CreateInProcessChannel(args,
+                                         std::move(interceptor_creators));
+}
+
+std::shared_ptr<grpc::Channel> Server::CreateInProcessChannel(
+    const grpc::ChannelArguments& args,
+    std::vector<
+        std::unique_ptr<grpc::experimental::ClientInterceptorFactoryInterface>>
+        interceptor_creators) {
   grpc_channel_args channel_args = args.c_channel_args();
-  return grpc::CreateChannelInternal(
-      "inproc",
-      grpc_inproc_channel_create(server_->server_, &channel_args, nullptr),
+  auto channel = grpc::CreateChannelInternal(
+      "inproc", grpc_inproc_channel_create(server_, &channel_args, nullptr),
       std::move(interceptor_creators));
+  channel->max_boxed_message_size_ =
+      grpc_core::InprocChannelObjectPassingLimit(
+          server_, grpc_core::ChannelArgs::FromC(&channel_args))
+          .value_or(0);
+  return channel;
 }
 
 static grpc_server_register_method_payload_handling PayloadHandlingForMethod(
@@ -26,10 +26,69 @@
 #include <grpcpp/support/status.h>
 
 #include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
 #include <vector>
 
+#include "src/core/lib/slice/slice_refcount.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
+
 namespace grpc {
 
+namespace {
+
+// Owns a boxed message for the slice that carries it.
+struct BoxedMessageRefcount final : public grpc_slice_refcount {
+  explicit BoxedMessageRefcount(std::unique_ptr<internal::BoxedMessage> message)
+      : grpc_slice_refcount(Destroy), message(std::move(message)) {}
+
+  static void Destroy(grpc_slice_refcount* refcount) {
+    delete static_cast<BoxedMessageRefcount*>(refcount);
+  }
+
+  std::unique_ptr<internal::BoxedMessage> message;
+};
+
+// The bytes of a boxed message: field number 0 is invalid in protobuf, so
+// code that parses them fails rather than seeing an empty message.
+const uint8_t kBoxedMessageBytes[1] = {0};
+
+}  // namespace
+
+namespace internal {
+
+void BoxMessage(std::unique_ptr<BoxedMessage> message, ByteBuffer* buffer) {
+  grpc_slice slice;
+  slice.refcount = new BoxedMessageRefcount(std::move(message));
+  slice.data.refcounted.bytes = const_cast<uint8_t*>(kBoxedMessageBytes);
+  slice.data.refcounted.length = sizeof(kBoxedMessageBytes);
+  grpc_byte_buffer* bb = grpc_raw_byte_buffer_create(nullptr, 0);
+  grpc_slice_buffer_add(&bb->data.raw.slice_buffer, slice);
+  buffer->set_buffer(bb);
+  grpc_core::global_stats().IncrementBoxedMessages();
+}
+
+BoxedMessage* GetBoxedMessage(ByteBuffer* buffer, bool* exclusive) {
+  grpc_byte_buffer* bb = buffer->buffer_;
+  if (bb == nullptr || bb->type != GRPC_BB_RAW ||
+      bb->data.raw.compression != GRPC_COMPRESS_NONE ||
+      bb->data.raw.slice_buffer.count != 1) {
+    return nullptr;
+  }
+  grpc_slice_refcount* refcount = bb->data.raw.slice_buffer.slices[0].refcount;
+  if (refcount == nullptr || refcount == grpc_slice_refcount::NoopRefcount() ||
+      refcount->destroyer_fn() != BoxedMessageRefcount::Destroy) {
+    return nullptr;
+  }
+  *exclusive = refcount->IsUnique();
+  return static_cast<BoxedMessageRefcount*>(refcount)->message.get();
+}
+
+}  // namespace internal
+
 Status ByteBuffer::TrySingleSlice(Slice* slice) const {
   if (!buffer_) {
     return Status(StatusCode::FAILED_PRECONDITION, "Buffer not initialized");
@@ -144,11 +144,13 @@ CORE_SOURCE_FILES = [
     'src/core/ext/transport/chttp2/chttp2_plugin.cc',
     'src/core/ext/transport/chttp2/client/chttp2_connector.cc',
     'src/core/ext/transport/chttp2/server/chttp2_server.cc',
+    'src/core/ext/transport/chttp2/transport/base64_simd.cc',
     'src/core/ext/transport/chttp2/transport/bin_decoder.cc',
     'src/core/ext/transport/chttp2/transport/bin_encoder.cc',
     'src/core/ext/transport/chttp2/transport/call_tracer_wrapper.cc',
     'src/core/ext/transport/chttp2/transport/chttp2_transport.cc',
     'src/core/ext/transport/chttp2/transport/decode_huff.cc',
+    'src/core/ext/transport/chttp2/transport/decode_huff_multi.cc',
     'src/core/ext/transport/chttp2/transport/flow_control.cc',
     'src/core/ext/transport/chttp2/transport/frame.cc',
     'src/core/ext/transport/chttp2/transport/frame_data.cc',
@@ -566,10 +568,12 @@ CORE_SOURCE_FILES = [
     'src/core/lib/event_engine/endpoint_channel_arg_wrapper.cc',
     'src/core/lib/event_engine/event_engine.cc',
     'src/core/lib/event_engine/posix_engine/ev_epoll1_linux.cc',
+    'src/core/lib/event_engine/posix_engine/ev_io_uring_linux.cc',
     'src/core/lib/event_engine/posix_engine/ev_poll_posix.cc',
     'src/core/lib/event_engine/posix_engine/event_poller_posix_default.cc',
     'src/core/lib/event_engine/posix_engine/file_descriptor_collection.cc',
     'src/core/lib/event_engine/posix_engine/internal_errqueue.cc',
+    'src/core/lib/event_engine/posix_engine/io_uring.cc',
     'src/core/lib/event_engine/posix_engine/lockfree_event.cc',
     'src/core/lib/event_engine/posix_engine/native_posix_dns_resolver.cc',
     'src/core/lib/event_engine/posix_engine/posix_endpoint.cc',
@@ -584,16 +588,19 @@ CORE_SOURCE_FILES = [
     'src/core/lib/event_engine/posix_engine/timer.cc',
     'src/core/lib/event_engine/posix_engine/timer_heap.cc',
     'src/core/lib/event_engine/posix_engine/timer_manager.cc',
+    'src/core/lib/event_engine/posix_engine/timer_wheel.cc',
     'src/core/lib/event_engine/posix_engine/traced_buffer_list.cc',
     'src/core/lib/event_engine/posix_engine/wakeup_fd_eventfd.cc',
     'src/core/lib/event_engine/posix_engine/wakeup_fd_pipe.cc',
     'src/core/lib/event_engine/posix_engine/wakeup_fd_posix_default.cc',
+    'src/core/lib/event_engine/posix_engine/write_batcher.cc',
     'src/core/lib/event_engine/resolved_address.cc',
     'src/core/lib/event_engine/shim.cc',
     'src/core/lib/event_engine/slice.cc',
     'src/core/lib/event_engine/slice_buffer.cc',
     'src/core/lib/event_engine/tcp_socket_utils.cc',
     'src/core/lib/event_engine/thread_local.cc',
+    'src/core/lib/event_engine/thread_pool/cpu_topology.cc',
     'src/core/lib/event_engine/thread_pool/thread_count.cc',
     'src/core/lib/event_engine/thread_pool/thread_pool_factory.cc',
     'src/core/lib/event_engine/thread_pool/work_stealing_thread_pool.cc',
@@ -608,6 +615,7 @@ CORE_SOURCE_FILES = [
     'src/core/lib/event_engine/windows/windows_engine.cc',
     'src/core/lib/event_engine/windows/windows_listener.cc',
     'src/core/lib/event_engine/work_queue/basic_work_queue.cc',
+    'src/core/lib/event_engine/work_queue/chase_lev_work_queue.cc',
     'src/core/lib/experiments/config.cc',
     'src/core/lib/experiments/experiments.cc',
     'src/core/lib/iomgr/buffer_list.cc',
@@ -829,6 +837,7 @@ CORE_SOURCE_FILES = [
     'src/core/tsi/fake_transport_security.cc',
     'src/core/tsi/local_transport_security.cc',
     'src/core/tsi/ssl/key_logging/ssl_key_logging.cc',
+    'src/core/tsi/ssl/ktls/ssl_ktls.cc',
     'src/core/tsi/ssl/session_cache/ssl_session_boringssl.cc',
     'src/core/tsi/ssl/session_cache/ssl_session_cache.cc',
     'src/core/tsi/ssl/session_cache/ssl_session_openssl.cc',
@@ -18,6 +18,7 @@
 
 #include "src/core/call/call_arena_allocator.h"
 
+#include <grpc/support/alloc.h>
 #include <grpc/support/sync.h>
 #include <grpc/support/time.h>
 #include <inttypes.h>
@@ -71,6 +72,75 @@ TEST(CallArenaAllocatorTest, SettlesWithAllocation) {
   LOG(INFO) << estimate;
 }
 
+TEST(CallArenaAllocatorTest, RecyclesArenaStorage) {
+  auto memory_quota = MakeResourceQuota("test-quota")->memory_quota();
+  auto allocator = MakeRefCounted<CallArenaAllocator>(
+      memory_quota->CreateMemoryAllocator("test-allocator"), 1, memory_quota);
+  for (int i = 0; i < 10000; i++) {
+    allocator->MakeArena();
+  }
+  auto arena = allocator->MakeArena();
+  const size_t used = arena->TotalUsedBytes();
+  Arena* storage = arena.get();
+  arena.reset();
+  // The freed block is not handed out by malloc while it is recycled.
+  void* other = gpr_malloc_aligned(allocator->CallSizeEstimate(), 64);
+  arena = allocator->MakeArena();
+  EXPECT_EQ(arena.get(), storage);
+  EXPECT_EQ(arena->TotalUsedBytes(), used);
+  gpr_free_aligned(other);
+}
+
+TEST(CallArenaAllocatorTest, RecycledArenaStartsEmpty) {
+  auto memory_quota = MakeResourceQuota("test-quota")->memory_quota();
+  auto allocator = MakeRefCounted<CallArenaAllocator>(
+      memory_quota->CreateMemoryAllocator("test-allocator"), 1, memory_quota);
+  for (int i = 0; i < 10000; i++) {
+    allocator->MakeArena()->Alloc(100);
+  }
+  bool destroyed = false;
+  struct Object {
+    explicit Object(bool* destroyed) : destroyed(destroyed) {}
+    ~Object() { *destroyed = true; }
+    bool* destroyed;
+  };
+  auto arena = allocator->MakeArena();
+  const size_t used = arena->TotalUsedBytes();
+  arena->Alloc(100);
+  arena->ManagedNew<Object>(&destroyed);
+  Arena* storage = arena.get();
+  arena.reset();
+  EXPECT_TRUE(destroyed);
+  arena = allocator->MakeArena();
+  EXPECT_EQ(arena.get(), storage);
+  EXPECT_EQ(arena->TotalUsedBytes(), used);
+}
+
+TEST(CallArenaAllocatorTest, ReclaimerFreesRecycledStorage) {
+  ExecCtx exec_ctx;
+  auto memory_quota = MakeResourceQuota("test-quota")->memory_quota();
+  auto allocator = MakeRefCounted<CallArenaAllocator>(
+      memory_quota->CreateMemoryAllocator("test-allocator"), 1, memory_quota);
+  for (int i = 0; i < 10000; i++) {
+    allocator->MakeArena();
+  }
+  auto arena = allocator->MakeArena();
+  Arena* storage = arena.get();
+  arena.reset();
+  // Going over the quota sweeps its reclaimers, benign ones first.
+  memory_quota->SetSize(4096);
+  auto other_allocator = memory_quota->CreateMemoryAllocator("other");
+  other_allocator.Reserve(8192);
+  exec_ctx.Flush();
+  other_allocator.Release(8192);
+  // The freed block is handed out by malloc instead of being recycled.
+  void* other = gpr_malloc_aligned(allocator->CallSizeEstimate(), 64);
+  arena = allocator->MakeArena();
+  EXPECT_NE(arena.get(), storage);
+  arena.reset();
+  gpr_free_aligned(other);
+}
+
 }  // namespace grpc_core
 
 int main(int argc, char* argv[]) {
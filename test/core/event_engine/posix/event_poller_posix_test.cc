@@ -21,6 +21,7 @@
 #include <chrono>
 #include <cstring>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "src/core/config/config_vars.h"
@@ -44,12 +45,14 @@
 
 #include <errno.h>
 #include <fcntl.h>
+#include <grpc/event_engine/slice_buffer.h>
 #include <grpc/support/alloc.h>
 #include <grpc/support/sync.h>
 #include <netinet/in.h>
 #include <poll.h>
 #include <stdlib.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
 #include "src/core/lib/event_engine/common_closures.h"
@@ -514,6 +517,138 @@ TEST_F(EventPollerTest, TestEventPollerHandleChange) {
   close(sv[1]);
 }
 
+// Test the completion based I/O offered by pollers whose handles implement
+// EventHandleAsyncIo: data sent with SendMsg on one end of a socketpair is
+// received with RecvMsg on the other, and a RecvMsg pending at shutdown
+// completes with the shutdown status.
+TEST_F(EventPollerTest, TestEventPollerHandleAsyncIo) {
+  int sv[2];
+  if (g_event_poller == nullptr) {
+    return;
+  }
+  EXPECT_EQ(socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, sv), 0);
+  EventHandle* reader = g_event_poller->CreateHandle(
+      g_event_poller->posix_interface().Adopt(sv[0]), "reader", false);
+  EventHandle* writer = g_event_poller->CreateHandle(
+      g_event_poller->posix_interface().Adopt(sv[1]), "writer", false);
+  if (reader->AsyncIo() == nullptr) {
+    reader->OrphanHandle(nullptr, nullptr, "");
+    writer->OrphanHandle(nullptr, nullptr, "");
+    GTEST_SKIP() << g_event_poller->Name() << " does not support async I/O";
+  }
+  int num_done = 0;
+  absl::StatusOr<int64_t> sent;
+  absl::StatusOr<int64_t> received;
+  auto poller_work = [&num_done](int want) {
+    gpr_mu_lock(&g_mu);
+    while (num_done < want) {
+      gpr_mu_unlock(&g_mu);
+      auto result = g_event_poller->Work(24h, []() {});
+      ASSERT_FALSE(result == Poller::WorkResult::kDeadlineExceeded);
+      gpr_mu_lock(&g_mu);
+    }
+    gpr_mu_unlock(&g_mu);
+  };
+  auto on_done = [&num_done](absl::StatusOr<int64_t>* out) {
+    return [&num_done, out](absl::StatusOr<int64_t> result) {
+      gpr_mu_lock(&g_mu);
+      *out = std::move(result);
+      ++num_done;
+      g_event_poller->Kick();
+      gpr_mu_unlock(&g_mu);
+    };
+  };
+
+  char send_buf[] = "hello";
+  char recv_buf[sizeof(send_buf)] = {};
+  struct iovec send_iov = {send_buf, sizeof(send_buf)};
+  struct iovec recv_iov = {recv_buf, sizeof(recv_buf)};
+  struct msghdr send_msg = {};
+  send_msg.msg_iov = &send_iov;
+  send_msg.msg_iovlen = 1;
+  struct msghdr recv_msg = {};
+  recv_msg.msg_iov = &recv_iov;
+  recv_msg.msg_iovlen = 1;
+  // Post the receive first so that it has to wait for the data.
+  reader->AsyncIo()->RecvMsg(&recv_msg, on_done(&received));
+  writer->AsyncIo()->SendMsg(&send_msg, 0, on_done(&sent));
+  poller_work(2);
+  ASSERT_TRUE(sent.ok()) << sent.status();
+  EXPECT_EQ(*sent, static_cast<int64_t>(sizeof(send_buf)));
+  ASSERT_TRUE(received.ok()) << received.status();
+  EXPECT_EQ(*received, static_cast<int64_t>(sizeof(send_buf)));
+  EXPECT_STREQ(recv_buf, send_buf);
+
+  // Nothing more is sent, so this receive only completes on shutdown.
+  reader->AsyncIo()->RecvMsg(&recv_msg, on_done(&received));
+  reader->ShutdownHandle(absl::CancelledError("shutdown"));
+  poller_work(3);
+  EXPECT_TRUE(absl::IsCancelled(received.status())) << received.status();
+
+  reader->OrphanHandle(nullptr, nullptr, "");
+  writer->OrphanHandle(nullptr, nullptr, "");
+}
+
+TEST_F(EventPollerTest, TestEventPollerHandleRecvBuffers) {
+  int sv[2];
+  if (g_event_poller == nullptr) {
+    return;
+  }
+  EXPECT_EQ(socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, sv), 0);
+  EventHandle* reader = g_event_poller->CreateHandle(
+      g_event_poller->posix_interface().Adopt(sv[0]), "reader", false);
+  if (reader->AsyncIo() == nullptr ||
+      !reader->AsyncIo()->SupportsRecvBuffers()) {
+    reader->OrphanHandle(nullptr, nullptr, "");
+    close(sv[1]);
+    GTEST_SKIP() << g_event_poller->Name()
+                 << " does not support provided receive buffers";
+  }
+  int num_done = 0;
+  absl::StatusOr<int64_t> received;
+  auto poller_work = [&num_done](int want) {
+    gpr_mu_lock(&g_mu);
+    while (num_done < want) {
+      gpr_mu_unlock(&g_mu);
+      auto result = g_event_poller->Work(24h, []() {});
+      ASSERT_FALSE(result == Poller::WorkResult::kDeadlineExceeded);
+      gpr_mu_lock(&g_mu);
+    }
+    gpr_mu_unlock(&g_mu);
+  };
+  auto on_done = [&num_done, &received](absl::StatusOr<int64_t> result) {
+    gpr_mu_lock(&g_mu);
+    received = std::move(result);
+    ++num_done;
+    g_event_poller->Kick();
+    gpr_mu_unlock(&g_mu);
+  };
+
+  // Post the receive first so that it has to wait for the data.
+  SliceBuffer buffer;
+  reader->AsyncIo()->RecvBuffers(&buffer, on_done);
+  const std::string data = "hello";
+  ASSERT_EQ(write(sv[1], data.data(), data.size()),
+            static_cast<ssize_t>(data.size()));
+  poller_work(1);
+  ASSERT_TRUE(received.ok()) << received.status();
+  EXPECT_EQ(*received, static_cast<int64_t>(data.size()));
+  EXPECT_EQ(buffer.Length(), data.size());
+  std::string got(buffer.Length(), '\0');
+  buffer.MoveFirstNBytesIntoBuffer(buffer.Length(),
+                                   reinterpret_cast<uint8_t*>(&got[0]));
+  EXPECT_EQ(got, data);
+
+  // Nothing more is sent, so this receive only completes on shutdown.
+  reader->AsyncIo()->RecvBuffers(&buffer, on_done);
+  reader->ShutdownHandle(absl::CancelledError("shutdown"));
+  poller_work(2);
+  EXPECT_TRUE(absl::IsCancelled(received.status())) << received.status();
+
+  reader->OrphanHandle(nullptr, nullptr, "");
+  close(sv[1]);
+}
+
 std::atomic<int> kTotalActiveWakeupFdHandles{0};
 
 // A helper class representing one file descriptor. Its implemented using
@@ -79,6 +79,26 @@ TEST(LockFreeEventTest, BasicTest) {
   event.DestroyEvent();
 }
 
+TEST(LockFreeEventTest, SetReadyRunInlineTest) {
+  LockfreeEvent event(g_thread_pool);
+  event.InitEvent();
+  const std::thread::id caller = std::this_thread::get_id();
+  bool ran = false;
+  event.NotifyOn(PosixEngineClosure::TestOnlyToClosure(
+      [&ran, caller](absl::Status status) {
+        EXPECT_TRUE(status.ok());
+        EXPECT_EQ(std::this_thread::get_id(), caller);
+        ran = true;
+      }));
+  event.SetReady(/*run_inline=*/true);
+  EXPECT_TRUE(ran);
+  // With no closure waiting, the event is just marked ready.
+  ran = false;
+  event.SetReady(/*run_inline=*/true);
+  EXPECT_FALSE(ran);
+  event.DestroyEvent();
+}
+
 TEST(LockFreeEventTest, MultiThreadedTest) {
   std::vector<std::thread> threads;
   LockfreeEvent event(g_thread_pool);
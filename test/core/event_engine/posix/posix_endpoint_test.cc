@@ -17,9 +17,14 @@
 #include <grpc/event_engine/event_engine.h>
 #include <grpc/grpc.h>
 #include <grpc/impl/channel_arg_names.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <unistd.h>
 
 #include <algorithm>
+#include <cerrno>
 #include <chrono>
+#include <cstring>
 #include <list>
 #include <memory>
 #include <string>
@@ -32,15 +37,20 @@
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/event_engine/channel_args_endpoint_config.h"
 #include "src/core/lib/event_engine/poller.h"
+#include "src/core/lib/event_engine/posix_engine/ev_io_uring_linux.h"
 #include "src/core/lib/event_engine/posix_engine/event_poller.h"
 #include "src/core/lib/event_engine/posix_engine/event_poller_posix_default.h"
+#include "src/core/lib/event_engine/posix_engine/io_uring.h"
 #include "src/core/lib/event_engine/posix_engine/posix_engine.h"
 #include "src/core/lib/event_engine/posix_engine/posix_engine_closure.h"
 #include "src/core/lib/event_engine/posix_engine/tcp_socket_utils.h"
 #include "src/core/lib/event_engine/tcp_socket_utils.h"
+#include "src/core/lib/experiments/config.h"
 #include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/iomgr/event_engine_shims/endpoint.h"
 #include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
 #include "src/core/tsi/fake_transport_security.h"
 #include "src/core/tsi/transport_security_grpc.h"
 #include "src/core/util/dual_ref_counted.h"
@@ -106,6 +116,9 @@ std::list<Connection> CreateConnectedEndpoints(
     args = args.Set(GRPC_ARG_TCP_TX_ZEROCOPY_ENABLED, 1);
     args = args.Set(GRPC_ARG_TCP_TX_ZEROCOPY_SEND_BYTES_THRESHOLD,
                     kMinMessageSize);
+    args = args.Set(GRPC_ARG_TCP_RX_ZEROCOPY_ENABLED, 1);
+    args = args.Set(GRPC_ARG_TCP_RX_ZEROCOPY_RECV_BYTES_THRESHOLD,
+                    kMinMessageSize);
   }
   ChannelArgsEndpointConfig config(args);
   auto listener = oracle_ee->CreateListener(
@@ -203,13 +216,16 @@ class Worker : public grpc_core::DualRefCounted<Worker> {
 
 class PosixEndpointTestBase {
  public:
-  void SetUp() {
+  using MakePollerFn = std::shared_ptr<PosixEventPoller> (*)(
+      std::shared_ptr<ThreadPool>);
+
+  void SetUp(MakePollerFn make_poller = MakeDefaultPoller) {
     oracle_ee_ = std::make_shared<PosixOracleEventEngine>();
     thread_pool_ =
         std::make_shared<grpc_event_engine::experimental::TestThreadPool>(
             posix_ee_.get());
     EXPECT_NE(thread_pool_, nullptr);
-    poller_ = MakeDefaultPoller(thread_pool_);
+    poller_ = make_poller(thread_pool_);
     posix_ee_ = PosixEventEngine::MakeTestOnlyPosixEventEngine(poller_);
     EXPECT_NE(posix_ee_, nullptr);
     thread_pool_->ChangeCurrentEventEngine(posix_ee_.get());
@@ -341,6 +357,140 @@ TEST_P(PosixEndpointTest, MultipleIPv6ConnectionsToOneOracleListenerTest) {
 INSTANTIATE_TEST_SUITE_P(PosixEndpoint, PosixEndpointTest,
                          ::testing::ValuesIn({false, true}), &TestScenarioName);
 
+#ifdef GRPC_LINUX_TCP_ZEROCOPY_RECEIVE
+
+TEST(ZerocopyReceiveMappingTest, UnmapsWhenLastSliceIsReleased) {
+  const size_t length = 2 * sysconf(_SC_PAGESIZE);
+  void* address = mmap(nullptr, length, PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  ASSERT_NE(address, MAP_FAILED);
+  memset(address, 'a', length);
+  std::vector<unsigned char> residency(2);
+  Slice slice = (new ZerocopyReceiveMapping(address, length))->MakeSlice();
+  EXPECT_EQ(slice.begin(), address);
+  EXPECT_EQ(slice.length(), length);
+  Slice ref = slice.Ref();
+  slice = Slice();
+  // Still mapped while a slice refers to it.
+  EXPECT_EQ(mincore(address, length, residency.data()), 0);
+  EXPECT_EQ(ref[length - 1], 'a');
+  ref = Slice();
+  EXPECT_EQ(mincore(address, length, residency.data()), -1);
+  EXPECT_EQ(errno, ENOMEM);
+}
+
+class PosixEndpointRxZerocopyTest : public PosixEndpointTestBase,
+                                    public ::testing::Test {
+  void SetUp() override { PosixEndpointTestBase::SetUp(); }
+  void TearDown() override { PosixEndpointTestBase::TearDown(); }
+};
+
+// Whether the kernel lets TCP sockets be mapped for TCP_ZEROCOPY_RECEIVE.
+bool TcpSocketsCanBeMapped() {
+  const int fd = socket(AF_INET6, SOCK_STREAM, 0);
+  if (fd < 0) return false;
+  const size_t length = sysconf(_SC_PAGESIZE);
+  void* address = mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (address == MAP_FAILED) return false;
+  munmap(address, length);
+  return true;
+}
+
+// Every large read tries to map the received pages. Whatever the kernel does
+// not map, because it is not page aligned, is copied instead.
+TEST_F(PosixEndpointRxZerocopyTest, MapsOrCopiesLargeReads) {
+  if (PosixPoller() == nullptr) {
+    return;
+  }
+  if (!TcpSocketsCanBeMapped()) {
+    GTEST_SKIP() << "TCP sockets cannot be mapped";
+  }
+  auto before = grpc_core::global_stats().Collect();
+  Worker* worker = new Worker(GetPosixEE(), PosixPoller());
+  worker->Start();
+  {
+    auto connections = CreateConnectedEndpoints(*PosixPoller(), true, 1,
+                                                GetPosixEE(), GetOracleEE());
+    auto it = connections.begin();
+    // Only the client endpoint is a PosixEndpoint.
+    auto client_endpoint = std::move((*it).client_endpoint);
+    auto server_endpoint = std::move((*it).server_endpoint);
+    connections.erase(it);
+    std::string payload;
+    while (payload.size() < 1024 * 1024) payload += GetNextSendMessage();
+    for (int i = 0; i < 4; ++i) {
+      ASSERT_TRUE(SendValidatePayload(payload, server_endpoint.get(),
+                                      client_endpoint.get())
+                      .ok());
+    }
+  }
+  worker->Wait();
+  auto stats = grpc_core::global_stats().Collect()->Diff(*before);
+  const double mapped_reads =
+      stats->histogram(grpc_core::GlobalStats::Histogram::kTcpReadZerocopySize)
+          .Count();
+  EXPECT_GT(mapped_reads + stats->tcp_read_zerocopy_fallback, 0);
+}
+
+#endif  // GRPC_LINUX_TCP_ZEROCOPY_RECEIVE
+
+#ifdef GRPC_LINUX_IO_URING_BUF_RING
+
+// Reads through a buffer ring far smaller than the data exchanged, so that
+// the ring only keeps up if its buffers are recycled and runs dry when the
+// sender outpaces the reader.
+class PosixEndpointRecvBuffersTest : public PosixEndpointTestBase,
+                                     public ::testing::Test {
+  static constexpr uint32_t kNumRecvBuffers = 4;
+
+  void SetUp() override {
+    PosixEndpointTestBase::SetUp(
+        [](std::shared_ptr<ThreadPool> thread_pool)
+            -> std::shared_ptr<PosixEventPoller> {
+          return MakeIoUringPoller(std::move(thread_pool), kNumRecvBuffers);
+        });
+  }
+  void TearDown() override { PosixEndpointTestBase::TearDown(); }
+};
+
+TEST_F(PosixEndpointRecvBuffersTest, RecyclesBuffersAndFallsBackWhenEmpty) {
+  if (PosixPoller() == nullptr || !IoUringBufferRingSupported()) {
+    GTEST_SKIP() << "io_uring provided buffer rings are not supported";
+  }
+  // The kernel supports buffer rings, so reads must go through one.
+  ASSERT_TRUE(grpc_core::IsEventEngineIoUringProvidedBuffersEnabled());
+  auto before = grpc_core::global_stats().Collect();
+  Worker* worker = new Worker(GetPosixEE(), PosixPoller());
+  worker->Start();
+  {
+    auto connections = CreateConnectedEndpoints(*PosixPoller(), false, 1,
+                                                GetPosixEE(), GetOracleEE());
+    auto it = connections.begin();
+    // Only the client endpoint is a PosixEndpoint.
+    auto client_endpoint = std::move((*it).client_endpoint);
+    auto server_endpoint = std::move((*it).server_endpoint);
+    connections.erase(it);
+    std::string payload;
+    while (payload.size() < 1024 * 1024) payload += GetNextSendMessage();
+    for (int i = 0; i < 8; ++i) {
+      ASSERT_TRUE(SendValidatePayload(payload, server_endpoint.get(),
+                                      client_endpoint.get())
+                      .ok());
+    }
+  }
+  worker->Wait();
+  auto stats = grpc_core::global_stats().Collect()->Diff(*before);
+  // Reads that find half of the ring lent out copy their data, which only
+  // happens on the ring path.
+  EXPECT_GT(stats->io_uring_recv_buffer_copies, 0);
+  // A burst larger than the ring ends the multishot receive with ENOBUFS and
+  // the read is finished with recvmsg.
+  EXPECT_GT(stats->io_uring_recv_buffer_exhausted, 0);
+}
+
+#endif  // GRPC_LINUX_IO_URING_BUF_RING
+
 struct PosixSecureEndpointTestParams {
   bool has_leftover_bytes;
   bool use_zero_copy_protector;
@@ -569,6 +719,10 @@ int main(int argc, char** argv) {
     // Skip the test entirely if poll strategy is none.
     return 0;
   }
+  // PosixEndpointRecvBuffersTest needs the buffer ring. Other pollers ignore
+  // the experiment.
+  grpc_core::ForceEnableExperiment("event_engine_io_uring_provided_buffers",
+                                   true);
   // TODO(ctiller): EventEngine temporarily needs grpc to be initialized first
   // until we clear out the iomgr shutdown code.
   grpc_init();
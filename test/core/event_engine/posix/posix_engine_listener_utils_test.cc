@@ -186,6 +186,46 @@ TEST(PosixEngineListenerUtils, ListenerContainerIpv6LinkLocalTest) {
   EXPECT_FALSE(IsSockAddrLinkLocal(&resolved_addr6_not_ll2));
 }
 
+TEST(PosixEngineListenerUtils, CreateListenerSocketShardTest) {
+  if (!IsSocketReusePortSupported()) {
+    LOG(INFO) << "Skipping CreateListenerSocketShardTest because SO_REUSEPORT "
+                 "is not supported.";
+    return;
+  }
+  EventEnginePosixInterface posix_interface;
+  PosixTcpOptions options;
+  options.allow_reuse_port = true;
+  int port = grpc_pick_unused_port_or_die();
+  auto addr = URIToResolvedAddress(absl::StrCat("ipv4:127.0.0.1:", port));
+  ASSERT_TRUE(addr.ok());
+  auto primary =
+      CreateAndPrepareListenerSocket(&posix_interface, options, *addr);
+  ASSERT_TRUE(primary.ok()) << primary.status();
+  constexpr int kNumShards = 4;
+  std::list<ListenerSocketsContainer::ListenerSocket> shards;
+  for (int i = 1; i < kNumShards; ++i) {
+    auto shard = CreateListenerSocketShard(&posix_interface, options, *primary);
+    ASSERT_TRUE(shard.ok()) << shard.status();
+    EXPECT_EQ(shard->port, primary->port);
+    auto local = posix_interface.LocalAddress(shard->sock);
+    ASSERT_TRUE(local.ok());
+    EXPECT_EQ(ResolvedAddressGetPort(*local), primary->port);
+    shards.push_back(*shard);
+  }
+#ifdef GRPC_LINUX_REUSEPORT_CBPF
+  EXPECT_TRUE(
+      AttachReusePortCpuSteering(&posix_interface, *primary, kNumShards).ok());
+#endif  // GRPC_LINUX_REUSEPORT_CBPF
+  // Without SO_REUSEPORT the port can not be shared.
+  options.allow_reuse_port = false;
+  EXPECT_FALSE(
+      CreateListenerSocketShard(&posix_interface, options, *primary).ok());
+  for (auto& shard : shards) {
+    posix_interface.Close(shard.sock);
+  }
+  posix_interface.Close(primary->sock);
+}
+
 #ifdef GRPC_HAVE_IFADDRS
 TEST(PosixEngineListenerUtils, ListenerContainerAddAllLocalAddressesTest) {
   EventEnginePosixInterface posix_interface;
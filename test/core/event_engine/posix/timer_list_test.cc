@@ -25,6 +25,7 @@
 #include <vector>
 
 #include "src/core/lib/event_engine/posix_engine/timer.h"
+#include "src/core/lib/event_engine/posix_engine/timer_wheel.h"
 #include "src/core/util/time.h"
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
@@ -64,9 +65,15 @@ CheckResult FinishCheck(
   return CheckResult::kTimersFired;
 }
 
+template <typename T>
+class TimerListTest : public testing::Test {};
+
+using TimerListTypes = testing::Types<TimerList, TimerWheel>;
+TYPED_TEST_SUITE(TimerListTest, TimerListTypes);
+
 }  // namespace
 
-TEST(TimerListTest, Add) {
+TYPED_TEST(TimerListTest, Add) {
   Timer timers[20];
   StrictMock<MockClosure> closures[20];
 
@@ -75,7 +82,7 @@ TEST(TimerListTest, Add) {
 
   StrictMock<MockHost> host;
   EXPECT_CALL(host, Now()).WillOnce(Return(kStart));
-  TimerList timer_list(&host);
+  TypeParam timer_list(&host);
 
   // 10 ms timers.  will expire in the current epoch
   for (int i = 0; i < 10; i++) {
@@ -129,7 +136,7 @@ TEST(TimerListTest, Add) {
 }
 
 // Cleaning up a list with pending timers.
-TEST(TimerListTest, Destruction) {
+TYPED_TEST(TimerListTest, Destruction) {
   Timer timers[5];
   StrictMock<MockClosure> closures[5];
 
@@ -137,7 +144,7 @@ TEST(TimerListTest, Destruction) {
   EXPECT_CALL(host, Now())
       .WillOnce(
           Return(grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(0)));
-  TimerList timer_list(&host);
+  TypeParam timer_list(&host);
 
   EXPECT_CALL(host, Now())
       .WillOnce(
@@ -195,7 +202,7 @@ TEST(TimerListTest, Destruction) {
 //      step 1) to `now+4`
 //  4) Shuts down the timer list
 // https://github.com/grpc/grpc/issues/15904
-TEST(TimerListTest, LongRunningServiceCleanup) {
+TYPED_TEST(TimerListTest, LongRunningServiceCleanup) {
   Timer timers[4];
   StrictMock<MockClosure> closures[4];
 
@@ -204,7 +211,7 @@ TEST(TimerListTest, LongRunningServiceCleanup) {
 
   StrictMock<MockHost> host;
   EXPECT_CALL(host, Now()).WillOnce(Return(kStart));
-  TimerList timer_list(&host);
+  TypeParam timer_list(&host);
 
   EXPECT_CALL(host, Now()).WillOnce(Return(kStart));
   timer_list.TimerInit(&timers[0], kStart + k25Days, &closures[0]);
@@ -238,6 +245,50 @@ TEST(TimerListTest, LongRunningServiceCleanup) {
   EXPECT_TRUE(timer_list.TimerCancel(&timers[3]));
 }
 
+// Timers spread over several orders of magnitude fire in deadline order as
+// time advances, and report the next deadline once the earlier ones fire.
+TYPED_TEST(TimerListTest, FiresAcrossTimeScales) {
+  const int64_t kDelaysMs[] = {1, 63, 64, 65, 4095, 4097, 300000, 20000000};
+  constexpr size_t kNumTimers = sizeof(kDelaysMs) / sizeof(kDelaysMs[0]);
+  Timer timers[kNumTimers];
+  StrictMock<MockClosure> closures[kNumTimers];
+
+  const auto kStart =
+      grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(1000);
+
+  StrictMock<MockHost> host;
+  EXPECT_CALL(host, Now()).WillOnce(Return(kStart));
+  TypeParam timer_list(&host);
+
+  EXPECT_CALL(host, Kick()).Times(testing::AnyNumber());
+  for (size_t i = 0; i < kNumTimers; i++) {
+    EXPECT_CALL(host, Now()).WillOnce(Return(kStart));
+    timer_list.TimerInit(
+        &timers[i], kStart + grpc_core::Duration::Milliseconds(kDelaysMs[i]),
+        &closures[i]);
+  }
+
+  for (size_t i = 0; i < kNumTimers; i++) {
+    const auto deadline =
+        kStart + grpc_core::Duration::Milliseconds(kDelaysMs[i]);
+    // Just before the deadline, nothing fires.
+    EXPECT_CALL(host, Now())
+        .WillOnce(Return(deadline - grpc_core::Duration::Milliseconds(1)));
+    EXPECT_NE(FinishCheck(timer_list.TimerCheck(nullptr)),
+              CheckResult::kTimersFired);
+    EXPECT_CALL(host, Now()).WillOnce(Return(deadline));
+    EXPECT_CALL(closures[i], Run());
+    grpc_core::Timestamp next = grpc_core::Timestamp::InfFuture();
+    EXPECT_EQ(FinishCheck(timer_list.TimerCheck(&next)),
+              CheckResult::kTimersFired);
+    Mock::VerifyAndClearExpectations(&closures[i]);
+    if (i + 1 < kNumTimers) {
+      EXPECT_LE(next,
+                kStart + grpc_core::Duration::Milliseconds(kDelaysMs[i + 1]));
+    }
+  }
+}
+
 }  // namespace experimental
 }  // namespace grpc_event_engine
 
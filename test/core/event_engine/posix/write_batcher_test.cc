@@ -0,0 +1,161 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/event_engine/posix_engine/write_batcher.h"
+
+#include <grpc/event_engine/event_engine.h>
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "src/core/lib/event_engine/thread_pool/thread_pool.h"
+#include "absl/functional/any_invocable.h"
+#include "gtest/gtest.h"
+
+namespace grpc_event_engine::experimental {
+namespace {
+
+// Holds closures until the test runs them.
+class ManualThreadPool final : public ThreadPool {
+ public:
+  void Quiesce() override {}
+  void Run(absl::AnyInvocable<void()> callback) override {
+    closures_.push_back(std::move(callback));
+  }
+  void Run(EventEngine::Closure* closure) override {
+    Run([closure]() { closure->Run(); });
+  }
+#if GRPC_ENABLE_FORK_SUPPORT
+  void PrepareFork() override {}
+  void PostFork() override {}
+#endif  // GRPC_ENABLE_FORK_SUPPORT
+
+  size_t pending() const { return closures_.size(); }
+  void RunAll() {
+    auto closures = std::move(closures_);
+    closures_.clear();
+    for (auto& closure : closures) closure();
+  }
+
+ private:
+  std::vector<absl::AnyInvocable<void()>> closures_;
+};
+
+TEST(WriteBatcherTest, WritesAddedBeforeTheFlushRunTogether) {
+  ManualThreadPool pool;
+  int end_batch_calls = 0;
+  auto batcher = std::make_shared<WriteBatcher>(
+      &pool, [&end_batch_calls]() { ++end_batch_calls; });
+  int writes = 0;
+  for (int i = 0; i < 10; ++i) {
+    batcher->Add([&writes, b = batcher.get()]() {
+      ++writes;
+      EXPECT_TRUE(WriteBatcher::DeferSubmit(b));
+    });
+  }
+  // Only the first write schedules a flush.
+  EXPECT_EQ(pool.pending(), 1u);
+  EXPECT_EQ(writes, 0);
+  pool.RunAll();
+  EXPECT_EQ(writes, 10);
+  EXPECT_EQ(end_batch_calls, 1);
+}
+
+TEST(WriteBatcherTest, NoEndBatchWithoutDeferredSubmissions) {
+  ManualThreadPool pool;
+  int end_batch_calls = 0;
+  auto batcher = std::make_shared<WriteBatcher>(
+      &pool, [&end_batch_calls]() { ++end_batch_calls; });
+  int writes = 0;
+  batcher->Add([&writes]() { ++writes; });
+  pool.RunAll();
+  EXPECT_EQ(writes, 1);
+  EXPECT_EQ(end_batch_calls, 0);
+}
+
+TEST(WriteBatcherTest, DeferSubmitOutsideAFlush) {
+  ManualThreadPool pool;
+  auto batcher = std::make_shared<WriteBatcher>(&pool, nullptr);
+  auto other = std::make_shared<WriteBatcher>(&pool, nullptr);
+  EXPECT_FALSE(WriteBatcher::DeferSubmit(batcher.get()));
+  EXPECT_FALSE(WriteBatcher::DeferSubmit(nullptr));
+  bool ran = false;
+  batcher->Add([&ran, other = other.get()]() {
+    // Sends on another poller are not covered by this batch.
+    EXPECT_FALSE(WriteBatcher::DeferSubmit(other));
+    ran = true;
+  });
+  pool.RunAll();
+  EXPECT_TRUE(ran);
+}
+
+TEST(WriteBatcherTest, ExplicitFlushTakesTheBatch) {
+  ManualThreadPool pool;
+  auto batcher = std::make_shared<WriteBatcher>(&pool, nullptr);
+  int writes = 0;
+  batcher->Add([&writes]() { ++writes; });
+  batcher->Add([&writes]() { ++writes; });
+  batcher->Flush();
+  EXPECT_EQ(writes, 2);
+  // The scheduled flush finds nothing left to do.
+  pool.RunAll();
+  EXPECT_EQ(writes, 2);
+  // A new write schedules a new flush.
+  batcher->Add([&writes]() { ++writes; });
+  EXPECT_EQ(pool.pending(), 1u);
+  pool.RunAll();
+  EXPECT_EQ(writes, 3);
+}
+
+TEST(WriteBatcherTest, WritesAddedDuringAFlushRunInTheNextOne) {
+  ManualThreadPool pool;
+  auto batcher = std::make_shared<WriteBatcher>(&pool, nullptr);
+  int writes = 0;
+  batcher->Add([&writes, b = batcher.get()]() {
+    ++writes;
+    b->Add([&writes]() { ++writes; });
+  });
+  pool.RunAll();
+  EXPECT_EQ(writes, 1);
+  EXPECT_EQ(pool.pending(), 1u);
+  pool.RunAll();
+  EXPECT_EQ(writes, 2);
+}
+
+TEST(WriteBatcherTest, FlushAfterShutdownSkipsEndBatch) {
+  ManualThreadPool pool;
+  int end_batch_calls = 0;
+  auto batcher = std::make_shared<WriteBatcher>(
+      &pool, [&end_batch_calls]() { ++end_batch_calls; });
+  int writes = 0;
+  batcher->Add([&writes, b = batcher.get()]() {
+    ++writes;
+    EXPECT_TRUE(WriteBatcher::DeferSubmit(b));
+  });
+  // The scheduled flush keeps the batcher alive past its owner.
+  batcher->Shutdown();
+  batcher.reset();
+  pool.RunAll();
+  EXPECT_EQ(writes, 1);
+  EXPECT_EQ(end_batch_calls, 0);
+}
+
+}  // namespace
+}  // namespace grpc_event_engine::experimental
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
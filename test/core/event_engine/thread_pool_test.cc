@@ -22,16 +22,19 @@
 #include <cstddef>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <thread>
 #include <tuple>
 #include <vector>
 
+#include "src/core/lib/event_engine/thread_pool/cpu_topology.h"
 #include "src/core/lib/event_engine/thread_pool/thread_count.h"
 #include "src/core/lib/event_engine/thread_pool/work_stealing_thread_pool.h"
 #include "src/core/util/notification.h"
 #include "src/core/util/thd.h"
 #include "src/core/util/time.h"
 #include "test/core/test_util/test_config.h"
+#include "gmock/gmock.h"
 #include "gtest/gtest.h"
 #include "absl/time/clock.h"
 #include "absl/time/time.h"
@@ -475,6 +478,65 @@ TEST_F(LivingThreadCountTest, BlockUntilThreadCountTest) {
   ASSERT_EQ(living_thread_count.count(), 0);
 }
 
+TEST(CpuTopologyTest, ParsesCpuLists) {
+  EXPECT_THAT(ParseCpuList("0-3,8,10-11\n"),
+              ::testing::Optional(
+                  ::testing::ElementsAre(0, 1, 2, 3, 8, 10, 11)));
+  EXPECT_THAT(ParseCpuList(""), ::testing::Optional(::testing::IsEmpty()));
+  EXPECT_EQ(ParseCpuList("3-"), std::nullopt);
+  EXPECT_EQ(ParseCpuList("5-2"), std::nullopt);
+  EXPECT_EQ(ParseCpuList("a"), std::nullopt);
+}
+
+TEST(CpuTopologyTest, OrdersOtherNodesByDistance) {
+  CpuTopology topology({{0, 1}, {2, 3}, {}, {4, 5}},
+                       {{10, 30, 20, 20},
+                        {30, 10, 20, 20},
+                        {20, 20, 10, 20},
+                        {20, 20, 20, 10}});
+  // The node without CPUs is dropped.
+  ASSERT_EQ(topology.num_nodes(), 3);
+  EXPECT_EQ(topology.NodeForCpu(3), 1);
+  EXPECT_EQ(topology.NodeForCpu(5), 2);
+  EXPECT_EQ(topology.NodeForCpu(42), 0);
+  EXPECT_THAT(topology.OtherNodes(0), ::testing::ElementsAre(2, 1));
+  EXPECT_THAT(topology.OtherNodes(1), ::testing::ElementsAre(2, 0));
+  EXPECT_THAT(topology.OtherNodes(2), ::testing::ElementsAre(0, 1));
+}
+
+TEST(CpuTopologyTest, DetectFindsAtLeastOneCpu) {
+  CpuTopology topology = CpuTopology::Detect();
+  ASSERT_GE(topology.num_nodes(), 1);
+  EXPECT_FALSE(topology.cpus(0).empty());
+  EXPECT_LT(topology.CurrentNode(), topology.num_nodes());
+}
+
+class ThreadPoolAffinityTest
+    : public testing::TestWithParam<WorkStealingThreadPool::ThreadAffinity> {};
+
+TEST_P(ThreadPoolAffinityTest, RunsAllClosures) {
+  constexpr int kClosureCount = 10000;
+  WorkStealingThreadPool p(8, GetParam());
+  std::atomic<int> runcount{0};
+  grpc_core::Notification done;
+  for (int i = 0; i < kClosureCount; i++) {
+    p.Run([&] {
+      if (runcount.fetch_add(1) + 1 == kClosureCount) done.Notify();
+    });
+  }
+  done.WaitForNotification();
+  auto stats = p.GetNodeStats();
+  ASSERT_FALSE(stats.empty());
+  for (const auto& node : stats) EXPECT_FALSE(node.cpus.empty());
+  p.Quiesce();
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    ThreadPoolAffinityTest, ThreadPoolAffinityTest,
+    ::testing::Values(WorkStealingThreadPool::ThreadAffinity::kNone,
+                      WorkStealingThreadPool::ThreadAffinity::kNumaNode,
+                      WorkStealingThreadPool::ThreadAffinity::kCore));
+
 }  // namespace experimental
 }  // namespace grpc_event_engine
 
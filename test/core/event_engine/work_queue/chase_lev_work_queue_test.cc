@@ -0,0 +1,175 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "src/core/lib/event_engine/work_queue/chase_lev_work_queue.h"
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "src/core/lib/event_engine/common_closures.h"
+#include "src/core/lib/event_engine/work_queue/basic_work_queue.h"
+#include "test/core/test_util/test_config.h"
+#include "gtest/gtest.h"
+
+namespace {
+using ::grpc_event_engine::experimental::AnyInvocableClosure;
+using ::grpc_event_engine::experimental::BasicWorkQueue;
+using ::grpc_event_engine::experimental::ChaseLevWorkQueue;
+using ::grpc_event_engine::experimental::EventEngine;
+
+TEST(ChaseLevWorkQueueTest, StartsEmpty) {
+  ChaseLevWorkQueue queue;
+  ASSERT_TRUE(queue.Empty());
+  ASSERT_EQ(queue.PopMostRecent(), nullptr);
+  ASSERT_EQ(queue.PopOldest(), nullptr);
+}
+
+TEST(ChaseLevWorkQueueTest, TakesClosures) {
+  ChaseLevWorkQueue queue;
+  bool ran = false;
+  AnyInvocableClosure closure([&ran] { ran = true; });
+  queue.Add(&closure);
+  ASSERT_FALSE(queue.Empty());
+  EventEngine::Closure* popped = queue.PopMostRecent();
+  ASSERT_NE(popped, nullptr);
+  popped->Run();
+  ASSERT_TRUE(ran);
+  ASSERT_TRUE(queue.Empty());
+}
+
+TEST(ChaseLevWorkQueueTest, TakesAnyInvocables) {
+  ChaseLevWorkQueue queue;
+  bool ran = false;
+  queue.Add([&ran] { ran = true; });
+  ASSERT_FALSE(queue.Empty());
+  EventEngine::Closure* popped = queue.PopMostRecent();
+  ASSERT_NE(popped, nullptr);
+  popped->Run();
+  ASSERT_TRUE(ran);
+  ASSERT_TRUE(queue.Empty());
+}
+
+TEST(ChaseLevWorkQueueTest, PopMostRecentIsLIFO) {
+  ChaseLevWorkQueue queue;
+  int flag = 0;
+  queue.Add([&flag] { flag |= 1; });
+  queue.Add([&flag] { flag |= 2; });
+  queue.PopMostRecent()->Run();
+  EXPECT_FALSE(flag & 1);
+  EXPECT_TRUE(flag & 2);
+  queue.PopMostRecent()->Run();
+  EXPECT_TRUE(flag & 1);
+  EXPECT_TRUE(flag & 2);
+  ASSERT_TRUE(queue.Empty());
+}
+
+TEST(ChaseLevWorkQueueTest, PopOldestIsFIFO) {
+  ChaseLevWorkQueue queue;
+  int flag = 0;
+  queue.Add([&flag] { flag |= 1; });
+  queue.Add([&flag] { flag |= 2; });
+  queue.PopOldest()->Run();
+  EXPECT_TRUE(flag & 1);
+  EXPECT_FALSE(flag & 2);
+  queue.PopOldest()->Run();
+  EXPECT_TRUE(flag & 1);
+  EXPECT_TRUE(flag & 2);
+  ASSERT_TRUE(queue.Empty());
+}
+
+TEST(ChaseLevWorkQueueTest, WrapsAround) {
+  ChaseLevWorkQueue queue(nullptr, nullptr, /*capacity=*/4);
+  AnyInvocableClosure closure([] {});
+  for (int i = 0; i < 100; i++) {
+    queue.Add(&closure);
+    queue.Add(&closure);
+    ASSERT_EQ(queue.Size(), 2u);
+    ASSERT_NE(queue.PopOldest(), nullptr);
+    ASSERT_NE(queue.PopMostRecent(), nullptr);
+    ASSERT_TRUE(queue.Empty());
+  }
+}
+
+TEST(ChaseLevWorkQueueTest, SpillsToOverflowWhenFull) {
+  BasicWorkQueue overflow;
+  ChaseLevWorkQueue queue(nullptr, &overflow, /*capacity=*/4);
+  AnyInvocableClosure closure([] {});
+  for (int i = 0; i < 6; i++) queue.Add(&closure);
+  EXPECT_EQ(queue.Size(), 4u);
+  EXPECT_EQ(overflow.Size(), 2u);
+  while (queue.PopMostRecent() != nullptr) {
+  }
+  while (overflow.PopMostRecent() != nullptr) {
+  }
+}
+
+// One owner adds and pops while many thieves steal. Every closure must run
+// exactly once.
+TEST(ChaseLevWorkQueueTest, ThreadedStealStress) {
+  constexpr int kThiefCount = 8;
+  constexpr int kElementCount = 100000;
+  BasicWorkQueue overflow;
+  ChaseLevWorkQueue queue(nullptr, &overflow, /*capacity=*/64);
+  std::atomic<int> run_count{0};
+  std::atomic<bool> done{false};
+  class CountingClosure : public EventEngine::Closure {
+   public:
+    explicit CountingClosure(std::atomic<int>* run_count)
+        : run_count_(run_count) {}
+    void Run() override {
+      run_count_->fetch_add(1, std::memory_order_relaxed);
+      delete this;
+    }
+
+   private:
+    std::atomic<int>* run_count_;
+  };
+  std::vector<std::thread> thieves;
+  thieves.reserve(kThiefCount);
+  for (int i = 0; i < kThiefCount; i++) {
+    thieves.emplace_back([&] {
+      while (!done.load(std::memory_order_acquire)) {
+        if (auto* c = queue.PopOldest()) c->Run();
+      }
+    });
+  }
+  for (int i = 0; i < kElementCount; i++) {
+    queue.Add(new CountingClosure(&run_count));
+    if (i % 3 == 0) {
+      if (auto* c = queue.PopMostRecent()) c->Run();
+    }
+  }
+  while (auto* c = queue.PopMostRecent()) c->Run();
+  while (run_count.load(std::memory_order_relaxed) + overflow.Size() <
+         static_cast<size_t>(kElementCount)) {
+    // Wait for thieves to finish running what they took.
+  }
+  done.store(true, std::memory_order_release);
+  for (auto& thd : thieves) thd.join();
+  while (auto* c = overflow.PopMostRecent()) c->Run();
+  EXPECT_TRUE(queue.Empty());
+  EXPECT_EQ(run_count.load(), kElementCount);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  auto result = RUN_ALL_TESTS();
+  return result;
+}
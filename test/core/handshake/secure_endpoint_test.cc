@@ -20,6 +20,7 @@
 
 #include <fcntl.h>
 #include <grpc/grpc.h>
+#include <grpc/impl/channel_arg_names.h>
 #include <grpc/support/alloc.h>
 #include <sys/types.h>
 
@@ -334,6 +335,19 @@ TEST(SecureEndpointTest, MainTest) {
   gpr_free(g_pollset);
 }
 
+TEST(SecureEndpointTest, KernelTlsOffloadIsNotCombinedWithTxZerocopy) {
+  const grpc_core::ChannelArgs args =
+      grpc_core::ChannelArgs().Set(GRPC_ARG_KERNEL_TLS_OFFLOAD, true);
+  EXPECT_TRUE(grpc_secure_endpoint_kernel_tls_offload_enabled(args));
+  EXPECT_FALSE(grpc_secure_endpoint_kernel_tls_offload_enabled(
+      args.Remove(GRPC_ARG_KERNEL_TLS_OFFLOAD)));
+  EXPECT_TRUE(grpc_secure_endpoint_kernel_tls_offload_enabled(
+      args.Set(GRPC_ARG_TCP_TX_ZEROCOPY_ENABLED, 0)));
+  // Kernel TLS would fail every zerocopy send.
+  EXPECT_FALSE(grpc_secure_endpoint_kernel_tls_offload_enabled(
+      args.Set(GRPC_ARG_TCP_TX_ZEROCOPY_ENABLED, 1)));
+}
+
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(&argc, argv);
   ::testing::InitGoogleTest(&argc, argv);
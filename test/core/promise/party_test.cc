@@ -37,6 +37,8 @@
 #include "src/core/lib/resource_quota/arena.h"
 #include "src/core/lib/resource_quota/memory_quota.h"
 #include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
 #include "src/core/util/json/json_writer.h"
 #include "src/core/util/notification.h"
 #include "src/core/util/ref_counted_ptr.h"
@@ -150,6 +152,48 @@ auto MakeOnDone(std::string& execution_order) {
   };
 }
 
+TEST_F(PartyTest, RecyclesParticipants) {
+#ifdef GRPC_ASAN_ENABLED
+  GTEST_SKIP() << "participants are heap allocated under ASAN";
+#endif
+  // Participants are allocated in the blocks freed by earlier ones, whichever
+  // thread they completed on.
+  auto party = MakeParty();
+  auto before = global_stats().Collect();
+  for (int i = 0; i < kLargeNumSpawns; ++i) {
+    Notification n;
+    party->Spawn(
+        "TestSpawn", []() -> Poll<int> { return 42; },
+        [&n](int x) {
+          EXPECT_EQ(x, 42);
+          n.Notify();
+        });
+    n.WaitForNotification();
+  }
+  auto stats = global_stats().Collect()->Diff(*before);
+  EXPECT_GE(stats->party_participants_allocated,
+            static_cast<uint64_t>(kLargeNumSpawns));
+  EXPECT_GT(stats->party_participants_recycled, 0u);
+}
+
+TEST_F(PartyTest, SharedParticipantPoolIsBounded) {
+  // Participants allocated on one thread and freed on another, which then
+  // exits, are not all kept for reuse.
+  constexpr size_t kBlocks = 10000;
+  std::vector<void*> blocks;
+  std::thread([&blocks] {
+    for (size_t i = 0; i < kBlocks; ++i) {
+      blocks.push_back(party_detail::AllocateParticipant(64));
+    }
+  }).join();
+  std::thread([&blocks] {
+    for (void* block : blocks) party_detail::FreeParticipant(block, 64);
+  }).join();
+  // The pool keeps up to 16 batches of fewer than 64 blocks of each of the 5
+  // block sizes.
+  EXPECT_LE(party_detail::SharedParticipantBlocks(), 5u * 16 * 64);
+}
+
 TEST_F(PartyTest, TestLargeNumberOfSpawnedPromises) {
   // This test spawns a large number of Promises on the same Party.
   // This test asserts the following:
@@ -118,7 +118,8 @@ bool MockEndpoint::Read(absl::AnyInvocable<void(absl::Status)> on_read,
 
 bool MockEndpoint::Write(absl::AnyInvocable<void(absl::Status)> on_writable,
                          SliceBuffer* data, WriteArgs /* args */) {
-  // No-op implementation. Nothing was using it.
+  // Only counts the write.
+  endpoint_control_->writes_.fetch_add(1, std::memory_order_relaxed);
   data->Clear();
   endpoint_control_->engine()->Run(
       [cb = std::move(on_writable)]() mutable { cb(absl::OkStatus()); });
@@ -22,6 +22,8 @@
 #include <grpc/event_engine/event_engine.h>
 #include <grpc/slice.h>
 
+#include <atomic>
+#include <cstddef>
 #include <memory>
 
 #include "src/core/lib/iomgr/endpoint.h"
@@ -53,11 +55,16 @@ class MockEndpointController
 
   // ---- accessors ----
   EventEngine* engine() { return engine_.get(); }
+  // Number of writes made to the endpoint so far.
+  size_t writes() const { return writes_.load(std::memory_order_relaxed); }
 
  private:
+  friend class MockEndpoint;
+
   explicit MockEndpointController(std::shared_ptr<EventEngine> engine);
 
   std::shared_ptr<EventEngine> engine_;
+  std::atomic<size_t> writes_{0};
   grpc_core::Mutex mu_;
   bool reads_done_ ABSL_GUARDED_BY(mu_) = false;
   SliceBuffer read_buffer_ ABSL_GUARDED_BY(mu_);
@@ -0,0 +1,157 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/chaotic_good/message_reassembly.h"
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "src/core/lib/promise/status_flag.h"
+#include "test/core/promise/poll_matcher.h"
+#include "gtest/gtest.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+
+namespace grpc_core {
+namespace chaotic_good {
+namespace {
+
+constexpr uint32_t kStreamId = 1;
+
+// Collects the messages pushed into a call, and whether it failed. Copies
+// share their state.
+struct Sink {
+  struct State {
+    std::vector<std::string> messages;
+    bool failed = false;
+  };
+  std::shared_ptr<State> state = std::make_shared<State>();
+
+  auto PushMessage(MessageHandle message) {
+    state->messages.push_back(message->payload()->JoinIntoString());
+    return []() -> Poll<StatusFlag> { return Success{}; };
+  }
+  void FailCall(absl::string_view) { state->failed = true; }
+};
+
+// A message chunk whose payload is still arriving, as if on a data
+// connection, until Arrive or Fail is called.
+class Chunk {
+ public:
+  explicit Chunk(absl::string_view payload)
+      : frame_(kStreamId, SliceBuffer(Slice::FromCopiedString(payload))) {}
+
+  IncomingFrame Incoming() {
+    return IncomingFrame(
+        frame_.MakeHeader(),
+        Promise<absl::StatusOr<SliceBuffer>>(
+            [payload = payload_]() -> Poll<absl::StatusOr<SliceBuffer>> {
+              if (!payload->has_value()) return Pending{};
+              return std::move(**payload);
+            }));
+  }
+
+  void Arrive() {
+    SliceBuffer payload;
+    frame_.SerializePayload(payload);
+    *payload_ = std::move(payload);
+  }
+  void Fail() { *payload_ = absl::UnavailableError("data connection lost"); }
+
+ private:
+  MessageChunkFrame frame_;
+  std::shared_ptr<std::optional<absl::StatusOr<SliceBuffer>>> payload_ =
+      std::make_shared<std::optional<absl::StatusOr<SliceBuffer>>>();
+};
+
+BeginMessageFrame BeginMessage(uint64_t length) {
+  BeginMessageFrame frame;
+  frame.stream_id = kStreamId;
+  frame.body.set_length(length);
+  return frame;
+}
+
+TEST(MessageReassemblyTest, GathersPayloadsArrivingOutOfOrder) {
+  MessageReassembly reassembly;
+  Sink sink;
+  EXPECT_THAT(reassembly.PushFrameInto(BeginMessage(12), sink)(),
+              IsReady(Success{}));
+  Chunk first("1234"), second("5678"), third("abcd");
+  // Chunks before the last are accepted without waiting for their payloads.
+  EXPECT_THAT(reassembly.PushChunkInto(first.Incoming(), sink)(),
+              IsReady(Success{}));
+  EXPECT_THAT(reassembly.PushChunkInto(second.Incoming(), sink)(),
+              IsReady(Success{}));
+  auto last = reassembly.PushChunkInto(third.Incoming(), sink);
+  EXPECT_TRUE(reassembly.in_message_boundary());
+  third.Arrive();
+  EXPECT_THAT(last(), IsPending());
+  first.Arrive();
+  EXPECT_THAT(last(), IsPending());
+  second.Arrive();
+  EXPECT_THAT(last(), IsReady(Success{}));
+  EXPECT_EQ(sink.state->messages, std::vector<std::string>{"12345678abcd"});
+  EXPECT_FALSE(sink.state->failed);
+}
+
+TEST(MessageReassemblyTest, FailsCallWhenAPayloadFails) {
+  MessageReassembly reassembly;
+  Sink sink;
+  EXPECT_THAT(reassembly.PushFrameInto(BeginMessage(8), sink)(),
+              IsReady(Success{}));
+  Chunk first("1234"), second("5678");
+  EXPECT_THAT(reassembly.PushChunkInto(first.Incoming(), sink)(),
+              IsReady(Success{}));
+  auto last = reassembly.PushChunkInto(second.Incoming(), sink);
+  second.Arrive();
+  EXPECT_THAT(last(), IsPending());
+  first.Fail();
+  EXPECT_THAT(last(), IsReady(Failure{}));
+  EXPECT_TRUE(sink.state->messages.empty());
+  EXPECT_TRUE(sink.state->failed);
+}
+
+TEST(MessageReassemblyTest, RejectsChunkWithoutBeginMessage) {
+  MessageReassembly reassembly;
+  Sink sink;
+  Chunk chunk("1234");
+  EXPECT_THAT(reassembly.PushChunkInto(chunk.Incoming(), sink)(),
+              IsReady(Failure{}));
+  EXPECT_TRUE(sink.state->failed);
+}
+
+TEST(MessageReassemblyTest, RejectsChunksLongerThanDeclared) {
+  MessageReassembly reassembly;
+  Sink sink;
+  EXPECT_THAT(reassembly.PushFrameInto(BeginMessage(6), sink)(),
+              IsReady(Success{}));
+  Chunk first("1234"), second("5678");
+  EXPECT_THAT(reassembly.PushChunkInto(first.Incoming(), sink)(),
+              IsReady(Success{}));
+  EXPECT_THAT(reassembly.PushChunkInto(second.Incoming(), sink)(),
+              IsReady(Failure{}));
+  EXPECT_TRUE(sink.state->failed);
+}
+
+}  // namespace
+}  // namespace chaotic_good
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
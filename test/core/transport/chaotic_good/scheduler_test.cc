@@ -0,0 +1,98 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/chaotic_good/scheduler.h"
+
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <vector>
+
+#include "src/core/ext/transport/chaotic_good/send_rate.h"
+#include "src/core/ext/transport/chaotic_good/tcp_ztrace_collector.h"
+#include "gtest/gtest.h"
+
+namespace grpc_core {
+namespace chaotic_good {
+namespace {
+
+constexpr uint64_t kChunkSize = 1024 * 1024;
+
+struct TestChannel {
+  bool ready;
+  double start_time;
+  double bytes_per_second;
+};
+
+// Places chunks of kChunkSize on channels in one scheduling step, and returns
+// how many went to each channel, stopping at the first that is held back.
+std::map<uint32_t, int> PlaceChunks(Scheduler& scheduler,
+                                    const std::vector<TestChannel>& channels,
+                                    int chunks) {
+  TcpZTraceCollector ztrace_collector;
+  scheduler.NewStep(chunks * kChunkSize, kChunkSize);
+  for (uint32_t id = 0; id < channels.size(); ++id) {
+    SendRate::DeliveryData delivery_data{};
+    delivery_data.start_time = channels[id].start_time;
+    delivery_data.bytes_per_second = channels[id].bytes_per_second;
+    scheduler.AddChannel(id, channels[id].ready, delivery_data);
+  }
+  scheduler.MakePlan(ztrace_collector);
+  std::map<uint32_t, int> placed;
+  for (int i = 0; i < chunks; ++i) {
+    std::optional<uint32_t> id = scheduler.AllocateMessage(kChunkSize);
+    if (!id.has_value()) break;
+    ++placed[*id];
+  }
+  return placed;
+}
+
+TEST(StripeSchedulerTest, SplitsInProportionToRate) {
+  auto scheduler = MakeScheduler("stripe");
+  EXPECT_EQ(PlaceChunks(*scheduler,
+                        {{true, 0, 3 * kChunkSize}, {true, 0, kChunkSize}}, 8),
+            (std::map<uint32_t, int>{{0, 6}, {1, 2}}));
+}
+
+TEST(StripeSchedulerTest, AccountsForQueuedBytes) {
+  auto scheduler = MakeScheduler("stripe");
+  // The first channel takes 2.5 seconds to deliver what it has queued.
+  EXPECT_EQ(
+      PlaceChunks(*scheduler, {{true, 2.5, kChunkSize}, {true, 0, kChunkSize}},
+                  4),
+      (std::map<uint32_t, int>{{0, 1}, {1, 3}}));
+}
+
+TEST(StripeSchedulerTest, WaitsForFasterChannelThatIsNotReady) {
+  auto scheduler = MakeScheduler("stripe");
+  EXPECT_EQ(PlaceChunks(*scheduler,
+                        {{false, 0, 10 * kChunkSize}, {true, 0, kChunkSize}},
+                        1),
+            (std::map<uint32_t, int>{}));
+}
+
+TEST(StripeSchedulerTest, ChannelWithoutRateCountsAsFast) {
+  auto scheduler = MakeScheduler("stripe");
+  EXPECT_EQ(PlaceChunks(*scheduler, {{true, 1, kChunkSize}, {true, 0, 0}}, 2),
+            (std::map<uint32_t, int>{{1, 2}}));
+}
+
+}  // namespace
+}  // namespace chaotic_good
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,273 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/chaotic_good/shared_memory.h"
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <utility>
+
+#include "src/core/ext/transport/chaotic_good/chaotic_good_frame.pb.h"
+#include "src/core/lib/event_engine/tcp_socket_utils.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/lib/slice/slice_buffer.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "gtest/gtest.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+
+#ifdef GPR_LINUX
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace grpc_core {
+namespace chaotic_good {
+namespace {
+
+using grpc_event_engine::experimental::EventEngine;
+using grpc_event_engine::experimental::URIToResolvedAddress;
+
+constexpr uint32_t kRingSize = 4096;
+
+EventEngine::ResolvedAddress Address(absl::string_view uri) {
+  auto address = URIToResolvedAddress(std::string(uri));
+  EXPECT_TRUE(address.ok()) << address.status();
+  return *address;
+}
+
+SliceBuffer Payload(size_t length, char fill) {
+  SliceBuffer payload;
+  payload.Append(Slice::FromCopiedString(std::string(length, fill)));
+  return payload;
+}
+
+TEST(SharedMemoryTest, OnlyLocalPeersShareMemory) {
+  EXPECT_TRUE(SharedMemorySegment::IsLocalPeer(Address("ipv4:127.0.0.1:1")));
+  EXPECT_TRUE(SharedMemorySegment::IsLocalPeer(Address("ipv4:127.1.2.3:1")));
+  EXPECT_TRUE(SharedMemorySegment::IsLocalPeer(Address("ipv6:[::1]:1")));
+  EXPECT_TRUE(
+      SharedMemorySegment::IsLocalPeer(Address("ipv6:[::ffff:127.0.0.1]:1")));
+  EXPECT_FALSE(SharedMemorySegment::IsLocalPeer(Address("ipv4:10.0.0.1:1")));
+  EXPECT_FALSE(SharedMemorySegment::IsLocalPeer(Address("ipv6:[::2]:1")));
+  EXPECT_FALSE(
+      SharedMemorySegment::IsLocalPeer(Address("ipv6:[::ffff:10.0.0.1]:1")));
+}
+
+#ifdef GPR_LINUX
+
+// A segment created by one end, and the same segment attached by the other.
+class SharedMemoryRingTest : public ::testing::Test {
+ protected:
+  SharedMemoryRingTest() {
+    auto segment = SharedMemorySegment::Create(kRingSize);
+    EXPECT_TRUE(segment.ok()) << segment.status();
+    creator_ = std::move(*segment);
+    chaotic_good_frame::Settings::SharedMemory offer;
+    creator_->PrepareOffer(offer);
+    segment = SharedMemorySegment::Attach(Address("ipv4:127.0.0.1:1"), offer,
+                                          kRingSize);
+    EXPECT_TRUE(segment.ok()) << segment.status();
+    peer_ = std::move(*segment);
+  }
+
+  // Writes a payload of length bytes from the creator, and reads it back on
+  // the peer.
+  std::optional<uint64_t> Write(size_t length, char fill) {
+    SliceBuffer payload = Payload(length, fill);
+    return creator_->Write(payload, 1);
+  }
+  SliceBuffer Read(uint64_t position, size_t length, char fill) {
+    auto payload = peer_->Read(position, length);
+    EXPECT_TRUE(payload.ok()) << payload.status();
+    EXPECT_EQ(payload->JoinIntoString(), std::string(length, fill));
+    return std::move(*payload);
+  }
+
+  RefCountedPtr<SharedMemorySegment> creator_;
+  RefCountedPtr<SharedMemorySegment> peer_;
+};
+
+TEST_F(SharedMemoryRingTest, WritesAreReadByPeer) {
+  auto position = Write(100, 'a');
+  ASSERT_TRUE(position.has_value());
+  EXPECT_EQ(*position, 0);
+  Read(*position, 100, 'a');
+  // The next payload follows at the requested alignment.
+  SliceBuffer payload = Payload(10, 'b');
+  position = creator_->Write(payload, 64);
+  ASSERT_TRUE(position.has_value());
+  EXPECT_EQ(*position, 128);
+  Read(*position, 10, 'b');
+}
+
+TEST_F(SharedMemoryRingTest, EachDirectionHasItsOwnRing) {
+  SliceBuffer payload = Payload(100, 'p');
+  auto position = peer_->Write(payload, 1);
+  ASSERT_TRUE(position.has_value());
+  EXPECT_EQ(*position, 0);
+  auto from_creator = Write(100, 'c');
+  ASSERT_TRUE(from_creator.has_value());
+  EXPECT_EQ(*from_creator, 0);
+  auto read = creator_->Read(*position, 100);
+  ASSERT_TRUE(read.ok()) << read.status();
+  EXPECT_EQ(read->JoinIntoString(), std::string(100, 'p'));
+  Read(*from_creator, 100, 'c');
+}
+
+TEST_F(SharedMemoryRingTest, FullRingIsReusedOnceReleased) {
+  auto first = Write(3000, 'a');
+  ASSERT_TRUE(first.has_value());
+  SliceBuffer held = Read(*first, 3000, 'a');
+  // No room until the reader releases the first payload.
+  EXPECT_EQ(Write(2000, 'b'), std::nullopt);
+  held.Clear();
+  auto second = Write(2000, 'b');
+  ASSERT_TRUE(second.has_value());
+  // It would not fit before the end of the ring, so it starts the next lap.
+  EXPECT_EQ(*second, kRingSize);
+  Read(*second, 2000, 'b');
+}
+
+TEST_F(SharedMemoryRingTest, ReleasesInOrderOfWriting) {
+  auto first = Write(2000, 'a');
+  ASSERT_TRUE(first.has_value());
+  auto second = Write(2000, 'b');
+  ASSERT_TRUE(second.has_value());
+  SliceBuffer first_payload = Read(*first, 2000, 'a');
+  SliceBuffer second_payload = Read(*second, 2000, 'b');
+  // Releasing the second payload frees nothing while the first is held.
+  second_payload.Clear();
+  EXPECT_EQ(Write(1000, 'c'), std::nullopt);
+  first_payload.Clear();
+  auto third = Write(1000, 'c');
+  ASSERT_TRUE(third.has_value());
+  EXPECT_EQ(*third, kRingSize);
+  Read(*third, 1000, 'c');
+}
+
+TEST_F(SharedMemoryRingTest, PayloadLargerThanRingIsNotShared) {
+  EXPECT_EQ(Write(kRingSize + 1, 'a'), std::nullopt);
+  EXPECT_EQ(Write(0, 'a'), std::nullopt);
+  // The ring is still usable.
+  auto position = Write(kRingSize, 'b');
+  ASSERT_TRUE(position.has_value());
+  Read(*position, kRingSize, 'b');
+}
+
+TEST_F(SharedMemoryRingTest, RejectsPayloadsOutOfBounds) {
+  EXPECT_FALSE(peer_->Read(kRingSize - 10, 20).ok());
+  EXPECT_FALSE(peer_->Read(0, 0).ok());
+  auto position = Write(100, 'a');
+  ASSERT_TRUE(position.has_value());
+  Read(*position, 100, 'a');
+  // A payload before one already read cannot be read.
+  EXPECT_FALSE(peer_->Read(0, 50).ok());
+}
+
+// Offers of segments that the server must not open, after which the
+// connection carries payloads itself.
+class SharedMemoryOfferTest : public ::testing::Test {
+ protected:
+  SharedMemoryOfferTest() {
+    auto segment = SharedMemorySegment::Create(kRingSize);
+    EXPECT_TRUE(segment.ok()) << segment.status();
+    segment_ = std::move(*segment);
+    segment_->PrepareOffer(offer_);
+  }
+
+  absl::Status Attach(absl::string_view peer = "ipv4:127.0.0.1:1",
+                      uint32_t max_ring_size = kRingSize) {
+    return SharedMemorySegment::Attach(Address(peer), offer_, max_ring_size)
+        .status();
+  }
+
+  RefCountedPtr<SharedMemorySegment> segment_;
+  chaotic_good_frame::Settings::SharedMemory offer_;
+};
+
+TEST_F(SharedMemoryOfferTest, AcceptsOfferFromLocalPeer) {
+  EXPECT_TRUE(Attach().ok());
+  EXPECT_TRUE(Attach("ipv6:[::1]:1").ok());
+  // The limit is rounded up to whole pages, as rings are.
+  EXPECT_TRUE(Attach("ipv4:127.0.0.1:1", kRingSize - 1).ok());
+}
+
+TEST_F(SharedMemoryOfferTest, RejectsRemotePeer) {
+  EXPECT_EQ(Attach("ipv4:10.0.0.1:1").code(),
+            absl::StatusCode::kFailedPrecondition);
+}
+
+TEST_F(SharedMemoryOfferTest, RejectsOtherHost) {
+  offer_.set_host_id("another host");
+  EXPECT_EQ(Attach().code(), absl::StatusCode::kFailedPrecondition);
+}
+
+TEST_F(SharedMemoryOfferTest, RejectsRingsOverLimit) {
+  offer_.set_ring_size(2 * kRingSize);
+  EXPECT_EQ(Attach().code(),
+            absl::StatusCode::kResourceExhausted);
+}
+
+TEST_F(SharedMemoryOfferTest, RejectsMalformedOffer) {
+  offer_.set_ring_size(kRingSize + 1);
+  EXPECT_EQ(Attach().code(), absl::StatusCode::kInvalidArgument);
+}
+
+TEST_F(SharedMemoryOfferTest, RejectsWrongNonce) {
+  offer_.set_nonce(std::string(offer_.nonce().size(), '\0'));
+  EXPECT_EQ(Attach().code(), absl::StatusCode::kInvalidArgument);
+}
+
+TEST_F(SharedMemoryOfferTest, RejectsSizeMismatch) {
+  offer_.set_ring_size(2 * kRingSize);
+  EXPECT_EQ(Attach("ipv4:127.0.0.1:1", 2 * kRingSize).code(),
+            absl::StatusCode::kInvalidArgument);
+}
+
+TEST_F(SharedMemoryOfferTest, RejectsFileThatIsNotASegment) {
+  const int fd = open("/dev/null", O_RDWR | O_CLOEXEC);
+  ASSERT_GE(fd, 0);
+  offer_.set_fd(fd);
+  EXPECT_EQ(Attach().code(), absl::StatusCode::kInvalidArgument);
+  close(fd);
+}
+
+TEST_F(SharedMemoryOfferTest, RejectsUnsealedSegment) {
+  // Named as a segment, and of the right size, but resizable.
+  const int fd = memfd_create("grpc_chaotic_good", MFD_CLOEXEC);
+  ASSERT_GE(fd, 0);
+  ASSERT_EQ(ftruncate(fd, 4096 + 2 * kRingSize), 0);
+  offer_.set_fd(fd);
+  EXPECT_EQ(Attach().code(), absl::StatusCode::kInvalidArgument);
+  close(fd);
+}
+
+#endif  // GPR_LINUX
+
+}  // namespace
+}  // namespace chaotic_good
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
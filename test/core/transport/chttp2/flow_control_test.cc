@@ -265,6 +265,79 @@ TEST_F(FlowControlTest, GradualReadsUpdate) {
   EXPECT_EQ(immediate_updates + queued_updates, 65535);
 }
 
+TEST_F(FlowControlTest, AdaptiveStreamWindowKeepsDefaultInitialWindow) {
+  ExecCtx exec_ctx;
+  TransportFlowControl tfc("test", true, &memory_owner_);
+  tfc.EnableAdaptiveStreamWindows();
+  // The mocker alternates between a small and a big target.
+  for (int i = 0; i < 4; i++) {
+    FlowControlAction action = tfc.PeriodicUpdate();
+    if (action.send_initial_window_update() !=
+        FlowControlAction::Urgency::NO_ACTION_NEEDED) {
+      EXPECT_LE(action.initial_window_size(), kDefaultWindow);
+    }
+  }
+}
+
+TEST_F(FlowControlTest, AdaptiveStreamWindowGrowsForFastReader) {
+  ExecCtx exec_ctx;
+  TransportFlowControl tfc("test", true, &memory_owner_);
+  tfc.EnableAdaptiveStreamWindows();
+  StreamFlowControl sfc(&tfc);
+  auto window = [&]() {
+    return tfc.test_only_acked_init_window() +
+           sfc.test_only_announced_window_delta();
+  };
+  // Each millisecond the peer sends all the window allows, and the
+  // application reads it at once and waits for more.
+  for (int i = 0; i < 100; i++) {
+    const int64_t available = window();
+    StreamFlowControl::IncomingUpdateContext sfc_upd(&sfc);
+    EXPECT_EQ(sfc_upd.RecvData(available), absl::OkStatus());
+    sfc_upd.RecordRead(available);
+    sfc_upd.SetMinProgressSize(5);
+    std::ignore = sfc_upd.MakeAction();
+    sfc.MaybeSendUpdate();
+    tfc.MaybeSendUpdate(true);
+    AdvanceClockMillis(1);
+  }
+  EXPECT_GT(sfc.test_only_target_window(), 1024 * 1024);
+  EXPECT_EQ(window(), sfc.test_only_target_window());
+  // Once the application stops reading, nothing more is advertised.
+  {
+    StreamFlowControl::IncomingUpdateContext sfc_upd(&sfc);
+    EXPECT_EQ(sfc_upd.RecvData(kDefaultWindow), absl::OkStatus());
+    EXPECT_EQ(sfc_upd.MakeAction().send_stream_update(),
+              FlowControlAction::Urgency::NO_ACTION_NEEDED);
+  }
+  EXPECT_EQ(sfc.DesiredAnnounceSize(), 0u);
+}
+
+TEST_F(FlowControlTest, AdaptiveStreamWindowShrinksForSlowReader) {
+  ExecCtx exec_ctx;
+  TransportFlowControl tfc("test", true, &memory_owner_);
+  tfc.EnableAdaptiveStreamWindows();
+  StreamFlowControl sfc(&tfc);
+  auto window = [&]() {
+    return tfc.test_only_acked_init_window() +
+           sfc.test_only_announced_window_delta();
+  };
+  // The application reads a kilobyte every ten milliseconds.
+  for (int i = 0; i < 100; i++) {
+    StreamFlowControl::IncomingUpdateContext sfc_upd(&sfc);
+    EXPECT_EQ(sfc_upd.RecvData(1024), absl::OkStatus());
+    sfc_upd.RecordRead(1024);
+    sfc_upd.SetMinProgressSize(5);
+    std::ignore = sfc_upd.MakeAction();
+    sfc.MaybeSendUpdate();
+    tfc.MaybeSendUpdate(true);
+    AdvanceClockMillis(10);
+  }
+  EXPECT_EQ(sfc.test_only_target_window(), 16384);
+  // The window drained to the target, which is less than the initial window.
+  EXPECT_EQ(window(), 16384);
+}
+
 }  // namespace chttp2
 }  // namespace grpc_core
 
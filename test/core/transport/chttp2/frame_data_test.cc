@@ -0,0 +1,214 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/chttp2/transport/frame_data.h"
+
+#include <grpc/slice.h>
+#include <grpc/slice_buffer.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "src/core/ext/transport/chttp2/transport/http2_ztrace_collector.h"
+#include "src/core/lib/slice/slice_buffer.h"
+#include "src/core/telemetry/call_tracer.h"
+#include "src/core/telemetry/stats_data.h"
+#include "src/core/util/grpc_check.h"
+#include "test/core/test_util/test_config.h"
+#include "gtest/gtest.h"
+#include "absl/strings/string_view.h"
+
+namespace grpc_core {
+namespace {
+
+class FakeCallTracer final : public CallTracerInterface {
+ public:
+  void RecordIncomingBytes(
+      const TransportByteSize& /*transport_byte_size*/) override {}
+  void RecordOutgoingBytes(
+      const TransportByteSize& transport_byte_size) override {
+    framing_bytes += transport_byte_size.framing_bytes;
+  }
+  void RecordSendInitialMetadata(
+      grpc_metadata_batch* send_initial_metadata) override {
+    GRPC_CHECK(!IsCallTracerSendInitialMetadataIsAnAnnotationEnabled());
+    MutateSendInitialMetadata(send_initial_metadata);
+  }
+  void MutateSendInitialMetadata(
+      grpc_metadata_batch* /*send_initial_metadata*/) override {}
+  void RecordSendTrailingMetadata(
+      grpc_metadata_batch* send_trailing_metadata) override {
+    GRPC_CHECK(!IsCallTracerSendTrailingMetadataIsAnAnnotationEnabled());
+    MutateSendTrailingMetadata(send_trailing_metadata);
+  }
+  void MutateSendTrailingMetadata(
+      grpc_metadata_batch* /*send_trailing_metadata*/) override {}
+  void RecordSendMessage(const Message& /*send_message*/) override {}
+  void RecordSendCompressedMessage(
+      const Message& /*send_compressed_message*/) override {}
+  void RecordReceivedInitialMetadata(
+      grpc_metadata_batch* /*recv_initial_metadata*/) override {}
+  void RecordReceivedMessage(const Message& /*recv_message*/) override {}
+  void RecordReceivedDecompressedMessage(
+      const Message& /*recv_decompressed_message*/) override {}
+  void RecordCancel(grpc_error_handle /*cancel_error*/) override {}
+  std::shared_ptr<TcpCallTracer> StartNewTcpTrace() override { return nullptr; }
+  void RecordAnnotation(absl::string_view /*annotation*/) override {}
+  void RecordAnnotation(const Annotation& /*annotation*/) override {}
+  std::string TraceId() override { return ""; }
+  std::string SpanId() override { return ""; }
+  bool IsSampled() override { return false; }
+
+  size_t framing_bytes = 0;
+};
+
+class EncodeDataTest : public ::testing::Test {
+ protected:
+  // Frames all of inbuf_ into DATA frames of at most max_frame_size bytes.
+  void EncodeAll(uint32_t max_frame_size) {
+    while (inbuf_.Length() > 0) {
+      const uint32_t write_bytes = static_cast<uint32_t>(
+          std::min<size_t>(inbuf_.Length(), max_frame_size));
+      grpc_chttp2_encode_data(kStreamId, inbuf_.c_slice_buffer(), write_bytes,
+                              write_bytes == inbuf_.Length(), &call_tracer_,
+                              &ztrace_collector_, &header_arena_, &stats_,
+                              outbuf_.c_slice_buffer());
+    }
+  }
+
+  // Whether slice references bytes of one of the slices given to inbuf_.
+  bool ReferencesInput(const grpc_slice& slice) const {
+    if (slice.refcount == nullptr) return false;
+    for (const grpc_slice& input : inputs_) {
+      if (GRPC_SLICE_START_PTR(slice) >= GRPC_SLICE_START_PTR(input) &&
+          GRPC_SLICE_END_PTR(slice) <= GRPC_SLICE_END_PTR(input)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void AddInput(grpc_slice slice) {
+    inputs_.push_back(slice);
+    grpc_slice_buffer_add_indexed(inbuf_.c_slice_buffer(),
+                                  grpc_slice_ref(slice));
+  }
+
+  ~EncodeDataTest() override {
+    for (const grpc_slice& input : inputs_) grpc_slice_unref(input);
+  }
+
+  static constexpr uint32_t kStreamId = 0x01020305;
+
+  FakeCallTracer call_tracer_;
+  Http2ZTraceCollector ztrace_collector_;
+  DataFrameHeaderArena header_arena_;
+  Http2StatsCollector stats_;
+  std::vector<grpc_slice> inputs_;
+  SliceBuffer inbuf_;
+  SliceBuffer outbuf_;
+};
+
+TEST_F(EncodeDataTest, LargeMessageIsNotCopied) {
+  constexpr size_t kSliceSize = 64 * 1024;
+  constexpr size_t kMessageSize = 4 * 1024 * 1024;
+  // Frames end in the middle of the input slices.
+  constexpr uint32_t kMaxFrameSize = 10000;
+  for (size_t i = 0; i < kMessageSize / kSliceSize; ++i) {
+    grpc_slice slice = grpc_slice_malloc(kSliceSize);
+    memset(GRPC_SLICE_START_PTR(slice), static_cast<int>(i), kSliceSize);
+    AddInput(slice);
+  }
+  EncodeAll(kMaxFrameSize);
+  const size_t frames = (kMessageSize + kMaxFrameSize - 1) / kMaxFrameSize;
+  EXPECT_EQ(outbuf_.Length(),
+            kMessageSize + frames * DataFrameHeaderArena::kHeaderSize);
+  EXPECT_EQ(call_tracer_.framing_bytes,
+            frames * DataFrameHeaderArena::kHeaderSize);
+  EXPECT_EQ(stats_.View().http2_data_payload_copies, 0u);
+  EXPECT_GE(stats_.View().http2_data_payload_references,
+            kMessageSize / kSliceSize);
+  // Every frame is a header followed by references to the input.
+  grpc_slice_buffer* out = outbuf_.c_slice_buffer();
+  size_t i = 0;
+  for (size_t frame = 0; frame < frames; ++frame) {
+    ASSERT_LT(i, out->count);
+    const grpc_slice& header = out->slices[i++];
+    ASSERT_EQ(GRPC_SLICE_LENGTH(header), DataFrameHeaderArena::kHeaderSize);
+    EXPECT_NE(header.refcount, nullptr);
+    const uint8_t* p = GRPC_SLICE_START_PTR(header);
+    const size_t length = (p[0] << 16) | (p[1] << 8) | p[2];
+    EXPECT_EQ(p[3], 0);  // DATA
+    EXPECT_EQ(p[4], frame == frames - 1 ? 1 : 0);
+    EXPECT_EQ(p[5], 0x01);
+    EXPECT_EQ(p[6], 0x02);
+    EXPECT_EQ(p[7], 0x03);
+    EXPECT_EQ(p[8], 0x05);
+    size_t payload = 0;
+    while (payload < length) {
+      ASSERT_LT(i, out->count);
+      const grpc_slice& slice = out->slices[i++];
+      EXPECT_TRUE(ReferencesInput(slice));
+      payload += GRPC_SLICE_LENGTH(slice);
+    }
+    EXPECT_EQ(payload, length);
+  }
+  EXPECT_EQ(i, out->count);
+}
+
+TEST_F(EncodeDataTest, SmallSlicesAreNotCoalesced) {
+  // Inlined slices hold their bytes themselves: moving one copies it.
+  grpc_slice_buffer_add_indexed(inbuf_.c_slice_buffer(),
+                                grpc_slice_from_copied_string("hello"));
+  grpc_slice_buffer_add_indexed(inbuf_.c_slice_buffer(),
+                                grpc_slice_from_copied_string("world"));
+  AddInput(grpc_slice_malloc(1024));
+  EncodeAll(1024);
+  EXPECT_EQ(stats_.View().http2_data_payload_copies, 2u);
+  EXPECT_EQ(stats_.View().http2_data_payload_references, 2u);
+  // The first frame: header, both small slices, and the start of the large
+  // one. The second: header and the rest of the large one.
+  grpc_slice_buffer* out = outbuf_.c_slice_buffer();
+  ASSERT_EQ(out->count, 6u);
+  EXPECT_EQ(GRPC_SLICE_LENGTH(out->slices[1]), 5u);
+  EXPECT_EQ(GRPC_SLICE_LENGTH(out->slices[2]), 5u);
+  EXPECT_TRUE(ReferencesInput(out->slices[3]));
+  EXPECT_EQ(GRPC_SLICE_LENGTH(out->slices[3]), 1014u);
+  EXPECT_TRUE(ReferencesInput(out->slices[5]));
+  EXPECT_EQ(GRPC_SLICE_LENGTH(out->slices[5]), 10u);
+}
+
+TEST_F(EncodeDataTest, EmptyFrame) {
+  grpc_chttp2_encode_data(kStreamId, inbuf_.c_slice_buffer(), 0, true,
+                          &call_tracer_, &ztrace_collector_, &header_arena_,
+                          &stats_, outbuf_.c_slice_buffer());
+  ASSERT_EQ(outbuf_.Count(), 1u);
+  EXPECT_EQ(outbuf_.Length(), DataFrameHeaderArena::kHeaderSize);
+  EXPECT_EQ(outbuf_.JoinIntoString(),
+            std::string("\x00\x00\x00\x00\x01\x01\x02\x03\x05", 9));
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
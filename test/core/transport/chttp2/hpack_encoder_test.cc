@@ -157,6 +157,87 @@ TEST(HpackEncoderTest, TestBasicHeaders) {
   delete g_compressor;
 }
 
+// Encodes one stream's worth of headers with a compressor that is shared
+// between streams; values are copied unless value_is_static.
+static grpc_core::Slice EncodeWithCompressor(
+    grpc_core::HPackCompressor* compressor, absl::string_view key,
+    const char* value, bool value_is_static) {
+  grpc_metadata_batch b;
+  b.Append(key,
+           value_is_static ? grpc_core::Slice::FromStaticString(value)
+                           : grpc_core::Slice::FromCopiedString(value),
+           CrashOnAppendError);
+  grpc_core::FakeCallTracer call_tracer;
+  grpc_core::HPackCompressor::EncodeHeaderOptions hopt{
+      0xdeadbeef,  // stream_id
+      false,       // is_eof
+      false,       // use_true_binary_metadata
+      16384,       // max_frame_size
+      &call_tracer, g_ztrace_collector};
+  grpc_slice_buffer output;
+  grpc_slice_buffer_init(&output);
+  compressor->EncodeHeaders(hopt, b, &output);
+  grpc_core::HpackEncoderTestHelper::verify_frames(output, false);
+  grpc_core::Slice merged(grpc_slice_merge(output.slices, output.count));
+  grpc_slice_buffer_destroy(&output);
+  return merged;
+}
+
+TEST(HpackEncoderTest, DeclaredStaticMetadataIsIndexedAcrossStreams) {
+  grpc_core::ExecCtx exec_ctx;
+  grpc_core::HPackCompressor compressor;
+  compressor.AddStaticMetadata(grpc_core::Slice::FromCopiedString("x-static"),
+                               grpc_core::Slice::FromCopiedString("abc"));
+  // The first stream inserts the pair into the dynamic table, later ones
+  // refer to it, although each stream carries its own copy of the value.
+  EXPECT_EQ(EncodeWithCompressor(&compressor, "x-static", "abc", false),
+            grpc_core::ParseHexstring(
+                "00000e 0104 deadbeef 40 0878 2d73 7461 7469 63 03 616263"));
+  EXPECT_EQ(EncodeWithCompressor(&compressor, "x-static", "abc", false),
+            grpc_core::ParseHexstring("000001 0104 deadbeef be"));
+  EXPECT_EQ(EncodeWithCompressor(&compressor, "x-static", "abc", false),
+            grpc_core::ParseHexstring("000001 0104 deadbeef be"));
+  // Other values of the same key are not affected.
+  EXPECT_EQ(EncodeWithCompressor(&compressor, "x-static", "abd", false),
+            grpc_core::ParseHexstring(
+                "00000e 0104 deadbeef 00 0878 2d73 7461 7469 63 03 616264"));
+}
+
+TEST(HpackEncoderTest, RepeatedStaticValueIsIndexedAcrossStreams) {
+  grpc_core::ExecCtx exec_ctx;
+  grpc_core::HPackCompressor compressor;
+  static const char kValue[] = "abc";
+  // Seen once, a static value is sent like any other; seen again, it is
+  // indexed.
+  EXPECT_EQ(EncodeWithCompressor(&compressor, "x-static", kValue, true),
+            grpc_core::ParseHexstring(
+                "00000e 0104 deadbeef 00 0878 2d73 7461 7469 63 03 616263"));
+  EXPECT_EQ(EncodeWithCompressor(&compressor, "x-static", kValue, true),
+            grpc_core::ParseHexstring(
+                "00000e 0104 deadbeef 40 0878 2d73 7461 7469 63 03 616263"));
+  EXPECT_EQ(EncodeWithCompressor(&compressor, "x-static", kValue, true),
+            grpc_core::ParseHexstring("000001 0104 deadbeef be"));
+}
+
+TEST(HpackEncoderTest, StaticValueIsMatchedByContent) {
+  grpc_core::ExecCtx exec_ctx;
+  grpc_core::HPackCompressor compressor;
+  // The memory behind a static value may be reused for another value once
+  // the batch that sent it is gone.
+  char value[] = "abc";
+  EncodeWithCompressor(&compressor, "x-static", value, true);
+  EXPECT_EQ(EncodeWithCompressor(&compressor, "x-static", value, true),
+            grpc_core::ParseHexstring(
+                "00000e 0104 deadbeef 40 0878 2d73 7461 7469 63 03 616263"));
+  value[2] = 'd';
+  EXPECT_EQ(EncodeWithCompressor(&compressor, "x-static", value, true),
+            grpc_core::ParseHexstring(
+                "00000e 0104 deadbeef 00 0878 2d73 7461 7469 63 03 616264"));
+  value[2] = 'c';
+  EXPECT_EQ(EncodeWithCompressor(&compressor, "x-static", value, true),
+            grpc_core::ParseHexstring("000001 0104 deadbeef be"));
+}
+
 MATCHER(HasLiteralHeaderFieldNewNameFlagIncrementalIndexing, "") {
   constexpr size_t kHttp2FrameHeaderSize = 9u;
   /// Reference: https://httpwg.org/specs/rfc7541.html#rfc.section.6.2.1
@@ -249,6 +330,103 @@ TEST(HpackEncoderTest, UserAgentMetadataNoIndexing) {
   grpc_slice_unref(encoded_header);
 }
 
+TEST(HpackEncoderTest, AdaptiveIndexingSkipsValuesSentOnceWhenTableIsFull) {
+  grpc_core::ExecCtx exec_ctx;
+  grpc_core::HPackCompressor compressor;
+  compressor.EnableAdaptiveIndexing();
+  // Three of these fill the initial 4096 byte table.
+  auto value = [](int i) { return std::string(1000, 'a' + i); };
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_THAT(
+        EncodeWithCompressor(&compressor, "user-agent", value(i).c_str(), false)
+            .c_slice(),
+        HasLiteralHeaderFieldNewNameFlagIncrementalIndexing());
+  }
+  for (int i = 3; i < 6; ++i) {
+    EXPECT_THAT(
+        EncodeWithCompressor(&compressor, "user-agent", value(i).c_str(), false)
+            .c_slice(),
+        HasLiteralHeaderFieldNewNameFlagNoIndexing());
+  }
+  // A value that was sent before is added to the table when sent again.
+  EXPECT_THAT(
+      EncodeWithCompressor(&compressor, "user-agent", value(4).c_str(), false)
+          .c_slice(),
+      HasLiteralHeaderFieldNewNameFlagIncrementalIndexing());
+  EXPECT_EQ(
+      EncodeWithCompressor(&compressor, "user-agent", value(4).c_str(), false),
+      grpc_core::ParseHexstring("000001 0104 deadbeef be"));
+  EXPECT_EQ(compressor.stats().dynamic_table_inserts, 4u);
+  EXPECT_EQ(compressor.stats().literals, 3u);
+  EXPECT_EQ(compressor.stats().dynamic_table_hits, 1u);
+}
+
+TEST(HpackEncoderTest, AdaptiveIndexingIndexesRepeatedUnknownMetadata) {
+  grpc_core::ExecCtx exec_ctx;
+  grpc_core::HPackCompressor compressor;
+  compressor.EnableAdaptiveIndexing();
+  // Copied values of unknown keys are otherwise never indexed.
+  EXPECT_EQ(EncodeWithCompressor(&compressor, "x-user", "abc", false),
+            grpc_core::ParseHexstring(
+                "00000c 0104 deadbeef 40 0678 2d75 7365 72 03 616263"));
+  EXPECT_EQ(EncodeWithCompressor(&compressor, "x-user", "abc", false),
+            grpc_core::ParseHexstring("000001 0104 deadbeef be"));
+  EXPECT_EQ(EncodeWithCompressor(&compressor, "x-user", "abc", false),
+            grpc_core::ParseHexstring("000001 0104 deadbeef be"));
+  EXPECT_EQ(compressor.stats().dynamic_table_inserts, 1u);
+  EXPECT_EQ(compressor.stats().dynamic_table_hits, 2u);
+  EXPECT_DOUBLE_EQ(compressor.stats().dynamic_table_hit_rate(), 2.0 / 3);
+}
+
+TEST(HpackEncoderTest, AdaptiveIndexingOutlivesStaticValues) {
+  grpc_core::ExecCtx exec_ctx;
+  grpc_core::HPackCompressor compressor;
+  compressor.EnableAdaptiveIndexing();
+  // The cache must not refer to the memory of a static value once the batch
+  // that sent it is gone.
+  auto value = std::make_unique<std::string>("abc");
+  EXPECT_EQ(EncodeWithCompressor(&compressor, "x-user", value->c_str(), true),
+            grpc_core::ParseHexstring(
+                "00000c 0104 deadbeef 40 0678 2d75 7365 72 03 616263"));
+  value = std::make_unique<std::string>("abc");
+  EXPECT_EQ(EncodeWithCompressor(&compressor, "x-user", value->c_str(), true),
+            grpc_core::ParseHexstring("000001 0104 deadbeef be"));
+}
+
+MATCHER(HasLiteralHeaderFieldNewNameFlagNeverIndexed, "") {
+  constexpr size_t kHttp2FrameHeaderSize = 9u;
+  /// Reference: https://httpwg.org/specs/rfc7541.html#rfc.section.6.2.3
+  /// The first byte of a literal header field never indexed should be 0x10.
+  constexpr uint8_t kLiteralHeaderFieldNewNameFlagNeverIndexed = 0x10;
+  return (GRPC_SLICE_START_PTR(arg)[kHttp2FrameHeaderSize] ==
+          kLiteralHeaderFieldNewNameFlagNeverIndexed);
+}
+
+TEST(HpackEncoderTest, CredentialsAreNeverIndexed) {
+  grpc_core::ExecCtx exec_ctx;
+  grpc_core::HPackCompressor compressor;
+  compressor.EnableAdaptiveIndexing();
+  EXPECT_EQ(EncodeWithCompressor(&compressor, "authorization", "abc", false),
+            grpc_core::ParseHexstring("000013 0104 deadbeef 10 0d61 7574 686f"
+                                      "7269 7a61 7469 6f6e 03 616263"));
+  // Neither repeating them, sending them as static values nor declaring them
+  // static adds them to the table.
+  for (const char* key : {"authorization", "proxy-authorization", "cookie",
+                          "set-cookie", "x-token-bin"}) {
+    compressor.AddStaticMetadata(grpc_core::Slice::FromCopiedString(key),
+                                 grpc_core::Slice::FromCopiedString("abc"));
+    for (int i = 0; i < 3; ++i) {
+      EXPECT_THAT(
+          EncodeWithCompressor(&compressor, key, "abc", false).c_slice(),
+          HasLiteralHeaderFieldNewNameFlagNeverIndexed());
+      EXPECT_THAT(EncodeWithCompressor(&compressor, key, "abc", true).c_slice(),
+                  HasLiteralHeaderFieldNewNameFlagNeverIndexed());
+    }
+  }
+  EXPECT_EQ(compressor.stats().dynamic_table_inserts, 0u);
+  EXPECT_EQ(compressor.stats().dynamic_table_hits, 0u);
+}
+
 static void verify_continuation_headers(const char* key, const char* value,
                                         bool is_eof) {
   grpc_core::MemoryAllocator memory_allocator =
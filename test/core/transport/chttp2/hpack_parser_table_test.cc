@@ -107,6 +107,25 @@ TEST(HpackParserTableTest, StaticTable) {
   AssertIndex(&tbl, 61, "www-authenticate", "");
 }
 
+TEST(HpackParserTableTest, StaticKeyIndex) {
+  ExecCtx exec_ctx;
+  HPackTable tbl;
+  for (uint32_t i = 1; i <= hpack_constants::kLastStaticEntry; i++) {
+    const auto key = tbl.Lookup(i)->md.key();
+    const uint32_t index = HPackTable::StaticKeyIndex(key);
+    ASSERT_NE(index, 0u) << key;
+    EXPECT_LE(index, i) << key;
+    EXPECT_EQ(tbl.Lookup(index)->md.key(), key);
+  }
+  EXPECT_EQ(HPackTable::StaticKeyIndex(":method"), 2u);
+  EXPECT_EQ(HPackTable::StaticKeyIndex(":status"), 8u);
+  EXPECT_EQ(HPackTable::StaticKeyIndex(""), 0u);
+  EXPECT_EQ(HPackTable::StaticKeyIndex("a"), 0u);
+  EXPECT_EQ(HPackTable::StaticKeyIndex("user-agenT"), 0u);
+  EXPECT_EQ(HPackTable::StaticKeyIndex("grpc-timeout"), 0u);
+  EXPECT_EQ(HPackTable::StaticKeyIndex("x-user-agent"), 0u);
+}
+
 TEST(HpackParserTableTest, ManyAdditions) {
   HPackTable tbl;
   int i;
@@ -822,7 +822,30 @@ INSTANTIATE_TEST_SUITE_P(
              {{"1f80808080808080808080808080808080808080808080808080808080",
                absl::InternalError(
                    "Malicious varint encoding detected in HPACK stream"),
-               kFailureIsConnectionError}}}),
+               kFailureIsConnectionError}}},
+        Test{"LiteralKeysFromTheStaticTable",
+             {},
+             {},
+             {{"400a757365722d6167656e7403666f6f", "user-agent: foo\n", 0},
+              {"be", "user-agent: foo\n", 0},
+              {"000c636f6e74656e742d74797065"
+               "106170706c69636174696f6e2f67727063",
+               "content-type: application/grpc\n", 0}}},
+        Test{"LongIllegalHeaderKey",
+             {},
+             {},
+             {{"001e782d6c6f6e672d6865616465722d6b65792d776974682d4361706974616c"
+               "0161",
+               absl::InternalError(
+                   "Illegal header key: x-long-header-key-with-Capital"),
+               0}}},
+        Test{"MultiByteVarintStringLength",
+             {},
+             {},
+             {{absl::StrCat("000c782d6c6f6e672d76616c75657fad01",
+                            std::string(600, '7')),
+               absl::StrCat("x-long-value: ", std::string(300, 'w'), "\n"),
+               0}}}),
     NameFromConfig);
 
 }  // namespace
@@ -34,9 +34,12 @@ using ::testing::StrictMock;
 using util::testing::TransportTest;
 
 struct TestStream : public RefCounted<TestStream> {
-  explicit TestStream(uint32_t stream_id) : stream_id(stream_id) {}
+  explicit TestStream(uint32_t stream_id, uint8_t urgency = kDefaultUrgency)
+      : stream_id(stream_id), urgency(urgency) {}
   uint32_t stream_id;
+  uint8_t urgency;
   uint32_t GetStreamId() const { return stream_id; }
+  uint8_t GetUrgency() const { return urgency; }
 };
 
 using Stream = TestStream;
@@ -453,6 +456,91 @@ TEST_F(WritableStreamsTest, TestForceReadyForWrite) {
   event_engine()->UnsetGlobalHooks();
 }
 
+/////////////////////////////////////////////////////////////////////////////////
+// Urgency tests
+TEST_F(WritableStreamsTest, DequeueByUrgencyTest) {
+  // Streams of priority kDefault are dequeued most urgent first, and in
+  // enqueue order within an urgency.
+  WritableStreams writable_streams;
+  EnqueueAndCheckSuccess(writable_streams, MakeRefCounted<Stream>(1, 5),
+                         WritableStreamPriority::kDefault);
+  EnqueueAndCheckSuccess(writable_streams, MakeRefCounted<Stream>(3, 1),
+                         WritableStreamPriority::kDefault);
+  EnqueueAndCheckSuccess(writable_streams, MakeRefCounted<Stream>(5),
+                         WritableStreamPriority::kDefault);
+  EnqueueAndCheckSuccess(writable_streams, MakeRefCounted<Stream>(7, 1),
+                         WritableStreamPriority::kDefault);
+  EnqueueAndCheckSuccess(writable_streams, MakeRefCounted<Stream>(9, 6),
+                         WritableStreamPriority::kStreamClosed);
+  DequeueAndCheckSuccess(writable_streams, /*expected_stream_id=*/9);
+  DequeueAndCheckSuccess(writable_streams, /*expected_stream_id=*/3);
+  DequeueAndCheckSuccess(writable_streams, /*expected_stream_id=*/7);
+  DequeueAndCheckSuccess(writable_streams, /*expected_stream_id=*/5);
+  DequeueAndCheckSuccess(writable_streams, /*expected_stream_id=*/1);
+
+  event_engine()->TickUntilIdle();
+  event_engine()->UnsetGlobalHooks();
+}
+
+TEST_F(WritableStreamsTest, UrgencyWeightedShareTest) {
+  // Two streams that stay writable share the writes eight to one between the
+  // most and the least urgent.
+  WritableStreams writable_streams;
+  EnqueueAndCheckSuccess(writable_streams, MakeRefCounted<Stream>(1, 7),
+                         WritableStreamPriority::kDefault);
+  EnqueueAndCheckSuccess(writable_streams, MakeRefCounted<Stream>(3, 0),
+                         WritableStreamPriority::kDefault);
+  int writes[2] = {0, 0};
+  for (int i = 0; i < 90; ++i) {
+    auto promise =
+        DequeuePromise(writable_streams, /*transport_tokens_available=*/true);
+    Poll<std::optional<RefCountedPtr<Stream>>> result = promise();
+    ASSERT_TRUE(result.ready());
+    ASSERT_TRUE(result.value().has_value());
+    RefCountedPtr<Stream> stream = std::move(*result.value());
+    writable_streams.RecordBytesWritten(16384);
+    ++writes[stream->GetStreamId() == 3 ? 0 : 1];
+    EnqueueAndCheckSuccess(writable_streams, std::move(stream),
+                           WritableStreamPriority::kDefault);
+  }
+  EXPECT_EQ(writes[0], 80);
+  EXPECT_EQ(writes[1], 10);
+
+  event_engine()->TickUntilIdle();
+  event_engine()->UnsetGlobalHooks();
+}
+
+TEST_F(WritableStreamsTest, LessUrgentStreamNotStarvedTest) {
+  // A large write is owed from later rounds rather than blocking the less
+  // urgent stream until the more urgent one is done.
+  WritableStreams writable_streams;
+  EnqueueAndCheckSuccess(writable_streams, MakeRefCounted<Stream>(1, 0),
+                         WritableStreamPriority::kDefault);
+  EnqueueAndCheckSuccess(writable_streams, MakeRefCounted<Stream>(3, 7),
+                         WritableStreamPriority::kDefault);
+  DequeueAndCheckSuccess(writable_streams, /*expected_stream_id=*/1);
+  writable_streams.RecordBytesWritten(1024 * 1024);
+  EnqueueAndCheckSuccess(writable_streams, MakeRefCounted<Stream>(1, 0),
+                         WritableStreamPriority::kDefault);
+  DequeueAndCheckSuccess(writable_streams, /*expected_stream_id=*/3);
+
+  event_engine()->TickUntilIdle();
+  event_engine()->UnsetGlobalHooks();
+}
+
+TEST(ParseUrgencyTest, ParsesRfc9218Priority) {
+  EXPECT_EQ(ParseUrgency("u=0"), 0);
+  EXPECT_EQ(ParseUrgency("u=7"), 7);
+  EXPECT_EQ(ParseUrgency("u=1, i"), 1);
+  EXPECT_EQ(ParseUrgency("i, u=5"), 5);
+  EXPECT_EQ(ParseUrgency("u=2,u=6"), 6);
+  EXPECT_EQ(ParseUrgency(""), kDefaultUrgency);
+  EXPECT_EQ(ParseUrgency("i"), kDefaultUrgency);
+  EXPECT_EQ(ParseUrgency("u=8"), kDefaultUrgency);
+  EXPECT_EQ(ParseUrgency("u=12"), kDefaultUrgency);
+  EXPECT_EQ(ParseUrgency("u=-1"), kDefaultUrgency);
+}
+
 }  // namespace testing
 }  // namespace http2
 }  // namespace grpc_core
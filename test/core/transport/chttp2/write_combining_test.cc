@@ -0,0 +1,223 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <grpc/grpc.h>
+#include <grpc/impl/channel_arg_names.h>
+#include <grpc/slice.h>
+#include <grpc/slice_buffer.h>
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+#include "src/core/ext/transport/chttp2/transport/chttp2_transport.h"
+#include "src/core/ext/transport/chttp2/transport/internal.h"
+#include "src/core/ext/transport/chttp2/transport/write_size_policy.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/lib/iomgr/closure.h"
+#include "src/core/lib/iomgr/combiner.h"
+#include "src/core/lib/iomgr/endpoint.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/util/notification.h"
+#include "src/core/util/orphanable.h"
+#include "test/core/test_util/mock_endpoint.h"
+#include "test/core/test_util/test_config.h"
+#include "gtest/gtest.h"
+#include "absl/status/status.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+
+namespace grpc_core {
+namespace {
+
+using grpc_event_engine::experimental::EventEngine;
+
+// Drives the write path of a client transport whose endpoint counts writes.
+// Frames are queued directly, as the frames of calls would be.
+class WriteCombiningTest : public ::testing::Test {
+ protected:
+  WriteCombiningTest() {
+    auto engine = grpc_event_engine::experimental::GetDefaultEventEngine();
+    mock_endpoint_controller_ =
+        grpc_event_engine::experimental::MockEndpointController::Create(engine);
+    args_ = args_.SetObject(ResourceQuota::Default());
+    args_ = args_.SetObject(std::move(engine));
+    args_ = args_.Set(GRPC_ARG_HTTP2_BDP_PROBE, 0);
+  }
+
+  ~WriteCombiningTest() override {
+    if (t_ != nullptr) {
+      ExecCtx exec_ctx;
+      t_->Orphan();
+    }
+  }
+
+  // Creates the transport with a write combining window of window, and waits
+  // for its initial write to finish.
+  void Start(absl::Duration window) {
+    ExecCtx exec_ctx;
+    t_ = reinterpret_cast<grpc_chttp2_transport*>(grpc_create_chttp2_transport(
+        args_.Set(GRPC_ARG_HTTP2_WRITE_COMBINING_WINDOW_MS,
+                  absl::ToInt64Milliseconds(window)),
+        OrphanablePtr<grpc_endpoint>(
+            mock_endpoint_controller_->TakeCEndpoint()),
+        /*is_client=*/true));
+    WaitForIdle();
+  }
+
+  // Runs f under the transport's combiner, and waits for it.
+  template <typename F>
+  void RunLocked(F f) {
+    Notification done;
+    {
+      ExecCtx exec_ctx;
+      t_->combiner->Run(NewClosure([&](absl::Status) {
+                          f();
+                          done.Notify();
+                        }),
+                        absl::OkStatus());
+    }
+    done.WaitForNotification();
+  }
+
+  void WaitForIdle() {
+    while (true) {
+      bool idle = false;
+      RunLocked(
+          [&] { idle = t_->write_state == GRPC_CHTTP2_WRITE_STATE_IDLE; });
+      if (idle) return;
+      absl::SleepFor(absl::Milliseconds(1));
+    }
+  }
+
+  // Waits up to timeout for the endpoint to have been written to writes
+  // times, and returns whether it was.
+  bool WaitForWrites(size_t writes, absl::Duration timeout) {
+    const absl::Time deadline = absl::Now() + timeout;
+    while (mock_endpoint_controller_->writes() < writes) {
+      if (absl::Now() > deadline) return false;
+      absl::SleepFor(absl::Milliseconds(1));
+    }
+    return true;
+  }
+
+  // Queues a frame, and starts a write for reason.
+  void QueueFrameLocked(grpc_chttp2_initiate_write_reason reason) {
+    grpc_slice_buffer_add(&t_->qbuf, grpc_slice_from_static_string("x"));
+    grpc_chttp2_initiate_write(t_, reason);
+  }
+
+  // Queues enough frames of calls at once for writes to be held back
+  // afterwards. They go out in one write; then waits until the next write is
+  // held back.
+  void MakeBusy() {
+    const size_t writes_before = writes();
+    RunLocked([this] {
+      for (int i = 0; i < Chttp2WriteCombiner::MinReadyPerWindow(); ++i) {
+        QueueFrameLocked(GRPC_CHTTP2_INITIATE_WRITE_SEND_MESSAGE);
+      }
+    });
+    ASSERT_TRUE(WaitForWrites(writes_before + 1, absl::Seconds(1)));
+    while (!WriteHeld()) absl::SleepFor(absl::Milliseconds(1));
+  }
+
+  bool WriteHeld() {
+    bool held = false;
+    RunLocked([&] {
+      held = t_->write_combining_timer_handle !=
+             EventEngine::TaskHandle::kInvalid;
+    });
+    return held;
+  }
+
+  size_t writes() const { return mock_endpoint_controller_->writes(); }
+
+  std::shared_ptr<grpc_event_engine::experimental::MockEndpointController>
+      mock_endpoint_controller_;
+  ChannelArgs args_;
+  grpc_chttp2_transport* t_ = nullptr;
+};
+
+TEST_F(WriteCombiningTest, WritesAtOnceWhenIdle) {
+  Start(absl::Seconds(5));
+  const size_t writes_before = writes();
+  RunLocked(
+      [this] { QueueFrameLocked(GRPC_CHTTP2_INITIATE_WRITE_SEND_MESSAGE); });
+  EXPECT_FALSE(WriteHeld());
+  EXPECT_TRUE(WaitForWrites(writes_before + 1, absl::Seconds(1)));
+}
+
+TEST_F(WriteCombiningTest, HoldsWritesOfBusyConnection) {
+  Start(absl::Seconds(5));
+  const size_t writes_before = writes();
+  MakeBusy();
+  ASSERT_EQ(writes(), writes_before + 1);
+  // Frames of calls wait for the window, together.
+  for (int i = 0; i < 3; ++i) {
+    RunLocked(
+        [this] { QueueFrameLocked(GRPC_CHTTP2_INITIATE_WRITE_SEND_MESSAGE); });
+  }
+  absl::SleepFor(absl::Milliseconds(100));
+  EXPECT_TRUE(WriteHeld());
+  EXPECT_EQ(writes(), writes_before + 1);
+  // Other frames start the held back write at once.
+  RunLocked(
+      [this] { QueueFrameLocked(GRPC_CHTTP2_INITIATE_WRITE_RST_STREAM); });
+  EXPECT_TRUE(WaitForWrites(writes_before + 2, absl::Seconds(1)));
+  EXPECT_FALSE(WriteHeld());
+  WaitForIdle();
+  EXPECT_EQ(writes(), writes_before + 2);
+}
+
+TEST_F(WriteCombiningTest, StartsHeldWriteAtEndOfWindow) {
+  Start(absl::Milliseconds(500));
+  const size_t writes_before = writes();
+  MakeBusy();
+  ASSERT_EQ(writes(), writes_before + 1);
+  RunLocked(
+      [this] { QueueFrameLocked(GRPC_CHTTP2_INITIATE_WRITE_SEND_MESSAGE); });
+  EXPECT_TRUE(WriteHeld());
+  EXPECT_TRUE(WaitForWrites(writes_before + 2, absl::Seconds(10)));
+  WaitForIdle();
+  EXPECT_EQ(writes(), writes_before + 2);
+}
+
+TEST_F(WriteCombiningTest, ClosingStartsHeldWrite) {
+  Start(absl::Seconds(60));
+  const size_t writes_before = writes();
+  MakeBusy();
+  ASSERT_EQ(writes(), writes_before + 1);
+  RunLocked(
+      [this] { QueueFrameLocked(GRPC_CHTTP2_INITIATE_WRITE_SEND_MESSAGE); });
+  ASSERT_TRUE(WriteHeld());
+  {
+    ExecCtx exec_ctx;
+    std::exchange(t_, nullptr)->Orphan();
+  }
+  EXPECT_TRUE(WaitForWrites(writes_before + 2, absl::Seconds(5)));
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  grpc_init();
+  auto ret = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return ret;
+}
@@ -116,6 +116,153 @@ TEST(WriteSizePolicyTest, MediumWritesJustHangOut) {
   EXPECT_EQ(policy.WriteTargetSize(), 131072);
 }
 
+TEST(ModelWriteSizePolicyTest, InitialValue) {
+  Chttp2ModelWriteSizePolicy policy;
+  EXPECT_EQ(policy.WriteTargetSize(), 131072);
+}
+
+TEST(ModelWriteSizePolicyTest, WritesFillTheLinkForARoundTrip) {
+  Chttp2ModelWriteSizePolicy policy;
+  // 10Gbps with a 1ms round trip.
+  policy.UpdateLinkEstimate({/*bandwidth=*/1.25e9, /*rtt=*/0.001});
+  EXPECT_EQ(policy.WriteTargetSize(), 1250000);
+  // Less what the kernel has yet to send.
+  policy.UpdateLinkEstimate({1.25e9, 0.001, /*unsent_bytes=*/250000});
+  EXPECT_EQ(policy.WriteTargetSize(), 1000000);
+  // Short round trips count as MinRtt().
+  policy.UpdateLinkEstimate({1.25e9, 0.00002});
+  EXPECT_EQ(policy.WriteTargetSize(), 1250000);
+}
+
+TEST(ModelWriteSizePolicyTest, TargetsStayWithinLimits) {
+  Chttp2ModelWriteSizePolicy policy;
+  policy.UpdateLinkEstimate({/*bandwidth=*/1e3, /*rtt=*/0.01});
+  EXPECT_EQ(policy.WriteTargetSize(), Chttp2WriteSizePolicy::MinTarget());
+  policy.UpdateLinkEstimate({1e11, 0.1});
+  EXPECT_EQ(policy.WriteTargetSize(), Chttp2WriteSizePolicy::MaxTarget());
+  policy.UpdateLinkEstimate({1.25e9, 0.001, /*unsent_bytes=*/4000000});
+  EXPECT_EQ(policy.WriteTargetSize(), Chttp2WriteSizePolicy::MinTarget());
+}
+
+TEST(ModelWriteSizePolicyTest, SlowWritesMeasureBandwidth) {
+  ScopedTimeCache time_cache;
+  auto timestamp = [&time_cache](int i) {
+    time_cache.TestOnlySetNow(Timestamp::ProcessEpoch() +
+                              Duration::Milliseconds(i));
+  };
+  Chttp2ModelWriteSizePolicy policy;
+  // Too quick to time.
+  timestamp(10);
+  policy.BeginWrite(1048576);
+  timestamp(11);
+  policy.EndWrite(true);
+  EXPECT_EQ(policy.WriteTargetSize(), 131072);
+  // 1MiB in 10ms.
+  timestamp(20);
+  policy.BeginWrite(1048576);
+  timestamp(30);
+  policy.EndWrite(true);
+  EXPECT_EQ(policy.WriteTargetSize(), 104857);
+  // The kernel's measurement counts when it is higher.
+  policy.UpdateLinkEstimate({/*bandwidth=*/1.25e9, /*rtt=*/0.001});
+  EXPECT_EQ(policy.WriteTargetSize(), 1250000);
+}
+
+TEST(ModelWriteSizePolicyTest, MeasuresLinkOncePerRoundTrip) {
+  ScopedTimeCache time_cache;
+  auto timestamp = [&time_cache](int i) {
+    time_cache.TestOnlySetNow(Timestamp::ProcessEpoch() +
+                              Duration::Milliseconds(i));
+  };
+  Chttp2ModelWriteSizePolicy policy;
+  timestamp(10);
+  EXPECT_TRUE(policy.LinkEstimateDue());
+  policy.UpdateLinkEstimate({/*bandwidth=*/1.25e9, /*rtt=*/0.005});
+  EXPECT_FALSE(policy.LinkEstimateDue());
+  timestamp(14);
+  EXPECT_FALSE(policy.LinkEstimateDue());
+  timestamp(15);
+  EXPECT_TRUE(policy.LinkEstimateDue());
+  // Short round trips count as MinRtt().
+  policy.UpdateLinkEstimate({1.25e9, 0.00002});
+  EXPECT_FALSE(policy.LinkEstimateDue());
+  timestamp(16);
+  EXPECT_TRUE(policy.LinkEstimateDue());
+}
+
+TEST(WriteSizePolicyTest, UseModel) {
+  Chttp2WriteSizePolicy policy;
+  EXPECT_EQ(policy.model(), nullptr);
+  policy.UseModel();
+  ASSERT_NE(policy.model(), nullptr);
+  EXPECT_EQ(policy.WriteTargetSize(), 131072);
+  policy.model()->UpdateLinkEstimate({/*bandwidth=*/1.25e9, /*rtt=*/0.001});
+  EXPECT_EQ(policy.WriteTargetSize(), 1250000);
+}
+
+TEST(WriteCombinerTest, DisabledByDefault) {
+  Chttp2WriteCombiner combiner;
+  EXPECT_FALSE(combiner.enabled());
+  const auto now = Timestamp::FromMillisecondsAfterProcessEpoch(1000);
+  for (int i = 0; i < 10; ++i) combiner.RecordReady(now);
+  EXPECT_EQ(combiner.HoldTime(), Duration::Zero());
+}
+
+TEST(WriteCombinerTest, HoldsWritesOnlyWhileBusy) {
+  Chttp2WriteCombiner combiner;
+  combiner.Configure(Duration::Milliseconds(50), 65536);
+  EXPECT_TRUE(combiner.enabled());
+  auto now = Timestamp::FromMillisecondsAfterProcessEpoch(1000);
+  // A few calls' frames do not make the connection busy.
+  for (int i = 1; i < Chttp2WriteCombiner::MinReadyPerWindow(); ++i) {
+    combiner.RecordReady(now);
+  }
+  EXPECT_EQ(combiner.HoldTime(), Duration::Zero());
+  // More in the same window do.
+  now += Duration::Milliseconds(10);
+  combiner.RecordReady(now);
+  EXPECT_EQ(combiner.HoldTime(), Duration::Milliseconds(50));
+  // Unless the next write has frames that should not wait.
+  combiner.WriteNow();
+  EXPECT_EQ(combiner.HoldTime(), Duration::Zero());
+  combiner.BeginWrite();
+  EXPECT_EQ(combiner.HoldTime(), Duration::Milliseconds(50));
+  // Still busy in the next window, from what happened in the last one.
+  now += Duration::Milliseconds(45);
+  combiner.RecordReady(now);
+  EXPECT_EQ(combiner.HoldTime(), Duration::Milliseconds(50));
+  // Not after a quiet window.
+  now += Duration::Milliseconds(120);
+  combiner.RecordReady(now);
+  EXPECT_EQ(combiner.HoldTime(), Duration::Zero());
+}
+
+TEST(WriteCombinerTest, FullOnceEnoughBytesAreHeld) {
+  Chttp2WriteCombiner combiner;
+  combiner.Configure(Duration::Milliseconds(50), 1000);
+  combiner.AddPendingBytes(600);
+  EXPECT_FALSE(combiner.Full());
+  combiner.AddPendingBytes(600);
+  EXPECT_TRUE(combiner.Full());
+  combiner.BeginWrite();
+  EXPECT_FALSE(combiner.Full());
+}
+
+TEST(WriteCombinerTest, DoesNotHoldWritesOnceFull) {
+  Chttp2WriteCombiner combiner;
+  combiner.Configure(Duration::Milliseconds(50), 1000);
+  const auto now = Timestamp::FromMillisecondsAfterProcessEpoch(1000);
+  for (int i = 0; i < Chttp2WriteCombiner::MinReadyPerWindow(); ++i) {
+    combiner.RecordReady(now);
+  }
+  combiner.AddPendingBytes(600);
+  EXPECT_EQ(combiner.HoldTime(), Duration::Milliseconds(50));
+  combiner.AddPendingBytes(600);
+  EXPECT_EQ(combiner.HoldTime(), Duration::Zero());
+  combiner.BeginWrite();
+  EXPECT_EQ(combiner.HoldTime(), Duration::Milliseconds(50));
+}
+
 }  // namespace
 }  // namespace grpc_core
 
@@ -31,6 +31,12 @@
 #include <string>
 #include <thread>
 
+#ifdef GPR_LINUX
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif  // GPR_LINUX
+
 #include "src/core/tsi/transport_security.h"
 #include "src/core/tsi/transport_security_interface.h"
 #include "src/core/util/memory.h"
@@ -1185,6 +1191,175 @@ TEST_P(SslTransportSecurityTest, ConcurrentlyProtectAndUnprotectOnServer) {
   tsi_frame_protector_destroy(client_protector);
   tsi_frame_protector_destroy(server_protector);
 }
+
+TEST_P(SslTransportSecurityTest, KernelOffloadWithoutSocket) {
+  SetUpSslFixture(tsi_tls_version::TSI_TLS1_3, /*send_client_ca_list=*/false);
+  DoHandshake();
+  bool protect_offloaded = true;
+  bool unprotect_offloaded = true;
+  EXPECT_EQ(tsi_handshaker_result_offload_to_kernel(
+                ssl_tsi_test_fixture_->server_result, /*fd=*/-1,
+                &protect_offloaded, &unprotect_offloaded),
+            TSI_OK);
+  EXPECT_FALSE(protect_offloaded);
+  EXPECT_FALSE(unprotect_offloaded);
+  tsi_frame_protector_type frame_protector_type;
+  EXPECT_EQ(tsi_handshaker_result_get_frame_protector_type(
+                ssl_tsi_test_fixture_->server_result, &frame_protector_type),
+            TSI_OK);
+  EXPECT_EQ(frame_protector_type, TSI_FRAME_PROTECTOR_NORMAL);
+  tsi_frame_protector* server_protector;
+  EXPECT_EQ(tsi_handshaker_result_create_frame_protector(
+                ssl_tsi_test_fixture_->server_result,
+                /*max_output_protected_frame_size=*/nullptr, &server_protector),
+            TSI_OK);
+  ASSERT_NE(server_protector, nullptr);
+  EXPECT_FALSE(tsi_frame_protector_protect_is_passthrough(server_protector));
+  std::string buffer(1024, 'a');
+  EXPECT_EQ(Protect(server_protector, buffer).size(),
+            buffer.size() + kTls13FrameOverhead);
+  tsi_frame_protector_destroy(server_protector);
+}
+
+#ifdef GPR_LINUX
+namespace {
+
+// Connects two TCP sockets over the loopback interface.
+void MakeTcpPair(int* client_fd, int* server_fd) {
+  int listener = socket(AF_INET, SOCK_STREAM, 0);
+  ASSERT_GE(listener, 0);
+  sockaddr_in addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  socklen_t addr_len = sizeof(addr);
+  ASSERT_EQ(bind(listener, reinterpret_cast<sockaddr*>(&addr), addr_len), 0);
+  ASSERT_EQ(listen(listener, 1), 0);
+  ASSERT_EQ(
+      getsockname(listener, reinterpret_cast<sockaddr*>(&addr), &addr_len), 0);
+  *client_fd = socket(AF_INET, SOCK_STREAM, 0);
+  ASSERT_GE(*client_fd, 0);
+  ASSERT_EQ(connect(*client_fd, reinterpret_cast<sockaddr*>(&addr), addr_len),
+            0);
+  *server_fd = accept(listener, nullptr, nullptr);
+  ASSERT_GE(*server_fd, 0);
+  close(listener);
+}
+
+void WriteAll(int fd, absl::string_view bytes) {
+  while (!bytes.empty()) {
+    ssize_t n = write(fd, bytes.data(), bytes.size());
+    ASSERT_GT(n, 0);
+    bytes.remove_prefix(n);
+  }
+}
+
+std::string ReadExactly(int fd, size_t size) {
+  std::string bytes(size, '\0');
+  size_t read_size = 0;
+  while (read_size < size) {
+    ssize_t n = read(fd, &bytes[read_size], size - read_size);
+    if (n <= 0) break;
+    read_size += n;
+  }
+  bytes.resize(read_size);
+  return bytes;
+}
+
+}  // namespace
+
+// The server hands both directions to the kernel, which must interoperate
+// with the client's user space protector.
+TEST_P(SslTransportSecurityTest, KernelOffload) {
+  SetUpSslFixture(tsi_tls_version::TSI_TLS1_3, /*send_client_ca_list=*/false);
+  DoHandshake();
+  int client_fd;
+  int server_fd;
+  MakeTcpPair(&client_fd, &server_fd);
+  bool protect_offloaded;
+  bool unprotect_offloaded;
+  ASSERT_EQ(tsi_handshaker_result_offload_to_kernel(
+                ssl_tsi_test_fixture_->server_result, server_fd,
+                &protect_offloaded, &unprotect_offloaded),
+            TSI_OK);
+  if (!protect_offloaded) {
+    close(client_fd);
+    close(server_fd);
+    GTEST_SKIP() << "Kernel TLS is not available";
+  }
+  EXPECT_TRUE(unprotect_offloaded);
+  tsi_frame_protector_type frame_protector_type;
+  EXPECT_EQ(tsi_handshaker_result_get_frame_protector_type(
+                ssl_tsi_test_fixture_->server_result, &frame_protector_type),
+            TSI_OK);
+  EXPECT_EQ(frame_protector_type, TSI_FRAME_PROTECTOR_NONE);
+  tsi_frame_protector* client_protector;
+  EXPECT_EQ(tsi_handshaker_result_create_frame_protector(
+                ssl_tsi_test_fixture_->client_result,
+                /*max_output_protected_frame_size=*/nullptr, &client_protector),
+            TSI_OK);
+  ASSERT_NE(client_protector, nullptr);
+  // Client to server: protected in user space, unprotected by the kernel.
+  std::string buffer(1024, 'a');
+  WriteAll(client_fd, Protect(client_protector, buffer));
+  EXPECT_EQ(ReadExactly(server_fd, buffer.size()), buffer);
+  // Server to client: protected by the kernel, unprotected in user space.
+  std::string second_buffer(2048, 'b');
+  WriteAll(server_fd, second_buffer);
+  EXPECT_EQ(
+      Unprotect(client_protector,
+                ReadExactly(client_fd,
+                            second_buffer.size() + kTls13FrameOverhead)),
+      second_buffer);
+  tsi_frame_protector_destroy(client_protector);
+  close(client_fd);
+  close(server_fd);
+}
+
+// A client only hands the protection of what it sends to the kernel.
+TEST_P(SslTransportSecurityTest, KernelOffloadOnClient) {
+  SetUpSslFixture(tsi_tls_version::TSI_TLS1_3, /*send_client_ca_list=*/false);
+  DoHandshake();
+  int client_fd;
+  int server_fd;
+  MakeTcpPair(&client_fd, &server_fd);
+  bool protect_offloaded;
+  bool unprotect_offloaded;
+  ASSERT_EQ(tsi_handshaker_result_offload_to_kernel(
+                ssl_tsi_test_fixture_->client_result, client_fd,
+                &protect_offloaded, &unprotect_offloaded),
+            TSI_OK);
+  if (!protect_offloaded) {
+    close(client_fd);
+    close(server_fd);
+    GTEST_SKIP() << "Kernel TLS is not available";
+  }
+  EXPECT_FALSE(unprotect_offloaded);
+  tsi_frame_protector* client_protector;
+  EXPECT_EQ(tsi_handshaker_result_create_frame_protector(
+                ssl_tsi_test_fixture_->client_result,
+                /*max_output_protected_frame_size=*/nullptr, &client_protector),
+            TSI_OK);
+  ASSERT_NE(client_protector, nullptr);
+  EXPECT_TRUE(tsi_frame_protector_protect_is_passthrough(client_protector));
+  tsi_frame_protector* server_protector;
+  EXPECT_EQ(tsi_handshaker_result_create_frame_protector(
+                ssl_tsi_test_fixture_->server_result,
+                /*max_output_protected_frame_size=*/nullptr, &server_protector),
+            TSI_OK);
+  ASSERT_NE(server_protector, nullptr);
+  std::string buffer(1024, 'a');
+  WriteAll(client_fd, Protect(client_protector, buffer));
+  EXPECT_EQ(Unprotect(server_protector,
+                      ReadExactly(server_fd,
+                                  buffer.size() + kTls13FrameOverhead)),
+            buffer);
+  tsi_frame_protector_destroy(client_protector);
+  tsi_frame_protector_destroy(server_protector);
+  close(client_fd);
+  close(server_fd);
+}
+#endif  // GPR_LINUX
 #endif  // defined(OPENSSL_IS_BORINGSSL)
 
 static const tsi_ssl_handshaker_factory_vtable* original_vtable;
@@ -29,6 +29,7 @@
 #include <grpcpp/server.h>
 #include <grpcpp/server_builder.h>
 #include <grpcpp/server_context.h>
+#include <grpcpp/support/byte_buffer.h>
 #include <grpcpp/support/string_ref.h>
 #include <grpcpp/test/channel_test_peer.h>
 
@@ -40,6 +41,8 @@
 #include "src/core/credentials/call/call_credentials.h"
 #include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/iomgr/iomgr.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
 #include "src/core/util/crash.h"
 #include "src/core/util/env.h"
 #include "src/core/util/grpc_check.h"
@@ -414,6 +417,11 @@ class End2endTest : public ::testing::TestWithParam<TestScenario> {
       args.SetUserAgentPrefix(user_agent_prefix_);
     }
     args.SetString(GRPC_ARG_SECONDARY_USER_AGENT_STRING, "end2end_test");
+    if (inproc_object_passing_) {
+      args.SetInt(GRPC_ARG_INPROC_OBJECT_PASSING, 1);
+      // Only the promise based transport passes objects.
+      args.SetInt("grpc.experimental.promise_based_inproc_transport", 1);
+    }
     ApplyCommonChannelArguments(args);
     if (!GetParam().inproc()) {
       if (!GetParam().use_interceptors()) {
@@ -478,6 +486,7 @@ class End2endTest : public ::testing::TestWithParam<TestScenario> {
   TestServiceImpl special_service_;
   TestServiceImplDupPkg dup_pkg_service_;
   std::string user_agent_prefix_;
+  bool inproc_object_passing_ = false;
   int first_picked_port_;
 };
 
@@ -1090,6 +1099,91 @@ TEST_P(End2endTest, BidiStream) {
   EXPECT_TRUE(s.ok());
 }
 
+// Messages passed as objects by this process so far.
+uint64_t BoxedMessages() {
+  return grpc_core::global_stats().Collect()->boxed_messages;
+}
+
+TEST_P(End2endTest, InprocObjectPassing) {
+  if (!GetParam().inproc()) {
+    return;
+  }
+  inproc_object_passing_ = true;
+  ResetStub();
+  // Interceptors may read serialized messages, so calls with them serialize.
+  const bool passes_objects = !GetParam().use_interceptors();
+  uint64_t boxed = BoxedMessages();
+  EchoRequest request;
+  EchoResponse response;
+  request.set_message("Hello hello hello hello");
+  ClientContext context;
+  Status s = stub_->Echo(&context, request, &response);
+  EXPECT_EQ(response.message(), request.message());
+  EXPECT_TRUE(s.ok());
+  // The request is copied, not moved from.
+  EXPECT_EQ(request.message(), "Hello hello hello hello");
+  // Both the request and the response were passed as objects.
+  if (passes_objects) {
+    EXPECT_GE(BoxedMessages(), boxed + 2);
+  } else {
+    EXPECT_EQ(BoxedMessages(), boxed);
+  }
+
+  boxed = BoxedMessages();
+  ClientContext stream_context;
+  auto stream = stub_->BidiStream(&stream_context);
+  for (int i = 0; i < kServerDefaultResponseStreamsToSend; ++i) {
+    request.set_message("hello" + std::to_string(i));
+    EXPECT_TRUE(stream->Write(request));
+    EXPECT_TRUE(stream->Read(&response));
+    EXPECT_EQ(response.message(), request.message());
+  }
+  stream->WritesDone();
+  EXPECT_FALSE(stream->Read(&response));
+  EXPECT_TRUE(stream->Finish().ok());
+  if (passes_objects) {
+    EXPECT_GE(BoxedMessages(), boxed + 2 * kServerDefaultResponseStreamsToSend);
+  }
+}
+
+TEST_P(End2endTest, InprocObjectPassingKeepsMaxMessageSize) {
+  if (!GetParam().inproc() || GetParam().use_interceptors() ||
+      GetParam().use_proxy()) {
+    return;
+  }
+  inproc_object_passing_ = true;
+  ResetStub();
+  // A message over the server's limit is serialized, and rejected.
+  const uint64_t boxed = BoxedMessages();
+  EchoRequest request;
+  EchoResponse response;
+  request.set_message(std::string(kMaxMessageSize_ * 2, 'a'));
+  ClientContext context;
+  Status s = stub_->Echo(&context, request, &response);
+  EXPECT_EQ(s.error_code(), grpc::StatusCode::RESOURCE_EXHAUSTED);
+  EXPECT_EQ(BoxedMessages(), boxed);
+}
+
+TEST_P(End2endTest, InprocObjectPassingSkipsCompression) {
+  if (!GetParam().inproc() || GetParam().use_interceptors() ||
+      GetParam().use_proxy()) {
+    return;
+  }
+  inproc_object_passing_ = true;
+  ResetStub();
+  // Boxed messages have no bytes to compress: the call still passes objects.
+  const uint64_t boxed = BoxedMessages();
+  EchoRequest request;
+  EchoResponse response;
+  request.set_message(std::string(1000, 'a'));
+  ClientContext context;
+  context.set_compression_algorithm(GRPC_COMPRESS_GZIP);
+  Status s = stub_->Echo(&context, request, &response);
+  EXPECT_TRUE(s.ok());
+  EXPECT_EQ(response.message(), request.message());
+  EXPECT_GE(BoxedMessages(), boxed + 2);
+}
+
 TEST_P(End2endTest, BidiStreamWithCoalescingApi) {
   ResetStub();
   EchoRequest request;
@@ -0,0 +1,149 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Measures how quickly an EventEngine listener accepts a storm of new
+// connections, as a function of the number of SO_REUSEPORT listener shards.
+
+#include <benchmark/benchmark.h>
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/impl/channel_arg_names.h>
+#include <grpcpp/impl/grpc_library.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/event_engine/channel_args_endpoint_config.h"
+#include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/lib/event_engine/tcp_socket_utils.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/util/grpc_check.h"
+#include "src/core/util/notification.h"
+#include "src/core/util/sync.h"
+#include "test/core/test_util/port.h"
+#include "test/core/test_util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+#include "absl/status/status.h"
+#include "absl/strings/str_cat.h"
+
+namespace {
+
+using ::grpc_event_engine::experimental::ChannelArgsEndpointConfig;
+using ::grpc_event_engine::experimental::EventEngine;
+using ::grpc_event_engine::experimental::GetDefaultEventEngine;
+using ::grpc_event_engine::experimental::MemoryAllocator;
+using ::grpc_event_engine::experimental::URIToResolvedAddress;
+
+constexpr int kClientThreads = 8;
+
+// Opens range(1) connections per iteration from kClientThreads threads, and
+// waits for the listener, which has range(0) shards, to accept all of them.
+void BM_AcceptStorm(benchmark::State& state) {
+  const int num_shards = state.range(0);
+  const int connections = state.range(1);
+  auto engine = GetDefaultEventEngine();
+  grpc_core::ChannelArgs args =
+      grpc_core::ChannelArgs()
+          .Set(GRPC_ARG_RESOURCE_QUOTA, grpc_core::ResourceQuota::Default())
+          .Set(GRPC_ARG_ALLOW_REUSEPORT, 1)
+          .Set(GRPC_ARG_EXPERIMENTAL_TCP_LISTENER_SHARDS, num_shards);
+  ChannelArgsEndpointConfig config(args);
+  grpc_core::Mutex mu;
+  std::vector<std::unique_ptr<EventEngine::Endpoint>> accepted;
+  std::atomic<int> remaining{0};
+  grpc_core::Notification* done = nullptr;
+  grpc_core::Notification shutdown;
+  auto listener = engine->CreateListener(
+      [&](std::unique_ptr<EventEngine::Endpoint> ep, MemoryAllocator) {
+        {
+          grpc_core::MutexLock lock(&mu);
+          accepted.push_back(std::move(ep));
+        }
+        if (remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+          done->Notify();
+        }
+      },
+      [&](absl::Status) { shutdown.Notify(); }, config,
+      std::make_unique<grpc_core::MemoryQuota>(
+          grpc_core::MakeRefCounted<grpc_core::channelz::ResourceQuotaNode>(
+              "bm_accept_storm")));
+  GRPC_CHECK_OK(listener.status());
+  const int port = grpc_pick_unused_port_or_die();
+  auto addr = URIToResolvedAddress(absl::StrCat("ipv4:127.0.0.1:", port));
+  GRPC_CHECK_OK(addr.status());
+  GRPC_CHECK_OK((*listener)->Bind(*addr).status());
+  GRPC_CHECK_OK((*listener)->Start());
+
+  std::vector<int> clients(connections, -1);
+  for (auto _ : state) {
+    grpc_core::Notification all_accepted;
+    done = &all_accepted;
+    remaining.store(connections, std::memory_order_relaxed);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kClientThreads; ++t) {
+      threads.emplace_back([&, t]() {
+        for (int i = t; i < connections; i += kClientThreads) {
+          clients[i] = socket(AF_INET, SOCK_STREAM, 0);
+          GRPC_CHECK_GE(clients[i], 0);
+          GRPC_CHECK_EQ(connect(clients[i], addr->address(), addr->size()), 0);
+        }
+      });
+    }
+    for (auto& thread : threads) thread.join();
+    all_accepted.WaitForNotification();
+    state.PauseTiming();
+    for (int& fd : clients) {
+      close(fd);
+      fd = -1;
+    }
+    {
+      grpc_core::MutexLock lock(&mu);
+      accepted.clear();
+    }
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * connections);
+  listener->reset();
+  shutdown.WaitForNotification();
+}
+BENCHMARK(BM_AcceptStorm)
+    ->ArgsProduct({{1, 2, 4, 8}, {1024}})
+    ->MeasureProcessCPUTime()
+    ->UseRealTime();
+
+}  // namespace
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  LibraryInitializer libInit;
+  benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -20,6 +20,7 @@
 
 #include <benchmark/benchmark.h>
 
+#include "src/core/call/call_arena_allocator.h"
 #include "src/core/lib/resource_quota/arena.h"
 #include "src/core/lib/resource_quota/resource_quota.h"
 #include "test/core/test_util/test_config.h"
@@ -60,6 +61,22 @@ static void BM_Arena_Batch(benchmark::State& state) {
 }
 BENCHMARK(BM_Arena_Batch)->Ranges({{1, 64 * 1024}, {1, 64}, {1, 1024}});
 
+// Arenas of calls made one after another, as by a channel.
+// Arguments: bytes allocated per call, whether arena storage is recycled.
+static void BM_Arena_CallArenaAllocator(benchmark::State& state) {
+  auto memory_quota =
+      grpc_core::MakeResourceQuota("bm_arena")->memory_quota();
+  auto allocator = grpc_core::MakeRefCounted<grpc_core::CallArenaAllocator>(
+      memory_quota->CreateMemoryAllocator("bm_arena"), 1024,
+      state.range(1) != 0 ? memory_quota : nullptr);
+  for (auto _ : state) {
+    allocator->MakeArena()->Alloc(state.range(0));
+  }
+}
+BENCHMARK(BM_Arena_CallArenaAllocator)
+    ->ArgsProduct({{256, 4096}, {0, 1}})
+    ->ThreadRange(1, 8);
+
 struct TestThingToAllocate {
   int a;
   int b;
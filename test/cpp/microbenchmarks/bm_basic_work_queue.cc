@@ -15,10 +15,14 @@
 #include <grpc/event_engine/event_engine.h>
 #include <grpc/support/port_platform.h>
 
+#include <atomic>
 #include <deque>
+#include <thread>
+#include <vector>
 
 #include "src/core/lib/event_engine/common_closures.h"
 #include "src/core/lib/event_engine/work_queue/basic_work_queue.h"
+#include "src/core/lib/event_engine/work_queue/chase_lev_work_queue.h"
 #include "src/core/util/grpc_check.h"
 #include "src/core/util/sync.h"
 #include "test/core/test_util/test_config.h"
@@ -27,6 +31,7 @@ namespace {
 
 using ::grpc_event_engine::experimental::AnyInvocableClosure;
 using ::grpc_event_engine::experimental::BasicWorkQueue;
+using ::grpc_event_engine::experimental::ChaseLevWorkQueue;
 using ::grpc_event_engine::experimental::EventEngine;
 
 grpc_core::Mutex globalMu;
@@ -122,6 +127,62 @@ void BM_MultithreadedStdDequeLIFO(benchmark::State& state) {
 }
 BENCHMARK(BM_MultithreadedStdDequeLIFO)->Apply(MultithreadedTestArguments);
 
+// --- Work Stealing Tests ---------------------------------------------------
+
+// Models a thread pool worker's local queue: one owner thread adds closures
+// and pops the most recent ones, while range(1) thieves concurrently steal
+// the oldest. Reports the owner's throughput and how much was stolen. The
+// element counts stay below ChaseLevWorkQueue's capacity.
+template <typename Queue>
+void BM_WorkQueueOwnerWithThieves(benchmark::State& state) {
+  Queue queue;
+  AnyInvocableClosure closure([] {});
+  const int element_count = state.range(0);
+  const int thief_count = state.range(1);
+  std::atomic<int> consumed{0};
+  std::atomic<int64_t> stolen{0};
+  std::atomic<bool> done{false};
+  std::vector<std::thread> thieves;
+  thieves.reserve(thief_count);
+  for (int i = 0; i < thief_count; i++) {
+    thieves.emplace_back([&] {
+      while (!done.load(std::memory_order_relaxed)) {
+        if (queue.PopOldest() != nullptr) {
+          consumed.fetch_add(1, std::memory_order_relaxed);
+          stolen.fetch_add(1, std::memory_order_relaxed);
+        }
+      }
+    });
+  }
+  for (auto _ : state) {
+    consumed.store(0, std::memory_order_relaxed);
+    for (int i = 0; i < element_count; i++) queue.Add(&closure);
+    while (consumed.load(std::memory_order_relaxed) < element_count) {
+      if (queue.PopMostRecent() != nullptr) {
+        consumed.fetch_add(1, std::memory_order_relaxed);
+      }
+    }
+  }
+  done.store(true, std::memory_order_relaxed);
+  for (auto& thd : thieves) thd.join();
+  GRPC_CHECK(queue.Empty());
+  state.counters["pop_rate"] = benchmark::Counter(
+      element_count * state.iterations(), benchmark::Counter::kIsRate);
+  state.counters["stolen_ratio"] =
+      static_cast<double>(stolen.load()) / (element_count * state.iterations());
+}
+
+void OwnerWithThievesArguments(benchmark::internal::Benchmark* b) {
+  b->ArgsProduct({{16, 256}, {0, 1, 4, 16}})
+      ->UseRealTime()
+      ->MeasureProcessCPUTime();
+}
+
+BENCHMARK(BM_WorkQueueOwnerWithThieves<BasicWorkQueue>)
+    ->Apply(OwnerWithThievesArguments);
+BENCHMARK(BM_WorkQueueOwnerWithThieves<ChaseLevWorkQueue>)
+    ->Apply(OwnerWithThievesArguments);
+
 // --- Basic Functionality Tests ---------------------------------------------
 
 void BM_WorkQueueIntptrPopMostRecent(benchmark::State& state) {
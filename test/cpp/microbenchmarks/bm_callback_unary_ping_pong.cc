@@ -101,6 +101,17 @@ BENCHMARK_TEMPLATE(BM_CallbackUnaryPingPong, InProcess, NoOpMutator,
 BENCHMARK_TEMPLATE(BM_CallbackUnaryPingPong, InProcess, NoOpMutator,
                    Server_AddInitialMetadata<RandomAsciiMetadata<10>, 100>)
     ->Args({0, 0});
+
+// Many calls at once on one connection: at 100k calls per second, parsing the
+// frames of the connection is a bottleneck.
+BENCHMARK_TEMPLATE(BM_CallbackUnaryCallsInFlight, TCP)
+    ->Arg(100)
+    ->Arg(1000)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_CallbackUnaryCallsInFlight, TlsTCP)
+    ->Arg(100)
+    ->Arg(1000)
+    ->UseRealTime();
 }  // namespace testing
 }  // namespace grpc
 
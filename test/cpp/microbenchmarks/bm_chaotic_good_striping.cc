@@ -0,0 +1,143 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Time to send one large message over chaotic_good data connections whose
+// bandwidths differ, for each scheduler.
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "src/core/ext/transport/chaotic_good/scheduler.h"
+#include "src/core/ext/transport/chaotic_good/send_rate.h"
+#include "src/core/ext/transport/chaotic_good/tcp_ztrace_collector.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace chaotic_good {
+namespace {
+
+constexpr uint64_t kMessageSize = 1024 * 1024 * 1024;
+// The default chunk size of the transport.
+constexpr uint64_t kChunkSize = 1024 * 1024;
+// Bytes the kernel of each connection buffers: a connection is ready for
+// more frames once what it has queued fits.
+constexpr double kSendBuffer = 4 * 1024 * 1024;
+constexpr double kRtt = 100e-6;
+
+const char* const kSchedulers[] = {"spanrr", "pick_best", "stripe"};
+
+struct LaneSet {
+  // Bytes per second of each data connection.
+  std::vector<double> bandwidths;
+};
+
+const LaneSet kLaneSets[] = {
+    {{10e9 / 8, 10e9 / 8, 10e9 / 8, 10e9 / 8}},
+    {{10e9 / 8, 10e9 / 8, 10e9 / 8, 1e9 / 8}},
+    {{25e9 / 8, 10e9 / 8, 5e9 / 8, 1e9 / 8}},
+};
+
+// A data connection shaped by a token bucket that drains its queue at a fixed
+// rate.
+struct Lane {
+  double bandwidth;
+  // Bytes queued on the connection.
+  double queued = 0;
+};
+
+// The chunks of one message are queued at once and placed by the scheduler
+// each time a connection becomes ready, as the data endpoints do. Reports the
+// time until the last byte of the message is delivered, and the resulting
+// goodput.
+// Arguments: scheduler, set of connection bandwidths.
+void BM_Striping(benchmark::State& state) {
+  const LaneSet& lane_set = kLaneSets[state.range(1)];
+  TcpZTraceCollector ztrace_collector;
+  double completion_time = 0;
+  for (auto _ : state) {
+    auto scheduler = MakeScheduler(kSchedulers[state.range(0)]);
+    std::vector<Lane> lanes;
+    for (double bandwidth : lane_set.bandwidths) {
+      lanes.push_back(Lane{bandwidth});
+    }
+    uint64_t unsent = kMessageSize;
+    double now = 0;
+    completion_time = 0;
+    while (unsent > 0) {
+      scheduler->NewStep(unsent, std::min(unsent, kChunkSize));
+      for (size_t i = 0; i < lanes.size(); ++i) {
+        SendRate::DeliveryData delivery_data{};
+        delivery_data.start_time =
+            kRtt / 2 + lanes[i].queued / lanes[i].bandwidth;
+        delivery_data.bytes_per_second = lanes[i].bandwidth;
+        delivery_data.queued_bytes.network_outstanding_bytes =
+            static_cast<uint64_t>(lanes[i].queued);
+        scheduler->AddChannel(i, lanes[i].queued <= kSendBuffer, delivery_data);
+      }
+      scheduler->MakePlan(ztrace_collector);
+      while (unsent > 0) {
+        const uint64_t chunk = std::min(unsent, kChunkSize);
+        std::optional<uint32_t> lane = scheduler->AllocateMessage(chunk);
+        if (!lane.has_value()) break;
+        Lane& l = lanes[*lane];
+        l.queued += chunk;
+        unsent -= chunk;
+        completion_time =
+            std::max(completion_time, now + kRtt / 2 + l.queued / l.bandwidth);
+      }
+      // Advance to when the next busy connection becomes ready, or a little
+      // if none is busy but the scheduler held back.
+      double step = std::numeric_limits<double>::max();
+      for (const Lane& l : lanes) {
+        if (l.queued > kSendBuffer) {
+          step = std::min(step, (l.queued - kSendBuffer) / l.bandwidth);
+        }
+      }
+      if (step == std::numeric_limits<double>::max()) step = kRtt;
+      now += step;
+      for (Lane& l : lanes) {
+        l.queued = std::max(0.0, l.queued - l.bandwidth * step);
+      }
+    }
+  }
+  state.counters["completion_ms"] = completion_time * 1e3;
+  state.counters["goodput_gbps"] = kMessageSize * 8 / completion_time / 1e9;
+}
+BENCHMARK(BM_Striping)
+    ->ArgsProduct({{0, 1, 2}, {0, 1, 2}})
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace
+}  // namespace chaotic_good
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
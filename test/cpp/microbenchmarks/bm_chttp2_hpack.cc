@@ -24,8 +24,13 @@
 #include <grpc/support/port_platform.h>
 #include <string.h>
 
+#include <cstdint>
 #include <memory>
+#include <random>
 #include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "src/core/call/metadata_batch.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_encoder.h"
@@ -42,6 +47,7 @@
 #include "test/cpp/util/test_config.h"
 #include "absl/log/log.h"
 #include "absl/random/random.h"
+#include "absl/strings/str_cat.h"
 
 static grpc_slice MakeSlice(const std::vector<uint8_t>& bytes) {
   grpc_slice s = grpc_slice_malloc(bytes.size());
@@ -138,6 +144,16 @@ static void BM_HpackEncoderEncodeDeadline(benchmark::State& state) {
 }
 BENCHMARK(BM_HpackEncoderEncodeDeadline);
 
+// Fixtures may define Configure(HPackCompressor*) to set up the compressor
+// before the first call.
+template <class Fixture>
+static auto ConfigureCompressor(grpc_core::HPackCompressor* c, int)
+    -> decltype(Fixture::Configure(c)) {
+  Fixture::Configure(c);
+}
+template <class Fixture>
+static void ConfigureCompressor(grpc_core::HPackCompressor*, long) {}
+
 template <class Fixture>
 static void BM_HpackEncoderEncodeHeader(benchmark::State& state) {
   grpc_core::ExecCtx exec_ctx;
@@ -147,6 +163,8 @@ static void BM_HpackEncoderEncodeHeader(benchmark::State& state) {
   Fixture::Prepare(&b);
 
   grpc_core::HPackCompressor c;
+  ConfigureCompressor<Fixture>(&c, 0);
+  size_t encoded_bytes = 0;
   grpc_core::FakeCallTracer call_tracer;
   grpc_slice_buffer outbuf;
   grpc_slice_buffer_init(&outbuf);
@@ -167,10 +185,13 @@ static void BM_HpackEncoderEncodeHeader(benchmark::State& state) {
         gpr_free(s);
       }
     }
+    encoded_bytes += outbuf.length;
     grpc_slice_buffer_reset_and_unref(&outbuf);
     grpc_core::ExecCtx::Get()->Flush();
   }
   grpc_slice_buffer_destroy(&outbuf);
+  state.counters["encoded_bytes_per_call"] = benchmark::Counter(
+      static_cast<double>(encoded_bytes), benchmark::Counter::kAvgIterations);
 }
 
 namespace hpack_encoder_fixtures {
@@ -294,6 +315,98 @@ class MoreRepresentativeClientInitialMetadata {
   }
 };
 
+// A client that authenticates with a bearer token and propagates large binary
+// context, without true binary support: the bulk of the header block is long
+// huffman coded and base64 encoded values.
+class LargeValueClientInitialMetadata {
+ public:
+  static constexpr bool kEnableTrueBinary = false;
+  static void Prepare(grpc_metadata_batch* b) {
+    b->Set(grpc_core::HttpSchemeMetadata(),
+           grpc_core::HttpSchemeMetadata::kHttp);
+    b->Set(grpc_core::HttpMethodMetadata(),
+           grpc_core::HttpMethodMetadata::kPost);
+    b->Set(grpc_core::HttpPathMetadata(),
+           grpc_core::Slice(grpc_core::StaticSlice::FromStaticString(
+               "/grpc.test.FooService/BarMethod")));
+    b->Set(grpc_core::HttpAuthorityMetadata(),
+           grpc_core::Slice(grpc_core::StaticSlice::FromStaticString(
+               "foo.test.google.fr:1234")));
+    b->Append("authorization", MakeToken(), CrashOnAppendError);
+    b->Append("x-context-bin", MakeBytes(1024), CrashOnAppendError);
+    b->Set(grpc_core::GrpcTraceBinMetadata(), MakeBytes(29));
+    b->Set(grpc_core::TeMetadata(), grpc_core::TeMetadata::kTrailers);
+    b->Set(grpc_core::ContentTypeMetadata(),
+           grpc_core::ContentTypeMetadata::kApplicationGrpc);
+  }
+
+ private:
+  // A JWT sized bearer token, in the base64url alphabet.
+  static grpc_core::Slice MakeToken() {
+    static constexpr char kAlphabet[] =
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+    std::string token = "Bearer ";
+    for (int i = 0; i < 800; i++) {
+      token.push_back(i % 200 == 199 ? '.' : kAlphabet[rand() % 64]);
+    }
+    return grpc_core::Slice::FromCopiedString(token);
+  }
+  static grpc_core::Slice MakeBytes(int length) {
+    std::vector<char> v;
+    v.reserve(length);
+    for (int i = 0; i < length; i++) {
+      v.push_back(static_cast<char>(rand()));
+    }
+    return grpc_core::Slice::FromCopiedBuffer(v);
+  }
+};
+
+// Application metadata that is the same on every call of a channel, as
+// static slices: the encoder recognizes the values when it sees them again.
+class RepeatedCustomClientInitialMetadata {
+ public:
+  static constexpr bool kEnableTrueBinary = false;
+  static void Prepare(grpc_metadata_batch* b) {
+    RepresentativeClientInitialMetadata::Prepare(b);
+    b->Append("x-tenant-id",
+              grpc_core::Slice::FromStaticString("tenant-0123456789"),
+              CrashOnAppendError);
+    b->Append("x-client-build",
+              grpc_core::Slice::FromStaticString("frontend/2025.06.1-rc3"),
+              CrashOnAppendError);
+    b->Append("x-routing-key",
+              grpc_core::Slice::FromStaticString("us-east1/cell-7/shard-42"),
+              CrashOnAppendError);
+  }
+};
+
+// The same metadata copied into each call, declared to the compressor as
+// static, as GRPC_ARG_HTTP2_STATIC_METADATA does.
+class DeclaredCustomClientInitialMetadata {
+ public:
+  static constexpr bool kEnableTrueBinary = false;
+  static void Configure(grpc_core::HPackCompressor* c) {
+    for (const auto& kv : kPairs) {
+      c->AddStaticMetadata(grpc_core::Slice::FromStaticString(kv.first),
+                           grpc_core::Slice::FromStaticString(kv.second));
+    }
+  }
+  static void Prepare(grpc_metadata_batch* b) {
+    RepresentativeClientInitialMetadata::Prepare(b);
+    for (const auto& kv : kPairs) {
+      b->Append(kv.first, grpc_core::Slice::FromCopiedString(kv.second),
+                CrashOnAppendError);
+    }
+  }
+
+ private:
+  static constexpr std::pair<const char*, const char*> kPairs[] = {
+      {"x-tenant-id", "tenant-0123456789"},
+      {"x-client-build", "frontend/2025.06.1-rc3"},
+      {"x-routing-key", "us-east1/cell-7/shard-42"},
+  };
+};
+
 class RepresentativeServerInitialMetadata {
  public:
   static constexpr bool kEnableTrueBinary = true;
@@ -333,6 +446,8 @@ BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader, SingleBinaryElem<31, false>)
     ->Args({0, 16384});
 BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader, SingleBinaryElem<100, false>)
     ->Args({0, 16384});
+BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader, SingleBinaryElem<1024, false>)
+    ->Args({0, 16384});
 // test with a tiny frame size, to highlight continuation costs
 BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader, SingleNonBinaryElem)
     ->Args({0, 1});
@@ -343,6 +458,15 @@ BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader,
 BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader,
                    MoreRepresentativeClientInitialMetadata)
     ->Args({0, 16384});
+BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader,
+                   LargeValueClientInitialMetadata)
+    ->Args({0, 16384});
+BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader,
+                   RepeatedCustomClientInitialMetadata)
+    ->Args({0, 16384});
+BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader,
+                   DeclaredCustomClientInitialMetadata)
+    ->Args({0, 16384});
 BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader,
                    RepresentativeServerInitialMetadata)
     ->Args({0, 16384});
@@ -350,6 +474,107 @@ BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader,
                    RepresentativeServerTrailingMetadata)
     ->Args({1, 16384});
 
+// Client initial metadata of the calls on one connection: a few hot methods,
+// deadlines that are mostly one of a few values, a request id that differs on
+// every call, the addresses of many end users forwarded by a proxy, and the
+// credentials of the few users that are active. Credentials are sent as
+// literals that are never indexed, however often they repeat.
+struct TracedCall {
+  std::string path;
+  int64_t timeout_ms;
+  std::string request_id;
+  std::string forwarded_for;
+  std::string user_id;
+  std::string authorization;
+};
+
+static const std::vector<TracedCall>& Trace() {
+  static const auto* const trace = []() {
+    constexpr int kCalls = 2000;
+    constexpr int kMethods = 20;
+    constexpr int kUsers = 8;
+    constexpr int64_t kTimeoutsMs[] = {250, 1000, 5000, 30000};
+    auto* trace = new std::vector<TracedCall>();
+    std::mt19937 rng(42);
+    std::vector<double> method_weights;
+    for (int i = 0; i < kMethods; ++i) method_weights.push_back(1.0 / (i + 1));
+    std::discrete_distribution<int> method(method_weights.begin(),
+                                           method_weights.end());
+    for (int i = 0; i < kCalls; ++i) {
+      TracedCall call;
+      call.path = absl::StrCat("/example.v1.OrderService/Method", method(rng));
+      call.timeout_ms =
+          rng() % 10 < 8 ? kTimeoutsMs[rng() % 4] : 100 + rng() % 5000;
+      call.request_id = absl::StrCat(absl::Hex(rng(), absl::kZeroPad8),
+                                     absl::Hex(rng(), absl::kZeroPad8));
+      call.forwarded_for = absl::StrCat("10.", rng() % 256, ".", rng() % 256,
+                                        ".", rng() % 256);
+      const int user = rng() % kUsers;
+      call.user_id = absl::StrCat("user-", user);
+      call.authorization =
+          absl::StrCat("Bearer ", std::string(120, 'a' + user));
+      trace->push_back(std::move(call));
+    }
+    return trace;
+  }();
+  return *trace;
+}
+
+// Encodes the trace on a new connection. Reports the bytes of headers per
+// call and the fraction of headers that were sent as an index into the
+// dynamic table.
+// Argument: whether the compressor indexes adaptively.
+static void BM_HpackEncoderReplayTrace(benchmark::State& state) {
+  grpc_core::ExecCtx exec_ctx;
+  const std::vector<TracedCall>& trace = Trace();
+  size_t encoded_bytes = 0;
+  double hit_rate = 0;
+  grpc_core::FakeCallTracer call_tracer;
+  grpc_slice_buffer outbuf;
+  grpc_slice_buffer_init(&outbuf);
+  for (auto _ : state) {
+    grpc_core::HPackCompressor c;
+    if (state.range(0) != 0) c.EnableAdaptiveIndexing();
+    uint32_t stream_id = 1;
+    for (const TracedCall& call : trace) {
+      grpc_metadata_batch b;
+      RepresentativeClientInitialMetadata::Prepare(&b);
+      b.Set(grpc_core::HttpPathMetadata(),
+            grpc_core::Slice::FromCopiedString(call.path));
+      b.Set(grpc_core::GrpcTimeoutMetadata(),
+            grpc_core::Timestamp::Now() +
+                grpc_core::Duration::Milliseconds(call.timeout_ms));
+      b.Append("x-request-id",
+               grpc_core::Slice::FromCopiedString(call.request_id),
+               CrashOnAppendError);
+      b.Append("x-forwarded-for",
+               grpc_core::Slice::FromCopiedString(call.forwarded_for),
+               CrashOnAppendError);
+      b.Append("x-user-id", grpc_core::Slice::FromCopiedString(call.user_id),
+               CrashOnAppendError);
+      b.Append("authorization",
+               grpc_core::Slice::FromCopiedString(call.authorization),
+               CrashOnAppendError);
+      c.EncodeHeaders(
+          grpc_core::HPackCompressor::EncodeHeaderOptions{
+              stream_id, false, true, size_t{16384}, &call_tracer,
+              grpc_core::ztrace_collector},
+          b, &outbuf);
+      stream_id += 2;
+      encoded_bytes += outbuf.length;
+      grpc_slice_buffer_reset_and_unref(&outbuf);
+    }
+    hit_rate = c.stats().dynamic_table_hit_rate();
+    grpc_core::ExecCtx::Get()->Flush();
+  }
+  grpc_slice_buffer_destroy(&outbuf);
+  state.counters["encoded_bytes_per_call"] =
+      benchmark::Counter(static_cast<double>(encoded_bytes) / trace.size(),
+                         benchmark::Counter::kAvgIterations);
+  state.counters["dynamic_table_hit_rate"] = hit_rate;
+}
+BENCHMARK(BM_HpackEncoderReplayTrace)->Arg(0)->Arg(1);
+
 }  // namespace hpack_encoder_fixtures
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -614,6 +839,8 @@ using RepresentativeServerTrailingMetadata = FromEncoderFixture<
     hpack_encoder_fixtures::RepresentativeServerTrailingMetadata>;
 using MoreRepresentativeClientInitialMetadata = FromEncoderFixture<
     hpack_encoder_fixtures::MoreRepresentativeClientInitialMetadata>;
+using LargeValueClientInitialMetadata = FromEncoderFixture<
+    hpack_encoder_fixtures::LargeValueClientInitialMetadata>;
 
 // Send the same deadline repeatedly
 class SameDeadline {
@@ -629,6 +856,34 @@ class SameDeadline {
   }
 };
 
+// Client initial metadata from a peer that sends every key as a literal that
+// is not indexed, such as some proxies do: some keys are in the static table,
+// and some long ones are not.
+class LiteralKeyClientInitialMetadata {
+ public:
+  static std::vector<grpc_slice> GetInitSlices() { return {}; }
+  static std::vector<grpc_slice> GetBenchmarkSlices() {
+    std::vector<uint8_t> bytes;
+    auto add = [&bytes](absl::string_view key, absl::string_view value) {
+      bytes.push_back(0x00);
+      bytes.push_back(key.size());
+      bytes.insert(bytes.end(), key.begin(), key.end());
+      bytes.push_back(value.size());
+      bytes.insert(bytes.end(), value.begin(), value.end());
+    };
+    add(":path", "/example.v1.OrderService/GetOrder");
+    add(":authority", "orders.example.com");
+    add("content-type", "application/grpc");
+    add("user-agent", "grpc-go/1.64.0 (linux; amd64)");
+    add("authorization",
+        "Bearer 0123456789abcdef0123456789abcdef0123456789abcdef");
+    add("x-request-id", "6f1c8a2e-4b7d-4e2a-9c35-2d8f0b1e7a94");
+    add("x-forwarded-client-cert-hash",
+        "c2b0b3a8e5d8f1a7c6e9d4b2a1f0e3d7c5b4a3928170f6e5d4c3b2a19080706");
+    return {MakeSlice(bytes)};
+  }
+};
+
 BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, EmptyBatch);
 BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, IndexedSingleStaticElem);
 BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, AddIndexedSingleStaticElem);
@@ -661,7 +916,9 @@ BENCHMARK_TEMPLATE(BM_HpackParserParseHeader,
                    MoreRepresentativeClientInitialMetadata);
 BENCHMARK_TEMPLATE(BM_HpackParserParseHeader,
                    RepresentativeServerInitialMetadata);
+BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, LargeValueClientInitialMetadata);
 BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, SameDeadline);
+BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, LiteralKeyClientInitialMetadata);
 
 }  // namespace hpack_parser_fixtures
 
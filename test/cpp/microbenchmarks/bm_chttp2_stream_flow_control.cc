@@ -0,0 +1,155 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Memory buffered by chttp2 flow control for many concurrent streaming calls
+// whose applications read at different speeds.
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <tuple>
+
+#include "src/core/ext/transport/chttp2/transport/flow_control.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/util/grpc_check.h"
+#include "src/core/util/time.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace chttp2 {
+namespace {
+
+constexpr size_t kNumStreams = 10000;
+constexpr int64_t kMessageSize = 16 * 1024;
+// Seconds.
+constexpr double kStep = 0.001;
+constexpr double kDuration = 1;
+// Bytes per second the peer can send on the connection.
+constexpr double kLinkBandwidth = 100e9 / 8;
+
+struct SimStream {
+  explicit SimStream(TransportFlowControl* tfc, double read_rate)
+      : fc(tfc), read_rate(read_rate) {}
+  StreamFlowControl fc;
+  // Bytes per second the application reads, or zero if it stopped reading.
+  double read_rate;
+  // When the application is done with the last message it read.
+  double next_read = 0;
+  int64_t buffered = 0;
+};
+
+// Each step, the peer sends every stream what its window allows, as far as
+// the link and the connection window let it, and then each application that
+// is waiting for a message is given what is buffered for it. One in ten
+// applications reads quickly, six read slowly, and three stopped reading.
+// Reports the most bytes buffered for the applications at any time and the
+// rate at which they read.
+// Argument: whether stream windows are sized from the rate of reads.
+void BM_StreamFlowControl(benchmark::State& state) {
+  ExecCtx exec_ctx;
+  ScopedTimeCache time_cache;
+  MemoryOwner memory_owner =
+      ResourceQuota::Default()->memory_quota()->CreateMemoryOwner();
+  int64_t peak_buffered = 0;
+  double read_rate = 0;
+  for (auto _ : state) {
+    TransportFlowControl tfc("bm", true, &memory_owner);
+    if (state.range(0) != 0) tfc.EnableAdaptiveStreamWindows();
+    // The peer acknowledges the initial window at once.
+    FlowControlAction action = tfc.PeriodicUpdate();
+    if (action.send_initial_window_update() !=
+        FlowControlAction::Urgency::NO_ACTION_NEEDED) {
+      tfc.FlushedSettings();
+      std::ignore = tfc.SetAckedInitialWindow(action.initial_window_size());
+    }
+    tfc.MaybeSendUpdate(true);
+    std::deque<SimStream> streams;
+    for (size_t i = 0; i < kNumStreams; ++i) {
+      const size_t kind = i % 10;
+      streams.emplace_back(&tfc, kind == 0  ? 2e6
+                                 : kind < 7 ? 32e3
+                                            : 0.0);
+    }
+    int64_t buffered = 0;
+    int64_t read = 0;
+    peak_buffered = 0;
+    size_t first = 0;
+    double now = 0;
+    for (; now < kDuration; now += kStep) {
+      time_cache.TestOnlySetNow(Timestamp::ProcessEpoch() +
+                                Duration::FromSecondsAsDouble(now));
+      int64_t link = static_cast<int64_t>(kLinkBandwidth * kStep);
+      // Start with a different stream each step to share the link.
+      first = (first + 1) % kNumStreams;
+      for (size_t i = 0; i < kNumStreams; ++i) {
+        SimStream& s = streams[(first + i) % kNumStreams];
+        StreamFlowControl::IncomingUpdateContext upd(&s.fc);
+        const int64_t send = std::min(
+            {tfc.test_only_acked_init_window() +
+                 s.fc.test_only_announced_window_delta(),
+             tfc.test_only_announced_window(), link});
+        if (send > 0) {
+          GRPC_CHECK_OK(upd.RecvData(send));
+          s.buffered += send;
+          buffered += send;
+          link -= send;
+        }
+        if (s.read_rate > 0 && s.next_read <= now) {
+          while (s.next_read <= now && s.buffered >= kMessageSize) {
+            s.buffered -= kMessageSize;
+            buffered -= kMessageSize;
+            read += kMessageSize;
+            upd.RecordRead(kMessageSize);
+            s.next_read =
+                std::max(s.next_read, now - kStep) + kMessageSize / s.read_rate;
+          }
+          if (s.next_read <= now) {
+            upd.SetMinProgressSize(kMessageSize - s.buffered);
+          }
+          upd.SetPendingSize(s.buffered);
+        }
+        std::ignore = upd.MakeAction();
+        s.fc.MaybeSendUpdate();
+      }
+      tfc.MaybeSendUpdate(true);
+      peak_buffered = std::max(peak_buffered, buffered);
+    }
+    read_rate = read / now;
+  }
+  state.counters["peak_buffered_mb"] = peak_buffered / (1024.0 * 1024.0);
+  state.counters["read_mb_per_s"] = read_rate / (1024.0 * 1024.0);
+}
+BENCHMARK(BM_StreamFlowControl)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+
+}  // namespace
+}  // namespace chttp2
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
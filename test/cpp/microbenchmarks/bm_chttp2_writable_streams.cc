@@ -0,0 +1,141 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Scheduling of unary calls behind a bulk stream by the write cycles of the
+// promise based HTTP/2 transport.
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "src/core/ext/transport/chttp2/transport/transport_common.h"
+#include "src/core/ext/transport/chttp2/transport/writable_streams.h"
+#include "src/core/util/grpc_check.h"
+#include "src/core/util/ref_counted.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace http2 {
+namespace {
+
+struct BenchStream : public RefCounted<BenchStream> {
+  BenchStream(uint32_t stream_id, uint8_t urgency, size_t arrival)
+      : stream_id(stream_id), urgency(urgency), arrival(arrival) {}
+  uint32_t stream_id;
+  uint8_t urgency;
+  // Bytes written on the connection before the stream became writable.
+  size_t arrival;
+  uint32_t GetStreamId() const { return stream_id; }
+  uint8_t GetUrgency() const { return urgency; }
+};
+
+constexpr size_t kWriteSize = 64 * 1024;
+constexpr size_t kUnaryCallSize = 256;
+constexpr uint32_t kBulkStreamId = 1;
+
+// Each iteration is a write cycle, filled by a bulk stream that always has
+// data and by the zero to two unary calls that became writable before it,
+// just before or just after the bulk stream was enqueued again. Reports the
+// bytes written on the connection from when a unary call became writable to
+// when it was written, which at line rate is its queueing delay.
+// Arguments: urgency of the bulk stream, urgency of the unary calls.
+void BM_UnaryBehindBulkStream(benchmark::State& state) {
+  const uint8_t bulk_urgency = state.range(0);
+  const uint8_t unary_urgency = state.range(1);
+  WritableStreams<RefCountedPtr<BenchStream>> writable_streams;
+  std::mt19937 rng(42);
+  uint32_t next_stream_id = kBulkStreamId + 2;
+  size_t connection_bytes = 0;
+  std::vector<size_t> latencies;
+  auto enqueue_unary_calls = [&](int count) {
+    for (int i = 0; i < count; ++i) {
+      GRPC_CHECK_OK(writable_streams.Enqueue(
+          MakeRefCounted<BenchStream>(next_stream_id, unary_urgency,
+                                      connection_bytes),
+          WritableStreamPriority::kDefault));
+      next_stream_id += 2;
+    }
+  };
+  GRPC_CHECK_OK(writable_streams.Enqueue(
+      MakeRefCounted<BenchStream>(kBulkStreamId, bulk_urgency, 0),
+      WritableStreamPriority::kDefault));
+  for (auto _ : state) {
+    // There is always a writable stream, so this resolves immediately.
+    auto ready = writable_streams.WaitForReady(
+        /*transport_tokens_available=*/true);
+    GRPC_CHECK(ready().ready());
+    const int unary_calls = rng() % 3;
+    const int before_bulk = rng() % (unary_calls + 1);
+    size_t remaining = kWriteSize;
+    RefCountedPtr<BenchStream> bulk;
+    while (remaining > 0) {
+      std::optional<RefCountedPtr<BenchStream>> stream =
+          writable_streams.ImmediateNext(/*transport_tokens_available=*/true);
+      if (!stream.has_value()) break;
+      const size_t bytes = (*stream)->stream_id == kBulkStreamId
+                               ? remaining
+                               : std::min(remaining, kUnaryCallSize);
+      writable_streams.RecordBytesWritten(bytes);
+      remaining -= bytes;
+      connection_bytes += bytes;
+      if ((*stream)->stream_id == kBulkStreamId) {
+        bulk = std::move(*stream);
+      } else {
+        latencies.push_back(connection_bytes - (*stream)->arrival);
+      }
+    }
+    // Calls that become writable while the cycle is written are scheduled in
+    // the next one, in the order they were enqueued.
+    enqueue_unary_calls(before_bulk);
+    if (bulk != nullptr) {
+      GRPC_CHECK_OK(writable_streams.Enqueue(std::move(bulk),
+                                             WritableStreamPriority::kDefault));
+    }
+    enqueue_unary_calls(unary_calls - before_bulk);
+  }
+  if (!latencies.empty()) {
+    std::sort(latencies.begin(), latencies.end());
+    state.counters["unary_p50_bytes"] = latencies[latencies.size() / 2];
+    state.counters["unary_p99_bytes"] = latencies[latencies.size() * 99 / 100];
+  }
+}
+// All calls of the default urgency: first come, first served.
+BENCHMARK(BM_UnaryBehindBulkStream)->Args({kDefaultUrgency, kDefaultUrgency});
+// Unary calls more urgent than the bulk stream.
+BENCHMARK(BM_UnaryBehindBulkStream)->Args({kDefaultUrgency, 1});
+BENCHMARK(BM_UnaryBehindBulkStream)->Args({7, 0});
+
+}  // namespace
+}  // namespace http2
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -0,0 +1,193 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Endpoint writes and latency of concurrent unary calls on one chttp2
+// connection, with the write combining window off and on. Writes are counted
+// with the syscall_write stat, on both sides of the connection.
+
+#include <benchmark/benchmark.h>
+#include <grpc/impl/channel_arg_names.h>
+#include <grpcpp/support/channel_arguments.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
+#include "src/core/util/grpc_check.h"
+#include "src/proto/grpc/testing/echo.grpc.pb.h"
+#include "test/core/test_util/test_config.h"
+#include "test/cpp/microbenchmarks/fullstack_fixtures.h"
+#include "test/cpp/util/test_config.h"
+
+namespace grpc {
+namespace testing {
+
+// Bytes of the request and response message of each call.
+constexpr size_t kMessageSize = 100;
+
+template <int kWindowMs>
+class WriteCombiningConfiguration : public FixtureConfiguration {
+  void ApplyCommonChannelArguments(ChannelArguments* a) const override {
+    a->SetInt(GRPC_ARG_HTTP2_WRITE_COMBINING_WINDOW_MS, kWindowMs);
+    FixtureConfiguration::ApplyCommonChannelArguments(a);
+  }
+
+  void ApplyCommonServerBuilderConfig(ServerBuilder* b) const override {
+    b->AddChannelArgument(GRPC_ARG_HTTP2_WRITE_COMBINING_WINDOW_MS, kWindowMs);
+    FixtureConfiguration::ApplyCommonServerBuilderConfig(b);
+  }
+};
+
+template <int kWindowMs>
+class WriteCombiningTCP : public TCP {
+ public:
+  explicit WriteCombiningTCP(Service* service)
+      : TCP(service, WriteCombiningConfiguration<kWindowMs>()) {}
+};
+
+// Completion queue tags are the index of a call, shifted, with what completed
+// in the low bits.
+enum CallEvent : intptr_t {
+  kServerRequest = 0,
+  kServerFinish = 1,
+  kClientFinish = 2,
+};
+
+static void* tag(size_t call, CallEvent event) {
+  return reinterpret_cast<void*>(static_cast<intptr_t>(call << 2) | event);
+}
+
+// Each iteration starts state.range(0) unary calls at once and waits for all
+// of them. Reports the endpoint writes per call, and the latency of calls.
+template <class Fixture>
+static void BM_ConcurrentUnary(benchmark::State& state) {
+  const size_t concurrency = state.range(0);
+  EchoTestService::AsyncService service;
+  auto fixture = std::make_unique<Fixture>(&service);
+  auto stub = EchoTestService::NewStub(fixture->channel());
+  EchoRequest send_request;
+  send_request.set_message(std::string(kMessageSize, 'a'));
+  EchoResponse send_response;
+  send_response.set_message(std::string(kMessageSize, 'a'));
+  struct ServerCall {
+    ServerContext ctx;
+    EchoRequest recv_request;
+    grpc::ServerAsyncResponseWriter<EchoResponse> response_writer;
+    ServerCall() : response_writer(&ctx) {}
+  };
+  struct ClientCall {
+    ClientContext ctx;
+    EchoResponse recv_response;
+    Status recv_status;
+    std::unique_ptr<ClientAsyncResponseReader<EchoResponse>> response_reader;
+    std::chrono::steady_clock::time_point start;
+  };
+  std::vector<std::unique_ptr<ServerCall>> server_calls(concurrency);
+  auto request_call = [&](size_t i) {
+    server_calls[i] = std::make_unique<ServerCall>();
+    service.RequestEcho(&server_calls[i]->ctx, &server_calls[i]->recv_request,
+                        &server_calls[i]->response_writer, fixture->cq(),
+                        fixture->cq(), tag(i, kServerRequest));
+  };
+  for (size_t i = 0; i < concurrency; ++i) request_call(i);
+  std::vector<int64_t> latencies_ns;
+  auto before = grpc_core::global_stats().Collect();
+  for (auto _ : state) {
+    std::vector<std::unique_ptr<ClientCall>> client_calls(concurrency);
+    for (size_t i = 0; i < concurrency; ++i) {
+      auto& call = client_calls[i];
+      call = std::make_unique<ClientCall>();
+      call->start = std::chrono::steady_clock::now();
+      call->response_reader =
+          stub->AsyncEcho(&call->ctx, send_request, fixture->cq());
+      call->response_reader->Finish(&call->recv_response, &call->recv_status,
+                                    tag(i, kClientFinish));
+    }
+    // Server calls are requested again once finished, so the next iteration
+    // finds them waiting.
+    size_t outstanding = 2 * concurrency;
+    while (outstanding > 0) {
+      void* t;
+      bool ok;
+      GRPC_CHECK(fixture->cq()->Next(&t, &ok));
+      GRPC_CHECK(ok);
+      const auto value = reinterpret_cast<intptr_t>(t);
+      const size_t i = static_cast<size_t>(value >> 2);
+      switch (static_cast<CallEvent>(value & 3)) {
+        case kServerRequest:
+          server_calls[i]->response_writer.Finish(send_response, Status::OK,
+                                                  tag(i, kServerFinish));
+          break;
+        case kServerFinish:
+          request_call(i);
+          --outstanding;
+          break;
+        case kClientFinish:
+          GRPC_CHECK(client_calls[i]->recv_status.ok());
+          latencies_ns.push_back(
+              std::chrono::duration_cast<std::chrono::nanoseconds>(
+                  std::chrono::steady_clock::now() - client_calls[i]->start)
+                  .count());
+          --outstanding;
+          break;
+      }
+    }
+  }
+  auto stats = grpc_core::global_stats().Collect()->Diff(*before);
+  stub.reset();
+  fixture.reset();
+  server_calls.clear();
+  const double calls = static_cast<double>(latencies_ns.size());
+  state.counters["writes_per_call"] =
+      static_cast<double>(stats->syscall_write) / calls;
+  std::sort(latencies_ns.begin(), latencies_ns.end());
+  auto percentile = [&latencies_ns](double p) {
+    return static_cast<double>(
+        latencies_ns[static_cast<size_t>(p * (latencies_ns.size() - 1))]);
+  };
+  state.counters["p50_ns"] = percentile(0.5);
+  state.counters["p99_ns"] = percentile(0.99);
+}
+
+BENCHMARK_TEMPLATE(BM_ConcurrentUnary, WriteCombiningTCP<0>)
+    ->Arg(1)
+    ->Arg(16)
+    ->Arg(128);
+BENCHMARK_TEMPLATE(BM_ConcurrentUnary, WriteCombiningTCP<1>)
+    ->Arg(1)
+    ->Arg(16)
+    ->Arg(128);
+
+}  // namespace testing
+}  // namespace grpc
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  LibraryInitializer libInit;
+  ::benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
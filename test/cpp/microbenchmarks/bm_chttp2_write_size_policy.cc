@@ -0,0 +1,131 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Throughput and latency of chttp2 write sizing on an emulated link whose
+// bandwidth changes.
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include "src/core/ext/transport/chttp2/transport/write_size_policy.h"
+#include "src/core/util/time.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+struct LinkPhase {
+  // Bytes per second.
+  double bandwidth;
+  // Seconds.
+  double duration;
+};
+
+constexpr LinkPhase kLinkPhases[] = {
+    {25e9 / 8, 0.05},
+    {100e9 / 8, 0.05},
+    {1e9 / 8, 0.05},
+    {25e9 / 8, 0.05},
+};
+constexpr double kRtt = 50e-6;
+// Size of the socket's send buffer.
+constexpr double kSendBuffer = 4 * 1024 * 1024;
+// Cost of preparing and starting each write.
+constexpr double kWriteOverhead = 10e-6;
+// A small message becomes ready to send this often.
+constexpr double kMessageInterval = 20e-6;
+
+// Emulates a bulk sender that always has data: each write is started as soon
+// as the last one was taken by the socket, which takes it once it fits in the
+// send buffer, and the link drains the buffer at its bandwidth. Reports the
+// throughput of the link and the latency of small messages that are sent
+// with the bulk data, from when they become ready until the link sends them.
+// Argument: whether writes are sized by the model instead of the step
+// controller.
+void BM_WriteSizePolicy(benchmark::State& state) {
+  ScopedTimeCache time_cache;
+  double throughput = 0;
+  std::vector<double> latencies;
+  for (auto _ : state) {
+    Chttp2WriteSizePolicy policy;
+    if (state.range(0) != 0) policy.UseModel();
+    double now = 0;
+    double unsent = 0;
+    double delivered = 0;
+    double next_message = 0;
+    latencies.clear();
+    auto set_now = [&]() {
+      time_cache.TestOnlySetNow(Timestamp::ProcessEpoch() +
+                                Duration::FromSecondsAsDouble(now));
+    };
+    for (const LinkPhase& phase : kLinkPhases) {
+      const double phase_end = now + phase.duration;
+      auto drain = [&](double seconds) {
+        const double sent = std::min(unsent, phase.bandwidth * seconds);
+        unsent -= sent;
+        delivered += sent;
+      };
+      while (now < phase_end) {
+        drain(kWriteOverhead);
+        now += kWriteOverhead;
+        set_now();
+        const double size = policy.WriteTargetSize();
+        policy.BeginWrite(size);
+        const double wait =
+            std::max(0.0, unsent + size - kSendBuffer) / phase.bandwidth;
+        drain(wait);
+        now += wait;
+        unsent += size;
+        set_now();
+        policy.EndWrite(true);
+        if (auto* model = policy.model(); model != nullptr) {
+          model->UpdateLinkEstimate(
+              {phase.bandwidth, kRtt, static_cast<size_t>(unsent)});
+        }
+        // Messages that became ready during this write go out with the next
+        // one, behind everything the socket has queued by then.
+        for (; next_message < now; next_message += kMessageInterval) {
+          latencies.push_back(now - next_message + kWriteOverhead +
+                              unsent / phase.bandwidth);
+        }
+      }
+    }
+    throughput = delivered / now;
+  }
+  std::sort(latencies.begin(), latencies.end());
+  state.counters["throughput_gbps"] = throughput * 8 / 1e9;
+  state.counters["p50_latency_us"] = latencies[latencies.size() / 2] * 1e6;
+  state.counters["p99_latency_us"] =
+      latencies[latencies.size() * 99 / 100] * 1e6;
+}
+BENCHMARK(BM_WriteSizePolicy)->Arg(0)->Arg(1);
+
+}  // namespace
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -24,6 +24,7 @@
 #include <grpcpp/security/server_credentials.h>
 
 #include "src/core/ext/transport/chaotic_good/chaotic_good.h"
+#include "src/core/ext/transport/chaotic_good/shared_memory.h"
 #include "src/core/transport/endpoint_transport.h"
 #include "test/core/test_util/test_config.h"
 #include "test/cpp/microbenchmarks/fullstack_unary_ping_pong.h"
@@ -89,6 +90,29 @@ class ChaoticGoodFixture : public BaseFixture {
   int port_;
 };
 
+// Carries payloads of the data connections in shared memory.
+class SharedMemoryConfiguration : public FixtureConfiguration {
+ public:
+  static constexpr int kSharedMemorySize = 64 * 1024 * 1024;
+
+  void ApplyCommonChannelArguments(ChannelArguments* a) const override {
+    a->SetInt(GRPC_ARG_CHAOTIC_GOOD_SHARED_MEMORY_SIZE, kSharedMemorySize);
+    FixtureConfiguration::ApplyCommonChannelArguments(a);
+  }
+
+  void ApplyCommonServerBuilderConfig(ServerBuilder* b) const override {
+    b->AddChannelArgument(GRPC_ARG_CHAOTIC_GOOD_SHARED_MEMORY_SIZE,
+                          kSharedMemorySize);
+    FixtureConfiguration::ApplyCommonServerBuilderConfig(b);
+  }
+};
+
+class ChaoticGoodSharedMemoryFixture : public ChaoticGoodFixture {
+ public:
+  explicit ChaoticGoodSharedMemoryFixture(Service* service)
+      : ChaoticGoodFixture(service, SharedMemoryConfiguration()) {}
+};
+
 //******************************************************************************
 // CONFIGURATIONS
 //
@@ -108,6 +132,20 @@ BENCHMARK_TEMPLATE(BM_UnaryPingPong, ChaoticGoodFixture, NoOpMutator,
                    NoOpMutator)
     ->Apply(SweepSizesArgs);
 
+// Messages large enough to use the data connections, over loopback TCP and
+// over shared memory.
+static void DataConnectionSizesArgs(benchmark::internal::Benchmark* b) {
+  b->Args({1024, 1024});
+  b->Args({1024 * 1024, 1024 * 1024});
+}
+
+BENCHMARK_TEMPLATE(BM_UnaryPingPong, ChaoticGoodFixture, NoOpMutator,
+                   NoOpMutator)
+    ->Apply(DataConnectionSizesArgs);
+BENCHMARK_TEMPLATE(BM_UnaryPingPong, ChaoticGoodSharedMemoryFixture,
+                   NoOpMutator, NoOpMutator)
+    ->Apply(DataConnectionSizesArgs);
+
 }  // namespace testing
 }  // namespace grpc
 
@@ -16,9 +16,11 @@
 
 #include <cstdint>
 #include <random>
+#include <string>
 
 #include "src/core/ext/transport/chttp2/transport/bin_encoder.h"
 #include "src/core/ext/transport/chttp2/transport/decode_huff.h"
+#include "src/core/ext/transport/chttp2/transport/decode_huff_multi.h"
 #include "src/core/lib/slice/slice.h"
 #include "src/core/util/no_destruct.h"
 #include "test/core/test_util/test_config.h"
@@ -45,6 +47,35 @@ std::vector<uint8_t> MakeBase64() {
   return std::vector<uint8_t>(s.begin(), s.end());
 }
 
+// Header values like the ones gRPC sees in practice: the huffman coded bulk of
+// real header blocks is tokens, paths, user agents and base64.
+std::vector<uint8_t> MakeHeaderValues() {
+  static const char* const kValues[] = {
+      "application/grpc",
+      "grpc-c++/1.74.0 grpc-c/48.0.0 (linux; chttp2)",
+      "grpc-java-netty/1.68.1",
+      "/google.pubsub.v1.Publisher/Publish",
+      "/grpc.testing.BenchmarkService/UnaryCall",
+      "Bearer eyJhbGciOiJSUzI1NiIsImtpZCI6IjE2NzY3OWI4YjQ3ZjU5MGE0NzI5YzY2ZTIx"
+      "NzdlYTM5IiwidHlwIjoiSldUIn0.eyJhdWQiOiJodHRwczovL3B1YnN1Yi5nb29nbGVhcG"
+      "lzLmNvbS8iLCJleHAiOjE3MzQ1NjM0NTYsImlhdCI6MTczNDU1OTg1Nn0.Q2xMaEFWdlBk"
+      "X3pZbUZlOVJvQlhOdHg0ZV9jS1RGaG5BMzJ1a0Y1b1NmT0tXbU5DVm1SYjlfT3ZHZ1h3",
+      "AAAAAAAAAAAA7XtfvgpCB6fV8uSDjjJ8+gAAAAAAAAAAAA==",
+      "00-0af7651916cd43dd8448eb211c80319c-b7ad6b7169203331-01",
+      "gzip, deflate, br",
+      "1S",
+      "identity,deflate,gzip",
+  };
+  std::mt19937 rd(0);
+  std::uniform_int_distribution<size_t> distribution(
+      0, sizeof(kValues) / sizeof(kValues[0]) - 1);
+  std::string v;
+  while (v.size() < 1024 * 1024) v += kValues[distribution(rd)];
+  grpc_core::Slice s = grpc_core::Slice::FromCopiedString(v);
+  grpc_core::Slice c(grpc_chttp2_huffman_compress(s.c_slice()));
+  return std::vector<uint8_t>(c.begin(), c.end());
+}
+
 const std::vector<uint8_t>& AllChars() {
   static const auto* const data = new std::vector<uint8_t>(MakeInput(0, 255));
   return *data;
@@ -62,6 +93,11 @@ const std::vector<uint8_t>& Base64Chars() {
   return *data;
 };
 
+const std::vector<uint8_t>& HeaderChars() {
+  static const auto* const data = new std::vector<uint8_t>(MakeHeaderValues());
+  return *data;
+};
+
 using CharSet = const std::vector<uint8_t>& (*)();
 
 template <template <typename Sink> class Decoder>
@@ -81,9 +117,12 @@ static void BM_Decode(benchmark::State& state, CharSet chars_gen) {
   BENCHMARK_CAPTURE(name, all_chars, AllChars);       \
   BENCHMARK_CAPTURE(name, base64_chars, Base64Chars); \
   BENCHMARK_CAPTURE(name, ascii_chars, AsciiChars);   \
-  BENCHMARK_CAPTURE(name, alpha_chars, AlphaChars)
+  BENCHMARK_CAPTURE(name, alpha_chars, AlphaChars);   \
+  BENCHMARK_CAPTURE(name, header_chars, HeaderChars)
 
 DECL_HUFFMAN_VARIANTS();
+DECL_BENCHMARK(grpc_core::HuffDecoder, BM_HuffDecoder);
+DECL_BENCHMARK(grpc_core::HuffMultiDecoder, BM_HuffMultiDecoder);
 
 // Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
 // and others do not. This allows us to support both modes.
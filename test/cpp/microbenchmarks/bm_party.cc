@@ -0,0 +1,143 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Throughput of spawning short lived participants on a party, as connection
+// level parties do for pings, writes and window updates.
+
+#include <benchmark/benchmark.h>
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/grpc.h>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <utility>
+
+#include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/lib/event_engine/event_engine_context.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/promise/party.h"
+#include "src/core/lib/promise/poll.h"
+#include "src/core/lib/resource_quota/arena.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+RefCountedPtr<Party> MakeParty(
+    grpc_event_engine::experimental::EventEngine* event_engine) {
+  auto arena = SimpleArenaAllocator()->MakeArena();
+  arena->SetContext<grpc_event_engine::experimental::EventEngine>(
+      event_engine);
+  return Party::Make(std::move(arena));
+}
+
+// Spawns a promise that completes when first polled, carrying kBytes of
+// state, and counts its completion.
+template <size_t kBytes>
+void SpawnOne(Party* party, std::atomic<size_t>& done) {
+  std::array<char, kBytes> state{};
+  party->Spawn(
+      "bm_party",
+      [state]() -> Poll<size_t> { return state.size(); },
+      [&done](size_t) { done.fetch_add(1, std::memory_order_relaxed); });
+}
+
+void WaitFor(std::atomic<size_t>& done, size_t expected) {
+  while (done.load(std::memory_order_relaxed) != expected) {
+    std::this_thread::yield();
+  }
+}
+
+// Reports the fraction of participants allocated in recycled blocks.
+void ReportAllocations(benchmark::State& state, const GlobalStats& before) {
+  auto stats = global_stats().Collect()->Diff(before);
+  state.counters["participants_recycled"] =
+      static_cast<double>(stats->party_participants_recycled) /
+      static_cast<double>(stats->party_participants_allocated);
+}
+
+// Spawns participants one at a time; each runs to completion before the
+// next is spawned.
+// Template argument: bytes of state each participant carries.
+template <size_t kBytes>
+void BM_PartySpawnComplete(benchmark::State& state) {
+  auto event_engine = grpc_event_engine::experimental::GetDefaultEventEngine();
+  ExecCtx exec_ctx;
+  auto party = MakeParty(event_engine.get());
+  std::atomic<size_t> done{0};
+  auto before = global_stats().Collect();
+  size_t spawned = 0;
+  for (auto _ : state) {
+    SpawnOne<kBytes>(party.get(), done);
+    ++spawned;
+  }
+  WaitFor(done, spawned);
+  state.SetItemsProcessed(spawned);
+  ReportAllocations(state, *before);
+}
+BENCHMARK_TEMPLATE(BM_PartySpawnComplete, 16);
+BENCHMARK_TEMPLATE(BM_PartySpawnComplete, 256);
+BENCHMARK_TEMPLATE(BM_PartySpawnComplete, 768);
+BENCHMARK_TEMPLATE(BM_PartySpawnComplete, 4096);
+
+// Spawns as many participants as a party holds while holding its wakeups, so
+// that all are allocated before any completes.
+// Template argument: bytes of state each participant carries.
+template <size_t kBytes>
+void BM_PartySpawnBurst(benchmark::State& state) {
+  auto event_engine = grpc_event_engine::experimental::GetDefaultEventEngine();
+  ExecCtx exec_ctx;
+  auto party = MakeParty(event_engine.get());
+  std::atomic<size_t> done{0};
+  auto before = global_stats().Collect();
+  size_t spawned = 0;
+  for (auto _ : state) {
+    Party::WakeupHold hold(party.get());
+    for (size_t i = 0; i < party_detail::kMaxParticipants; ++i) {
+      SpawnOne<kBytes>(party.get(), done);
+    }
+    spawned += party_detail::kMaxParticipants;
+  }
+  WaitFor(done, spawned);
+  state.SetItemsProcessed(spawned);
+  ReportAllocations(state, *before);
+}
+BENCHMARK_TEMPLATE(BM_PartySpawnBurst, 16);
+BENCHMARK_TEMPLATE(BM_PartySpawnBurst, 256);
+BENCHMARK_TEMPLATE(BM_PartySpawnBurst, 768);
+BENCHMARK_TEMPLATE(BM_PartySpawnBurst, 4096);
+
+}  // namespace
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  benchmark::Initialize(&argc, argv);
+  grpc_init();
+  benchmark::RunTheBenchmarksNamespaced();
+  grpc_shutdown();
+  return 0;
+}
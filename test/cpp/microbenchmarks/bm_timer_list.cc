@@ -0,0 +1,179 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Compares the heap-based TimerList with the TimerWheel on the workload that
+// dominates busy servers: a large number of outstanding timers, and a steady
+// stream of timers that are added and cancelled before they fire.
+
+#include <benchmark/benchmark.h>
+#include <grpc/event_engine/event_engine.h>
+#include <grpcpp/impl/grpc_library.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "src/core/lib/event_engine/posix_engine/timer.h"
+#include "src/core/lib/event_engine/posix_engine/timer_wheel.h"
+#include "src/core/util/time.h"
+#include "test/core/test_util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+namespace {
+
+using ::grpc_event_engine::experimental::EventEngine;
+using ::grpc_event_engine::experimental::Timer;
+using ::grpc_event_engine::experimental::TimerList;
+using ::grpc_event_engine::experimental::TimerListHost;
+using ::grpc_event_engine::experimental::TimerWheel;
+
+class FakeHost final : public TimerListHost {
+ public:
+  grpc_core::Timestamp Now() override { return now_; }
+  void Kick() override {}
+
+  void Advance(grpc_core::Duration d) { now_ += d; }
+
+ private:
+  grpc_core::Timestamp now_ =
+      grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(1000);
+};
+
+class NoopClosure final : public EventEngine::Closure {
+ public:
+  void Run() override {}
+};
+
+// Deadlines between 1s and 10min out, like a mix of per-call deadlines,
+// keepalives and idle timers.
+std::vector<grpc_core::Duration> MakeDelays(size_t n) {
+  std::mt19937 rng(42);
+  std::uniform_int_distribution<int64_t> dist(1000, 600000);
+  std::vector<grpc_core::Duration> delays;
+  delays.reserve(n);
+  for (size_t i = 0; i < n; i++) {
+    delays.push_back(grpc_core::Duration::Milliseconds(dist(rng)));
+  }
+  return delays;
+}
+
+void ReportLatencies(benchmark::State& state, std::vector<int64_t>& ns) {
+  if (ns.empty()) return;
+  std::sort(ns.begin(), ns.end());
+  auto percentile = [&ns](double p) {
+    return static_cast<double>(ns[static_cast<size_t>(p * (ns.size() - 1))]);
+  };
+  state.counters["p50_ns"] = percentile(0.5);
+  state.counters["p99_ns"] = percentile(0.99);
+  state.counters["p999_ns"] = percentile(0.999);
+  state.counters["max_ns"] = static_cast<double>(ns.back());
+}
+
+// Adds and cancels one timer per iteration while range(0) other timers are
+// outstanding.
+template <typename TimerListType>
+void BM_TimerChurn(benchmark::State& state) {
+  const size_t outstanding = state.range(0);
+  FakeHost host;
+  TimerListType timer_list(&host);
+  NoopClosure closure;
+  const auto delays = MakeDelays(outstanding + 4096);
+  std::vector<Timer> background(outstanding);
+  for (size_t i = 0; i < outstanding; i++) {
+    timer_list.TimerInit(&background[i], host.Now() + delays[i], &closure);
+  }
+  Timer timer;
+  std::vector<int64_t> latencies;
+  size_t i = 0;
+  for (auto _ : state) {
+    const auto start = std::chrono::steady_clock::now();
+    timer_list.TimerInit(&timer, host.Now() + delays[outstanding + (i & 4095)],
+                         &closure);
+    benchmark::DoNotOptimize(timer_list.TimerCancel(&timer));
+    latencies.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                            std::chrono::steady_clock::now() - start)
+                            .count());
+    ++i;
+  }
+  for (auto& t : background) {
+    benchmark::DoNotOptimize(timer_list.TimerCancel(&t));
+  }
+  state.SetItemsProcessed(state.iterations());
+  ReportLatencies(state, latencies);
+}
+BENCHMARK_TEMPLATE(BM_TimerChurn, TimerList)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_TimerChurn, TimerWheel)->Range(1 << 10, 1 << 20);
+
+// As BM_TimerChurn, but time moves forward by 1ms per iteration and every
+// iteration checks for expired timers, so the outstanding timers gradually
+// fire. Latency covers the add, cancel and check.
+template <typename TimerListType>
+void BM_TimerChurnWithExpiry(benchmark::State& state) {
+  const size_t outstanding = state.range(0);
+  FakeHost host;
+  TimerListType timer_list(&host);
+  NoopClosure closure;
+  const auto delays = MakeDelays(outstanding + 4096);
+  std::vector<Timer> background(outstanding);
+  for (size_t i = 0; i < outstanding; i++) {
+    timer_list.TimerInit(&background[i], host.Now() + delays[i], &closure);
+  }
+  Timer timer;
+  std::vector<int64_t> latencies;
+  size_t i = 0;
+  size_t fired = 0;
+  for (auto _ : state) {
+    host.Advance(grpc_core::Duration::Milliseconds(1));
+    const auto start = std::chrono::steady_clock::now();
+    timer_list.TimerInit(&timer, host.Now() + delays[outstanding + (i & 4095)],
+                         &closure);
+    benchmark::DoNotOptimize(timer_list.TimerCancel(&timer));
+    auto expired = timer_list.TimerCheck(nullptr);
+    latencies.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                            std::chrono::steady_clock::now() - start)
+                            .count());
+    if (expired.has_value()) fired += expired->size();
+    ++i;
+  }
+  for (auto& t : background) {
+    benchmark::DoNotOptimize(timer_list.TimerCancel(&t));
+  }
+  state.SetItemsProcessed(state.iterations());
+  state.counters["fired"] = fired;
+  ReportLatencies(state, latencies);
+}
+BENCHMARK_TEMPLATE(BM_TimerChurnWithExpiry, TimerList)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_TimerChurnWithExpiry, TimerWheel)->Arg(1 << 20);
+
+}  // namespace
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  LibraryInitializer libInit;
+  benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -23,7 +23,12 @@
 
 #include <benchmark/benchmark.h>
 
+#include <algorithm>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
 #include <sstream>
+#include <vector>
 
 #include "src/core/util/grpc_check.h"
 #include "src/proto/grpc/testing/echo.grpc.pb.h"
@@ -95,6 +100,62 @@ static void BM_CallbackUnaryPingPong(benchmark::State& state) {
                           (response_msgs_size * state.iterations()));
 }
 
+// Keeps in_flight unary calls outstanding on one channel, starting another
+// as each one finishes, until calls have been made.
+inline void SendCallbackUnaryCalls(EchoTestService::Stub* stub,
+                                   const EchoRequest& request, int in_flight,
+                                   int calls) {
+  struct Call {
+    ClientContext cli_ctx;
+    EchoResponse response;
+  };
+  std::vector<Call> slots(std::min(in_flight, calls));
+  std::mutex mu;
+  std::condition_variable cv;
+  int started = static_cast<int>(slots.size());
+  size_t idle = 0;
+  std::function<void(Call*)> start = [&](Call* call) {
+    stub->async()->Echo(
+        &call->cli_ctx, &request, &call->response, [&, call](Status s) {
+          GRPC_CHECK(s.ok());
+          {
+            std::lock_guard<std::mutex> l(mu);
+            if (started == calls) {
+              if (++idle == slots.size()) cv.notify_one();
+              return;
+            }
+            ++started;
+          }
+          call->cli_ctx.~ClientContext();
+          new (&call->cli_ctx) ClientContext();
+          start(call);
+        });
+  };
+  for (Call& call : slots) start(&call);
+  std::unique_lock<std::mutex> l(mu);
+  cv.wait(l, [&] { return idle == slots.size(); });
+}
+
+// Unary calls of small messages on one connection, with a number of calls in
+// flight at once. Reports the calls per second the connection carries.
+template <class Fixture>
+static void BM_CallbackUnaryCallsInFlight(benchmark::State& state) {
+  constexpr int kCallsPerIteration = 10000;
+  const int in_flight = state.range(0);
+  CallbackStreamingTestService service;
+  std::unique_ptr<Fixture> fixture(new Fixture(&service));
+  std::unique_ptr<EchoTestService::Stub> stub_(
+      EchoTestService::NewStub(fixture->channel()));
+  EchoRequest request;
+  request.set_message(std::string(100, 'a'));
+  for (auto _ : state) {
+    SendCallbackUnaryCalls(stub_.get(), request, in_flight,
+                           kCallsPerIteration);
+  }
+  fixture.reset();
+  state.SetItemsProcessed(state.iterations() * kCallsPerIteration);
+}
+
 }  // namespace testing
 }  // namespace grpc
 
@@ -30,6 +30,7 @@
 
 #include "src/core/config/core_configuration.h"
 #include "src/core/ext/transport/chttp2/transport/chttp2_transport.h"
+#include "src/core/handshaker/security/secure_endpoint.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/iomgr/endpoint.h"
 #include "src/core/lib/iomgr/endpoint_pair.h"
@@ -42,6 +43,7 @@
 #include "src/core/util/crash.h"
 #include "src/core/util/grpc_check.h"
 #include "src/cpp/client/create_channel_internal.h"
+#include "test/core/end2end/data/ssl_test_data.h"
 #include "test/core/test_util/port.h"
 #include "test/core/test_util/test_config.h"
 #include "test/cpp/microbenchmarks/helpers.h"
@@ -63,6 +65,14 @@ class FixtureConfiguration {
     b->SetMaxReceiveMessageSize(INT_MAX);
     b->SetMaxSendMessageSize(INT_MAX);
   }
+
+  // Credentials of the fullstack fixtures that listen on an address.
+  virtual std::shared_ptr<ServerCredentials> MakeServerCredentials() const {
+    return InsecureServerCredentials();
+  }
+  virtual std::shared_ptr<ChannelCredentials> MakeChannelCredentials() const {
+    return InsecureChannelCredentials();
+  }
 };
 
 class BaseFixture {
@@ -76,7 +86,7 @@ class FullstackFixture : public BaseFixture {
                    const std::string& address) {
     ServerBuilder b;
     if (!address.empty()) {
-      b.AddListeningPort(address, InsecureServerCredentials());
+      b.AddListeningPort(address, config.MakeServerCredentials());
     }
     cq_ = b.AddCompletionQueue(true);
     b.RegisterService(service);
@@ -85,8 +95,8 @@ class FullstackFixture : public BaseFixture {
     ChannelArguments args;
     config.ApplyCommonChannelArguments(&args);
     if (!address.empty()) {
-      channel_ = grpc::CreateCustomChannel(address,
-                                           InsecureChannelCredentials(), args);
+      channel_ = grpc::CreateCustomChannel(
+          address, config.MakeChannelCredentials(), args);
     } else {
       channel_ = server_->InProcessChannel(args);
     }
@@ -286,6 +296,59 @@ typedef MinStackize<UDS> MinUDS;
 typedef MinStackize<InProcess> MinInProcess;
 typedef MinStackize<SockPair> MinSockPair;
 
+////////////////////////////////////////////////////////////////////////////////
+// TLS fixtures
+
+class TlsConfiguration : public FixtureConfiguration {
+ public:
+  void ApplyCommonChannelArguments(ChannelArguments* a) const override {
+    a->SetSslTargetNameOverride("foo.test.google.fr");
+    FixtureConfiguration::ApplyCommonChannelArguments(a);
+  }
+
+  std::shared_ptr<ServerCredentials> MakeServerCredentials() const override {
+    SslServerCredentialsOptions options;
+    options.pem_key_cert_pairs.push_back({test_server1_key, test_server1_cert});
+    return SslServerCredentials(options);
+  }
+
+  std::shared_ptr<ChannelCredentials> MakeChannelCredentials() const override {
+    SslCredentialsOptions options;
+    options.pem_root_certs = test_root_cert;
+    return SslCredentials(options);
+  }
+};
+
+// TLS with the record protection offloaded to the kernel where possible.
+class KernelTlsConfiguration : public TlsConfiguration {
+ public:
+  void ApplyCommonChannelArguments(ChannelArguments* a) const override {
+    a->SetInt(GRPC_ARG_KERNEL_TLS_OFFLOAD, 1);
+    TlsConfiguration::ApplyCommonChannelArguments(a);
+  }
+
+  void ApplyCommonServerBuilderConfig(ServerBuilder* b) const override {
+    b->AddChannelArgument(GRPC_ARG_KERNEL_TLS_OFFLOAD, 1);
+    TlsConfiguration::ApplyCommonServerBuilderConfig(b);
+  }
+};
+
+template <class Base>
+class Tlsize : public Base {
+ public:
+  explicit Tlsize(Service* service) : Base(service, TlsConfiguration()) {}
+};
+
+template <class Base>
+class KernelTlsize : public Base {
+ public:
+  explicit KernelTlsize(Service* service)
+      : Base(service, KernelTlsConfiguration()) {}
+};
+
+typedef Tlsize<TCP> TlsTCP;
+typedef KernelTlsize<TCP> KernelTlsTCP;
+
 }  // namespace testing
 }  // namespace grpc
 
@@ -23,7 +23,11 @@
 
 #include <benchmark/benchmark.h>
 
+#include <algorithm>
+#include <chrono>
+#include <ctime>
 #include <sstream>
+#include <vector>
 
 #include "src/core/util/grpc_check.h"
 #include "src/proto/grpc/testing/echo.grpc.pb.h"
@@ -74,8 +78,11 @@ static void BM_UnaryPingPong(benchmark::State& state) {
                       fixture->cq(), tag(1));
   std::unique_ptr<EchoTestService::Stub> stub(
       EchoTestService::NewStub(fixture->channel()));
+  std::vector<int64_t> latencies_ns;
+  const std::clock_t cpu_start = std::clock();
   for (auto _ : state) {
     GRPC_LATENT_SEE_ALWAYS_ON_SCOPE("OneRequest");
+    const auto start = std::chrono::steady_clock::now();
     recv_response.Clear();
     ClientContext cli_ctx;
     ClientContextMutator cli_ctx_mut(&cli_ctx);
@@ -105,6 +112,9 @@ static void BM_UnaryPingPong(benchmark::State& state) {
       }
       GRPC_CHECK(recv_status.ok());
     }
+    latencies_ns.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                               std::chrono::steady_clock::now() - start)
+                               .count());
     {
       GRPC_LATENT_SEE_ALWAYS_ON_SCOPE("RequestEcho");
       senv->~ServerEnv();
@@ -114,12 +124,29 @@ static void BM_UnaryPingPong(benchmark::State& state) {
                           tag(slot));
     }
   }
+  // Process CPU time per RPC, including that of poller and executor threads,
+  // alongside latency percentiles: busy polling
+  // (GRPC_EXPERIMENTAL_EVENT_ENGINE_BUSY_POLL_US) trades the former for the
+  // latter.
+  const double cpu_seconds =
+      static_cast<double>(std::clock() - cpu_start) / CLOCKS_PER_SEC;
   stub.reset();
   fixture.reset();
   server_env[0]->~ServerEnv();
   server_env[1]->~ServerEnv();
   state.SetBytesProcessed((state.range(0) * state.iterations()) +
                           (state.range(1) * state.iterations()));
+  if (!latencies_ns.empty()) {
+    std::sort(latencies_ns.begin(), latencies_ns.end());
+    auto percentile = [&latencies_ns](double p) {
+      return static_cast<double>(
+          latencies_ns[static_cast<size_t>(p * (latencies_ns.size() - 1))]);
+    };
+    state.counters["p50_ns"] = percentile(0.5);
+    state.counters["p99_ns"] = percentile(0.99);
+    state.counters["cpu_ns_per_rpc"] =
+        cpu_seconds * 1e9 / static_cast<double>(latencies_ns.size());
+  }
 }
 }  // namespace testing
 }  // namespace grpc
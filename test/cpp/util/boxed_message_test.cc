@@ -0,0 +1,174 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include <grpc/grpc.h>
+#include <grpcpp/impl/proto_utils.h>
+#include <grpcpp/support/byte_buffer.h>
+#include <grpcpp/support/slice.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
+#include "src/proto/grpc/testing/echo_messages.pb.h"
+#include "test/core/test_util/test_config.h"
+#include "gtest/gtest.h"
+
+namespace grpc {
+namespace {
+
+using grpc::testing::EchoRequest;
+using grpc::testing::EchoResponse;
+
+class BoxedMessageTest : public ::testing::Test {
+ protected:
+  static void SetUpTestSuite() { grpc_init(); }
+
+  static void TearDownTestSuite() { grpc_shutdown(); }
+
+  static EchoRequest Request() {
+    EchoRequest request;
+    request.set_message("hello boxed world");
+    return request;
+  }
+
+  // Messages boxed by this process so far.
+  static uint64_t BoxedMessages() {
+    return grpc_core::global_stats().Collect()->boxed_messages;
+  }
+
+  static std::string Bytes(ByteBuffer* buffer) {
+    std::vector<Slice> slices;
+    EXPECT_TRUE(buffer->Dump(&slices).ok());
+    std::string bytes;
+    for (const Slice& slice : slices) {
+      bytes.append(reinterpret_cast<const char*>(slice.begin()),
+                   slice.size());
+    }
+    return bytes;
+  }
+};
+
+TEST_F(BoxedMessageTest, BoxesMessageWithinLimit) {
+  const uint64_t boxed_before = BoxedMessages();
+  ByteBuffer buffer;
+  ASSERT_TRUE(SerializationTraits<EchoRequest>::Box(Request(), 1000, &buffer));
+  EXPECT_EQ(BoxedMessages(), boxed_before + 1);
+  bool exclusive = false;
+  internal::BoxedMessage* boxed =
+      internal::GetBoxedMessage(&buffer, &exclusive);
+  ASSERT_NE(boxed, nullptr);
+  EXPECT_TRUE(exclusive);
+  EXPECT_EQ(boxed->type(), internal::BoxedMessageOf<EchoRequest>::Type());
+  EXPECT_EQ(static_cast<internal::BoxedMessageOf<EchoRequest>*>(boxed)
+                ->message()
+                ->message(),
+            "hello boxed world");
+}
+
+TEST_F(BoxedMessageTest, SerializesMessageOverLimit) {
+  const EchoRequest request = Request();
+  ByteBuffer buffer;
+  EXPECT_FALSE(SerializationTraits<EchoRequest>::Box(
+      request, request.ByteSizeLong() - 1, &buffer));
+  EXPECT_FALSE(buffer.Valid());
+  EXPECT_TRUE(SerializationTraits<EchoRequest>::Box(
+      request, request.ByteSizeLong(), &buffer));
+}
+
+TEST_F(BoxedMessageTest, BytesAreNotABox) {
+  // A buffer holding the same byte as a boxed message is still bytes.
+  Slice slice(std::string(1, '\0'));
+  ByteBuffer buffer(&slice, 1);
+  bool exclusive;
+  EXPECT_EQ(internal::GetBoxedMessage(&buffer, &exclusive), nullptr);
+  ByteBuffer empty;
+  EXPECT_EQ(internal::GetBoxedMessage(&empty, &exclusive), nullptr);
+}
+
+TEST_F(BoxedMessageTest, BytesOfBoxDoNotParse) {
+  // Filters that read payloads, such as logging, see a placeholder byte.
+  ByteBuffer buffer;
+  ASSERT_TRUE(SerializationTraits<EchoRequest>::Box(Request(), 1000, &buffer));
+  const std::string bytes = Bytes(&buffer);
+  EXPECT_EQ(bytes, std::string(1, '\0'));
+  EchoRequest parsed;
+  EXPECT_FALSE(parsed.ParseFromString(bytes));
+}
+
+TEST_F(BoxedMessageTest, ReceiverOfSameTypeTakesMessage) {
+  ByteBuffer buffer;
+  ASSERT_TRUE(SerializationTraits<EchoRequest>::Box(Request(), 1000, &buffer));
+  EchoRequest received;
+  ASSERT_TRUE(
+      SerializationTraits<EchoRequest>::Deserialize(&buffer, &received).ok());
+  EXPECT_EQ(received.message(), "hello boxed world");
+  EXPECT_FALSE(buffer.Valid());
+}
+
+TEST_F(BoxedMessageTest, SharedBoxIsCopiedFrom) {
+  ByteBuffer buffer;
+  ASSERT_TRUE(SerializationTraits<EchoRequest>::Box(Request(), 1000, &buffer));
+  ByteBuffer copy(buffer);
+  bool exclusive = true;
+  ASSERT_NE(internal::GetBoxedMessage(&buffer, &exclusive), nullptr);
+  EXPECT_FALSE(exclusive);
+  EchoRequest received;
+  ASSERT_TRUE(
+      SerializationTraits<EchoRequest>::Deserialize(&buffer, &received).ok());
+  EXPECT_EQ(received.message(), "hello boxed world");
+  // The copy still holds the whole message.
+  ASSERT_TRUE(
+      SerializationTraits<EchoRequest>::Deserialize(&copy, &received).ok());
+  EXPECT_EQ(received.message(), "hello boxed world");
+}
+
+TEST_F(BoxedMessageTest, ReceiverOfOtherTypeParsesSerialization) {
+  ByteBuffer buffer;
+  ASSERT_TRUE(SerializationTraits<EchoRequest>::Box(Request(), 1000, &buffer));
+  // EchoResponse shares the message field of EchoRequest.
+  EchoResponse received;
+  ASSERT_TRUE(
+      SerializationTraits<EchoResponse>::Deserialize(&buffer, &received).ok());
+  EXPECT_EQ(received.message(), "hello boxed world");
+  EXPECT_FALSE(buffer.Valid());
+}
+
+TEST_F(BoxedMessageTest, ByteBufferReceiverGetsSerialization) {
+  ByteBuffer buffer;
+  ASSERT_TRUE(SerializationTraits<EchoRequest>::Box(Request(), 1000, &buffer));
+  ByteBuffer received;
+  ASSERT_TRUE(
+      SerializationTraits<ByteBuffer>::Deserialize(&buffer, &received).ok());
+  bool exclusive;
+  EXPECT_EQ(internal::GetBoxedMessage(&received, &exclusive), nullptr);
+  EchoRequest parsed;
+  ASSERT_TRUE(parsed.ParseFromString(Bytes(&received)));
+  EXPECT_EQ(parsed.message(), "hello boxed world");
+}
+
+}  // namespace
+}  // namespace grpc
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}